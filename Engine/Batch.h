@@ -0,0 +1,370 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+#include "Rays.h"
+#include "Rules.h"
+
+using namespace std;
+
+// Пачка позиций для массовой генерации ходов (самоигра, подготовка данных): позиции хранятся структурой массивов
+// битбордов 8x8 (бит x * 8 + y), ходы всех позиций генерируются и применяются за один вызов.
+// generate идёт в два прохода: ядро без ветвлений считает для всех позиций маски фигур, которые могут бить
+// и ходить (сдвиги битбордов по диагоналям, компилятор векторизует цикл по позициям), затем по маскам
+// разворачиваются ходы целиком — серия взятий до конца, по тем же правилам, что BasicLogic<Rules>.
+// Ход — откуда, куда, маска побитых фигур и превращение в дамку; серии с одинаковыми началом, концом и побитыми
+// фигурами (разный порядок взятий дамкой) дают одну позицию и записываются одним ходом
+template <class Rules> class BasicBatch
+{
+    static_assert(Rules::size == 8, "битборды 64 бита: только доска 8x8");
+    static constexpr const DiagonalRays<8> &rays = diagonal_rays<8>;
+    static constexpr uint64_t NOT_A = ~0x0101010101010101ULL; // без столбца a (y == 0)
+    static constexpr uint64_t NOT_H = ~0x8080808080808080ULL; // без столбца h (y == 7)
+    static constexpr uint64_t ROW_0 = 0xFFULL;                // ряд превращения белых
+    static constexpr uint64_t ROW_7 = 0xFFULL << 56;          // ряд превращения чёрных
+
+    // Номер младшего единичного бита (bits != 0) и число единичных битов: у MSVC нет __builtin_*
+    static int ctz64(const uint64_t bits)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, bits);
+        return int(index);
+#else
+        return __builtin_ctzll(bits);
+#endif
+    }
+
+    static int popcount64(const uint64_t bits)
+    {
+#ifdef _MSC_VER
+        return int(__popcnt64(bits));
+#else
+        return __builtin_popcountll(bits);
+#endif
+    }
+
+  public:
+    // Ход позиции пачки
+    struct Move
+    {
+        uint8_t from, to;  // клетки x * 8 + y
+        bool promotes;     // шашка стала дамкой
+        uint64_t captured; // побитые фигуры
+    };
+
+    explicit BasicBatch(const size_t capacity = 0)
+    {
+        reserve(capacity);
+    }
+
+    void reserve(const size_t capacity)
+    {
+        white.reserve(capacity);
+        black.reserve(capacity);
+        kings.reserve(capacity);
+        side.reserve(capacity);
+    }
+
+    size_t size() const
+    {
+        return white.size();
+    }
+
+    // Добавляет позицию (матрица 1..4, как в Board и Logic; color: true — ходят чёрные), возвращает её номер
+    size_t add(const vector<vector<POS_T>> &mtx, const bool color)
+    {
+        white.push_back(0);
+        black.push_back(0);
+        kings.push_back(0);
+        side.push_back(0);
+        set(size() - 1, mtx, color);
+        return size() - 1;
+    }
+
+    void set(const size_t i, const vector<vector<POS_T>> &mtx, const bool color)
+    {
+        uint64_t w = 0, b = 0, k = 0;
+        for (int x = 0; x < 8; ++x)
+        {
+            for (int y = 0; y < 8; ++y)
+            {
+                const uint64_t bit = 1ULL << (x * 8 + y);
+                const POS_T type = mtx[x][y];
+                w |= (type == 1 || type == 3 ? bit : 0);
+                b |= (type == 2 || type == 4 ? bit : 0);
+                k |= (type > 2 ? bit : 0);
+            }
+        }
+        white[i] = w;
+        black[i] = b;
+        kings[i] = k;
+        side[i] = color;
+    }
+
+    vector<vector<POS_T>> get(const size_t i) const
+    {
+        vector<vector<POS_T>> mtx(8, vector<POS_T>(8, 0));
+        for (int s = 0; s < 64; ++s)
+        {
+            const uint64_t bit = 1ULL << s;
+            if ((white[i] | black[i]) & bit)
+                mtx[s / 8][s % 8] = POS_T((white[i] & bit ? 1 : 2) + (kings[i] & bit ? 2 : 0));
+        }
+        return mtx;
+    }
+
+    // Кто ходит в позиции i: true — чёрные
+    bool color(const size_t i) const
+    {
+        return side[i];
+    }
+
+    /**
+     * Ходы всех позиций пачки; у позиции без ходов ходящий проиграл.
+     * Ходы позиции i — moves()[first(i)] ... moves()[first(i) + count(i) - 1]
+     */
+    void generate()
+    {
+        const size_t n = size();
+        capturers.resize(n);
+        movers.resize(n);
+        scan_kernel(n);
+        offsets.resize(n + 1);
+        list.clear();
+        for (size_t i = 0; i < n; ++i)
+        {
+            offsets[i] = uint32_t(list.size());
+            expand(i);
+        }
+        offsets[n] = uint32_t(list.size());
+    }
+
+    uint32_t first(const size_t i) const
+    {
+        return offsets[i];
+    }
+
+    uint32_t count(const size_t i) const
+    {
+        return offsets[i + 1] - offsets[i];
+    }
+
+    const vector<Move> &moves() const
+    {
+        return list;
+    }
+
+    /**
+     * Делает в каждой позиции i ход choice[i] (номер среди её ходов из последнего generate, -1 — позицию не трогать),
+     * ход переходит к сопернику. После apply ходы нужно сгенерировать заново
+     */
+    void apply(const vector<int> &choice)
+    {
+        const size_t n = size();
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (choice[i] < 0)
+                continue;
+            const Move &m = list[offsets[i] + uint32_t(choice[i])];
+            const uint64_t from = 1ULL << m.from, to = 1ULL << m.to;
+            // Без ветвлений: маски ходящего и соперника выбираются по side.
+            // Дамка может закончить серию на исходном поле или на поле побитой фигуры: сначала снять, затем поставить
+            const uint64_t black_moves = 0 - uint64_t(side[i]);
+            white[i] = (white[i] & ~m.captured & ~(from & ~black_moves)) | (to & ~black_moves);
+            black[i] = (black[i] & ~m.captured & ~(from & black_moves)) | (to & black_moves);
+            const uint64_t king = 0 - ((kings[i] >> m.from) & 1);
+            kings[i] = ((kings[i] & ~m.captured & ~from) | (to & (king | (0 - uint64_t(m.promotes)))));
+            side[i] ^= 1;
+        }
+    }
+
+  private:
+    // Сдвиг на одну клетку по диагонали D в порядке Rays.h: (-1,-1), (-1,+1), (+1,-1), (+1,+1)
+    template <int D> static uint64_t step(const uint64_t b)
+    {
+        if (D == 0)
+            return (b & NOT_A) >> 9;
+        if (D == 1)
+            return (b & NOT_H) >> 7;
+        if (D == 2)
+            return (b & NOT_A) << 7;
+        return (b & NOT_H) << 9;
+    }
+
+    // Для направления D: фигуры, которые могут бить (в capt) и ходить (в quiet) в этом направлении
+    template <int D>
+    static void scan_direction(const uint64_t men, const uint64_t own_kings, const uint64_t opp, const uint64_t empty,
+                               const bool black_side, uint64_t &capt, uint64_t &quiet)
+    {
+        constexpr int B = 3 - D; // обратное направление
+        // Шашка ходит вперёд: белые к ряду 0 (D < 2), чёрные к ряду 7
+        const uint64_t forward_men = men & (0 - uint64_t((D < 2) != black_side));
+        const uint64_t capture_men = (Rules::men_capture_back ? men : forward_men);
+        // Чужая фигура с пустым полем за ней и поле перед ней
+        const uint64_t before = step<B>(opp & step<B>(empty));
+        capt |= before & (capture_men | own_kings);
+        const uint64_t to_empty = step<B>(empty);
+        quiet |= to_empty & (forward_men | own_kings);
+        if (Rules::flying_kings)
+        {
+            // Дальнобойная дамка: поле перед жертвой, продолженное назад по пустым полям
+            uint64_t reach = before;
+            for (int k = 0; k < 6; ++k)
+                reach |= step<B>(reach & empty);
+            capt |= reach & own_kings;
+        }
+    }
+
+    // Проход ядра: маски фигур, которые могут бить и ходить, для всех позиций; в цикле нет ветвлений
+    void scan_kernel(const size_t n)
+    {
+        const uint64_t *w = white.data(), *b = black.data(), *k = kings.data();
+        const uint8_t *s = side.data();
+        uint64_t *capt_out = capturers.data(), *quiet_out = movers.data();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const bool black_side = s[i];
+            const uint64_t side_mask = 0 - uint64_t(black_side);
+            const uint64_t own = (b[i] & side_mask) | (w[i] & ~side_mask);
+            const uint64_t opp = (w[i] & side_mask) | (b[i] & ~side_mask);
+            const uint64_t empty = ~(w[i] | b[i]);
+            const uint64_t men = own & ~k[i], own_kings = own & k[i];
+            uint64_t capt = 0, quiet = 0;
+            scan_direction<0>(men, own_kings, opp, empty, black_side, capt, quiet);
+            scan_direction<1>(men, own_kings, opp, empty, black_side, capt, quiet);
+            scan_direction<2>(men, own_kings, opp, empty, black_side, capt, quiet);
+            scan_direction<3>(men, own_kings, opp, empty, black_side, capt, quiet);
+            capt_out[i] = capt;
+            quiet_out[i] = quiet;
+        }
+    }
+
+    // Ходы позиции i по маскам ядра: взятия, если они есть, иначе тихие ходы
+    void expand(const size_t i)
+    {
+        const bool black_side = side[i];
+        const uint64_t own = black_side ? black[i] : white[i];
+        const uint64_t opp = black_side ? white[i] : black[i];
+        if (capturers[i])
+        {
+            const size_t begin = list.size();
+            for (uint64_t pieces = capturers[i]; pieces; pieces &= pieces - 1)
+            {
+                const int s = ctz64(pieces);
+                const bool king = (kings[i] >> s) & 1;
+                // Фигура снимается с исходного поля: дамка может пройти через него
+                capture(begin, s, s, king, king, black_side, (own | opp) & ~(1ULL << s), opp, 0);
+            }
+            if (Rules::capture_majority)
+                keep_longest(begin);
+            return;
+        }
+        const uint64_t occupied = own | opp;
+        for (uint64_t pieces = movers[i]; pieces; pieces &= pieces - 1)
+        {
+            const int s = ctz64(pieces);
+            const bool king = (kings[i] >> s) & 1;
+            for (int d = 0; d < 4; ++d)
+            {
+                if (!king && (d < 2) == black_side)
+                    continue;
+                const auto *ray = rays.at(POS_T(s / 8), POS_T(s % 8), d);
+                const int len = rays.len(POS_T(s / 8), POS_T(s % 8), d);
+                const int reach = (king && Rules::flying_kings ? len : min(len, 1));
+                for (int k = 0; k < reach; ++k)
+                {
+                    const int t = ray[k].x * 8 + ray[k].y;
+                    if ((occupied >> t) & 1)
+                        break;
+                    list.push_back(Move{uint8_t(s), uint8_t(t), !king && promotes(black_side, t), 0});
+                }
+            }
+        }
+    }
+
+    /**
+     * Серии взятий фигуры с поля s (начала хода from): occupied — фигуры на доске без неё и без уже побитых,
+     * opp — оставшиеся фигуры соперника. Законченные серии дописываются в list, повторы (с begin) пропускаются.
+     * Возвращает, было ли хоть одно взятие
+     */
+    bool capture(const size_t begin, const int from, const int s, const bool started_king, const bool king,
+                 const bool black_side, const uint64_t occupied, const uint64_t opp, const uint64_t captured)
+    {
+        bool found = false;
+        const POS_T x = POS_T(s / 8), y = POS_T(s % 8);
+        for (int d = 0; d < 4; ++d)
+        {
+            if (!king && !Rules::men_capture_back && (d < 2) == black_side)
+                continue;
+            const auto *ray = rays.at(x, y, d);
+            const int len = rays.len(x, y, d);
+            int k = 0;
+            if (king && Rules::flying_kings)
+                while (k < len && !((occupied >> (ray[k].x * 8 + ray[k].y)) & 1))
+                    ++k;
+            if (k + 1 >= len)
+                continue;
+            const int victim = ray[k].x * 8 + ray[k].y;
+            if (!((opp >> victim) & 1))
+                continue;
+            const uint64_t victim_bit = 1ULL << victim;
+            // Недальнобойная фигура приземляется сразу за жертвой, дальнобойная дамка — на любое пустое поле за ней
+            const int last = (king && Rules::flying_kings ? len : k + 2);
+            for (++k; k < last; ++k)
+            {
+                const int t = ray[k].x * 8 + ray[k].y;
+                if ((occupied >> t) & 1)
+                    break;
+                found = true;
+                const bool crowned = !king && promotes(black_side, t);
+                const bool next_king = king || (crowned && Rules::promote_in_capture);
+                const bool ends = crowned && Rules::crowning_ends_move;
+                if (ends || !capture(begin, from, t, started_king, next_king, black_side, occupied & ~victim_bit,
+                                     opp & ~victim_bit, captured | victim_bit))
+                    add_capture(begin, from, t, !started_king && (next_king || promotes(black_side, t)),
+                                captured | victim_bit);
+            }
+        }
+        return found;
+    }
+
+    void add_capture(const size_t begin, const int from, const int to, const bool crowned, const uint64_t captured)
+    {
+        for (size_t j = begin; j < list.size(); ++j)
+            if (list[j].from == from && list[j].to == to && list[j].captured == captured)
+                return;
+        list.push_back(Move{uint8_t(from), uint8_t(to), crowned, captured});
+    }
+
+    // Правило большинства: остаются серии с наибольшим числом побитых фигур
+    void keep_longest(const size_t begin)
+    {
+        int best = 0;
+        for (size_t j = begin; j < list.size(); ++j)
+            best = max(best, popcount64(list[j].captured));
+        list.erase(remove_if(list.begin() + begin, list.end(),
+                             [best](const Move &m) { return popcount64(m.captured) < best; }),
+                   list.end());
+    }
+
+    // Клетка t — ряд превращения для шашки ходящего
+    static bool promotes(const bool black_side, const int t)
+    {
+        return ((black_side ? ROW_7 : ROW_0) >> t) & 1;
+    }
+
+    // Позиции: фигуры белых, чёрных, дамки обоих цветов; side — ходят чёрные
+    vector<uint64_t> white, black, kings;
+    vector<uint8_t> side;
+    // Результат generate: маски ядра и ходы всех позиций подряд
+    vector<uint64_t> capturers, movers;
+    vector<uint32_t> offsets;
+    vector<Move> list;
+};
+
+using Batch = BasicBatch<RussianRules>;
@@ -0,0 +1,31 @@
+#pragma once
+
+// Позиции бенчмарка поиска (bench.cpp) и калибровки уровней (calibrate.cpp): начальная, миттельшпиль, эндшпиль
+// с дамками. Набор и глубины фиксированы и версионированы: при их изменении Bench_version нужно поднять,
+// иначе сравнение с базовыми результатами bench потеряет смысл
+
+struct BenchPosition
+{
+    const char *name;
+    const char *squares;
+    const char *side;
+    int depth;
+};
+
+static const char *const Bench_version = "1";
+
+static const BenchPosition Bench_positions[] = {
+    {"start", "bbbbbbbbbbbb........wwwwwwwwwwww", "w", 9},
+    {"mid1", "..bbbwb.b.bb......w.....w.w..www", "b", 9},
+    {"mid2", ".b.b...bb..bbw.b..w.w.w.w.w..w.w", "b", 11},
+    {"mid3", ".b.b.bbb...bb....ww.w...w.w..www", "b", 8},
+    {"mid4", ".b.bb.b.b.....bb.w..w..ww..ww..w", "b", 10},
+    {"mid5", "..bb.bb...bb......ww......w.www.", "b", 9},
+    {"mid6", ".bbb....b.b..b.bw..ww...w...w.ww", "b", 9},
+    {"end1", ".W.bb......b......w........ww.B.", "w", 8},
+    {"end2", "W......b..b...b....w......w....B", "b", 8},
+    {"end3", "W..b...b.w..........w......B....", "b", 10},
+    {"end4", "b.W..........w.....w........wB..", "b", 8},
+    {"end5", "..............w.w......bW......B", "w", 8},
+    {"end6", "......W.....b..b...........b.B..", "w", 8},
+};
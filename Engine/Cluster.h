@@ -0,0 +1,610 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Logic.h"
+#include "Notation.h"
+#include "Socket.h"
+
+// Распределённый поиск: координатор (ClusterSearch) делит корень поиска на куски — шаги корня —
+// и раздаёт их процессам-исполнителям (ClusterWorker) по TCP. Протокол построчный:
+//   options optimization <O0|O1|O2> scoring <NumberOnly|NumberAndPotential> repetition N noprogress N
+//   position <32 клетки> <w|b> [history <32 клетки> <w|b> ...]  — корень и позиции партии до него, от первой
+//   unit <id> depth D alpha A beta B move <шаг> [pv <ход> ...]   — окно и оценки — целые Score (Score.h)
+//                                                -> result <id> score S nodes N pv <ход> ...
+//                                                 | result <id> stopped nodes N | error <id> <причина>
+//   stop                                          — прерывает текущий кусок (ответ: result <id> stopped)
+// Кусок — оценка одного шага корня (Logic::search_root_move), исполнитель считает один кусок за раз;
+// pv — вариант этого хода с прошлой итерации, его ходы исполнитель смотрит первыми.
+// Итерация корня: первым с полным окном ищется лучший ход прошлой итерации (старший брат), после его оценки
+// остальные раздаются с alpha = лучшей известной оценке, и каждый следующий кусок получает уже улучшенную границу.
+// Мелкие итерации (прошлая — меньше LOCAL_NODES узлов) координатор считает сам: там ожидание старшего брата
+// и пересылка дороже самого поиска. Исполнитель сохраняет ходы-убийцы между кусками одного корня.
+// Оценка итерации та же, что у поиска в одном процессе; из равных по оценке ходов может быть выбран другой.
+// Кусок исполнителя, чьё соединение оборвалось, возвращается в начало очереди, к исполнителю координатор
+// переподключается раз в RETRY_MS (перезапущенный процесс снова получает работу). Если не подключён никто,
+// кусок считается в самом координаторе. С общим кешем (SharedCacheMB) исполнители на одной машине берут
+// оценки позиций друг у друга, и оценка может отличаться от поиска в одном процессе
+
+// Исполнитель: выполняет команды одного координатора, кусок считается в своём потоке,
+// чтобы stop и новые команды читались во время поиска
+class ClusterWorker
+{
+  public:
+    // initial — настройки исполнителя (общий кеш); настройки поиска присылает координатор
+    explicit ClusterWorker(function<bool(const string &)> write, const Settings &initial = Settings())
+        : write(move(write)), config(initial), logic(&config)
+    {
+        mtx = start_position();
+    }
+
+    ClusterWorker(const ClusterWorker &) = delete;
+    ClusterWorker &operator=(const ClusterWorker &) = delete;
+
+    ~ClusterWorker()
+    {
+        stop();
+    }
+
+    // Выполняет команду координатора; вызывается из потока чтения соединения
+    void handle(const string &line)
+    {
+        istringstream cmd(line);
+        string name;
+        if (!(cmd >> name))
+            return;
+        if (name == "options")
+            cmd_options(cmd);
+        else if (name == "position")
+            cmd_position(cmd);
+        else if (name == "unit")
+            cmd_unit(cmd);
+        else if (name == "stop")
+            stop();
+        else
+            send("error - unknown command " + name);
+    }
+
+    // Прерывает текущий кусок и дожидается ответа на него
+    void stop()
+    {
+        cancel = true;
+        if (search_thread.joinable())
+            search_thread.join();
+    }
+
+    // Кусков посчитано до конца
+    uint64_t units_done() const
+    {
+        return units.load();
+    }
+
+  private:
+    void send(const string &line)
+    {
+        lock_guard<mutex> lock(out_mtx);
+        write(line + "\n");
+    }
+
+    void cmd_options(istringstream &cmd)
+    {
+        Settings s = *config.snapshot();
+        string key, value;
+        while (cmd >> key >> value)
+        {
+            if (key == "optimization")
+                s.optimization = (value == "O0" ? OptLevel::O0 : value == "O2" ? OptLevel::O2 : OptLevel::O1);
+            else if (key == "scoring")
+                s.scoring = (value == "NumberOnly" ? ScoringMode::NumberOnly : ScoringMode::NumberAndPotential);
+            else if (key == "repetition")
+                s.repetition_draw = atoi(value.c_str());
+            else if (key == "noprogress")
+                s.no_progress_turns = atoi(value.c_str());
+        }
+        config.set(s);
+    }
+
+    void cmd_position(istringstream &cmd)
+    {
+        stop();
+        string squares, side, word;
+        vector<vector<POS_T>> new_mtx;
+        bool new_color = false;
+        if (!(cmd >> squares >> side) || !parse_position(squares, side, new_mtx, new_color))
+        {
+            send("error - bad position");
+            return;
+        }
+        vector<vector<vector<POS_T>>> positions;
+        bool first_color = new_color, color_i = false;
+        if (cmd >> word && word == "history")
+        {
+            vector<vector<POS_T>> h;
+            while (cmd >> squares >> side && parse_position(squares, side, h, color_i))
+            {
+                if (positions.empty())
+                    first_color = color_i;
+                positions.push_back(h);
+            }
+        }
+        positions.push_back(new_mtx);
+        mtx = new_mtx;
+        color = new_color;
+        logic.set_history(positions, first_color);
+    }
+
+    void cmd_unit(istringstream &cmd)
+    {
+        string id, key, value;
+        cmd >> id;
+        int depth = 0;
+        Score alpha = -SCORE_INF, beta = SCORE_INF;
+        move_pos step;
+        string pv;
+        while (cmd >> key)
+        {
+            if (key == "pv")
+            {
+                getline(cmd, pv);
+                break;
+            }
+            cmd >> value;
+            if (key == "depth")
+                depth = atoi(value.c_str());
+            else if (key == "alpha")
+                alpha = atoi(value.c_str());
+            else if (key == "beta")
+                beta = atoi(value.c_str());
+            else if (key == "move" && (value.size() != 5 || !parse_square(value.substr(0, 2), step.x, step.y) ||
+                                       !parse_square(value.substr(3, 2), step.x2, step.y2)))
+                step = move_pos();
+        }
+        if (busy)
+        {
+            send("error " + id + " busy");
+            return;
+        }
+        if (step.x == -1)
+        {
+            send("error " + id + " bad move");
+            return;
+        }
+        if (search_thread.joinable())
+            search_thread.join();
+        cancel = false;
+        busy = true;
+        search_thread = thread([this, id, depth, alpha, beta, step, pv] {
+            TRACE_THREAD_NAME("cluster_unit");
+            SearchLimits limits;
+            limits.stop = &cancel;
+            Score score = 0;
+            vector<move_pos> line, seed;
+            parse_line(logic, pv, mtx, color, seed);
+            const bool ok = logic.search_root_move(mtx, color, step, depth, alpha, beta, limits, score, line, seed);
+            const string nodes = to_string(logic.searched_nodes());
+            units += ok;
+            // Кусок закончен до ответа: следующий unit может прийти сразу за ним
+            busy = false;
+            if (ok)
+                send("result " + id + " score " + to_string(score) + " nodes " + nodes + " pv " +
+                     line_to_string(line));
+            else if (cancel)
+                send("result " + id + " stopped nodes " + nodes);
+            else
+                send("error " + id + " illegal move");
+        });
+    }
+
+    function<bool(const string &)> write;
+    mutex out_mtx; // ответы пишутся из потока чтения и из потока куска
+    SettingsStore config;
+    Logic logic;
+    vector<vector<POS_T>> mtx; // корень, шаги которого раздаёт координатор
+    bool color = false;
+    thread search_thread;
+    atomic<bool> cancel{false};
+    atomic<bool> busy{false};
+    atomic<uint64_t> units{0};
+};
+
+// Координатор: поиск с итеративным углублением, корень которого считают исполнители
+class ClusterSearch
+{
+    static const int RETRY_MS = 500; // пауза между попытками подключиться к исполнителю
+    static const int POLL_MS = 20;   // ожидание ответов за один проход цикла
+    static const uint64_t LOCAL_NODES = 200000; // итерация после меньшей итерации считается в координаторе
+
+    struct Worker
+    {
+        string host;
+        uint16_t port = 0;
+        socket_t sock = BAD_SOCKET;
+        LineReader reader;
+        bool busy = false;      // исполнитель считает кусок unit_id (возможно, уже ненужный)
+        string unit_id;
+        int root_index = -1;    // ход корня текущей итерации, -1 — ответ больше не нужен
+        Score alpha = -SCORE_INF; // граница, с которой выдан кусок
+        chrono::steady_clock::time_point next_try;
+        uint64_t units = 0;     // получено оценок
+    };
+
+    struct RootMove
+    {
+        move_pos mv;
+        int gen = 0;            // место в порядке генерации ходов
+        Score score = -SCORE_INF;
+        bool exact = false;     // оценка точная (больше alpha, с которой искался ход)
+        vector<move_pos> pv;
+    };
+
+  public:
+    // addresses — исполнители в виде host:port
+    ClusterSearch(const SettingsStore *config, const vector<string> &addresses) : config(config), logic(config)
+    {
+        for (const auto &address : addresses)
+        {
+            Worker w;
+            const size_t colon = address.rfind(':');
+            w.host = (colon == string::npos ? "127.0.0.1" : address.substr(0, colon));
+            w.port = uint16_t(atoi(address.c_str() + (colon == string::npos ? 0 : colon + 1)));
+            workers.push_back(move(w));
+        }
+    }
+
+    ClusterSearch(const ClusterSearch &) = delete;
+    ClusterSearch &operator=(const ClusterSearch &) = delete;
+
+    ~ClusterSearch()
+    {
+        for (auto &w : workers)
+            disconnect(w);
+    }
+
+    // История партии, как Logic::set_history: позиции от первой до корня включительно
+    void set_history(const vector<vector<vector<POS_T>>> &positions, const bool first_color)
+    {
+        history = positions;
+        history_color = first_color;
+        logic.set_history(positions, first_color);
+    }
+
+    /**
+     * Поиск с итеративным углублением до limits.depth (-1 — Max_depth) по ограничениям limits, как Logic::search.
+     * Первая итерация доводится до конца; прерванная итерация отбрасывается, исполнителям уходит stop.
+     * Узлы в info.nodes — сумма по кускам, о которых уже пришёл ответ
+     */
+    vector<move_pos> search(const vector<vector<POS_T>> &mtx, const bool color, const SearchLimits &limits,
+                            const function<void(const SearchInfo &)> &on_info = nullptr)
+    {
+        TRACE_SCOPE_NAMED(trace, "cluster_search", "search");
+        const auto start = chrono::steady_clock::now();
+        root_mtx = mtx;
+        root_color = color;
+        nodes = 0;
+        best_line.clear();
+        for (auto &w : workers)
+            if (w.sock != BAD_SOCKET && !sync(w))
+                disconnect(w);
+        logic.find_turns(color, mtx);
+        vector<RootMove> root(logic.turns.size());
+        for (size_t i = 0; i < root.size(); ++i)
+        {
+            root[i].mv = logic.turns[i];
+            root[i].gen = int(i);
+        }
+        const int max_depth = max(0, limits.depth >= 0 ? limits.depth : logic.Max_depth);
+        uint64_t iteration_nodes = 0; // узлов прошлой итерации
+        for (int depth = 0; depth <= max_depth && !root.empty(); ++depth)
+        {
+            TRACE_SCOPE_NAMED(iteration, "iteration", "search");
+            // Порядок корня как у Logic::order_turns: ходы в порядке генерации, лучший ход прошлой итерации — первым
+            sort(root.begin(), root.end(), [](const RootMove &a, const RootMove &b) { return a.gen < b.gen; });
+            for (size_t i = 1; !best_line.empty() && i < root.size(); ++i)
+                if (root[i].mv == best_line[0])
+                    swap(root[0], root[i]);
+            const uint64_t nodes_before = nodes;
+            if (!run_iteration(root, depth, depth ? &limits : nullptr, iteration_nodes < LOCAL_NODES))
+                break;
+            iteration_nodes = nodes - nodes_before;
+            TRACE_ARG(iteration, "depth", depth);
+            TRACE_ARG(iteration, "nodes", nodes);
+            // Лучший из точно оценённых; при равных — раньше в порядке итерации
+            const RootMove *best = nullptr;
+            for (const auto &rm : root)
+                if (rm.exact && (!best || rm.score > best->score))
+                    best = &rm;
+            best_line = best->pv;
+            if (on_info)
+            {
+                SearchInfo info;
+                info.depth = depth;
+                info.score = best->score;
+                info.nodes = nodes;
+                info.time_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+                info.pv = best_line;
+                on_info(info);
+            }
+            if (stopped(limits))
+                break;
+        }
+        TRACE_ARG(trace, "nodes", nodes);
+        return best_line.empty() ? vector<move_pos>() : split_line(best_line).front();
+    }
+
+    // Лучший вариант последней завершённой итерации: шаги ходов обеих сторон подряд
+    vector<move_pos> principal_variation() const
+    {
+        return best_line;
+    }
+
+    string stats() const
+    {
+        size_t connected = 0;
+        ostringstream out;
+        for (const auto &w : workers)
+            connected += (w.sock != BAD_SOCKET);
+        out << "cluster workers " << workers.size() << " connected " << connected << " units " << units_remote
+            << " local " << units_local << " requeued " << requeued << " lost " << lost << " connects " << connects;
+        for (const auto &w : workers)
+            out << " " << w.host << ":" << w.port << "=" << w.units;
+        return out.str();
+    }
+
+  private:
+    /**
+     * Одна итерация корня на глубину depth: куски раздаются свободным исполнителям, пока не оценены все ходы.
+     * limits == nullptr — итерацию нельзя прервать, local — все куски считаются в координаторе.
+     * false — итерация прервана по limits
+     */
+    bool run_iteration(vector<RootMove> &root, const int depth, const SearchLimits *limits, const bool local)
+    {
+        deque<int> pending;
+        for (size_t i = 0; i < root.size(); ++i)
+        {
+            root[i].exact = false;
+            pending.push_back(int(i));
+        }
+        size_t remaining = root.size();
+        Score alpha = -SCORE_INF; // лучшая точная оценка итерации
+        bool eldest_done = false;
+        // Старший брат (первый ход) ищется раньше остальных, чтобы они получили его оценку как границу
+        const auto can_dispatch = [&] { return !pending.empty() && (eldest_done || pending.front() == 0); };
+        const auto record = [&](const int index, const Score score, const Score unit_alpha, const string &pv) {
+            RootMove &rm = root[index];
+            rm.score = score;
+            rm.exact = (score > unit_alpha);
+            if (rm.exact)
+            {
+                parse_line(logic, pv, root_mtx, root_color, rm.pv);
+                if (rm.pv.empty() || rm.pv[0] != rm.mv)
+                    rm.pv.assign(1, rm.mv);
+                alpha = max(alpha, score);
+            }
+            eldest_done |= (index == 0);
+            --remaining;
+        };
+
+        while (remaining > 0)
+        {
+            if (limits && stopped(*limits))
+            {
+                for (auto &w : workers)
+                {
+                    if (w.busy && w.root_index >= 0 && !send_line(w, "stop"))
+                        disconnect(w);
+                    w.root_index = -1;
+                }
+                return false;
+            }
+            if (!local)
+                reconnect();
+            bool any_connected = false;
+            for (auto &w : workers)
+            {
+                if (local || w.sock == BAD_SOCKET)
+                    continue;
+                any_connected = true;
+                if (w.busy || !can_dispatch())
+                    continue;
+                const int index = pending.front();
+                pending.pop_front();
+                w.unit_id = to_string(++unit_counter);
+                w.root_index = index;
+                w.alpha = alpha;
+                w.busy = true;
+                if (!send_line(w, "unit " + w.unit_id + " depth " + to_string(depth) + " alpha " +
+                                      to_string(alpha) + " beta " + to_string(SCORE_INF) + " move " +
+                                      turn_to_string({root[index].mv}) +
+                                      (root[index].pv.empty() ? "" : " pv " + line_to_string(root[index].pv))))
+                {
+                    disconnect(w); // кусок вернётся в очередь
+                    pending.push_front(index);
+                }
+            }
+            // Мелкая итерация или исполнителей нет: кусок считается здесь же
+            if (!any_connected && can_dispatch())
+            {
+                const int index = pending.front();
+                pending.pop_front();
+                Score score = 0;
+                vector<move_pos> line;
+                const bool ok = logic.search_root_move(root_mtx, root_color, root[index].mv, depth, alpha, SCORE_INF,
+                                                       limits ? *limits : SearchLimits(), score, line, root[index].pv);
+                nodes += logic.searched_nodes();
+                if (!ok)
+                    return false;
+                ++units_local;
+                record(index, score, alpha, line_to_string(line));
+                continue;
+            }
+            wait_results([&](Worker &w, istringstream &msg) {
+                string kind, id, word;
+                msg >> kind >> id;
+                if (!w.busy || id != w.unit_id)
+                    return;
+                w.busy = false;
+                const int index = w.root_index;
+                w.root_index = -1;
+                if (kind == "result")
+                {
+                    msg >> word;
+                    if (word == "score")
+                    {
+                        Score score = 0;
+                        uint64_t unit_nodes = 0;
+                        string pv;
+                        msg >> score >> word >> unit_nodes >> word;
+                        getline(msg, pv);
+                        nodes += unit_nodes;
+                        if (index >= 0)
+                        {
+                            ++w.units;
+                            ++units_remote;
+                            record(index, score, w.alpha, pv);
+                        }
+                        return;
+                    }
+                    uint64_t unit_nodes = 0;
+                    msg >> word >> unit_nodes;
+                    nodes += unit_nodes;
+                }
+                // Остановленный без нашего stop или отвергнутый кусок: исполнитель не в том состоянии.
+                // Соединение рвём (переподключение пришлёт позицию заново), кусок — снова в очередь
+                if (index >= 0)
+                {
+                    pending.push_front(index);
+                    ++requeued;
+                    disconnect(w);
+                }
+            },
+                         [&](Worker &w) {
+                             if (w.busy && w.root_index >= 0)
+                             {
+                                 pending.push_front(w.root_index);
+                                 ++requeued;
+                             }
+                             ++lost;
+                             disconnect(w);
+                         });
+        }
+        return true;
+    }
+
+    // Ждёт строки от подключённых исполнителей до POLL_MS, отдаёт их on_line; оборванные соединения — on_lost
+    template <class OnLine, class OnLost> void wait_results(OnLine &&on_line, OnLost &&on_lost)
+    {
+        vector<pollfd> fds;
+        vector<Worker *> polled;
+        for (auto &w : workers)
+        {
+            if (w.sock == BAD_SOCKET)
+                continue;
+            fds.push_back({w.sock, POLLIN, 0});
+            polled.push_back(&w);
+        }
+        if (fds.empty())
+        {
+            this_thread::sleep_for(chrono::milliseconds(POLL_MS));
+            return;
+        }
+        if (poll_sockets(fds.data(), fds.size(), POLL_MS) <= 0)
+            return;
+        for (size_t i = 0; i < fds.size(); ++i)
+        {
+            Worker &w = *polled[i];
+            if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+                continue;
+            if (!w.reader.fill(w.sock))
+            {
+                on_lost(w);
+                continue;
+            }
+            string line;
+            while (w.sock != BAD_SOCKET && w.reader.next(line))
+            {
+                istringstream msg(line);
+                on_line(w, msg);
+            }
+        }
+    }
+
+    // Подключает исполнителей, которые отключены и чья пауза между попытками прошла
+    void reconnect()
+    {
+        const auto now = chrono::steady_clock::now();
+        for (auto &w : workers)
+        {
+            if (w.sock != BAD_SOCKET || now < w.next_try)
+                continue;
+            w.sock = connect_local(w.host, w.port);
+            w.next_try = now + chrono::milliseconds(RETRY_MS);
+            if (w.sock == BAD_SOCKET)
+                continue;
+            ++connects;
+            if (!sync(w))
+                disconnect(w);
+        }
+    }
+
+    // Настройки поиска и корень с историей партии
+    bool sync(Worker &w)
+    {
+        auto s = config->snapshot();
+        string msg = string("options optimization ") +
+                     (s->optimization == OptLevel::O0 ? "O0" : s->optimization == OptLevel::O2 ? "O2" : "O1") +
+                     " scoring " + (s->scoring == ScoringMode::NumberOnly ? "NumberOnly" : "NumberAndPotential") +
+                     " repetition " + to_string(s->repetition_draw) + " noprogress " + to_string(s->no_progress_turns) +
+                     "\nposition " + position_to_string(root_mtx, root_color);
+        // История нужна, только если заканчивается корнем
+        if (history.size() > 1 && history.back() == root_mtx)
+        {
+            msg += " history";
+            bool c = history_color;
+            for (size_t i = 0; i + 1 < history.size(); ++i, c = !c)
+                msg += " " + position_to_string(history[i], c);
+        }
+        return send_line(w, msg);
+    }
+
+    bool send_line(Worker &w, const string &line)
+    {
+        return send_all(w.sock, line + "\n");
+    }
+
+    void disconnect(Worker &w)
+    {
+        if (w.sock != BAD_SOCKET)
+            close_socket(w.sock);
+        w.sock = BAD_SOCKET;
+        w.reader = LineReader();
+        w.busy = false;
+        w.root_index = -1;
+        w.next_try = chrono::steady_clock::now() + chrono::milliseconds(RETRY_MS);
+    }
+
+    bool stopped(const SearchLimits &limits) const
+    {
+        return (limits.nodes && nodes >= limits.nodes) || (limits.stop && limits.stop->load()) ||
+               chrono::steady_clock::now() >= limits.deadline;
+    }
+
+    const SettingsStore *config;
+    Logic logic; // ходы корня, разбор вариантов и куски без исполнителей
+    vector<Worker> workers;
+    vector<vector<vector<POS_T>>> history;
+    bool history_color = false;
+    vector<vector<POS_T>> root_mtx;
+    bool root_color = false;
+    vector<move_pos> best_line;
+    uint64_t nodes = 0;
+    uint64_t unit_counter = 0;
+    uint64_t units_remote = 0, units_local = 0, requeued = 0, lost = 0, connects = 0;
+};
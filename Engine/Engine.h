@@ -0,0 +1,126 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "Logic.h"
+#include "Notation.h"
+#include "Settings.h"
+
+// Небольшой C++ API движка без SDL и Board: позиция, настройки, генерация ходов и поиск.
+// На нём построен C API (EngineApi.h)
+class CheckersEngine
+{
+  public:
+    CheckersEngine() : settings(default_settings()), logic(&settings)
+    {
+        mtx = start_position();
+        logic.Max_depth = settings.snapshot()->bot_level[1];
+        reset_history();
+    }
+
+    // Опции как в консольном движке: Level (0..30), Scoring, Optimization, NoRandom
+    bool set_option(const string &name, const string &value)
+    {
+        Settings s = *settings.snapshot();
+        if (name == "Level")
+        {
+            if (value.empty() || value.size() > 2 || value.find_first_not_of("0123456789") != string::npos ||
+                atoi(value.c_str()) > 30)
+                return false;
+            logic.Max_depth = atoi(value.c_str());
+            return true;
+        }
+        else if (name == "Scoring" && (value == "NumberOnly" || value == "NumberAndPotential"))
+            s.scoring = (value == "NumberOnly" ? ScoringMode::NumberOnly : ScoringMode::NumberAndPotential);
+        else if (name == "Optimization" && (value == "O0" || value == "O1" || value == "O2"))
+            s.optimization = (value == "O0" ? OptLevel::O0 : value == "O1" ? OptLevel::O1 : OptLevel::O2);
+        else if (name == "NoRandom" && (value == "true" || value == "false"))
+            s.no_random = (value == "true");
+        else
+            return false;
+        settings.set(s);
+        return true;
+    }
+
+    // "startpos" или "<32 клетки> <w|b>" в нотации Notation.h
+    bool set_position(const string &text)
+    {
+        if (text == "startpos")
+        {
+            mtx = start_position();
+            color = false;
+            reset_history();
+            return true;
+        }
+        const size_t space = text.find(' ');
+        if (space == string::npos || !parse_position(text.substr(0, space), text.substr(space + 1), mtx, color))
+            return false;
+        reset_history();
+        return true;
+    }
+
+    string position() const
+    {
+        return position_to_string(mtx, color);
+    }
+
+    // Все легальные ходы целиком (серии взятий разворачиваются до конца)
+    vector<string> legal_moves()
+    {
+        return legal_turns(logic, mtx, color);
+    }
+
+    bool play(const string &move)
+    {
+        vector<move_pos> turn;
+        if (!parse_turn(logic, move, mtx, color, turn))
+            return false;
+        mtx = apply_turn(logic, mtx, turn);
+        color = !color;
+        history.push_back(mtx);
+        logic.set_history(history, history_color);
+        return true;
+    }
+
+    // Поиск из текущей позиции. Можно прервать из другого потока через stop()
+    SearchInfo search(SearchLimits limits, vector<move_pos> &best)
+    {
+        stop_flag = false;
+        limits.stop = &stop_flag;
+        SearchInfo last;
+        best = logic.search(mtx, color, limits, [&](const SearchInfo &info) { last = info; });
+        last.nodes = logic.searched_nodes();
+        return last;
+    }
+
+    void stop()
+    {
+        stop_flag = true;
+    }
+
+  private:
+    // По умолчанию движок детерминирован
+    static Settings default_settings()
+    {
+        Settings s;
+        s.no_random = true;
+        return s;
+    }
+
+    // История партии начинается с текущей позиции
+    void reset_history()
+    {
+        history = {mtx};
+        history_color = color;
+        logic.set_history(history, history_color);
+    }
+
+    SettingsStore settings;
+    Logic logic;
+    vector<vector<POS_T>> mtx; // текущая позиция
+    bool color = false;        // кто ходит: true — чёрные, false — белые
+    vector<vector<vector<POS_T>>> history; // позиции партии для обнаружения повторений
+    bool history_color = false;            // кто ходил в первой позиции истории
+    atomic<bool> stop_flag{false};
+};
@@ -0,0 +1,143 @@
+#include <cstring>
+
+#include "Engine.h"
+#include "EngineApi.h"
+
+// Единица трансляции библиотеки движка: собирается в статическую или разделяемую библиотеку
+
+struct checkers_engine
+{
+    CheckersEngine engine;
+};
+
+static int copy_string(const string &text, char *buf, const size_t size)
+{
+    if (!buf || text.size() + 1 > size)
+        return -1;
+    memcpy(buf, text.c_str(), text.size() + 1);
+    return 0;
+}
+
+checkers_engine *checkers_engine_create(void)
+{
+    try
+    {
+        return new checkers_engine();
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void checkers_engine_destroy(checkers_engine *engine)
+{
+    delete engine;
+}
+
+int checkers_engine_set_option(checkers_engine *engine, const char *name, const char *value)
+{
+    if (!engine || !name || !value)
+        return -1;
+    try
+    {
+        return engine->engine.set_option(name, value) ? 0 : -1;
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
+
+int checkers_engine_set_position(checkers_engine *engine, const char *position)
+{
+    if (!engine || !position)
+        return -1;
+    try
+    {
+        return engine->engine.set_position(position) ? 0 : -1;
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
+
+int checkers_engine_get_position(checkers_engine *engine, char *buf, const size_t size)
+{
+    if (!engine)
+        return -1;
+    try
+    {
+        return copy_string(engine->engine.position(), buf, size);
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
+
+int checkers_engine_legal_moves(checkers_engine *engine, char *buf, const size_t size)
+{
+    if (!engine)
+        return -1;
+    try
+    {
+        string res;
+        for (const auto &move : engine->engine.legal_moves())
+            res += (res.empty() ? "" : " ") + move;
+        return copy_string(res, buf, size);
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
+
+int checkers_engine_play(checkers_engine *engine, const char *move)
+{
+    if (!engine || !move)
+        return -1;
+    try
+    {
+        return engine->engine.play(move) ? 0 : -1;
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
+
+int checkers_engine_search(checkers_engine *engine, const int depth, const int64_t movetime_ms, const uint64_t nodes,
+                           checkers_result *result)
+{
+    if (!engine || !result)
+        return -1;
+    try
+    {
+        SearchLimits limits;
+        limits.depth = depth;
+        limits.nodes = nodes;
+        if (movetime_ms > 0)
+            limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(movetime_ms);
+        vector<move_pos> best;
+        SearchInfo info = engine->engine.search(limits, best);
+        if (copy_string(turn_to_string(best), result->bestmove, sizeof(result->bestmove)) != 0)
+            return -1;
+        result->score = info.score;
+        result->depth = info.depth;
+        result->nodes = info.nodes;
+        result->time_ms = info.time_ms;
+        return 0;
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
+
+void checkers_engine_stop(checkers_engine *engine)
+{
+    if (engine)
+        engine->engine.stop();
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/* C API библиотеки движка (без SDL). Строки позиций и ходов — в нотации Engine/Notation.h.
+ * Функции возвращают 0 при успехе и -1 при ошибке. checkers_engine_stop можно вызывать из другого потока. */
+
+#if defined(_WIN32) && defined(CHECKERS_ENGINE_SHARED)
+    #ifdef CHECKERS_ENGINE_BUILD
+        #define CHECKERS_API __declspec(dllexport)
+    #else
+        #define CHECKERS_API __declspec(dllimport)
+    #endif
+#elif defined(__GNUC__)
+    #define CHECKERS_API __attribute__((visibility("default")))
+#else
+    #define CHECKERS_API
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct checkers_engine checkers_engine;
+
+/* Оценки выигрыша (Models/Score.h) */
+#define CHECKERS_SCORE_WIN 30000
+#define CHECKERS_SCORE_WIN_MIN 29000
+
+typedef struct checkers_result
+{
+    char bestmove[128]; /* лучший ход, "none" если ходов нет */
+    int score;          /* оценка с точки зрения ходящего в сотых долях шашки; от CHECKERS_SCORE_WIN_MIN —
+                           выигрыш через CHECKERS_SCORE_WIN - score шагов, от -CHECKERS_SCORE_WIN_MIN — проигрыш */
+    int depth;          /* глубина последней завершённой итерации */
+    uint64_t nodes;     /* просмотрено узлов */
+    int64_t time_ms;    /* время поиска */
+} checkers_result;
+
+CHECKERS_API checkers_engine *checkers_engine_create(void);
+CHECKERS_API void checkers_engine_destroy(checkers_engine *engine);
+
+/* name: Level (0..30), Scoring, Optimization, NoRandom; -1 — неизвестная опция или неверное значение */
+CHECKERS_API int checkers_engine_set_option(checkers_engine *engine, const char *name, const char *value);
+
+/* "startpos" или "<32 клетки> <w|b>" */
+CHECKERS_API int checkers_engine_set_position(checkers_engine *engine, const char *position);
+CHECKERS_API int checkers_engine_get_position(checkers_engine *engine, char *buf, size_t size);
+
+/* Легальные ходы через пробел */
+CHECKERS_API int checkers_engine_legal_moves(checkers_engine *engine, char *buf, size_t size);
+CHECKERS_API int checkers_engine_play(checkers_engine *engine, const char *move);
+
+/* depth < 0 — уровень из опции Level, movetime_ms и nodes равные 0 — без ограничения */
+CHECKERS_API int checkers_engine_search(checkers_engine *engine, int depth, int64_t movetime_ms, uint64_t nodes,
+                                        checkers_result *result);
+CHECKERS_API void checkers_engine_stop(checkers_engine *engine);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,360 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "Pdn.h"
+#include "Zobrist.h"
+
+// Бинарная база партий (*.ckdb), читается через mmap без разбора.
+// Формат (little-endian, секции выровнены на 8 байт):
+//   DbHeader
+//   DbGameEntry[games]            — таблица партий
+//   uint32_t[games]               — номера партий, сгруппированные по результату (см. result_count)
+//   DbPositionEntry[positions]    — индекс позиций, отсортирован по хешу Зобриста
+//   ходы                          — для каждого хода: число шагов n, клетка начала, n пар (клетка конца, побитая клетка)
+// Клетки кодируются номером тёмного поля 0..31 (x * 4 + y / 2), 0xFF — нет взятия.
+
+struct DbHeader
+{
+    char magic[4] = {'C', 'K', 'D', 'B'};
+    uint32_t version = 1;
+    uint64_t games = 0;
+    uint64_t positions = 0;
+    uint64_t result_count[4] = {0, 0, 0, 0}; // по значениям GameResult
+    uint64_t games_offset = 0;
+    uint64_t results_offset = 0;
+    uint64_t positions_offset = 0;
+    uint64_t moves_offset = 0;
+    uint64_t moves_size = 0;
+};
+
+struct DbGameEntry
+{
+    uint64_t moves_offset; // смещение ходов партии от начала секции ходов
+    uint16_t turns;        // число ходов
+    uint8_t result;        // GameResult
+    uint8_t reserved[5];
+};
+
+struct DbPositionEntry
+{
+    uint64_t hash; // хеш Зобриста позиции с учётом очереди хода
+    uint32_t game; // номер партии
+    uint16_t ply;  // позиция после ply ходов (0 — стартовая)
+    uint16_t reserved;
+};
+
+// Собирает базу в памяти и записывает её в файл
+class GameDatabaseWriter
+{
+  public:
+    // index_plies — сколько первых позиций партии попадает в индекс (0 — все)
+    explicit GameDatabaseWriter(const size_t index_plies = 0) : index_plies(index_plies)
+    {
+    }
+
+    void add(const GameRecord &game)
+    {
+        const uint32_t id = uint32_t(entries.size());
+        DbGameEntry entry{};
+        entry.moves_offset = moves.size();
+        entry.turns = uint16_t(min<size_t>(game.turns.size(), UINT16_MAX));
+        entry.result = uint8_t(game.result);
+        entries.push_back(entry);
+        result_ids[entry.result].push_back(id);
+
+        const Zobrist &z = Zobrist::instance();
+        auto mtx = start_position();
+        bool color = false;
+        positions.push_back({z.hash(mtx, color), id, 0, 0});
+        for (size_t i = 0; i < entry.turns; ++i)
+        {
+            const auto &turn = game.turns[i];
+            moves.push_back(uint8_t(turn.size()));
+            moves.push_back(square_code(turn[0].x, turn[0].y));
+            for (const auto &mv : turn)
+            {
+                moves.push_back(square_code(mv.x2, mv.y2));
+                moves.push_back(mv.xb == -1 ? 0xFF : square_code(mv.xb, mv.yb));
+                mtx = Logic::apply_move(mtx, mv);
+            }
+            color = !color;
+            if (!index_plies || i + 1 < index_plies)
+                positions.push_back({z.hash(mtx, color), id, uint16_t(i + 1), 0});
+        }
+    }
+
+    bool write(const string &path)
+    {
+        sort(positions.begin(), positions.end(), [](const DbPositionEntry &a, const DbPositionEntry &b) {
+            return a.hash != b.hash ? a.hash < b.hash : a.game != b.game ? a.game < b.game : a.ply < b.ply;
+        });
+        DbHeader header;
+        header.games = entries.size();
+        header.positions = positions.size();
+        for (int r = 0; r < 4; ++r)
+            header.result_count[r] = result_ids[r].size();
+        header.games_offset = align(sizeof(DbHeader));
+        header.results_offset = align(header.games_offset + entries.size() * sizeof(DbGameEntry));
+        header.positions_offset = align(header.results_offset + entries.size() * sizeof(uint32_t));
+        header.moves_offset = align(header.positions_offset + positions.size() * sizeof(DbPositionEntry));
+        header.moves_size = moves.size();
+
+        ofstream fout(path, ios_base::binary | ios_base::trunc);
+        if (!fout)
+            return false;
+        write_at(fout, 0, &header, sizeof(header));
+        write_at(fout, header.games_offset, entries.data(), entries.size() * sizeof(DbGameEntry));
+        fout.seekp(header.results_offset);
+        for (int r = 0; r < 4; ++r)
+            fout.write(reinterpret_cast<const char *>(result_ids[r].data()), result_ids[r].size() * sizeof(uint32_t));
+        write_at(fout, header.positions_offset, positions.data(), positions.size() * sizeof(DbPositionEntry));
+        write_at(fout, header.moves_offset, moves.data(), moves.size());
+        return bool(fout);
+    }
+
+    static uint8_t square_code(const POS_T x, const POS_T y)
+    {
+        return uint8_t(x * 4 + y / 2);
+    }
+
+  private:
+    static uint64_t align(const uint64_t offset)
+    {
+        return (offset + 7) & ~uint64_t(7);
+    }
+
+    static void write_at(ofstream &fout, const uint64_t offset, const void *data, const size_t size)
+    {
+        // дополняем нулями до начала секции
+        fout.seekp(0, ios_base::end);
+        for (uint64_t pos = uint64_t(fout.tellp()); pos < offset; ++pos)
+            fout.put(0);
+        fout.write(reinterpret_cast<const char *>(data), size);
+    }
+
+    size_t index_plies;
+    vector<DbGameEntry> entries;
+    vector<uint32_t> result_ids[4];
+    vector<DbPositionEntry> positions;
+    vector<uint8_t> moves;
+};
+
+// Отображённая в память база партий только для чтения
+class GameDatabase
+{
+  public:
+    template <class T> struct Range
+    {
+        const T *first = nullptr;
+        const T *last = nullptr;
+        const T *begin() const
+        {
+            return first;
+        }
+        const T *end() const
+        {
+            return last;
+        }
+        size_t size() const
+        {
+            return size_t(last - first);
+        }
+    };
+
+    GameDatabase() = default;
+    GameDatabase(const GameDatabase &) = delete;
+    GameDatabase &operator=(const GameDatabase &) = delete;
+
+    ~GameDatabase()
+    {
+        close();
+    }
+
+    // Отображает файл в память и проверяет заголовок и границы секций
+    bool open(const string &path, string *error = nullptr)
+    {
+        close();
+        if (!map_file(path))
+            return fail(error, "can't map " + path);
+        if (size < sizeof(DbHeader))
+            return fail(error, "file too small");
+        header = reinterpret_cast<const DbHeader *>(data);
+        if (memcmp(header->magic, "CKDB", 4) != 0 || header->version != 1)
+            return fail(error, "bad header");
+        if (header->games_offset + header->games * sizeof(DbGameEntry) > size ||
+            header->results_offset + header->games * sizeof(uint32_t) > size ||
+            header->positions_offset + header->positions * sizeof(DbPositionEntry) > size ||
+            header->moves_offset + header->moves_size > size)
+            return fail(error, "truncated file");
+        return true;
+    }
+
+    void close()
+    {
+        if (data)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(data);
+            CloseHandle(mapping);
+            CloseHandle(file);
+#else
+            munmap(const_cast<uint8_t *>(data), size);
+#endif
+        }
+        data = nullptr;
+        header = nullptr;
+        size = 0;
+    }
+
+    uint64_t games() const
+    {
+        return header ? header->games : 0;
+    }
+
+    GameResult result(const uint32_t game) const
+    {
+        return GameResult(game_entries()[game].result);
+    }
+
+    // Номера партий с заданным результатом
+    Range<uint32_t> games_with_result(const GameResult result) const
+    {
+        const uint32_t *ids = reinterpret_cast<const uint32_t *>(data + header->results_offset);
+        uint64_t from = 0;
+        for (int r = 0; r < int(result); ++r)
+            from += header->result_count[r];
+        return {ids + from, ids + from + header->result_count[int(result)]};
+    }
+
+    // Все вхождения позиции в партии базы (двоичный поиск по индексу)
+    Range<DbPositionEntry> find_position(const uint64_t hash) const
+    {
+        const DbPositionEntry *first = reinterpret_cast<const DbPositionEntry *>(data + header->positions_offset);
+        const DbPositionEntry *last = first + header->positions;
+        auto lo = lower_bound(first, last, hash, [](const DbPositionEntry &e, uint64_t h) { return e.hash < h; });
+        auto hi = upper_bound(lo, last, hash, [](uint64_t h, const DbPositionEntry &e) { return h < e.hash; });
+        return {lo, hi};
+    }
+
+    // Декодирует ходы партии
+    vector<vector<move_pos>> turns(const uint32_t game) const
+    {
+        const DbGameEntry &entry = game_entries()[game];
+        const uint8_t *p = data + header->moves_offset + entry.moves_offset;
+        const uint8_t *end = data + header->moves_offset + header->moves_size;
+        vector<vector<move_pos>> res(entry.turns);
+        for (auto &turn : res)
+        {
+            if (p + 2 > end)
+                break;
+            uint8_t steps = *p++;
+            POS_T x, y;
+            decode(*p++, x, y);
+            for (uint8_t k = 0; k < steps && p + 2 <= end; ++k)
+            {
+                POS_T x2, y2, xb = -1, yb = -1;
+                decode(*p++, x2, y2);
+                if (*p != 0xFF)
+                    decode(*p, xb, yb);
+                ++p;
+                turn.emplace_back(x, y, x2, y2, xb, yb);
+                x = x2;
+                y = y2;
+            }
+        }
+        return res;
+    }
+
+    // Партия целиком, например для экспорта в PDN
+    GameRecord record(const uint32_t game) const
+    {
+        GameRecord rec;
+        rec.turns = turns(game);
+        rec.result = result(game);
+        return rec;
+    }
+
+  private:
+    const DbGameEntry *game_entries() const
+    {
+        return reinterpret_cast<const DbGameEntry *>(data + header->games_offset);
+    }
+
+    static void decode(const uint8_t code, POS_T &x, POS_T &y)
+    {
+        x = POS_T(code / 4);
+        y = POS_T((code % 4) * 2 + (x % 2 == 0 ? 1 : 0));
+    }
+
+    bool fail(string *error, const string &text)
+    {
+        close();
+        if (error)
+            *error = text;
+        return false;
+    }
+
+    bool map_file(const string &path)
+    {
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER file_size;
+        GetFileSizeEx(file, &file_size);
+        size = size_t(file_size.QuadPart);
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return false;
+        }
+        data = static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!data)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+        }
+        return data != nullptr;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        size = size_t(st.st_size);
+        void *p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED)
+            return false;
+        data = static_cast<const uint8_t *>(p);
+        return true;
+#endif
+    }
+
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    const DbHeader *header = nullptr;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Logic.h"
+
+using namespace std;
+
+// Подсказки игроку: несколько лучших ходов (Logic::search_multipv), которые ищутся в фоновом потоке,
+// пока человек думает над ходом. Интерфейс не ждёт поиска: он опрашивает ready() и забирает строки take()
+class HintSearch
+{
+  public:
+    HintSearch() = default;
+    HintSearch(const HintSearch &) = delete;
+    HintSearch &operator=(const HintSearch &) = delete;
+
+    ~HintSearch()
+    {
+        stop();
+    }
+
+    /**
+     * Запускает поиск lines лучших ходов стороны color в позиции mtx на копии logic
+     * (с её историей партии и настройками), прерывая предыдущий поиск.
+     * Глубина и время — limits, внешний флаг остановки заменяется своим
+     */
+    void start(const Logic &logic, const vector<vector<POS_T>> &mtx, const bool color, const int lines,
+               SearchLimits limits)
+    {
+        stop();
+        cancel = false;
+        limits.stop = &cancel;
+        worker = thread([this, engine = logic, mtx, color, lines, limits]() mutable {
+            TRACE_THREAD_NAME("hints");
+            auto found = engine.search_multipv(mtx, color, lines, limits);
+            if (cancel || found.empty())
+                return;
+            lock_guard<mutex> lock(result_mtx);
+            result = move(found);
+            has_result = true;
+        });
+    }
+
+    // Останавливает поиск и забывает невыданные подсказки
+    void stop()
+    {
+        cancel = true;
+        if (worker.joinable())
+            worker.join();
+        lock_guard<mutex> lock(result_mtx);
+        result.clear();
+        has_result = false;
+    }
+
+    // Готовы подсказки, которые ещё не забраны
+    bool ready() const
+    {
+        return has_result.load(memory_order_acquire);
+    }
+
+    // Забирает готовые подсказки по убыванию оценки (пусто, если их нет)
+    vector<PvLine> take()
+    {
+        lock_guard<mutex> lock(result_mtx);
+        has_result = false;
+        vector<PvLine> res;
+        res.swap(result);
+        return res;
+    }
+
+  private:
+    thread worker;
+    atomic<bool> cancel{false};
+    mutex result_mtx;
+    vector<PvLine> result;
+    atomic<bool> has_result{false};
+};
@@ -0,0 +1,521 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+    #include <fcntl.h>
+    #include <io.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#include "Settings.h"
+
+using namespace std;
+
+// Журнал в формате JSON Lines: одна запись — один объект в строке,
+//   {"ts":"2026-01-31T12:00:00.123Z","level":"info","event":"bot_turn","time_ms":250,...}
+// Запись только форматирует строку и кладёт её в очередь без блокировок; файл открыт один раз,
+// пишет его фоновый поток пачками. При переполнении очереди записи отбрасываются (счётчик dropped),
+// поток игры никогда не ждёт диска. Файл ротируется по размеру: log.jsonl -> log.1.jsonl -> ... -> log.N.jsonl.
+// Очередь дописывается при close и по std::terminate. По сигналам падения (SIGSEGV, SIGABRT, SIGFPE, SIGILL)
+// в файл пишется только запись crash: обработчик сигнала не выделяет память и не берёт блокировок
+
+// Поле записи: имя и значение, уже записанное в JSON
+struct LogField
+{
+    template <class T, typename enable_if<is_arithmetic<T>::value && !is_same<T, bool>::value, int>::type = 0>
+    LogField(const char *key, const T value) : key(key), value(to_string(value))
+    {
+    }
+
+    LogField(const char *key, const bool value) : key(key), value(value ? "true" : "false")
+    {
+    }
+
+    LogField(const char *key, const string &value) : key(key), value(quote(value))
+    {
+    }
+
+    LogField(const char *key, const char *value) : key(key), value(quote(value))
+    {
+    }
+
+    // Строка JSON в кавычках с экранированием
+    static string quote(const string &text)
+    {
+        string res = "\"";
+        for (const char c : text)
+        {
+            if (c == '"' || c == '\\')
+                res += '\\', res += c;
+            else if (c == '\n')
+                res += "\\n";
+            else if (c == '\r')
+                res += "\\r";
+            else if (c == '\t')
+                res += "\\t";
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", int(c));
+                res += buf;
+            }
+            else
+                res += c;
+        }
+        return res + "\"";
+    }
+
+    const char *key;
+    string value;
+};
+
+class Logger
+{
+    static const size_t CAPACITY = 1 << 12; // записей в очереди
+
+    // Ячейка очереди Вьюкова: seq говорит, чья очередь (писателя или читателя) заполнять ячейку
+    struct Cell
+    {
+        atomic<size_t> seq;
+        string line;
+    };
+
+  public:
+    static Logger &instance()
+    {
+        static Logger logger;
+        return logger;
+    }
+
+    /**
+     * Открывает журнал path (дописывает, если файл уже есть) и запускает поток записи.
+     * max_bytes — размер, после которого файл ротируется, files — сколько старых файлов хранить (0 — не хранить)
+     */
+    bool open(const string &file_path, const LogLevel level, const size_t max_bytes, const int files)
+    {
+        close();
+        path = file_path;
+        max_size = max_bytes;
+        keep_files = files;
+        set_level(level);
+        {
+            lock_guard<mutex> lock(file_mtx);
+            file.open(path, ios_base::app | ios_base::binary);
+            if (!file)
+                return false;
+            file.seekp(0, ios_base::end);
+            size = size_t(file.tellp());
+            reopen_crash_fd();
+        }
+        running = true;
+        writer = thread(&Logger::write_loop, this);
+        install_crash_handlers();
+        return true;
+    }
+
+    // Дописывает очередь, останавливает поток записи и закрывает файл
+    void close()
+    {
+        if (!writer.joinable())
+            return;
+        {
+            lock_guard<mutex> lock(wake_mtx);
+            running = false;
+        }
+        wake.notify_one();
+        writer.join();
+        lock_guard<mutex> lock(file_mtx);
+        file.close();
+        close_fd(crash_fd().exchange(-1));
+    }
+
+    void set_level(const LogLevel level)
+    {
+        min_level.store(int(level), memory_order_relaxed);
+    }
+
+    bool enabled(const LogLevel level) const
+    {
+        return int(level) >= min_level.load(memory_order_relaxed) && running.load(memory_order_relaxed);
+    }
+
+    // Ставит запись в очередь. Без ввода-вывода и блокировок; при полной очереди запись теряется
+    void write(const LogLevel level, const char *event, const vector<LogField> &fields)
+    {
+        if (!enabled(level))
+            return;
+        string line = "{\"ts\":\"" + timestamp() + "\",\"level\":\"" + level_name(level) + "\",\"event\":" +
+                      LogField::quote(event);
+        for (const auto &f : fields)
+        {
+            line += ",\"";
+            line += f.key;
+            line += "\":";
+            line += f.value;
+        }
+        line += "}\n";
+        if (!push(line))
+            dropped_count.fetch_add(1, memory_order_relaxed);
+        else if (level == LogLevel::Error)
+            wake.notify_one(); // ошибки пишутся сразу, остальное — пачкой по таймеру
+    }
+
+    void debug(const char *event, const vector<LogField> &fields = {})
+    {
+        write(LogLevel::Debug, event, fields);
+    }
+
+    void info(const char *event, const vector<LogField> &fields = {})
+    {
+        write(LogLevel::Info, event, fields);
+    }
+
+    void warning(const char *event, const vector<LogField> &fields = {})
+    {
+        write(LogLevel::Warning, event, fields);
+    }
+
+    void error(const char *event, const vector<LogField> &fields = {})
+    {
+        write(LogLevel::Error, event, fields);
+    }
+
+    // Дописывает очередь в файл в текущем потоке. Вызывается при падении, когда поток записи может не успеть;
+    // если файл сейчас пишет поток записи, ничего не делает
+    void flush_now()
+    {
+        unique_lock<mutex> lock(file_mtx, try_to_lock);
+        if (lock.owns_lock() && file.is_open())
+            drain();
+    }
+
+    // Записей, потерянных из-за переполнения очереди
+    uint64_t dropped() const
+    {
+        return dropped_count.load(memory_order_relaxed);
+    }
+
+    ~Logger()
+    {
+        close();
+    }
+
+  private:
+    Logger() : cells(new Cell[CAPACITY])
+    {
+        for (size_t i = 0; i < CAPACITY; ++i)
+            cells[i].seq.store(i, memory_order_relaxed);
+    }
+
+    bool push(string &line)
+    {
+        size_t pos = enqueue_pos.load(memory_order_relaxed);
+        Cell *cell;
+        while (true)
+        {
+            cell = &cells[pos & (CAPACITY - 1)];
+            const size_t seq = cell->seq.load(memory_order_acquire);
+            const intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0)
+            {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false; // очередь полна
+            else
+                pos = enqueue_pos.load(memory_order_relaxed);
+        }
+        cell->line.swap(line);
+        cell->seq.store(pos + 1, memory_order_release);
+        // Очередь заполнена наполовину — будим поток записи, не дожидаясь таймера
+        if (pos - dequeue_pos.load(memory_order_relaxed) == CAPACITY / 2)
+            wake.notify_one();
+        return true;
+    }
+
+    bool pop(string &line)
+    {
+        size_t pos = dequeue_pos.load(memory_order_relaxed);
+        Cell *cell;
+        while (true)
+        {
+            cell = &cells[pos & (CAPACITY - 1)];
+            const size_t seq = cell->seq.load(memory_order_acquire);
+            const intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0)
+            {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false; // очередь пуста
+            else
+                pos = dequeue_pos.load(memory_order_relaxed);
+        }
+        line.clear();
+        line.swap(cell->line);
+        cell->seq.store(pos + CAPACITY, memory_order_release);
+        return true;
+    }
+
+    // Поток записи: раз в FLUSH_MS (или сразу после ошибки) забирает всё из очереди и пишет одним куском
+    void write_loop()
+    {
+        static const int FLUSH_MS = 100;
+        while (true)
+        {
+            {
+                unique_lock<mutex> lock(wake_mtx);
+                wake.wait_for(lock, chrono::milliseconds(FLUSH_MS), [this] { return !running; });
+            }
+            lock_guard<mutex> lock(file_mtx);
+            drain();
+            if (!running)
+                break;
+        }
+    }
+
+    // Под file_mtx: всё из очереди в файл, с ротацией по размеру
+    void drain()
+    {
+        string line;
+        batch.clear();
+        while (pop(line))
+        {
+            batch += line;
+            if (max_size && size + batch.size() >= max_size)
+            {
+                write_batch();
+                rotate();
+            }
+        }
+        write_batch();
+    }
+
+    void write_batch()
+    {
+        if (batch.empty())
+            return;
+        file.write(batch.data(), streamsize(batch.size()));
+        file.flush();
+        size += batch.size();
+        batch.clear();
+    }
+
+    // log.jsonl -> log.1.jsonl, log.1.jsonl -> log.2.jsonl ..., самый старый удаляется
+    void rotate()
+    {
+        file.close();
+        const auto numbered = [this](const int i) {
+            const size_t dot = path.rfind('.');
+            return dot == string::npos || dot < path.find_last_of("/\\") + 1
+                       ? path + "." + to_string(i)
+                       : path.substr(0, dot) + "." + to_string(i) + path.substr(dot);
+        };
+        if (keep_files > 0)
+        {
+            remove(numbered(keep_files).c_str());
+            for (int i = keep_files - 1; i >= 1; --i)
+                rename(numbered(i).c_str(), numbered(i + 1).c_str());
+            rename(path.c_str(), numbered(1).c_str());
+        }
+        file.open(path, ios_base::trunc | ios_base::binary);
+        size = 0;
+        reopen_crash_fd();
+    }
+
+    // Дескриптор текущего файла журнала для обработчика сигналов (ofstream в обработчике сигнала нельзя)
+    static atomic<int> &crash_fd()
+    {
+        static atomic<int> fd{-1};
+        return fd;
+    }
+
+    void reopen_crash_fd()
+    {
+#ifdef _WIN32
+        const int fd = _open(path.c_str(), _O_WRONLY | _O_APPEND | _O_BINARY);
+#else
+        const int fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+#endif
+        close_fd(crash_fd().exchange(fd));
+    }
+
+    static void close_fd(const int fd)
+    {
+        if (fd < 0)
+            return;
+#ifdef _WIN32
+        _close(fd);
+#else
+        ::close(fd);
+#endif
+    }
+
+    static const char *level_name(const LogLevel level)
+    {
+        switch (level)
+        {
+        case LogLevel::Debug:
+            return "debug";
+        case LogLevel::Info:
+            return "info";
+        case LogLevel::Warning:
+            return "warning";
+        default:
+            return "error";
+        }
+    }
+
+    // Время UTC в формате ISO 8601 с миллисекундами
+    static string timestamp()
+    {
+        const auto now = chrono::system_clock::now();
+        const time_t t = chrono::system_clock::to_time_t(now);
+        const int ms = int(chrono::duration_cast<chrono::milliseconds>(now.time_since_epoch()).count() % 1000);
+        tm utc;
+#ifdef _WIN32
+        gmtime_s(&utc, &t);
+#else
+        gmtime_r(&t, &utc);
+#endif
+        char buf[32];
+        const size_t n = strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &utc);
+        snprintf(buf + n, sizeof(buf) - n, ".%03dZ", ms);
+        return buf;
+    }
+
+    // При std::terminate дописываем очередь, при сигнале падения — только запись crash;
+    // затем отдаём управление обработчику по умолчанию
+    static void install_crash_handlers()
+    {
+        static bool installed = false;
+        if (installed)
+            return;
+        installed = true;
+        for (const int sig : {SIGSEGV, SIGABRT, SIGFPE, SIGILL})
+            signal(sig, on_crash_signal);
+        previous_terminate() = set_terminate([] {
+            Logger &logger = instance();
+            logger.write(LogLevel::Error, "terminate", {});
+            logger.flush_now();
+            if (previous_terminate())
+                previous_terminate()();
+            abort();
+        });
+    }
+
+    // Только async-signal-safe вызовы: куча может быть испорчена, а file_mtx — захвачен упавшим потоком
+    static void on_crash_signal(const int sig)
+    {
+        signal(sig, SIG_DFL);
+        char record[128];
+        const size_t n = crash_record(sig, record);
+        const int fd = crash_fd().load(memory_order_relaxed);
+        if (fd >= 0)
+        {
+#ifdef _WIN32
+            _write(fd, record, unsigned(n));
+#else
+            const ssize_t written = ::write(fd, record, n);
+            (void)written;
+#endif
+        }
+        raise(sig);
+    }
+
+    // Запись crash в формате write() в буфер на стеке: только арифметика, без strftime и аллокаций
+    static size_t crash_record(const int sig, char (&buf)[128])
+    {
+        size_t n = 0;
+        const auto put = [&](const char *text) {
+            while (*text && n < sizeof(buf) - 1)
+                buf[n++] = *text++;
+        };
+        const auto put_num = [&](int64_t value, int width) {
+            char digits[20];
+            int len = 0;
+            do
+            {
+                digits[len++] = char('0' + value % 10);
+                value /= 10;
+            } while (value > 0 || len < width);
+            while (len > 0 && n < sizeof(buf) - 1)
+                buf[n++] = digits[--len];
+        };
+        int64_t sec = 0, ms = 0;
+#ifdef _WIN32
+        sec = int64_t(time(nullptr));
+#else
+        timespec now = {};
+        clock_gettime(CLOCK_REALTIME, &now);
+        sec = int64_t(now.tv_sec);
+        ms = int64_t(now.tv_nsec / 1000000);
+#endif
+        // Дата по числу дней от 1970-01-01 (григорианский календарь)
+        const int64_t days = sec / 86400 + 719468, day_sec = sec % 86400;
+        const int64_t era = days / 146097, doe = days - era * 146097;
+        const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100), mp = (5 * doy + 2) / 153;
+        const int64_t month = mp < 10 ? mp + 3 : mp - 9;
+        put("{\"ts\":\"");
+        put_num(yoe + era * 400 + (month <= 2), 4);
+        put("-");
+        put_num(month, 2);
+        put("-");
+        put_num(doy - (153 * mp + 2) / 5 + 1, 2);
+        put("T");
+        put_num(day_sec / 3600, 2);
+        put(":");
+        put_num(day_sec / 60 % 60, 2);
+        put(":");
+        put_num(day_sec % 60, 2);
+        put(".");
+        put_num(ms, 3);
+        put("Z\",\"level\":\"error\",\"event\":\"crash\",\"signal\":");
+        put_num(sig, 1);
+        put("}\n");
+        return n;
+    }
+
+    static terminate_handler &previous_terminate()
+    {
+        static terminate_handler handler = nullptr;
+        return handler;
+    }
+
+    unique_ptr<Cell[]> cells;
+    atomic<size_t> enqueue_pos{0}, dequeue_pos{0};
+    atomic<uint64_t> dropped_count{0};
+    atomic<int> min_level{int(LogLevel::Info)};
+    atomic<bool> running{false};
+
+    mutex wake_mtx;
+    condition_variable wake;
+    thread writer;
+
+    mutex file_mtx; // файл, batch, size и ротация
+    ofstream file;
+    string path;
+    string batch;
+    size_t size = 0;
+    size_t max_size = 0;
+    int keep_files = 0;
+};
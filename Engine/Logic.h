@@ -0,0 +1,1171 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "../Models/Score.h"
+#include "../Models/Search.h"
+#include "Rays.h"
+#include "Rules.h"
+#include "Settings.h"
+#include "SharedCache.h"
+#include "Trace.h"
+#include "Zobrist.h"
+
+using namespace std;
+
+const int MAX_PLY = 128;   // уровней стека поиска (шаг серии взятий — отдельный уровень)
+const int MAX_TURNS = 160; // ходов в одной позиции
+
+// Поиск и генерация ходов для варианта правил Rules (см. Rules.h); Logic — русские шашки
+template <class Rules> class BasicLogic
+{
+    static constexpr POS_T N = Rules::size; // сторона доски
+    static constexpr const DiagonalRays<Rules::size> &rays = diagonal_rays<Rules::size>; // лучи из клеток доски
+
+  public:
+    BasicLogic(const SettingsStore *config) : stack(MAX_PLY), pv_table(MAX_PLY * MAX_PLY), config(config)
+    {
+        refresh_settings();
+    }
+
+    // Подхватывает актуальный снимок настроек (после горячей перезагрузки settings.json).
+    // Вызывается перед каждым поиском, в самом поиске строки и json не используются
+    void refresh_settings()
+    {
+        auto snapshot = config->snapshot();
+        if (snapshot == settings)
+            return;
+        if (!settings || settings->no_random != snapshot->no_random)
+            rand_eng = std::default_random_engine(!snapshot->no_random ? unsigned(time(0)) : 0);
+        settings = snapshot;
+        scoring_mode = settings->scoring;
+        optimization = settings->optimization;
+        // Оценки из кеша годятся только при тех же правилах, оценке, выборочном поиске и правилах ничьей
+        cache_salt = mix_salt(0, Rules::pdn_game_type);
+        for (const int value : {int(scoring_mode), int(optimization), settings->no_progress_turns, settings->repetition_draw})
+            cache_salt = mix_salt(cache_salt, uint64_t(value));
+        if (settings->shared_cache_mb != cache_mb || settings->shared_cache_name != cache_name)
+        {
+            cache_mb = settings->shared_cache_mb;
+            cache_name = settings->shared_cache_name;
+            cache_error.clear();
+            cache = (cache_mb ? SharedCache::attach(cache_name, cache_mb, cache_error) : nullptr);
+        }
+    }
+
+    /**
+     * Находит оптимальную последовательность ходов для бота заданного цвета.
+     * Возвращает вектор ходов, которые должен сделать бот.
+     * color: true — чёрные, false — белые
+     */
+    vector<move_pos> find_best_turns(const bool color, const vector<vector<POS_T>> &mtx) {
+        TRACE_SCOPE_NAMED(trace, "find_best_turns", "search");
+        refresh_settings();
+        limits = SearchLimits();
+        can_abort = false;
+        aborted = false;
+        nodes = 0;
+        const uint64_t root_hash = start_search(mtx, color);
+        search_root(color, root_hash);
+        finish_search(root_hash);
+        TRACE_ARG(trace, "depth", Max_depth);
+        TRACE_ARG(trace, "nodes", nodes);
+        return first_turn();
+    }
+
+    /**
+     * Поиск с итеративным углублением и ограничениями по глубине, узлам и времени.
+     * После каждой завершённой итерации вызывает on_info. Прерванная итерация отбрасывается,
+     * первая итерация (глубина 0) всегда доводится до конца, чтобы был хотя бы один ход.
+     * Лучший вариант итерации первым просматривается в следующей.
+     */
+    vector<move_pos> search(const vector<vector<POS_T>> &mtx, const bool color, const SearchLimits &search_limits,
+                            const function<void(const SearchInfo &)> &on_info = nullptr)
+    {
+        TRACE_SCOPE_NAMED(trace, "search", "search");
+        refresh_settings();
+        limits = search_limits;
+        can_abort = false;
+        aborted = false;
+        nodes = 0;
+        const auto start = chrono::steady_clock::now();
+        const int saved_depth = Max_depth;
+        const int max_depth = max(0, limits.depth >= 0 ? limits.depth : Max_depth); // глубина 0 есть всегда
+        const uint64_t root_hash = start_search(mtx, color);
+        vector<move_pos> best;
+        for (int depth = 0; depth <= max_depth; ++depth)
+        {
+            Max_depth = depth;
+            TRACE_SCOPE_NAMED(iteration, "iteration", "search");
+            const Score score = search_root(color, root_hash);
+            TRACE_ARG(iteration, "depth", depth);
+            TRACE_ARG(iteration, "nodes", nodes);
+            if (aborted)
+                break;
+            best = first_turn();
+            can_abort = true;
+            if (on_info)
+            {
+                SearchInfo info;
+                info.depth = depth;
+                info.score = score;
+                info.nodes = nodes;
+                info.time_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+                info.pv = principal_variation();
+                on_info(info);
+            }
+            if (best.empty() || out_of_limits())
+                break;
+        }
+        Max_depth = saved_depth;
+        finish_search(root_hash);
+        TRACE_ARG(trace, "nodes", nodes);
+        return best;
+    }
+
+    /**
+     * Поиск нескольких лучших ходов (multi-PV) с теми же ограничениями и итеративным углублением, что у search.
+     * Точную оценку получают только lines лучших ходов корня: остальные ищутся с окном от оценки худшего из них
+     * и отсекаются так же, как в обычном поиске. Ходы-убийцы, затравка варианта и порядок ходов корня
+     * (по оценкам прошлой итерации) общие для всех строк, поэтому это заметно дешевле lines отдельных поисков.
+     * Ход корня — шаг: серия взятий, начатая одним шагом, даёт одну строку с лучшим продолжением.
+     * Возвращает строки последней завершённой итерации по убыванию оценки, on_info получает их в info.lines
+     */
+    vector<PvLine> search_multipv(const vector<vector<POS_T>> &mtx, const bool color, const int max_lines,
+                                  const SearchLimits &search_limits,
+                                  const function<void(const SearchInfo &)> &on_info = nullptr)
+    {
+        TRACE_SCOPE_NAMED(trace, "search_multipv", "search");
+        const int lines = max(1, max_lines);
+        refresh_settings();
+        limits = search_limits;
+        can_abort = false;
+        aborted = false;
+        nodes = 0;
+        const auto start = chrono::steady_clock::now();
+        const int saved_depth = Max_depth;
+        const int max_depth = max(0, limits.depth >= 0 ? limits.depth : Max_depth); // глубина 0 есть всегда
+        const uint64_t root_hash = start_search(mtx, color);
+        Ply &p = stack[0];
+        gen_turns(color, p);
+        // Ходы корня с оценками прошлой итерации; точные оценки только у тех, что не отсечены окном
+        struct RootMove
+        {
+            move_pos mv;
+            Score score = -SCORE_INF;
+            bool exact = false;
+            vector<move_pos> pv;
+        };
+        vector<RootMove> root(p.count);
+        for (int i = 0; i < p.count; ++i)
+            root[i].mv = p.moves[i];
+        // Первым — ход затравки, оставленной прошлым поиском
+        for (size_t i = 0; seed_len > 0 && i < root.size(); ++i)
+        {
+            if (root[i].mv == seed_line[0])
+            {
+                rotate(root.begin(), root.begin() + i, root.begin() + i + 1);
+                break;
+            }
+        }
+        vector<PvLine> best;
+        for (int depth = 0; depth <= max_depth && !root.empty(); ++depth)
+        {
+            Max_depth = depth;
+            TRACE_SCOPE_NAMED(iteration, "iteration", "search");
+            stable_sort(root.begin(), root.end(), [](const RootMove &a, const RootMove &b) { return a.score > b.score; });
+            ++nodes;
+            vector<Score> top; // точные оценки итерации по убыванию, не больше lines
+            for (size_t i = 0; i < root.size() && !aborted; ++i)
+            {
+                RootMove &rm = root[i];
+                // Вариант прошлой итерации ведёт только через лучший ход
+                follow_pv = (i == 0 && seed_len > 0 && seed_line[0] == rm.mv);
+                const Score alpha = (int(top.size()) < lines ? -SCORE_INF : top.back());
+                const Score eval = search_move(rm.mv, p, color, -1, 0, alpha, SCORE_INF, root_hash, !p.beats, false);
+                if (aborted)
+                    break;
+                rm.score = eval;
+                rm.exact = (eval > alpha);
+                if (!rm.exact)
+                    continue;
+                rm.pv.assign(1, rm.mv);
+                rm.pv.insert(rm.pv.end(), &pv_table[MAX_PLY + 1], &pv_table[MAX_PLY] + pv_len[1]);
+                top.insert(upper_bound(top.begin(), top.end(), eval, greater<Score>()), eval);
+                if (int(top.size()) > lines)
+                    top.pop_back();
+            }
+            TRACE_ARG(iteration, "depth", depth);
+            TRACE_ARG(iteration, "nodes", nodes);
+            if (aborted)
+                break;
+            best.clear();
+            for (const auto &rm : root)
+                if (rm.exact)
+                    best.push_back(PvLine{rm.score, rm.pv});
+            stable_sort(best.begin(), best.end(), [](const PvLine &a, const PvLine &b) { return a.score > b.score; });
+            if (int(best.size()) > lines)
+                best.resize(lines);
+            // Лучшая строка — вариант поиска: затравка следующей итерации и следующего поиска
+            best_line_len = int(best[0].pv.size());
+            copy(best[0].pv.begin(), best[0].pv.end(), best_line);
+            seed_len = best_line_len;
+            copy(best_line, best_line + best_line_len, seed_line);
+            seed_hash = root_hash;
+            can_abort = true;
+            if (on_info)
+            {
+                SearchInfo info;
+                info.depth = depth;
+                info.score = best[0].score;
+                info.nodes = nodes;
+                info.time_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+                info.pv = best[0].pv;
+                info.lines = best;
+                on_info(info);
+            }
+            if (out_of_limits())
+                break;
+        }
+        Max_depth = saved_depth;
+        finish_search(root_hash);
+        TRACE_ARG(trace, "nodes", nodes);
+        return best;
+    }
+
+    /**
+     * Оценка одного шага корня mv позиции mtx (ходит color) на глубину depth с окном (alpha, beta):
+     * ровно то, что для этого шага считает корень find_best_turns с тем же окном. Кусок работы распределённого
+     * поиска (Cluster.h). Прерывается по limits с первого узла. seed — вариант прошлой итерации через mv,
+     * его ходы смотрятся первыми. Ходы-убийцы остаются от прошлых кусков того же корня, как у соседних шагов
+     * корня в find_best_turns. Возвращает false, если mv — не ход корня или поиск прерван;
+     * иначе оценку в score и вариант, начинающийся с mv, в line
+     */
+    bool search_root_move(const vector<vector<POS_T>> &mtx, const bool color, const move_pos &mv, const int depth,
+                          const Score alpha, const Score beta, const SearchLimits &search_limits, Score &score,
+                          vector<move_pos> &line, const vector<move_pos> &seed = {})
+    {
+        TRACE_SCOPE_NAMED(trace, "search_root_move", "search");
+        refresh_settings();
+        limits = search_limits;
+        can_abort = true;
+        aborted = false;
+        nodes = 0;
+        const int saved_depth = Max_depth;
+        const uint64_t root_hash = start_search(mtx, color, true);
+        Ply &p = stack[0];
+        gen_turns(color, p);
+        // Шаг из генератора: в mv может не быть побитой шашки
+        const move_pos *root_move = find(p.moves, p.moves + p.count, mv);
+        if (root_move == p.moves + p.count)
+            return false;
+        const move_pos step = *root_move;
+        Max_depth = depth;
+        ++nodes;
+        seed_len = (!seed.empty() && seed[0] == step ? min(int(seed.size()), MAX_PLY) : 0);
+        copy(seed.begin(), seed.begin() + seed_len, seed_line);
+        follow_pv = (seed_len > 0);
+        const Score eval = search_move(step, p, color, -1, 0, alpha, beta, root_hash, !p.beats, false);
+        Max_depth = saved_depth;
+        seed_len = 0; // затравка куска не относится к следующему поиску
+        TRACE_ARG(trace, "nodes", nodes);
+        if (aborted)
+            return false;
+        score = eval;
+        line.assign(1, step);
+        line.insert(line.end(), &pv_table[MAX_PLY + 1], &pv_table[MAX_PLY] + pv_len[1]);
+        return true;
+    }
+
+    // Лучший вариант последней завершённой итерации: шаги ходов обеих сторон подряд
+    vector<move_pos> principal_variation() const
+    {
+        return vector<move_pos>(best_line, best_line + best_line_len);
+    }
+
+    // Число узлов, просмотренных последним поиском
+    uint64_t searched_nodes() const
+    {
+        return nodes;
+    }
+
+    // Сколько узлов последнего поиска взяли оценку из общего кеша (SharedCacheMB)
+    uint64_t shared_cache_hits() const
+    {
+        return cache_hits;
+    }
+
+    // Почему не удалось подключиться к общему кешу (пусто — подключён или выключен)
+    const string &shared_cache_error() const
+    {
+        return cache_error;
+    }
+
+    /**
+     * Задаёт историю партии: позиции на границах ходов от начала партии до текущей включительно,
+     * first_color — кто ходил в первой из них. Нужна для обнаружения повторений в поиске и в Game
+     */
+    void set_history(const vector<vector<vector<POS_T>>> &positions, const bool first_color)
+    {
+        const Zobrist &z = Zobrist::instance();
+        history_hashes.clear();
+        history_reversible.clear();
+        bool color = first_color;
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            history_hashes.push_back(z.hash(positions[i], color));
+            history_reversible.push_back(i && is_reversible(positions[i - 1], positions[i]) ? history_reversible.back() + 1
+                                                                                             : 0);
+            color = !color;
+        }
+    }
+
+    // Ничья в последней позиции истории: повторение RepetitionDraw раз или NoProgressTurns ходов без взятий и ходов шашками
+    bool history_is_draw()
+    {
+        refresh_settings();
+        if (history_hashes.empty())
+            return false;
+        const int reversible = history_reversible.back();
+        if (settings->no_progress_turns && reversible >= settings->no_progress_turns)
+            return true;
+        if (!settings->repetition_draw)
+            return false;
+        int count = 1;
+        const int last = int(history_hashes.size()) - 1;
+        for (int i = last - 2; i >= 0 && last - i <= reversible; i -= 2)
+            count += (history_hashes[i] == history_hashes[last]);
+        return count >= settings->repetition_draw;
+    }
+
+    // Ходов подряд без взятий и ходов шашками к последней позиции истории
+    int reversible_turns() const
+    {
+        return history_reversible.empty() ? 0 : history_reversible.back();
+    }
+
+    // Ход между позициями обратим, если число фигур не изменилось и ни одна простая шашка не сдвинулась
+    static bool is_reversible(const vector<vector<POS_T>> &before, const vector<vector<POS_T>> &after)
+    {
+        int pieces_before = 0, pieces_after = 0;
+        for (POS_T i = 0; i < N; ++i)
+        {
+            for (POS_T j = 0; j < N; ++j)
+            {
+                pieces_before += (before[i][j] != 0);
+                pieces_after += (after[i][j] != 0);
+                if ((before[i][j] == 1 || before[i][j] == 2 || after[i][j] == 1 || after[i][j] == 2) &&
+                    before[i][j] != after[i][j])
+                    return false;
+            }
+        }
+        return pieces_before == pieces_after;
+    }
+
+    /**
+     * Рекурсивная функция поиска (negamax с alpha-beta отсечением) на доске pos (ходы делаются и откатываются на месте).
+     * color — чей ход, depth — глубина поиска (у корня -1), ply — уровень стека поиска,
+     * alpha/beta — окно с точки зрения color, x/y — координаты для продолжения серии взятий,
+     * hash — хеш позиции, reversible — сколько ходов подряд сделано без взятий и ходов шашками.
+     * Возвращает оценку позиции для color (Score.h), лучший вариант из узла кладёт в строку ply таблицы PV.
+     */
+    Score find_best_turns_rec(bool color, int depth, int ply, Score alpha, Score beta, POS_T x, POS_T y, uint64_t hash, int reversible) {
+        ++nodes;
+        pv_len[ply] = ply;
+        // Если вышли за ограничения поиска — результат итерации всё равно будет отброшен
+        if (out_of_limits()) {
+            return 0;
+        }
+        // Корень и повторный вход в тот же узел для ProbCut уже лежат в пути поиска
+        const bool root = (ply == 0);
+        const bool reentry = probcut_reentry;
+        probcut_reentry = false;
+        // На границе хода проверяем повторение и правило ходов без прогресса, позицию кладём в путь поиска
+        const bool boundary = (x == -1 && !reentry && !root);
+        if (boundary && is_draw(hash, reversible)) {
+            return SCORE_DRAW;
+        }
+        PathGuard guard(*this, boundary, hash, reversible);
+        // Если достигли максимальной глубины (или конца стека) — оцениваем позицию
+        if (depth >= Max_depth || ply >= MAX_PLY - 1) {
+            return calc_score(color, ply);
+        }
+        const int remaining = Max_depth - depth;
+        // Общий кеш: позиция уже посчитана на нужную глубину этим или другим процессом.
+        // На варианте прошлой итерации оценку не берём, чтобы вариант не обрывался
+        const bool cached = (cache && boundary && optimization != OptLevel::O0);
+        const uint64_t key = (cached ? cache_key(hash, reversible) : 0);
+        move_pos cache_move;
+        if (cached) {
+            SharedCache::Hit hit;
+            if (cache->probe(key, hit)) {
+                cache_move = hit.move;
+                const Score score = unpack_score(hit.score, ply);
+                if (hit.draft >= remaining && !follow_pv &&
+                    (hit.bound == SharedCache::EXACT || (hit.bound == SharedCache::LOWER && score >= beta) ||
+                     (hit.bound == SharedCache::UPPER && score <= alpha))) {
+                    ++cache_hits;
+                    return score;
+                }
+            }
+        }
+        // Определяем возможные ходы
+        Ply &p = stack[ply];
+        if (x != -1) {
+            gen_piece_turns(x, y, p);
+        } else {
+            gen_turns(color, p);
+        }
+        // Если нет взятий и продолжается серия — передаём ход противнику (на том же уровне стека)
+        if (!p.beats && x != -1) {
+            return -find_best_turns_rec(!color, depth + 1, ply, -beta, -alpha, -1, -1, hash ^ Zobrist::instance().side(), 0);
+        }
+        // Если ходов нет — ходящий проиграл
+        if (p.count == 0) {
+            return loss_in(ply);
+        }
+        const bool quiet = (x == -1 && !p.beats);
+        order_turns(p, ply, quiet, cache_move);
+        // O2: выборочный поиск только в тихих позициях (взятия обязательны и меняют материал)
+        const bool selective = (optimization == OptLevel::O2 && quiet && !in_probcut && !root);
+        if (selective) {
+            p.static_eval = calc_score(color, ply);
+            // Futility pruning: у листьев тихие ходы не сдвинут оценку больше чем на margin за ход
+            if (remaining <= 2 && p.static_eval + settings->futility_margin * remaining <= alpha) {
+                return p.static_eval;
+            }
+            // ProbCut: если мелкий поиск уверенно выходит за границу окна, полный поиск тоже выйдет
+            if (remaining >= settings->probcut_depth && remaining > 3 && !is_decisive(beta)) {
+                const Score bound = beta + settings->probcut_margin;
+                const Score eval = probcut_search(color, depth + 3, ply, bound - 1, bound, hash, reversible);
+                if (eval >= bound) {
+                    return eval;
+                }
+            }
+        }
+        const Score alpha_start = alpha;
+        Score best = -SCORE_INF;
+        move_pos best_move;
+        // Перебираем все возможные ходы
+        for (int i = 0; i < p.count; ++i) {
+            const move_pos mv = p.moves[i];
+            // Вариант прошлой итерации ведёт только через первый ход узла
+            if (i > 0) {
+                follow_pv = false;
+            }
+            // Late move reductions: поздние тихие ходы сначала смотрим на ход мельче
+            const bool reduce = quiet && selective && i >= settings->lmr_moves && remaining >= settings->lmr_depth;
+            const Score eval = search_move(mv, p, color, depth, ply, alpha, beta, hash, quiet, reduce);
+            // Лучший ход узла продолжаем вариантом из дочернего узла
+            if (eval > best) {
+                best = eval;
+                best_move = mv;
+                update_pv(ply, mv);
+            }
+            alpha = max(alpha, best);
+            // Alpha-beta отсечение
+            if (optimization != OptLevel::O0 && alpha >= beta) {
+                if (quiet) {
+                    store_killer(p, mv);
+                }
+                if (cached) {
+                    cache_store(key, ply, remaining, best, SharedCache::LOWER, best_move);
+                }
+                return best;
+            }
+        }
+        if (cached) {
+            cache_store(key, ply, remaining, best, best > alpha_start ? SharedCache::EXACT : SharedCache::UPPER,
+                        best_move);
+        }
+        return best;
+    }
+
+    /**
+     * Применяет ход к копии матрицы доски и возвращает новую матрицу.
+     */
+    static vector<vector<POS_T>> apply_move(const vector<vector<POS_T>>& mtx, const move_pos& mv) {
+        auto copy = mtx;
+        Undo undo;
+        make_step(copy, mv, undo);
+        return copy;
+    }
+
+    // Шаг варианта next продолжает ход prev, если это следующее взятие той же фигурой
+    // (чужая фигура не может начать ход с клетки, где закончилось взятие)
+    static bool continues_turn(const move_pos &prev, const move_pos &next)
+    {
+        return prev.xb != -1 && next.xb != -1 && next.x == prev.x2 && next.y == prev.y2;
+    }
+
+    // Что нужно для отката шага хода
+    struct Undo
+    {
+        POS_T moved = 0;    // фигура до хода (до превращения в дамку)
+        POS_T captured = 0; // побитая фигура
+    };
+
+    // Шаг хода на доске board. Без превращения посреди взятия шашка становится дамкой,
+    // только если серия взятий на последнем ряду закончилась
+    template <class Board> static void make_step(Board &board, const move_pos &mv, Undo &undo)
+    {
+        const POS_T type = board[mv.x][mv.y];
+        undo.moved = type;
+        undo.captured = (mv.xb != -1 ? board[mv.xb][mv.yb] : 0);
+        if (mv.xb != -1)
+            board[mv.xb][mv.yb] = 0;
+        board[mv.x][mv.y] = 0;
+        board[mv.x2][mv.y2] = type;
+        if (promotes(type, mv.x2) && (Rules::promote_in_capture || mv.xb == -1 || !has_beats(board, mv.x2, mv.y2)))
+            board[mv.x2][mv.y2] = type + 2;
+    }
+
+    template <class Board> static void unmake_step(Board &board, const move_pos &mv, const Undo &undo)
+    {
+        board[mv.x2][mv.y2] = 0;
+        board[mv.x][mv.y] = undo.moved;
+        if (mv.xb != -1)
+            board[mv.xb][mv.yb] = undo.captured;
+    }
+
+    // Шашка type, пришедшая на ряд x, становится дамкой: белые на ряду 0, чёрные на последнем
+    static bool promotes(const POS_T type, const POS_T x)
+    {
+        return (type == 1 && x == 0) || (type == 2 && x == N - 1);
+    }
+
+    // Хеш позиции после шага mv по доске после шага и данным отката (очередь хода не меняется)
+    template <class Board>
+    static uint64_t step_hash(uint64_t hash, const Board &after, const move_pos &mv, const Undo &undo)
+    {
+        const Zobrist &z = Zobrist::instance();
+        hash ^= z.piece(mv.x, mv.y, undo.moved);
+        if (mv.xb != -1)
+            hash ^= z.piece(mv.xb, mv.yb, undo.captured);
+        return hash ^ z.piece(mv.x2, mv.y2, after[mv.x2][mv.y2]);
+    }
+
+    // Ходы цвета color на доске board (только взятия, если они есть, с правилом большинства), без перемешивания.
+    // Общий генератор для поиска, MCTS и инструментов; доска после вызова та же
+    template <class Board> static int generate(Board &board, const bool color, move_pos *out, bool &beats)
+    {
+        int n = 0;
+        for (POS_T i = 0; i < N; ++i)
+            for (POS_T j = 0; j < N; ++j)
+                if (board[i][j] && board[i][j] % 2 != color)
+                    n = gen_beats(board, i, j, out, n);
+        beats = (n != 0);
+        if (!beats)
+        {
+            for (POS_T i = 0; i < N; ++i)
+                for (POS_T j = 0; j < N; ++j)
+                    if (board[i][j] && board[i][j] % 2 != color)
+                        n = gen_quiet(board, i, j, out, n);
+        }
+        else if (Rules::capture_majority)
+        {
+            n = keep_longest(board, out, n);
+        }
+        return n;
+    }
+
+    // Ходы фигуры (x, y) на доске board
+    template <class Board>
+    static int generate_piece(Board &board, const POS_T x, const POS_T y, move_pos *out, bool &beats)
+    {
+        int n = gen_beats(board, x, y, out, 0);
+        beats = (n != 0);
+        if (!beats)
+            n = gen_quiet(board, x, y, out, 0);
+        else if (Rules::capture_majority)
+            n = keep_longest(board, out, n);
+        return n;
+    }
+
+    /**
+     * Перебирает ходы стороны color целиком (серия взятий — до конца) на доске board с хешем hash.
+     * На время вызова visit(turn, hash_after, quiet_king) доска стоит в позиции после хода turn;
+     * hash_after — без смены очереди, quiet_king — тихий ход дамкой (продолжает счётчик обратимых ходов)
+     */
+    template <class Board, class Visit>
+    static void for_each_turn(Board &board, const bool color, const uint64_t hash, Visit &&visit)
+    {
+        vector<move_pos> prefix;
+        for_each_turn_from(board, color, -1, -1, hash, prefix, visit);
+    }
+
+    // Продолжения хода prefix фигурой с поля (x, y); x == -1 — начало хода
+    template <class Board, class Visit>
+    static void for_each_turn_from(Board &board, const bool color, const POS_T x, const POS_T y, const uint64_t hash,
+                                   vector<move_pos> &prefix, Visit &visit)
+    {
+        move_pos moves[MAX_TURNS];
+        bool beats;
+        const int n = (x == -1 ? generate(board, color, moves, beats) : generate_piece(board, x, y, moves, beats));
+        if (x != -1 && !beats)
+        {
+            visit(prefix, hash, false);
+            return;
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            const move_pos &mv = moves[i];
+            Undo undo;
+            make_step(board, mv, undo);
+            const uint64_t next_hash = step_hash(hash, board, mv, undo);
+            prefix.push_back(mv);
+            if (!beats)
+                visit(prefix, next_hash, undo.moved > 2);
+            else if (Rules::crowning_ends_move && undo.moved != board[mv.x2][mv.y2])
+                visit(prefix, next_hash, false);
+            else
+                for_each_turn_from(board, color, mv.x2, mv.y2, next_hash, prefix, visit);
+            prefix.pop_back();
+            unmake_step(board, mv, undo);
+        }
+    }
+
+    // Оценивает положение на доске для стороны color (true — чёрные, false — белые) в сотых долях шашки:
+    // материал стороны минус материал соперника (дамка — 4 шашки). potential — учитывать продвижение шашек
+    // (5 за ряд, дамка — 5 шашек). SCORE_WIN — у соперника нет фигур, -SCORE_WIN — нет своих
+    template <class Board>
+    static Score evaluate(const Board &board, const bool color, const bool potential)
+    {
+        int w = 0, wq = 0, b = 0, bq = 0, wp = 0, bp = 0;
+        for (POS_T i = 0; i < N; ++i)
+        {
+            for (POS_T j = 0; j < N; ++j)
+            {
+                w += (board[i][j] == 1);  // белые шашки
+                wq += (board[i][j] == 3); // белые дамки
+                b += (board[i][j] == 2);  // чёрные шашки
+                bq += (board[i][j] == 4); // чёрные дамки
+                // Продвижение шашек: чем ближе к дамке, тем выше оценка
+                wp += (board[i][j] == 1) * (N - 1 - i);
+                bp += (board[i][j] == 2) * i;
+            }
+        }
+        const bool w_none = (w + wq == 0), b_none = (b + bq == 0);
+        // Если выбран режим оценки "NumberAndPotential", учитываем продвижение шашек
+        const Score white = 100 * w + (potential ? 500 : 400) * wq + (potential ? 5 * wp : 0);
+        const Score black = 100 * b + (potential ? 500 : 400) * bq + (potential ? 5 * bp : 0);
+        // Сторона без фигур проиграла
+        if (color ? b_none : w_none)
+            return -SCORE_WIN;
+        if (color ? w_none : b_none)
+            return SCORE_WIN;
+        return color ? black - white : white - black;
+    }
+
+private:
+    // Кладёт позицию на границе хода в путь поиска и снимает её при выходе из узла
+    struct PathGuard
+    {
+        PathGuard(BasicLogic &logic, const bool active, const uint64_t hash, const int reversible)
+            : logic(logic), active(active)
+        {
+            if (active)
+            {
+                logic.path_hashes.push_back(hash);
+                logic.path_reversible.push_back(reversible);
+            }
+        }
+        ~PathGuard()
+        {
+            if (active)
+            {
+                logic.path_hashes.pop_back();
+                logic.path_reversible.pop_back();
+            }
+        }
+        BasicLogic &logic;
+        const bool active;
+    };
+
+    // Уровень стека поиска: всё, что узлу нужно, выделено заранее
+    struct Ply
+    {
+        move_pos moves[MAX_TURNS]; // ходы узла
+        int count = 0;             // число ходов
+        bool beats = false;        // ходы узла — взятия
+        move_pos killers[2];       // тихие ходы, давшие отсечение на этом уровне
+        Score static_eval = 0;     // статическая оценка узла для ходящего (O2)
+        Undo undo;                 // данные для отката текущего хода
+    };
+
+    // Мелкий поиск того же узла для ProbCut с нулевым окном, без вложенных выборочных отсечений.
+    // Идёт на следующем уровне стека, чтобы не затереть ходы узла
+    Score probcut_search(const bool color, const int depth, const int ply, const Score alpha, const Score beta,
+                         const uint64_t hash, const int reversible)
+    {
+        in_probcut = true;
+        probcut_reentry = true;
+        const bool saved_follow = follow_pv;
+        follow_pv = false;
+        const Score eval = find_best_turns_rec(color, depth, ply + 1, alpha, beta, -1, -1, hash, reversible);
+        follow_pv = saved_follow;
+        in_probcut = false;
+        return eval;
+    }
+
+    // Делает шаг mv узла ply, ищет дочерний узел и откатывает шаг; оценка — для color, окно тоже.
+    // quiet — ходы узла тихие, reduce — сначала искать на ход мельче и пересчитать на полную глубину,
+    // если оценка вышла выше alpha
+    Score search_move(const move_pos &mv, Ply &p, const bool color, const int depth, const int ply, const Score alpha,
+                      const Score beta, const uint64_t hash, const bool quiet, const bool reduce)
+    {
+        Score eval = 0;
+        make_move(mv, p.undo);
+        const uint64_t next_hash = step_hash(hash, pos, mv, p.undo);
+        if (quiet) {
+            const int next_rev = next_reversible(mv, p.undo);
+            eval = -find_best_turns_rec(!color, depth + 1 + reduce, ply + 1, -beta, -alpha, -1, -1,
+                                        next_hash ^ Zobrist::instance().side(), next_rev);
+            if (reduce && eval > alpha) {
+                eval = -find_best_turns_rec(!color, depth + 1, ply + 1, -beta, -alpha, -1, -1,
+                                            next_hash ^ Zobrist::instance().side(), next_rev);
+            }
+        } else if (Rules::crowning_ends_move && p.undo.moved != pos[mv.x2][mv.y2]) {
+            // Превращение в дамку заканчивает ход
+            eval = -find_best_turns_rec(!color, depth + 1, ply + 1, -beta, -alpha, -1, -1,
+                                        next_hash ^ Zobrist::instance().side(), 0);
+        } else {
+            // Продолжаем серию взятий: ходит та же сторона
+            eval = find_best_turns_rec(color, depth, ply + 1, alpha, beta, mv.x2, mv.y2, next_hash, 0);
+        }
+        unmake_move(mv, p.undo);
+        return eval;
+    }
+
+    // Готовит поиск: копирует доску, путь поиска (история партии, если она заканчивается корневой позицией,
+    // иначе только корень), сбрасывает ходы-убийцы (keep_killers — оставляет, если корень тот же) и берёт
+    // затравку PV от прошлого поиска. Возвращает хеш корня
+    uint64_t start_search(const vector<vector<POS_T>> &mtx, const bool color, const bool keep_killers = false)
+    {
+        for (POS_T i = 0; i < N; ++i)
+            for (POS_T j = 0; j < N; ++j)
+                pos[i][j] = mtx[i][j];
+        const uint64_t root_hash = Zobrist::instance().hash(mtx, color);
+        in_probcut = false;
+        probcut_reentry = false;
+        path_hashes.clear();
+        path_reversible.clear();
+        if (!history_hashes.empty() && history_hashes.back() == root_hash)
+        {
+            path_hashes = history_hashes;
+            path_reversible = history_reversible;
+        }
+        else
+        {
+            path_hashes.push_back(root_hash);
+            path_reversible.push_back(0);
+        }
+        path_hashes.reserve(path_hashes.size() + MAX_PLY);
+        path_reversible.reserve(path_reversible.size() + MAX_PLY);
+        if (!keep_killers || killers_hash != root_hash)
+            for (auto &p : stack)
+                p.killers[0] = p.killers[1] = move_pos();
+        killers_hash = root_hash;
+        cache_generation = (cache ? cache->new_search() : 0);
+        cache_hits = 0;
+        best_line_len = 0;
+        if (seed_hash != root_hash)
+            seed_len = 0;
+        return root_hash;
+    }
+
+    // Одна итерация поиска из корня. Начинает с варианта прошлой итерации (или затравки),
+    // после завершения делает найденный вариант затравкой следующей
+    Score search_root(const bool color, const uint64_t root_hash)
+    {
+        follow_pv = (seed_len > 0);
+        const Score score = find_best_turns_rec(color, -1, 0, -SCORE_INF, SCORE_INF, -1, -1, root_hash, path_reversible.back());
+        if (!aborted)
+        {
+            best_line_len = pv_len[0];
+            copy(pv_table.begin(), pv_table.begin() + best_line_len, best_line);
+            seed_len = best_line_len;
+            copy(best_line, best_line + best_line_len, seed_line);
+            seed_hash = root_hash;
+        }
+        return score;
+    }
+
+    // После поиска оставляет затравкой продолжение варианта за ответом соперника:
+    // если партия пойдёт по нему, следующий поиск начнёт с него
+    void finish_search(const uint64_t root_hash)
+    {
+        POS_T board[N][N];
+        memcpy(board, pos, sizeof(board));
+        uint64_t hash = root_hash;
+        int turns_done = 0, i = 0;
+        for (; i < best_line_len && turns_done < 2; ++i)
+        {
+            const move_pos &mv = best_line[i];
+            Undo undo;
+            make_step(board, mv, undo);
+            hash = step_hash(hash, board, mv, undo);
+            if (i + 1 == best_line_len || !continues_turn(mv, best_line[i + 1]))
+            {
+                hash ^= Zobrist::instance().side();
+                ++turns_done;
+            }
+        }
+        seed_len = 0;
+        if (turns_done < 2)
+            return;
+        seed_len = best_line_len - i;
+        copy(best_line + i, best_line + best_line_len, seed_line);
+        seed_hash = hash;
+    }
+
+    // Первый ход варианта: шаги одной серии взятий
+    vector<move_pos> first_turn() const
+    {
+        vector<move_pos> res;
+        for (int i = 0; i < best_line_len; ++i)
+        {
+            if (i && !continues_turn(best_line[i - 1], best_line[i]))
+                break;
+            res.push_back(best_line[i]);
+        }
+        return res;
+    }
+
+    // Строка ply таблицы PV: ход mv и вариант дочернего узла
+    void update_pv(const int ply, const move_pos &mv)
+    {
+        move_pos *row = &pv_table[ply * MAX_PLY];
+        const move_pos *child = &pv_table[(ply + 1) * MAX_PLY];
+        row[ply] = mv;
+        for (int i = ply + 1; i < pv_len[ply + 1]; ++i)
+            row[i] = child[i];
+        pv_len[ply] = max(pv_len[ply + 1], ply + 1);
+    }
+
+    // Порядок ходов: ход варианта прошлой итерации, лучший ход из общего кеша, затем ходы-убийцы,
+    // остальные как сгенерированы
+    void order_turns(Ply &p, const int ply, const bool quiet, const move_pos &cache_move)
+    {
+        int front = 0;
+        if (follow_pv)
+        {
+            follow_pv = false;
+            for (int i = 0; ply < seed_len && i < p.count; ++i)
+            {
+                if (p.moves[i] == seed_line[ply])
+                {
+                    swap(p.moves[0], p.moves[i]);
+                    front = 1;
+                    follow_pv = true;
+                    break;
+                }
+            }
+        }
+        for (int i = front; cache_move.x != -1 && i < p.count; ++i)
+        {
+            if (p.moves[i] == cache_move)
+            {
+                swap(p.moves[front++], p.moves[i]);
+                break;
+            }
+        }
+        if (!quiet)
+            return;
+        for (const auto &killer : p.killers)
+        {
+            for (int i = front; i < p.count; ++i)
+            {
+                if (p.moves[i] == killer)
+                {
+                    swap(p.moves[front++], p.moves[i]);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Ключ общего кеша: позиция, счётчик обратимых ходов (если правило включено) и настройки поиска
+    uint64_t cache_key(const uint64_t hash, const int reversible) const
+    {
+        const int r = (settings->no_progress_turns ? reversible : 0);
+        return hash ^ (uint64_t(r + 1) * 0x9E3779B97F4A7C15ull) ^ cache_salt;
+    }
+
+    static uint64_t mix_salt(const uint64_t salt, const uint64_t value)
+    {
+        return (salt ^ value) * 0xBF58476D1CE4E5B9ull + 0x94D049BB133111EBull;
+    }
+
+    // Оценка прерванного поиска случайна — в кеш её не пишем
+    void cache_store(const uint64_t key, const int ply, const int remaining, const Score score,
+                     const SharedCache::Bound bound, const move_pos &mv)
+    {
+        if (!aborted)
+            cache->store(key, pack_score(score, ply), remaining, bound, mv, cache_generation);
+    }
+
+    static void store_killer(Ply &p, const move_pos &mv)
+    {
+        if (p.killers[0] != mv)
+        {
+            p.killers[1] = p.killers[0];
+            p.killers[0] = mv;
+        }
+    }
+
+    // Повторение позиции из пути поиска или истории партии (при той же очереди хода)
+    // либо NoProgressTurns обратимых ходов подряд — ничья
+    bool is_draw(const uint64_t hash, const int reversible) const
+    {
+        if (settings->no_progress_turns && reversible >= settings->no_progress_turns)
+            return true;
+        if (!settings->repetition_draw)
+            return false;
+        const int size = int(path_hashes.size());
+        for (int back = 2; back <= reversible && back <= size; back += 2)
+        {
+            if (path_hashes[size - back] == hash)
+                return true;
+        }
+        return false;
+    }
+
+    // Делает ход на доске поиска, запоминая в undo, что нужно для отката
+    void make_move(const move_pos &mv, Undo &undo)
+    {
+        make_step(pos, mv, undo);
+    }
+
+    void unmake_move(const move_pos &mv, const Undo &undo)
+    {
+        unmake_step(pos, mv, undo);
+    }
+
+    // Счётчик обратимых ходов после тихого хода mv: тихий ход дамкой продолжает серию, ход шашкой её обнуляет
+    int next_reversible(const move_pos &mv, const Undo &undo) const
+    {
+        return (mv.xb == -1 && undo.moved > 2) ? path_reversible.back() + 1 : 0;
+    }
+
+    // Оценка доски поиска для ходящего color на уровне ply в текущем режиме оценки
+    // (сторона без фигур проиграла на этом уровне)
+    Score calc_score(const bool color, const int ply) const
+    {
+        const Score score = evaluate(pos, color, scoring_mode == ScoringMode::NumberAndPotential);
+        if (score == SCORE_WIN)
+            return win_in(ply);
+        if (score == -SCORE_WIN)
+            return loss_in(ply);
+        return score;
+    }
+
+    // Проверяет ограничения поиска; проверка времени — раз в 1024 узла
+    bool out_of_limits()
+    {
+        if (!can_abort)
+            return false;
+        if (aborted)
+            return true;
+        if ((limits.nodes && nodes >= limits.nodes) || (limits.stop && limits.stop->load(memory_order_relaxed)) ||
+            ((nodes & 1023) == 0 && chrono::steady_clock::now() >= limits.deadline))
+            aborted = true;
+        return aborted;
+    }
+
+    // Ходы всех фигур цвета color в уровень стека p (только взятия, если они есть)
+    void gen_turns(const bool color, Ply &p)
+    {
+        p.count = generate(pos, color, p.moves, p.beats);
+        shuffle(p.moves, p.moves + p.count, rand_eng);
+    }
+
+    // Ходы фигуры (x, y) в уровень стека p
+    void gen_piece_turns(const POS_T x, const POS_T y, Ply &p)
+    {
+        p.count = generate_piece(pos, x, y, p.moves, p.beats);
+    }
+
+    // Дописывает в out взятия фигуры (x, y), возвращает новое число ходов
+    template <class Board> static int gen_beats(const Board &mtx, const POS_T x, const POS_T y, move_pos *out, int n)
+    {
+        const POS_T type = mtx[x][y];
+        for (int d = 0; d < 4; ++d)
+        {
+            const auto *ray = rays.at(x, y, d);
+            const int len = rays.len(x, y, d);
+            if (type <= 2 || !Rules::flying_kings)
+            {
+                // шашка (и недальнобойная дамка) бьёт соседнюю фигуру, приземляясь на поле за ней;
+                // без взятия назад шашка бьёт только к своему последнему ряду
+                if (len < 2 || (!Rules::men_capture_back && type <= 2 && (type == 1) != (d < 2)))
+                    continue;
+                const POS_T victim = mtx[ray[0].x][ray[0].y];
+                if (mtx[ray[1].x][ray[1].y] || !victim || victim % 2 == type % 2 || n >= MAX_TURNS)
+                    continue;
+                out[n++] = move_pos(x, y, ray[1].x, ray[1].y, ray[0].x, ray[0].y);
+                continue;
+            }
+            // дальнобойная дамка: пропускаем пустые поля до первой фигуры,
+            // если она чужая — приземляемся на любое пустое поле за ней
+            int k = 0;
+            while (k < len && !mtx[ray[k].x][ray[k].y])
+                ++k;
+            if (k + 1 >= len || mtx[ray[k].x][ray[k].y] % 2 == type % 2)
+                continue;
+            const auto victim = ray[k++];
+            for (; k < len && !mtx[ray[k].x][ray[k].y] && n < MAX_TURNS; ++k)
+                out[n++] = move_pos(x, y, ray[k].x, ray[k].y, victim.x, victim.y);
+        }
+        return n;
+    }
+
+    // Дописывает в out тихие ходы фигуры (x, y), возвращает новое число ходов
+    template <class Board> static int gen_quiet(const Board &mtx, const POS_T x, const POS_T y, move_pos *out, int n)
+    {
+        const POS_T type = mtx[x][y];
+        for (int d = 0; d < 4; ++d)
+        {
+            const auto *ray = rays.at(x, y, d);
+            const int len = rays.len(x, y, d);
+            if (type <= 2 || !Rules::flying_kings)
+            {
+                // шашка ходит на поле вперёд, недальнобойная дамка — на соседнее поле в любую сторону
+                if (!len || (type <= 2 && (type == 1) != (d < 2)) || mtx[ray[0].x][ray[0].y] || n >= MAX_TURNS)
+                    continue;
+                out[n++] = move_pos(x, y, ray[0].x, ray[0].y);
+                continue;
+            }
+            // дальнобойная дамка — на любое пустое поле до первой фигуры
+            for (int k = 0; k < len && !mtx[ray[k].x][ray[k].y] && n < MAX_TURNS; ++k)
+                out[n++] = move_pos(x, y, ray[k].x, ray[k].y);
+        }
+        return n;
+    }
+
+    template <class Board> static bool has_beats(const Board &board, const POS_T x, const POS_T y)
+    {
+        move_pos buf[MAX_TURNS];
+        return gen_beats(board, x, y, buf, 0) != 0;
+    }
+
+    // Правило большинства: оставляет взятия, с которых начинается самая длинная серия
+    template <class Board> static int keep_longest(Board &board, move_pos *moves, const int n)
+    {
+        int len[MAX_TURNS], best = 0, kept = 0;
+        for (int i = 0; i < n; ++i)
+            best = max(best, len[i] = chain_length(board, moves[i]));
+        for (int i = 0; i < n; ++i)
+            if (len[i] == best)
+                moves[kept++] = moves[i];
+        return kept;
+    }
+
+    // Число взятий в самой длинной серии, начинающейся взятием mv
+    template <class Board> static int chain_length(Board &board, const move_pos &mv)
+    {
+        Undo undo;
+        make_step(board, mv, undo);
+        move_pos next[MAX_TURNS];
+        const int n = gen_beats(board, mv.x2, mv.y2, next, 0);
+        int best = 0;
+        for (int i = 0; i < n; ++i)
+            best = max(best, chain_length(board, next[i]));
+        unmake_step(board, mv, undo);
+        return best + 1;
+    }
+
+public:
+    // Поиск всех возможных ходов для заданного цвета на переданной матрице доски
+    void find_turns(const bool color, const vector<vector<POS_T>> &mtx)
+    {
+        TRACE_SCOPE("find_turns", "movegen");
+        move_pos buf[MAX_TURNS];
+        int n = 0;
+        for (POS_T i = 0; i < N; ++i)
+            for (POS_T j = 0; j < N; ++j)
+                if (mtx[i][j] && mtx[i][j] % 2 != color)
+                    n = gen_beats(mtx, i, j, buf, n);
+        have_beats = (n != 0);
+        if (!have_beats)
+        {
+            for (POS_T i = 0; i < N; ++i)
+                for (POS_T j = 0; j < N; ++j)
+                    if (mtx[i][j] && mtx[i][j] % 2 != color)
+                        n = gen_quiet(mtx, i, j, buf, n);
+        }
+        else if (Rules::capture_majority)
+        {
+            auto board = mtx;
+            n = keep_longest(board, buf, n);
+        }
+        turns.assign(buf, buf + n);
+        shuffle(turns.begin(), turns.end(), rand_eng);
+    }
+
+    // Поиск всех возможных ходов для фигуры по координатам (x, y) на переданной матрице доски
+    void find_turns(const POS_T x, const POS_T y, const vector<vector<POS_T>> &mtx)
+    {
+        TRACE_SCOPE("find_turns", "movegen");
+        move_pos buf[MAX_TURNS];
+        int n = gen_beats(mtx, x, y, buf, 0);
+        have_beats = (n != 0);
+        if (!have_beats)
+        {
+            n = gen_quiet(mtx, x, y, buf, 0);
+        }
+        else if (Rules::capture_majority)
+        {
+            auto board = mtx;
+            n = keep_longest(board, buf, n);
+        }
+        turns.assign(buf, buf + n);
+    }
+
+  public:
+    vector<move_pos> turns; // список возможных ходов для текущего состояния
+    bool have_beats;       // есть ли обязательные взятия среди возможных ходов
+    int Max_depth = 0;     // максимальная глубина поиска для бота
+
+  private:
+    default_random_engine rand_eng; // генератор случайных чисел для перемешивания ходов и случайности бота
+    shared_ptr<const Settings> settings; // снимок настроек, с которым работает поиск
+    ScoringMode scoring_mode;            // режим оценки позиции
+    OptLevel optimization;               // уровень оптимизации поиска
+    POS_T pos[N][N];                 // доска поиска, ходы делаются и откатываются на ней
+    vector<Ply> stack;               // стек поиска по уровням, выделяется в конструкторе
+    vector<move_pos> pv_table;       // треугольная таблица PV: строка ply — вариант из узла уровня ply
+    int pv_len[MAX_PLY];             // конец варианта в строке ply
+    move_pos best_line[MAX_PLY];     // вариант последней завершённой итерации
+    int best_line_len = 0;
+    move_pos seed_line[MAX_PLY];     // вариант, с которого начинается следующая итерация или следующий поиск
+    int seed_len = 0;
+    uint64_t seed_hash = 0;          // хеш позиции, к которой относится seed_line
+    uint64_t killers_hash = 0;       // хеш корня, от поиска которого остались ходы-убийцы
+    bool follow_pv = false;          // узел лежит на варианте seed_line
+    vector<uint64_t> history_hashes; // хеши позиций партии на границах ходов
+    vector<int> history_reversible;  // число обратимых ходов подряд, приведших к позиции истории
+    vector<uint64_t> path_hashes;    // история партии и путь текущего поиска
+    vector<int> path_reversible;     // счётчики обратимых ходов для path_hashes
+    bool in_probcut = false;         // идёт мелкий поиск ProbCut
+    bool probcut_reentry = false;    // следующий вызов — повторный вход в узел для ProbCut
+    SearchLimits limits;            // ограничения текущего поиска
+    uint64_t nodes = 0;             // счётчик узлов текущего поиска
+    bool can_abort = false;         // можно ли прерывать поиск (после первой завершённой итерации)
+    bool aborted = false;           // поиск прерван по ограничениям
+    const SettingsStore *config;    // источник снимков настроек
+    shared_ptr<SharedCache> cache;  // общий кеш оценок (SharedCacheMB), nullptr — выключен
+    unsigned int cache_mb = 0;      // с какими настройками подключён cache
+    string cache_name;
+    string cache_error;             // ошибка подключения к кешу
+    uint64_t cache_salt = 0;        // настройки поиска в ключе кеша
+    uint8_t cache_generation = 0;   // поколение записей текущего поиска
+    uint64_t cache_hits = 0;        // узлов текущего поиска, оценённых по кешу
+};
+
+using Logic = BasicLogic<RussianRules>;
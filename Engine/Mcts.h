@@ -0,0 +1,338 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Logic.h"
+
+using namespace std;
+
+// Поиск Монте-Карло по дереву (UCT) — второй алгоритм бота.
+// Узел дерева — позиция на границе хода, ребро — ход целиком (с серией взятий).
+// Потоки спускаются по общему дереву (tree parallelism); пока симуляция идёт, её путь помечен
+// виртуальными потерями, чтобы другие потоки шли в другие ветви. Лист расширяется со второго посещения,
+// оценка листа — короткая случайная симуляция и оценка материала Logic::evaluate.
+// Между ходами дерево сохраняется: если новая позиция есть в нём (после своего хода и ответа соперника),
+// поиск продолжается с её поддерева. Размер дерева ограничен MctsTreeMB: когда узлы кончились, листья больше
+// не расширяются, и симуляции продолжаются от листьев уже построенного дерева
+template <class Rules> class BasicMcts
+{
+    static constexpr POS_T N = Rules::size;
+    using Engine = BasicLogic<Rules>;
+    static const int VIRTUAL_LOSS = 3;   // виртуальных посещений без выигрыша на время симуляции
+    static const int SCALE = 1000;       // результаты копятся в тысячных
+    static const int PLAYOUT_BATCH = 64; // симуляций в пачке
+
+    struct Node
+    {
+        vector<move_pos> turn;         // ход, ведущий в узел
+        uint64_t hash = 0;             // хеш позиции с очередью хода
+        bool color = false;            // кто ходит в узле
+        int reversible = 0;            // ходов подряд без взятий и ходов шашками
+        atomic<int> visits{0};         // посещения, включая виртуальные потери
+        atomic<int64_t> score{0};      // сумма результатов (в тысячных) для стороны, сделавшей ход turn
+        atomic<bool> expanded{false};  // children заполнен и больше не меняется
+        mutex expand_mtx;
+        vector<unique_ptr<Node>> children;
+    };
+    // Оценка памяти узла: сам узел, указатель на него у родителя, ход в куче и накладные расходы кучи
+    static const size_t NODE_BYTES = sizeof(Node) + 80;
+
+  public:
+    explicit BasicMcts(const SettingsStore *config) : config(config)
+    {
+    }
+
+    /**
+     * Ищет ход для стороны color в позиции mtx. Бюджет — limits.deadline, limits.nodes (число симуляций)
+     * и limits.stop; без ограничений берутся MctsTimeMS и MctsPlayouts из настроек.
+     * reversible — сколько ходов подряд в партии сделано без взятий и ходов шашками (для NoProgressTurns).
+     * Возвращает ход с наибольшим числом посещений (шаги серии взятий), пустой — если ходов нет
+     */
+    vector<move_pos> search(const vector<vector<POS_T>> &mtx, const bool color, SearchLimits limits = SearchLimits(),
+                            const int reversible = 0)
+    {
+        TRACE_SCOPE_NAMED(trace, "mcts", "search");
+        settings = config->snapshot();
+        if (limits.deadline == chrono::steady_clock::time_point::max() && !limits.nodes)
+        {
+            if (settings->mcts_time_ms)
+                limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(settings->mcts_time_ms);
+            limits.nodes = settings->mcts_playouts;
+        }
+        for (POS_T i = 0; i < N; ++i)
+            for (POS_T j = 0; j < N; ++j)
+                root_board[i][j] = mtx[i][j];
+        max_nodes = max<size_t>(1, size_t(settings->mcts_tree_mb) * 1024 * 1024 / NODE_BYTES);
+        reuse_root(Zobrist::instance().hash(mtx, color), color, reversible);
+        expand(root.get(), root_board, true);
+        playouts_done = 0;
+        const unsigned int hw = max(1u, thread::hardware_concurrency());
+        const unsigned int threads = settings->mcts_threads ? settings->mcts_threads : hw;
+        const unsigned int seed = settings->no_random ? 0 : unsigned(time(0));
+        vector<thread> workers;
+        for (unsigned int t = 1; t < threads; ++t)
+            workers.emplace_back(&BasicMcts::worker, this, limits, seed + t);
+        worker(limits, seed);
+        for (auto &w : workers)
+            w.join();
+        TRACE_ARG(trace, "playouts", playouts_done.load());
+        // Надёжный выбор: ход с наибольшим числом посещений
+        const Node *best = nullptr;
+        for (const auto &child : root->children)
+            if (!best || child->visits.load() > best->visits.load())
+                best = child.get();
+        return best ? best->turn : vector<move_pos>();
+    }
+
+    // Число симуляций последнего поиска
+    uint64_t playouts() const
+    {
+        return playouts_done.load();
+    }
+
+    // Доля выигрышей лучшего хода последнего поиска для ходящей стороны
+    double best_value() const
+    {
+        const Node *best = nullptr;
+        for (const auto &child : root->children)
+            if (!best || child->visits.load() > best->visits.load())
+                best = child.get();
+        return best && best->visits.load() ? double(best->score.load()) / SCALE / best->visits.load() : 0.5;
+    }
+
+    // Число узлов дерева после последнего поиска
+    size_t tree_nodes() const
+    {
+        return nodes_count.load();
+    }
+
+    // Забывает дерево (новая партия)
+    void clear()
+    {
+        root.reset();
+        nodes_count = 0;
+    }
+
+  private:
+    // Новый корень: поддерево старого дерева с той же позицией и тем же счётчиком обратимых ходов
+    // (на глубине до двух ходов) или пустой узел
+    void reuse_root(const uint64_t hash, const bool color, const int reversible)
+    {
+        const auto same = [&](const Node &node) {
+            return node.hash == hash && node.color == color && node.reversible == reversible;
+        };
+        if (root && !same(*root))
+        {
+            unique_ptr<Node> found;
+            for (auto &child : root->children)
+            {
+                if (same(*child))
+                    found = move(child);
+                for (size_t k = 0; !found && child && k < child->children.size(); ++k)
+                {
+                    auto &grandchild = child->children[k];
+                    if (same(*grandchild))
+                        found = move(grandchild);
+                }
+                if (found)
+                    break;
+            }
+            root = move(found);
+        }
+        if (!root)
+        {
+            root = make_unique<Node>();
+            root->hash = hash;
+            root->color = color;
+            root->reversible = reversible;
+        }
+        // Пересчитываем узлы оставшегося поддерева
+        size_t count = 0;
+        vector<const Node *> stack{root.get()};
+        while (!stack.empty())
+        {
+            const Node *node = stack.back();
+            stack.pop_back();
+            ++count;
+            for (const auto &child : node->children)
+                stack.push_back(child.get());
+        }
+        nodes_count = count;
+    }
+
+    void worker(const SearchLimits limits, const unsigned int seed)
+    {
+        mt19937 rng(seed);
+        POS_T board[N][N];
+        vector<Node *> path;
+        bool running = true;
+        while (running)
+        {
+            // Симуляции идут пачками: в трассе одно событие на пачку
+            TRACE_SCOPE_NAMED(batch, "playouts", "search");
+            int k = 0;
+            while (k < PLAYOUT_BATCH && (running = take_playout(limits)))
+            {
+                memcpy(board, root_board, sizeof(board));
+                playout(board, path, rng);
+                ++k;
+            }
+            TRACE_ARG(batch, "playouts", k);
+        }
+    }
+
+    // Можно ли начать ещё одну симуляцию; если да, она учтена в playouts_done
+    bool take_playout(const SearchLimits &limits)
+    {
+        if ((limits.stop && limits.stop->load(memory_order_relaxed)) || chrono::steady_clock::now() >= limits.deadline)
+            return false;
+        if (playouts_done.fetch_add(1) >= limits.nodes && limits.nodes)
+        {
+            playouts_done.fetch_sub(1);
+            return false;
+        }
+        return true;
+    }
+
+    // Одна симуляция: спуск по UCT, расширение, оценка листа и обратное распространение
+    void playout(POS_T (&board)[N][N], vector<Node *> &path, mt19937 &rng)
+    {
+        path.clear();
+        Node *node = root.get();
+        node->visits.fetch_add(VIRTUAL_LOSS);
+        path.push_back(node);
+        bool first_visit = false;
+        while (node->expanded.load(memory_order_acquire) && !node->children.empty())
+        {
+            node = select(node);
+            first_visit = (node->visits.fetch_add(VIRTUAL_LOSS) == 0);
+            for (const auto &mv : node->turn)
+            {
+                typename Engine::Undo undo;
+                Engine::make_step(board, mv, undo);
+            }
+            path.push_back(node);
+            if (first_visit)
+                break;
+        }
+        // Результат для стороны, которая ходит в листе
+        double value;
+        if (settings->no_progress_turns && node->reversible >= settings->no_progress_turns)
+        {
+            value = 0.5;
+        }
+        else
+        {
+            if (!first_visit)
+                expand(node, board);
+            value = (node->expanded.load(memory_order_acquire) && node->children.empty())
+                        ? 0.0
+                        : rollout(board, node->color, rng);
+        }
+        for (Node *n : path)
+        {
+            n->score.fetch_add(int64_t(SCALE * (n->color == node->color ? 1.0 - value : value)));
+            n->visits.fetch_add(1 - VIRTUAL_LOSS);
+        }
+    }
+
+    // UCT: средний результат хода плюс бонус за редкие посещения; непосещённые ходы — первыми
+    Node *select(Node *node) const
+    {
+        const double log_parent = log(double(max(1, node->visits.load())));
+        Node *best = nullptr;
+        double best_uct = -1;
+        for (const auto &child : node->children)
+        {
+            const int visits = child->visits.load(memory_order_relaxed);
+            if (!visits)
+                return child.get();
+            const double uct = double(child->score.load(memory_order_relaxed)) / SCALE / visits +
+                               settings->mcts_exploration * sqrt(log_parent / visits);
+            if (uct > best_uct)
+            {
+                best_uct = uct;
+                best = child.get();
+            }
+        }
+        return best;
+    }
+
+    // Заполняет детей узла всеми ходами из позиции board; расширяет один поток, остальные ждут на мьютексе.
+    // Когда дерево достигло MctsTreeMB, узел остаётся листом (корень расширяется всегда)
+    void expand(Node *node, POS_T (&board)[N][N], const bool force = false)
+    {
+        if (node->expanded.load(memory_order_acquire) || (!force && nodes_count.load(memory_order_relaxed) >= max_nodes))
+            return;
+        lock_guard<mutex> lock(node->expand_mtx);
+        if (node->expanded.load(memory_order_relaxed))
+            return;
+        Engine::for_each_turn(board, node->color, node->hash,
+                              [&](const vector<move_pos> &turn, const uint64_t hash, const bool quiet_king) {
+                                  add_child(node, turn, hash, quiet_king);
+                              });
+        nodes_count.fetch_add(node->children.size(), memory_order_relaxed);
+        node->expanded.store(true, memory_order_release);
+    }
+
+    // Добавляет ход turn в дети узла; тихий ход дамкой продолжает счётчик обратимых ходов
+    void add_child(Node *node, const vector<move_pos> &turn, const uint64_t hash, const bool quiet_king)
+    {
+        auto child = make_unique<Node>();
+        child->turn = turn;
+        child->hash = hash ^ Zobrist::instance().side();
+        child->color = !node->color;
+        child->reversible = quiet_king ? node->reversible + 1 : 0;
+        node->children.push_back(move(child));
+    }
+
+    // Случайная симуляция на mcts_playout_turns ходов и оценка материала для стороны color
+    double rollout(POS_T (&board)[N][N], const bool color, mt19937 &rng) const
+    {
+        move_pos moves[MAX_TURNS];
+        bool side = color;
+        for (int t = 0; t < settings->mcts_playout_turns; ++t)
+        {
+            bool beats;
+            int n = Engine::generate(board, side, moves, beats);
+            if (!n)
+                return side == color ? 0.0 : 1.0;
+            move_pos mv = moves[rng() % n];
+            while (true)
+            {
+                typename Engine::Undo undo;
+                Engine::make_step(board, mv, undo);
+                if (!beats || (Rules::crowning_ends_move && undo.moved != board[mv.x2][mv.y2]))
+                    break;
+                n = Engine::generate_piece(board, mv.x2, mv.y2, moves, beats);
+                if (!beats)
+                    break;
+                mv = moves[rng() % n];
+            }
+            side = !side;
+        }
+        // Разницу материала (в сотых долях шашки) переводим в ожидаемый результат логистической кривой:
+        // лишняя шашка — около 0.56, три — около 0.68
+        const Score score = Engine::evaluate(board, color, settings->scoring == ScoringMode::NumberAndPotential);
+        if (is_decisive(score))
+            return score > 0 ? 1.0 : 0.0;
+        return 1 / (1 + exp(-score / 400.0));
+    }
+
+    const SettingsStore *config;         // источник снимков настроек
+    shared_ptr<const Settings> settings; // снимок настроек текущего поиска
+    unique_ptr<Node> root;               // корень дерева, переживает поиск ради повторного использования
+    POS_T root_board[N][N];              // позиция корня
+    atomic<uint64_t> playouts_done{0};
+    atomic<size_t> nodes_count{0}; // узлов в дереве
+    size_t max_nodes = 0;          // предел узлов по MctsTreeMB
+};
+
+using Mcts = BasicMcts<RussianRules>;
@@ -0,0 +1,237 @@
+#pragma once
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Logic.h"
+#include "../Models/Move.h"
+
+// Текстовая нотация позиций и ходов для консольных инструментов.
+// Клетки: буква a-h — столбец (y), цифра 1-8 — ряд (8 - x), белые внизу, как в русских шашках.
+// Позиция: 32 символа по тёмным клеткам сверху вниз, слева направо
+// ('w'/'b' — шашки, 'W'/'B' — дамки, '.' — пусто), затем через пробел ходящий: 'w' или 'b'.
+// Ход: "c3-d4" — тихий ход, "c3:e5:c7" — серия взятий.
+
+// Стартовая расстановка (1 - белые, 2 - чёрные, как в Board)
+inline vector<vector<POS_T>> start_position()
+{
+    return initial_position<RussianRules>();
+}
+
+inline string square_to_string(const POS_T x, const POS_T y)
+{
+    return string(1, char('a' + y)) + char('1' + (7 - x));
+}
+
+inline bool parse_square(const string &s, POS_T &x, POS_T &y)
+{
+    if (s.size() != 2 || s[0] < 'a' || s[0] > 'h' || s[1] < '1' || s[1] > '8')
+        return false;
+    y = POS_T(s[0] - 'a');
+    x = POS_T(7 - (s[1] - '1'));
+    return true;
+}
+
+// Записывает ход целиком (с серией взятий)
+inline string turn_to_string(const vector<move_pos> &turn)
+{
+    if (turn.empty())
+        return "none";
+    string res = square_to_string(turn[0].x, turn[0].y);
+    for (const auto &mv : turn)
+        res += (mv.xb != -1 ? ":" : "-") + square_to_string(mv.x2, mv.y2);
+    return res;
+}
+
+// Делит вариант (шаги ходов обеих сторон подряд, как в SearchInfo::pv) на ходы
+inline vector<vector<move_pos>> split_line(const vector<move_pos> &line)
+{
+    vector<vector<move_pos>> res;
+    for (size_t i = 0; i < line.size(); ++i)
+    {
+        if (!i || !Logic::continues_turn(line[i - 1], line[i]))
+            res.emplace_back();
+        res.back().push_back(line[i]);
+    }
+    return res;
+}
+
+// Записывает вариант ходами через пробел
+inline string line_to_string(const vector<move_pos> &line)
+{
+    string res;
+    for (const auto &turn : split_line(line))
+        res += (res.empty() ? "" : " ") + turn_to_string(turn);
+    return res.empty() ? "none" : res;
+}
+
+inline string position_to_string(const vector<vector<POS_T>> &mtx, const bool color)
+{
+    static const char symbols[] = ".wbWB";
+    string res;
+    for (POS_T i = 0; i < 8; ++i)
+        for (POS_T j = 0; j < 8; ++j)
+            if ((i + j) % 2 == 1)
+                res += symbols[mtx[i][j]];
+    return res + ' ' + (color ? 'b' : 'w');
+}
+
+// Разбирает позицию из 32 символов клеток и ходящей стороны
+inline bool parse_position(const string &squares, const string &side, vector<vector<POS_T>> &mtx, bool &color)
+{
+    if (squares.size() != 32 || (side != "w" && side != "b"))
+        return false;
+    vector<vector<POS_T>> res(8, vector<POS_T>(8, 0));
+    size_t k = 0;
+    for (POS_T i = 0; i < 8; ++i)
+    {
+        for (POS_T j = 0; j < 8; ++j)
+        {
+            if ((i + j) % 2 == 0)
+                continue;
+            switch (squares[k++])
+            {
+            case '.':
+                break;
+            case 'w':
+                res[i][j] = 1;
+                break;
+            case 'b':
+                res[i][j] = 2;
+                break;
+            case 'W':
+                res[i][j] = 3;
+                break;
+            case 'B':
+                res[i][j] = 4;
+                break;
+            default:
+                return false;
+            }
+        }
+    }
+    mtx = res;
+    color = (side == "b");
+    return true;
+}
+
+// Разбирает ход в нотации и проверяет его по генератору ходов logic.
+// Ход обязан быть полным: серия взятий продолжается, пока есть взятия
+inline bool parse_turn(Logic &logic, const string &text, const vector<vector<POS_T>> &mtx, const bool color,
+                       vector<move_pos> &turn)
+{
+    vector<POS_T> xs, ys;
+    string sq;
+    for (size_t i = 0; i <= text.size(); ++i)
+    {
+        if (i == text.size() || text[i] == '-' || text[i] == ':' || text[i] == 'x')
+        {
+            POS_T x, y;
+            if (!parse_square(sq, x, y))
+                return false;
+            xs.push_back(x);
+            ys.push_back(y);
+            sq.clear();
+        }
+        else
+            sq += text[i];
+    }
+    if (xs.size() < 2)
+        return false;
+    turn.clear();
+    auto cur = mtx;
+    logic.find_turns(color, cur);
+    for (size_t k = 1; k < xs.size(); ++k)
+    {
+        if (k > 1)
+        {
+            logic.find_turns(xs[k - 1], ys[k - 1], cur);
+            if (!logic.have_beats)
+                return false;
+        }
+        bool found = false;
+        for (const auto &mv : logic.turns)
+        {
+            if (mv.x == xs[k - 1] && mv.y == ys[k - 1] && mv.x2 == xs[k] && mv.y2 == ys[k])
+            {
+                turn.push_back(mv);
+                cur = logic.apply_move(cur, mv);
+                found = true;
+                break;
+            }
+        }
+        if (!found || (k > 1 && turn.back().xb == -1))
+            return false;
+    }
+    // Серия взятий не может обрываться раньше времени
+    if (turn.back().xb != -1)
+    {
+        logic.find_turns(turn.back().x2, turn.back().y2, cur);
+        if (logic.have_beats)
+            return false;
+    }
+    return true;
+}
+
+// Применяет ход целиком к матрице
+inline vector<vector<POS_T>> apply_turn(const Logic &logic, vector<vector<POS_T>> mtx, const vector<move_pos> &turn)
+{
+    for (const auto &mv : turn)
+        mtx = logic.apply_move(mtx, mv);
+    return mtx;
+}
+
+// Дописывает в res ходы, продолжающие prefix с поля (x, y); x == -1 — начало хода
+inline void collect_turns(Logic &logic, const vector<vector<POS_T>> &cur, const bool color, const POS_T x,
+                          const POS_T y, vector<move_pos> &prefix, vector<string> &res)
+{
+    if (x == -1)
+        logic.find_turns(color, cur);
+    else
+        logic.find_turns(x, y, cur);
+    if (x != -1 && !logic.have_beats)
+    {
+        res.push_back(turn_to_string(prefix));
+        return;
+    }
+    const auto turns = logic.turns;
+    const bool beats = logic.have_beats;
+    for (const auto &mv : turns)
+    {
+        prefix.push_back(mv);
+        if (beats)
+            collect_turns(logic, Logic::apply_move(cur, mv), color, mv.x2, mv.y2, prefix, res);
+        else
+            res.push_back(turn_to_string(prefix));
+        prefix.pop_back();
+    }
+}
+
+// Все легальные ходы стороны color целиком (серии взятий разворачиваются до конца)
+inline vector<string> legal_turns(Logic &logic, const vector<vector<POS_T>> &mtx, const bool color)
+{
+    vector<string> res;
+    vector<move_pos> prefix;
+    collect_turns(logic, mtx, color, -1, -1, prefix, res);
+    return res;
+}
+
+// Разбирает вариант из ходов через пробел (как line_to_string), начиная с позиции mtx, в шаги line.
+// Разбор останавливается на первом нелегальном ходе; false — если такой ход был
+inline bool parse_line(Logic &logic, const string &text, vector<vector<POS_T>> mtx, bool color,
+                       vector<move_pos> &line)
+{
+    line.clear();
+    istringstream in(text);
+    string word;
+    vector<move_pos> turn;
+    while (in >> word)
+    {
+        if (!parse_turn(logic, word, mtx, color, turn))
+            return false;
+        line.insert(line.end(), turn.begin(), turn.end());
+        mtx = apply_turn(logic, mtx, turn);
+        color = !color;
+    }
+    return true;
+}
@@ -0,0 +1,248 @@
+#pragma once
+#include <cstdint>
+#include <ctime>
+#include <istream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Logic.h"
+#include "Notation.h"
+
+// Результат партии. Значения совпадают с res в Game::play: 0 — ничья, 1 — победа белых, 2 — победа чёрных
+enum class GameResult : uint8_t
+{
+    Draw = 0,
+    WhiteWin = 1,
+    BlackWin = 2,
+    Unknown = 3
+};
+
+// Партия: теги PDN, ходы целиком (с сериями взятий) от стартовой позиции и результат
+struct GameRecord
+{
+    vector<pair<string, string>> tags; // теги PDN, кроме Result и GameType
+    vector<vector<move_pos>> turns;
+    GameResult result = GameResult::Unknown;
+};
+
+inline string result_to_pdn(const GameResult result)
+{
+    switch (result)
+    {
+    case GameResult::Draw:
+        return "1/2-1/2";
+    case GameResult::WhiteWin:
+        return "1-0";
+    case GameResult::BlackWin:
+        return "0-1";
+    default:
+        return "*";
+    }
+}
+
+// Разбирает токен результата, в том числе варианты "2-0"/"0-2"/"1-1", принятые в шашечном PDN
+inline bool pdn_to_result(const string &token, GameResult &result)
+{
+    if (token == "1-0" || token == "2-0")
+        result = GameResult::WhiteWin;
+    else if (token == "0-1" || token == "0-2")
+        result = GameResult::BlackWin;
+    else if (token == "1/2-1/2" || token == "1-1")
+        result = GameResult::Draw;
+    else if (token == "*")
+        result = GameResult::Unknown;
+    else
+        return false;
+    return true;
+}
+
+// Записывает партию в PDN (GameType 25 — русские шашки, алгебраическая нотация)
+inline string write_pdn(const GameRecord &game)
+{
+    ostringstream out;
+    for (const auto &tag : game.tags)
+        out << "[" << tag.first << " \"" << tag.second << "\"]\n";
+    out << "[GameType \"" << RussianRules::pdn_game_type << "\"]\n";
+    out << "[Result \"" << result_to_pdn(game.result) << "\"]\n";
+    size_t line_len = 0;
+    for (size_t i = 0; i < game.turns.size(); ++i)
+    {
+        string token = (i % 2 == 0 ? to_string(i / 2 + 1) + ". " : "") + turn_to_string(game.turns[i]);
+        if (line_len + token.size() > 79)
+        {
+            out << "\n";
+            line_len = 0;
+        }
+        else if (line_len)
+        {
+            out << " ";
+            ++line_len;
+        }
+        out << token;
+        line_len += token.size();
+    }
+    out << (line_len ? " " : "") << result_to_pdn(game.result) << "\n\n";
+    return out.str();
+}
+
+// Восстанавливает ходы партии по истории досок Board (history_mtx и серии взятий).
+// Новый ход начинается с записи, у которой серия взятий не больше 1
+inline GameRecord record_from_history(Logic &logic, const vector<vector<vector<POS_T>>> &history,
+                                      const vector<int> &beat_series)
+{
+    GameRecord game;
+    bool color = false;
+    for (size_t i = 1; i < history.size(); ++i)
+    {
+        const auto &prev = history[i - 1];
+        if (i >= beat_series.size() || beat_series[i] <= 1)
+        {
+            if (!game.turns.empty())
+                color = !color;
+            game.turns.emplace_back();
+            logic.find_turns(color, prev);
+        }
+        else
+        {
+            const auto &last = game.turns.back().back();
+            logic.find_turns(last.x2, last.y2, prev);
+        }
+        for (const auto &mv : logic.turns)
+        {
+            if (logic.apply_move(prev, mv) == history[i])
+            {
+                game.turns.back().push_back(mv);
+                break;
+            }
+        }
+        if (game.turns.back().empty())
+        {
+            game.turns.pop_back();
+            break;
+        }
+    }
+    return game;
+}
+
+// Читает все партии из PDN. Партии с нелегальными или непонятными ходами пропускаются,
+// описание ошибки добавляется в errors
+inline vector<GameRecord> read_pdn(istream &in, Logic &logic, vector<string> *errors = nullptr)
+{
+    vector<GameRecord> games;
+    GameRecord game;
+    auto mtx = start_position();
+    bool color = false;
+    bool in_moves = false;
+    bool broken = false;
+    auto finish = [&](const bool keep) {
+        if (keep && !broken && (!game.turns.empty() || !game.tags.empty()))
+            games.push_back(game);
+        game = GameRecord();
+        mtx = start_position();
+        color = false;
+        in_moves = false;
+        broken = false;
+    };
+
+    char c;
+    string token;
+    while (in.get(c))
+    {
+        if (isspace((unsigned char)c))
+            continue;
+        if (c == '[')
+        {
+            if (in_moves)
+                finish(true); // новая партия без явного результата
+            string name, value;
+            while (in.get(c) && c != ']' && c != '"')
+                if (!isspace((unsigned char)c))
+                    name += c;
+            if (c == '"')
+            {
+                while (in.get(c) && c != '"')
+                    value += c;
+                while (c != ']' && in.get(c))
+                {
+                }
+            }
+            if (name == "Result")
+                pdn_to_result(value, game.result);
+            else if (name != "GameType")
+                game.tags.emplace_back(name, value);
+            continue;
+        }
+        if (c == '{')
+        {
+            while (in.get(c) && c != '}')
+            {
+            }
+            continue;
+        }
+        if (c == ';')
+        {
+            string rest;
+            getline(in, rest);
+            continue;
+        }
+        if (c == '(')
+        {
+            for (int level = 1; level && in.get(c);)
+                level += (c == '(') - (c == ')');
+            continue;
+        }
+        token = c;
+        while (in.peek() != EOF && !isspace(in.peek()) && in.peek() != '{' && in.peek() != '(' && in.peek() != '[')
+            token += char(in.get());
+
+        GameResult result;
+        if (pdn_to_result(token, result))
+        {
+            if (game.result == GameResult::Unknown)
+                game.result = result;
+            finish(true);
+            continue;
+        }
+        in_moves = true;
+        // номер хода "12." или "12..."
+        size_t digits = 0;
+        while (digits < token.size() && isdigit((unsigned char)token[digits]))
+            ++digits;
+        if (digits && digits < token.size() && token[digits] == '.')
+        {
+            const size_t pos = token.find_first_not_of('.', digits);
+            if (pos == string::npos)
+                continue;
+            token = token.substr(pos);
+        }
+        if (broken)
+            continue;
+        // отбрасываем комментарии к ходу вида "!?"
+        while (!token.empty() && (token.back() == '!' || token.back() == '?' || token.back() == '+'))
+            token.pop_back();
+        vector<move_pos> turn;
+        if (!parse_turn(logic, token, mtx, color, turn))
+        {
+            broken = true;
+            if (errors)
+                errors->push_back("game " + to_string(games.size() + 1) + ": illegal move " + token);
+            continue;
+        }
+        game.turns.push_back(turn);
+        mtx = apply_turn(logic, mtx, turn);
+        color = !color;
+    }
+    finish(true);
+    return games;
+}
+
+// Текущая дата в формате тега Date
+inline string pdn_date()
+{
+    time_t now = time(nullptr);
+    char buf[16];
+    strftime(buf, sizeof(buf), "%Y.%m.%d", localtime(&now));
+    return buf;
+}
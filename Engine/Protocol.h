@@ -0,0 +1,367 @@
+#pragma once
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "Logic.h"
+#include "Notation.h"
+#include "Solver.h"
+
+// Построчный текстовый протокол консольного движка (по мотивам UCI/DXP).
+// Команды:
+//   checkers                                   -> id/option..., checkersok
+//   isready                                    -> readyok
+//   setoption name <Level|Scoring|Optimization|NoRandom|SharedCacheMB|SharedCacheName> value <v>
+//                                              -> info string shared cache ... (для SharedCache*)
+//   newgame
+//   position startpos|fen <32 клетки> <w|b> [moves <ход> ...]
+//   go [depth N] [nodes N] [movetime MS] [infinite] [ponder] [multipv K]
+//                                              -> info ... [multipv i] ..., bestmove <ход> [ponder <ответ>]
+//   solve [nodes N] [movetime MS]              -> solve win|loss|unknown nodes N time MS [pv <ход> ...]
+//   stop, ponderhit, print, quit
+class EngineProtocol
+{
+  public:
+    EngineProtocol(istream &in, ostream &out) : in(in), out(out), logic(&config), solver(&config)
+    {
+        mtx = start_position();
+        logic.Max_depth = config.snapshot()->bot_level[1];
+    }
+
+    ~EngineProtocol()
+    {
+        stop_search();
+    }
+
+    // Читает команды до quit или конца ввода
+    int run()
+    {
+        string line;
+        while (getline(in, line))
+        {
+            istringstream cmd(line);
+            string name;
+            if (!(cmd >> name))
+                continue;
+            if (name == "quit")
+                break;
+            else if (name == "checkers")
+                cmd_hello();
+            else if (name == "isready")
+                send("readyok");
+            else if (name == "setoption")
+                cmd_setoption(cmd);
+            else if (name == "newgame")
+            {
+                stop_search();
+                mtx = start_position();
+                color = false;
+                logic.set_history({mtx}, color);
+            }
+            else if (name == "position")
+                cmd_position(cmd);
+            else if (name == "go")
+                cmd_go(cmd);
+            else if (name == "solve")
+                cmd_solve(cmd);
+            else if (name == "stop")
+                stop_search();
+            else if (name == "ponderhit")
+                cmd_ponderhit();
+            else if (name == "print")
+                send("info string " + position_to_string(mtx, color));
+            else
+                send("info string unknown command " + name);
+        }
+        stop_search();
+        return 0;
+    }
+
+  private:
+    void send(const string &line)
+    {
+        lock_guard<mutex> lock(out_mtx);
+        out << line << endl;
+    }
+
+    void cmd_hello()
+    {
+        auto s = config.snapshot();
+        send("id name Checkers");
+        send("option name Level type spin default " + to_string(logic.Max_depth) + " min 0 max 30");
+        send(string("option name Scoring type combo default ") +
+             (s->scoring == ScoringMode::NumberOnly ? "NumberOnly" : "NumberAndPotential") +
+             " var NumberOnly var NumberAndPotential");
+        send("option name Optimization type combo default O1 var O0 var O1 var O2");
+        send(string("option name NoRandom type check default ") + (s->no_random ? "true" : "false"));
+        send("option name SharedCacheMB type spin default " + to_string(s->shared_cache_mb) + " min 0 max 65536");
+        send("option name SharedCacheName type string default " + s->shared_cache_name);
+        send("checkersok");
+    }
+
+    void cmd_setoption(istringstream &cmd)
+    {
+        string word, name, value;
+        cmd >> word >> name >> word >> value;
+        Settings s = *config.snapshot();
+        if (name == "Level")
+        {
+            if (value.empty() || value.size() > 2 || value.find_first_not_of("0123456789") != string::npos ||
+                atoi(value.c_str()) > 30)
+            {
+                send("info string bad option " + name + " " + value);
+                return;
+            }
+            stop_search();
+            logic.Max_depth = atoi(value.c_str());
+            return;
+        }
+        else if (name == "Scoring" && (value == "NumberOnly" || value == "NumberAndPotential"))
+            s.scoring = (value == "NumberOnly" ? ScoringMode::NumberOnly : ScoringMode::NumberAndPotential);
+        else if (name == "Optimization" && (value == "O0" || value == "O1" || value == "O2"))
+            s.optimization = (value == "O0" ? OptLevel::O0 : value == "O1" ? OptLevel::O1 : OptLevel::O2);
+        else if (name == "NoRandom" && (value == "true" || value == "false"))
+            s.no_random = (value == "true");
+        else if (name == "SharedCacheMB" && !value.empty() && value.find_first_not_of("0123456789") == string::npos)
+            s.shared_cache_mb = unsigned(atoi(value.c_str()));
+        else if (name == "SharedCacheName" && value.size() > 1 && value[0] == '/' && value.find('/', 1) == string::npos)
+            s.shared_cache_name = value;
+        else
+        {
+            send("info string bad option " + name + " " + value);
+            return;
+        }
+        config.set(s);
+        if (name == "SharedCacheMB" || name == "SharedCacheName")
+            attach_cache(s);
+    }
+
+    // Подключает общий кеш сразу, чтобы сообщить об ошибке; поиск подключится к тому же сегменту
+    void attach_cache(const Settings &s)
+    {
+        shared_cache.reset();
+        if (!s.shared_cache_mb)
+            return;
+        string error;
+        shared_cache = SharedCache::attach(s.shared_cache_name, s.shared_cache_mb, error);
+        if (shared_cache)
+            send("info string shared cache " + s.shared_cache_name + " " +
+                 to_string(shared_cache->size() / (1024 * 1024)) + " MB");
+        else
+            send("info string shared cache error " + error);
+    }
+
+    void cmd_position(istringstream &cmd)
+    {
+        stop_search();
+        string word;
+        cmd >> word;
+        vector<vector<POS_T>> new_mtx;
+        bool new_color = false;
+        vector<vector<vector<POS_T>>> history; // позиции партии для обнаружения повторений
+        if (word == "startpos")
+            new_mtx = start_position();
+        else if (word == "fen")
+        {
+            string squares, side;
+            cmd >> squares >> side;
+            if (!parse_position(squares, side, new_mtx, new_color))
+            {
+                send("info string bad position");
+                return;
+            }
+        }
+        else
+        {
+            send("info string bad position");
+            return;
+        }
+        const bool first_color = new_color;
+        history.push_back(new_mtx);
+        if (cmd >> word && word == "moves")
+        {
+            while (cmd >> word)
+            {
+                vector<move_pos> turn;
+                if (!parse_turn(logic, word, new_mtx, new_color, turn))
+                {
+                    send("info string illegal move " + word);
+                    return;
+                }
+                new_mtx = apply_turn(logic, new_mtx, turn);
+                new_color = !new_color;
+                history.push_back(new_mtx);
+            }
+        }
+        mtx = new_mtx;
+        color = new_color;
+        logic.set_history(history, first_color);
+    }
+
+    void cmd_go(istringstream &cmd)
+    {
+        stop_search();
+        SearchLimits limits;
+        limits.depth = logic.Max_depth;
+        long long movetime = 0;
+        int multipv = 1;
+        bool infinite = false, ponder = false, has_depth = false;
+        string word;
+        while (cmd >> word)
+        {
+            if (word == "depth")
+            {
+                has_depth = bool(cmd >> limits.depth);
+                if (!has_depth || limits.depth < 0)
+                {
+                    send("info string bad depth");
+                    return;
+                }
+            }
+            else if (word == "nodes")
+                cmd >> limits.nodes;
+            else if (word == "movetime")
+                cmd >> movetime;
+            else if (word == "infinite")
+                infinite = true;
+            else if (word == "ponder")
+                ponder = true;
+            else if (word == "multipv")
+                cmd >> multipv;
+        }
+        // Без явной глубины поиск ограничивают время или узлы, а не уровень бота
+        if (infinite || (!has_depth && (movetime > 0 || limits.nodes > 0)))
+            limits.depth = 64;
+        limits.stop = &stop;
+        stop = false;
+        pondering = ponder;
+        waiting = infinite;
+        searching = true;
+        ponder_movetime = movetime;
+        if (movetime > 0 && !ponder)
+            start_timer(movetime);
+
+        search_thread = thread([this, limits, multipv] {
+            Logic worker = logic;
+            const auto on_info = [this](const SearchInfo &info) {
+                long long nps = info.time_ms ? (long long)(info.nodes * 1000 / info.time_ms) : 0;
+                const string stats = " nodes " + to_string(info.nodes) + " time " + to_string(info.time_ms) +
+                                     " nps " + to_string(nps);
+                if (info.lines.empty())
+                    send("info depth " + to_string(info.depth) + " score " + score_to_string(info.score) + stats + " pv " +
+                         line_to_string(info.pv));
+                for (size_t i = 0; i < info.lines.size(); ++i)
+                    send("info depth " + to_string(info.depth) + " multipv " + to_string(i + 1) + " score " +
+                         score_to_string(info.lines[i].score) + stats + " pv " + line_to_string(info.lines[i].pv));
+            };
+            vector<move_pos> best;
+            if (multipv > 1)
+            {
+                const auto lines = worker.search_multipv(mtx, color, multipv, limits, on_info);
+                if (!lines.empty())
+                    best = split_line(lines[0].pv).front();
+            }
+            else
+                best = worker.search(mtx, color, limits, on_info);
+            {
+                // В режимах ponder/infinite bestmove отдаётся только после stop или ponderhit
+                unique_lock<mutex> lock(state_mtx);
+                state_cv.wait(lock, [this] { return stop.load() || (!pondering && !waiting); });
+                searching = false;
+            }
+            state_cv.notify_all();
+            // Второй ход варианта — ожидаемый ответ соперника, его можно обдумывать в режиме ponder
+            const auto line = split_line(worker.principal_variation());
+            send("bestmove " + turn_to_string(best) + (line.size() > 1 ? " ponder " + turn_to_string(line[1]) : ""));
+        });
+    }
+
+    // Доказательство выигрыша или проигрыша ходящего решателем, выполняется синхронно
+    void cmd_solve(istringstream &cmd)
+    {
+        stop_search();
+        SearchLimits limits;
+        long long movetime = 0;
+        string word;
+        while (cmd >> word)
+        {
+            if (word == "nodes")
+                cmd >> limits.nodes;
+            else if (word == "movetime")
+                cmd >> movetime;
+        }
+        if (movetime > 0)
+            limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(movetime);
+        const SolveInfo info = solver.solve(mtx, color, limits, logic.reversible_turns());
+        send(string("solve ") +
+             (info.outcome == SolveOutcome::Win    ? "win"
+              : info.outcome == SolveOutcome::Loss ? "loss"
+                                                   : "unknown") +
+             " nodes " + to_string(info.nodes) + " time " + to_string(info.time_ms) +
+             (info.line.empty() ? "" : " pv " + line_to_string(info.line)));
+    }
+
+    void cmd_ponderhit()
+    {
+        {
+            lock_guard<mutex> lock(state_mtx);
+            if (!pondering)
+                return;
+            pondering = false;
+        }
+        state_cv.notify_all();
+        if (ponder_movetime > 0)
+            start_timer(ponder_movetime);
+    }
+
+    // Останавливает поиск по истечении movetime миллисекунд
+    void start_timer(const long long movetime)
+    {
+        if (timer_thread.joinable())
+            timer_thread.join();
+        timer_thread = thread([this, movetime] {
+            unique_lock<mutex> lock(state_mtx);
+            if (!state_cv.wait_for(lock, chrono::milliseconds(movetime), [this] { return !searching; }))
+                stop = true;
+            lock.unlock();
+            state_cv.notify_all();
+        });
+    }
+
+    // Прерывает текущий поиск и дожидается выдачи bestmove
+    void stop_search()
+    {
+        {
+            lock_guard<mutex> lock(state_mtx);
+            stop = true;
+        }
+        state_cv.notify_all();
+        if (search_thread.joinable())
+            search_thread.join();
+        if (timer_thread.joinable())
+            timer_thread.join();
+    }
+
+    istream &in;
+    ostream &out;
+    mutex out_mtx; // строки info/bestmove пишутся из потока поиска
+    SettingsStore config;
+    Logic logic;
+    Solver solver;
+    shared_ptr<SharedCache> shared_cache; // общий кеш (SharedCacheMB), пока он задан
+    vector<vector<POS_T>> mtx; // текущая позиция
+    bool color = false;        // кто ходит: true — чёрные, false — белые
+
+    thread search_thread;
+    thread timer_thread;
+    mutex state_mtx;
+    condition_variable state_cv;
+    atomic<bool> stop{false};
+    bool pondering = false; // идёт поиск на время соперника
+    bool waiting = false;   // go infinite: ждать stop
+    bool searching = false; // поток поиска ещё не выдал bestmove
+    long long ponder_movetime = 0;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include "../Models/Move.h"
+
+// Диагональные лучи доски N x N, построенные при компиляции.
+// Направления в порядке (-1,-1), (-1,+1), (+1,-1), (+1,+1); для клетки (x, y) и направления d
+// at(x, y, d)[k] — k-я клетка луча от неё, len(x, y, d) — длина луча до края доски.
+// Первая клетка луча — соседнее поле, вторая — поле за ним (куда приземляется шашка при взятии)
+template <int N> struct DiagonalRays
+{
+    struct Square
+    {
+        POS_T x = 0, y = 0;
+    };
+
+    static constexpr POS_T dx[4] = {-1, -1, 1, 1};
+    static constexpr POS_T dy[4] = {-1, 1, -1, 1};
+
+    constexpr DiagonalRays()
+    {
+        for (int x = 0; x < N; ++x)
+        {
+            for (int y = 0; y < N; ++y)
+            {
+                for (int d = 0; d < 4; ++d)
+                {
+                    int k = 0;
+                    for (int i = x + dx[d], j = y + dy[d]; i >= 0 && i < N && j >= 0 && j < N; i += dx[d], j += dy[d])
+                    {
+                        squares[x][y][d][k].x = POS_T(i);
+                        squares[x][y][d][k].y = POS_T(j);
+                        ++k;
+                    }
+                    lengths[x][y][d] = POS_T(k);
+                }
+            }
+        }
+    }
+
+    constexpr const Square *at(const POS_T x, const POS_T y, const int d) const
+    {
+        return squares[x][y][d];
+    }
+
+    constexpr int len(const POS_T x, const POS_T y, const int d) const
+    {
+        return lengths[x][y][d];
+    }
+
+    Square squares[N][N][4][N - 1] = {};
+    POS_T lengths[N][N][4] = {};
+};
+
+// Таблица лучей для доски N x N, одна на программу
+template <int N> inline constexpr DiagonalRays<N> diagonal_rays{};
@@ -0,0 +1,70 @@
+#pragma once
+#include <vector>
+
+#include "../Models/Move.h"
+
+using namespace std;
+
+// Правила игры как политики времени компиляции для BasicLogic<Rules>.
+// Все поля — constexpr, поэтому генератор ходов и оценка специализируются под вариант без проверок правил в поиске.
+// Доска: size x size, фигуры 1/3 — белые шашка/дамка (ходят к ряду 0), 2/4 — чёрные (к ряду size - 1)
+
+// Русские шашки: 8x8, дальнобойные дамки, шашки бьют назад, шашка, дошедшая до последнего ряда при взятии,
+// продолжает бить уже дамкой, большинство брать не обязательно
+struct RussianRules
+{
+    static constexpr int size = 8;                    // сторона доски
+    static constexpr int start_rows = 3;              // рядов шашек у каждой стороны в начальной позиции
+    static constexpr bool flying_kings = true;        // дамка ходит и бьёт на любое расстояние
+    static constexpr bool men_capture_back = true;    // простая шашка бьёт назад
+    static constexpr bool capture_majority = false;   // обязательно брать наибольшее число фигур
+    static constexpr bool promote_in_capture = true;  // превращение в дамку посреди серии взятий
+    static constexpr bool crowning_ends_move = false; // превращение в дамку заканчивает ход
+    static constexpr int pdn_game_type = 25;          // GameType в PDN
+};
+
+// Английские шашки (чекерс): 8x8, дамка ходит на одно поле, шашки бьют только вперёд,
+// превращение в дамку заканчивает ход
+struct EnglishRules
+{
+    static constexpr int size = 8;
+    static constexpr int start_rows = 3;
+    static constexpr bool flying_kings = false;
+    static constexpr bool men_capture_back = false;
+    static constexpr bool capture_majority = false;
+    static constexpr bool promote_in_capture = true;
+    static constexpr bool crowning_ends_move = true;
+    static constexpr int pdn_game_type = 21;
+};
+
+// Международные шашки: 10x10, дальнобойные дамки, шашки бьют назад, бить обязательно наибольшее число фигур,
+// шашка становится дамкой, только если закончила ход на последнем ряду
+struct InternationalRules
+{
+    static constexpr int size = 10;
+    static constexpr int start_rows = 4;
+    static constexpr bool flying_kings = true;
+    static constexpr bool men_capture_back = true;
+    static constexpr bool capture_majority = true;
+    static constexpr bool promote_in_capture = false;
+    static constexpr bool crowning_ends_move = false;
+    static constexpr int pdn_game_type = 20;
+};
+
+// Начальная расстановка варианта Rules
+template <class Rules> vector<vector<POS_T>> initial_position()
+{
+    const int n = Rules::size;
+    vector<vector<POS_T>> mtx(n, vector<POS_T>(n, 0));
+    for (POS_T i = 0; i < n; ++i)
+    {
+        for (POS_T j = 0; j < n; ++j)
+        {
+            if (i < Rules::start_rows && (i + j) % 2 == 1)
+                mtx[i][j] = 2;
+            if (i >= n - Rules::start_rows && (i + j) % 2 == 1)
+                mtx[i][j] = 1;
+        }
+    }
+    return mtx;
+}
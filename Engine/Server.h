@@ -0,0 +1,327 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Logic.h"
+#include "Notation.h"
+#include "ThreadPool.h"
+
+// Сервер партий: много партий (сессий) в одном процессе, ходы ботов ищутся на общем пуле потоков.
+// Протокол построчный, как у консольного движка. Команды игрока:
+//   new [bot white|black|both|none] [level N] [budget MS]  -> session <id>
+//   move <id> <ход>                                         -> ok <id>
+//   position <id>                                           -> position <id> <32 клетки> <w|b> <playing|результат>
+//   moves <id>                                              -> moves <id> <ход> ...
+//   close <id>                                              -> closed <id>
+//   stats                                                   -> stats sessions N threads N queued N ...
+// Сообщения сервера, приходящие сами: botmove <id> <ход> depth <d> wait <ms> time <ms>, result <id> <1-0|0-1|1/2-1/2>.
+// Ошибки: error <id|-> <причина>.
+// Бюджет хода бота отсчитывается от постановки в очередь: при перегрузке поиск короче, а не ответ позже.
+// У сессии не больше одного поиска в очереди, а рабочие берут задания в порядке поступления,
+// поэтому партия бот против бота не вытесняет остальные
+
+// Параметры сервера партий
+struct ServerOptions
+{
+    unsigned int threads = 0;              // потоков поиска в общем пуле, 0 — по числу ядер
+    int default_level = 5;                 // уровень бота, если в new он не задан
+    int max_level = 12;
+    unsigned int default_budget_ms = 500;  // время на ход бота, если в new оно не задано
+    unsigned int max_budget_ms = 10000;
+    size_t max_sessions = 1000;
+};
+
+// Подключение игрока. Ответы пишутся из потока ввода-вывода и из рабочих потоков пула, поэтому send сериализован.
+// После close ничего не пишется: сокет можно закрывать
+class ServerConnection
+{
+  public:
+    explicit ServerConnection(function<bool(const string &)> write) : write(move(write))
+    {
+    }
+
+    void send(const string &line)
+    {
+        lock_guard<mutex> lock(mtx);
+        if (open && !write(line + "\n"))
+            open = false;
+    }
+
+    void close()
+    {
+        lock_guard<mutex> lock(mtx);
+        open = false;
+    }
+
+  private:
+    function<bool(const string &)> write;
+    mutex mtx;
+    bool open = true;
+};
+
+class GameServer
+{
+    struct Session
+    {
+        int id = 0;
+        shared_ptr<ServerConnection> owner;
+        mutex guard;                           // защищает всё ниже, кроме closed
+        vector<vector<POS_T>> board;
+        bool color = false;                    // кто ходит: true — чёрные
+        vector<vector<vector<POS_T>>> history; // позиции партии от начальной
+        bool bot[2] = {false, true};           // за кого играет бот: 0 — белые, 1 — чёрные
+        int level = 0;
+        unsigned int budget_ms = 0;
+        bool searching = false;                // ход бота в очереди или в поиске
+        string result;                         // пусто, пока партия идёт
+        atomic<bool> closed{false};            // сессия закрыта, поиск останавливается
+    };
+
+  public:
+    GameServer(const Settings &settings, const ServerOptions &options)
+        : config(settings), options(options), referee(&config),
+          pool(options.threads ? options.threads : max(1u, thread::hardware_concurrency()))
+    {
+        // У каждого рабочего пула свой Logic
+        for (unsigned int i = 0; i < pool.size(); ++i)
+            engines.push_back(make_unique<Logic>(&config));
+    }
+
+    ~GameServer()
+    {
+        for (auto &entry : sessions)
+            entry.second->closed = true;
+    }
+
+    // Выполняет команду игрока conn. handle и disconnect вызываются из одного потока ввода-вывода
+    void handle(const shared_ptr<ServerConnection> &conn, const string &line)
+    {
+        istringstream cmd(line);
+        string name;
+        if (!(cmd >> name))
+            return;
+        if (name == "new")
+        {
+            cmd_new(conn, cmd);
+            return;
+        }
+        if (name == "stats")
+        {
+            conn->send(stats());
+            return;
+        }
+        if (name != "move" && name != "position" && name != "moves" && name != "close")
+        {
+            conn->send("error - unknown command " + name);
+            return;
+        }
+        int id = -1;
+        cmd >> id;
+        const auto it = sessions.find(id);
+        if (it == sessions.end() || it->second->owner != conn)
+        {
+            conn->send("error " + (id >= 0 ? to_string(id) : string("-")) + " unknown session");
+            return;
+        }
+        const shared_ptr<Session> s = it->second;
+        if (name == "move")
+            cmd_move(s, cmd);
+        else if (name == "close")
+        {
+            s->closed = true;
+            sessions.erase(it);
+            conn->send("closed " + to_string(id));
+        }
+        else
+        {
+            lock_guard<mutex> lock(s->guard);
+            if (name == "position")
+                conn->send("position " + to_string(id) + " " + position_to_string(s->board, s->color) + " " +
+                           (s->result.empty() ? "playing" : s->result));
+            else
+            {
+                string reply = "moves " + to_string(id);
+                if (s->result.empty())
+                    for (const auto &turn : legal_turns(referee, s->board, s->color))
+                        reply += " " + turn;
+                conn->send(reply);
+            }
+        }
+    }
+
+    // Игрок отключился: его партии закрываются, их поиски останавливаются
+    void disconnect(const shared_ptr<ServerConnection> &conn)
+    {
+        for (auto it = sessions.begin(); it != sessions.end();)
+        {
+            if (it->second->owner == conn)
+            {
+                it->second->closed = true;
+                it = sessions.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    string stats() const
+    {
+        const uint64_t n = searches.load();
+        ostringstream out;
+        out << "stats sessions " << sessions.size() << " threads " << pool.size() << " queued " << pool.pending()
+            << " searches " << n << " avg_wait_ms "
+            << (n ? wait_us.load() / 1000.0 / n : 0) << " max_wait_ms " << max_wait_us.load() / 1000.0
+            << " avg_search_ms " << (n ? search_us.load() / 1000.0 / n : 0);
+        return out.str();
+    }
+
+  private:
+    void cmd_new(const shared_ptr<ServerConnection> &conn, istringstream &cmd)
+    {
+        if (sessions.size() >= options.max_sessions)
+        {
+            conn->send("error - too many sessions");
+            return;
+        }
+        auto s = make_shared<Session>();
+        s->id = next_id++;
+        s->owner = conn;
+        s->level = options.default_level;
+        s->budget_ms = options.default_budget_ms;
+        string word;
+        while (cmd >> word)
+        {
+            if (word == "bot" && cmd >> word)
+            {
+                s->bot[0] = (word == "white" || word == "both");
+                s->bot[1] = (word == "black" || word == "both");
+            }
+            else if (word == "level")
+                cmd >> s->level;
+            else if (word == "budget")
+                cmd >> s->budget_ms;
+        }
+        s->level = clamp(s->level, 0, options.max_level);
+        s->budget_ms = clamp(s->budget_ms, 1u, options.max_budget_ms);
+        s->board = start_position();
+        s->history = {s->board};
+        sessions[s->id] = s;
+        conn->send("session " + to_string(s->id));
+        lock_guard<mutex> lock(s->guard);
+        if (s->bot[0])
+            schedule(s);
+    }
+
+    void cmd_move(const shared_ptr<Session> &s, istringstream &cmd)
+    {
+        string text;
+        cmd >> text;
+        const string id = to_string(s->id);
+        lock_guard<mutex> lock(s->guard);
+        if (!s->result.empty())
+        {
+            s->owner->send("error " + id + " game over");
+            return;
+        }
+        if (s->searching || s->bot[s->color])
+        {
+            s->owner->send("error " + id + " not your turn");
+            return;
+        }
+        vector<move_pos> turn;
+        if (!parse_turn(referee, text, s->board, s->color, turn))
+        {
+            s->owner->send("error " + id + " illegal move " + text);
+            return;
+        }
+        s->board = apply_turn(referee, s->board, turn);
+        s->owner->send("ok " + id);
+        after_turn(s, referee);
+    }
+
+    // Ход сделан (под s->guard): передаёт очередь, проверяет конец партии и при необходимости ставит поиск бота
+    void after_turn(const shared_ptr<Session> &s, Logic &logic)
+    {
+        s->color = !s->color;
+        s->history.push_back(s->board);
+        logic.set_history(s->history, false);
+        logic.find_turns(s->color, s->board);
+        if (int(s->history.size()) - 1 >= config.snapshot()->max_num_turns || logic.history_is_draw())
+            s->result = "1/2-1/2";
+        else if (logic.turns.empty())
+            s->result = (s->color ? "1-0" : "0-1");
+        if (!s->result.empty())
+            s->owner->send("result " + to_string(s->id) + " " + s->result);
+        else if (s->bot[s->color])
+            schedule(s);
+    }
+
+    void schedule(const shared_ptr<Session> &s)
+    {
+        s->searching = true;
+        const auto queued_at = chrono::steady_clock::now();
+        pool.submit([this, s, queued_at](const unsigned int worker) { bot_move(s, queued_at, worker); });
+    }
+
+    // Задание пула: поиск хода бота на Logic рабочего worker
+    void bot_move(const shared_ptr<Session> &s, const chrono::steady_clock::time_point queued_at,
+                  const unsigned int worker)
+    {
+        TRACE_SCOPE_NAMED(trace, "bot_move", "server");
+        TRACE_ARG(trace, "session", s->id);
+        Logic &logic = *engines[worker];
+        vector<vector<POS_T>> board;
+        bool color;
+        SearchLimits limits;
+        {
+            lock_guard<mutex> lock(s->guard);
+            board = s->board;
+            color = s->color;
+            logic.set_history(s->history, false);
+            limits.depth = s->level;
+            limits.deadline = queued_at + chrono::milliseconds(s->budget_ms);
+        }
+        limits.stop = &s->closed;
+        const auto start = chrono::steady_clock::now();
+        SearchInfo last;
+        vector<move_pos> best;
+        if (!s->closed)
+            best = logic.search(board, color, limits, [&](const SearchInfo &info) { last = info; });
+        const auto end = chrono::steady_clock::now();
+        const uint64_t waited = chrono::duration_cast<chrono::microseconds>(start - queued_at).count();
+        searches.fetch_add(1);
+        wait_us.fetch_add(waited);
+        search_us.fetch_add(chrono::duration_cast<chrono::microseconds>(end - start).count());
+        uint64_t prev_max = max_wait_us.load();
+        while (waited > prev_max && !max_wait_us.compare_exchange_weak(prev_max, waited))
+            ;
+
+        lock_guard<mutex> lock(s->guard);
+        s->searching = false;
+        if (s->closed || best.empty())
+            return;
+        s->board = apply_turn(logic, s->board, best);
+        s->owner->send("botmove " + to_string(s->id) + " " + turn_to_string(best) + " depth " + to_string(last.depth) +
+                       " wait " + to_string(waited / 1000) + " time " +
+                       to_string(chrono::duration_cast<chrono::milliseconds>(end - queued_at).count()));
+        after_turn(s, logic);
+    }
+
+    SettingsStore config;
+    const ServerOptions options;
+    Logic referee; // проверка ходов игроков в потоке ввода-вывода
+    unordered_map<int, shared_ptr<Session>> sessions;
+    int next_id = 1;
+    atomic<uint64_t> searches{0}, wait_us{0}, max_wait_us{0}, search_us{0};
+    vector<unique_ptr<Logic>> engines;
+    ThreadPool pool; // объявлен последним: уничтожается первым, пока живы engines и сессии
+};
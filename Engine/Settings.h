@@ -0,0 +1,117 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Режим оценки позиции ботом
+enum class ScoringMode
+{
+    NumberOnly,        // только количество шашек
+    NumberAndPotential // количество шашек и их продвижение
+};
+
+// Уровень оптимизации поиска
+enum class OptLevel
+{
+    O0, // полный перебор без отсечений
+    O1, // alpha-beta отсечение
+    O2  // выборочный поиск
+};
+
+// Алгоритм бота
+enum class BotAlgorithm
+{
+    Minimax, // перебор на глубину уровня бота (Logic)
+    Mcts     // поиск Монте-Карло по дереву с бюджетом времени или симуляций (Mcts)
+};
+
+// Минимальный уровень записей журнала (Log.h)
+enum class LogLevel
+{
+    Debug,
+    Info,
+    Warning,
+    Error
+};
+
+// Типизированный снимок настроек.
+// Индекс 0 в массивах — белые, 1 — чёрные (как turn_num % 2 в Game::play)
+struct Settings
+{
+    unsigned int width = 0;  // ширина окна, 0 — весь экран
+    unsigned int height = 0; // высота окна, 0 — весь экран
+    bool is_bot[2] = {false, true};
+    int bot_level[2] = {0, 5};
+    BotAlgorithm algorithm[2] = {BotAlgorithm::Minimax, BotAlgorithm::Minimax};
+    ScoringMode scoring = ScoringMode::NumberAndPotential;
+    unsigned int bot_delay_ms = 0;
+    bool no_random = false;
+    OptLevel optimization = OptLevel::O1;
+    vector<unsigned int> level_time_ms; // бюджет хода бота по уровням (calibrate.cpp), 0 или нет — без ограничения
+    // Параметры выборочного поиска O2 (запасы — в сотых долях шашки, как оценки Score.h)
+    int futility_margin = 100;    // запас futility pruning на каждый оставшийся ход (до 2 ходов до листьев)
+    int probcut_margin = 200;     // запас ProbCut относительно границы окна
+    int probcut_depth = 5;        // минимальная оставшаяся глубина для ProbCut (мелкий поиск на 3 хода короче)
+    int lmr_moves = 3;            // сколько первых тихих ходов смотреть без сокращения
+    int lmr_depth = 3;            // минимальная оставшаяся глубина для сокращения поздних ходов
+    // Общий для процессов кеш оценок позиций в разделяемой памяти (SharedCache.h)
+    unsigned int shared_cache_mb = 0;             // размер сегмента, 0 — кеш выключен
+    string shared_cache_name = "/checkers_cache"; // имя сегмента POSIX
+    // Параметры MCTS
+    unsigned int mcts_time_ms = 1000;  // время на ход, 0 — без ограничения (тогда нужен лимит симуляций)
+    unsigned int mcts_playouts = 0;    // лимит симуляций на ход, 0 — без ограничения
+    unsigned int mcts_threads = 0;     // потоков поиска, 0 — по числу ядер
+    double mcts_exploration = 1.4;     // константа исследования UCT
+    int mcts_playout_turns = 8;        // ходов случайной симуляции до оценки позиции
+    unsigned int mcts_tree_mb = 512;   // память дерева: дальше листья не расширяются
+    // Параметры решателя (доказательство выигрыша при малом материале)
+    int solver_pieces = 0;             // решатель включается при стольких фигурах на доске и меньше, 0 — выключен
+    uint64_t solver_nodes = 300000;    // лимит узлов решателя на ход
+    unsigned int solver_table_mb = 64; // размер таблицы решателя
+    // Подсказки человеку: лучшие ходы ищутся в фоне, пока он думает
+    int hint_moves = 0;                // сколько лучших ходов подсвечивать, 0 — подсказки выключены
+    int hint_depth = 8;                // глубина поиска подсказок
+    unsigned int hint_time_ms = 1000;  // время поиска подсказок, 0 — без ограничения
+    // Журнал log.jsonl
+    LogLevel log_level = LogLevel::Info;
+    unsigned int log_max_kb = 1024; // размер файла журнала, после которого он ротируется
+    int log_files = 3;              // сколько прежних файлов журнала хранить
+    int max_num_turns = 120;
+    int repetition_draw = 3;    // ничья при повторении позиции столько раз, 0 — правило отключено
+    int no_progress_turns = 30; // ничья после стольких ходов подряд без взятий и ходов шашками, 0 — отключено
+};
+
+// Хранилище снимка настроек, из которого читает Logic. Снимок неизменяем и подменяется атомарно.
+// Без файлов и json: консольные инструменты и библиотека движка задают настройки через set()
+class SettingsStore
+{
+  public:
+    SettingsStore() : settings(make_shared<const Settings>())
+    {
+    }
+
+    explicit SettingsStore(const Settings &initial) : settings(make_shared<const Settings>(initial))
+    {
+    }
+
+    SettingsStore(const SettingsStore &) = delete;
+    SettingsStore &operator=(const SettingsStore &) = delete;
+
+    // Атомарно подменяет снимок настроек
+    void set(const Settings &updated)
+    {
+        atomic_store(&settings, make_shared<const Settings>(updated));
+    }
+
+    // Текущий снимок настроек. Держите shared_ptr, пока он нужен
+    shared_ptr<const Settings> snapshot() const
+    {
+        return atomic_load(&settings);
+    }
+
+  protected:
+    shared_ptr<const Settings> settings; // текущий снимок, подменяется атомарно
+};
@@ -0,0 +1,272 @@
+#pragma once
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "../Models/Move.h"
+#include "../Models/Score.h"
+
+using namespace std;
+
+// Общий для процессов кеш оценок позиций в разделяемой памяти POSIX (shm_open/mmap).
+// Сегмент создаёт первый подключившийся процесс, остальные подключаются к нему с тем размером, что он выбрал;
+// сегмент живёт до перезагрузки или до удаления (/dev/shm/<имя> в Linux), поэтому кеш переживает перезапуски.
+// В Windows — именованное отображение Local\<имя>, оно живёт, пока открыто хотя бы в одном процессе.
+// Записи без блокировок: два 64-битных слова, первое — ключ XOR данные. Запись, собранная из половин двух
+// одновременных записей (или из чужого процесса с другой позицией), не проходит проверку и считается промахом
+class SharedCache
+{
+    static const uint32_t MAGIC = 0x43484b43; // "CKHC"
+    static const uint32_t VERSION = 1;
+    static const int BUCKET = 4; // записей в корзине: 64 байта, одна строка кеша процессора
+
+    // Заголовок сегмента. magic пишется последним: пока его нет, сегмент ещё размечается создателем
+    struct alignas(64) Header
+    {
+        atomic<uint32_t> magic;
+        uint32_t version;
+        uint64_t buckets;
+        atomic<uint32_t> generation; // номер поиска любого процесса: старые записи вытесняются первыми
+    };
+
+    struct Entry
+    {
+        atomic<uint64_t> check; // ключ XOR data
+        atomic<uint64_t> data;
+    };
+    static_assert(atomic<uint64_t>::is_always_lock_free, "записи кеша должны быть без блокировок");
+    static_assert(sizeof(Entry) * BUCKET == 64, "корзина — одна строка кеша");
+
+  public:
+    // Вид границы оценки в записи
+    enum Bound : uint8_t
+    {
+        NONE = 0,
+        UPPER = 1, // оценка не выше (все ходы не подняли alpha)
+        LOWER = 2, // оценка не ниже (отсечение по beta)
+        EXACT = 3
+    };
+
+    // Распакованная запись
+    struct Hit
+    {
+        PackedScore score = 0; // оценка от узла (pack_score)
+        int draft = 0;         // оставшаяся глубина поиска, которым получена оценка
+        Bound bound = NONE;
+        move_pos move;         // первый шаг лучшего хода, x == -1 — нет
+    };
+
+    /**
+     * Подключает процесс к сегменту name (имя POSIX: "/checkers_cache") размером mb мегабайт, создавая его при
+     * необходимости. Один сегмент на процесс: повторные вызовы с тем же именем возвращают то же отображение.
+     * При ошибке возвращает nullptr и текст в error
+     */
+    static shared_ptr<SharedCache> attach(const string &name, const unsigned mb, string &error)
+    {
+        static mutex registry_mtx;
+        static map<string, weak_ptr<SharedCache>> registry;
+        lock_guard<mutex> lock(registry_mtx);
+        if (auto cache = registry[name].lock())
+            return cache;
+        shared_ptr<SharedCache> cache(new SharedCache());
+        error = cache->map_segment(name, mb);
+        if (!error.empty())
+            return nullptr;
+        registry[name] = cache;
+        return cache;
+    }
+
+    ~SharedCache()
+    {
+#ifdef _WIN32
+        if (header)
+            UnmapViewOfFile(header);
+        if (mapping)
+            CloseHandle(mapping);
+#else
+        if (header)
+            munmap(header, mapped);
+#endif
+    }
+
+    SharedCache(const SharedCache &) = delete;
+    SharedCache &operator=(const SharedCache &) = delete;
+
+    // Начало поиска: номер поколения, которым помечаются новые записи
+    uint8_t new_search()
+    {
+        return uint8_t(header->generation.fetch_add(1, memory_order_relaxed) + 1);
+    }
+
+    // Ищет запись ключа key; false — нет записи или она повреждена одновременной записью
+    bool probe(const uint64_t key, Hit &hit) const
+    {
+        const Entry *bucket = &entries[key % header->buckets * BUCKET];
+        for (int i = 0; i < BUCKET; ++i)
+        {
+            const uint64_t data = bucket[i].data.load(memory_order_relaxed);
+            const uint64_t check = bucket[i].check.load(memory_order_relaxed);
+            if ((check ^ data) != key || !(data >> 24 & 3))
+                continue;
+            hit.score = PackedScore(uint16_t(data));
+            hit.draft = int(data >> 16 & 0xff);
+            hit.bound = Bound(data >> 24 & 3);
+            hit.move = unpack_move(uint16_t(data >> 32));
+            return true;
+        }
+        return false;
+    }
+
+    // Записывает оценку ключа key. Своя запись заменяется всегда (лучший ход сохраняется, если нового нет),
+    // иначе вытесняется запись прошлых поисков, из них — с наименьшей глубиной
+    void store(const uint64_t key, const PackedScore score, const int draft, const Bound bound, const move_pos &move,
+               const uint8_t generation)
+    {
+        Entry *bucket = &entries[key % header->buckets * BUCKET];
+        Entry *victim = nullptr;
+        int victim_worth = INT32_MAX;
+        uint16_t stored_move = pack_move(move);
+        for (int i = 0; i < BUCKET; ++i)
+        {
+            const uint64_t data = bucket[i].data.load(memory_order_relaxed);
+            if ((bucket[i].check.load(memory_order_relaxed) ^ data) == key)
+            {
+                victim = &bucket[i];
+                if (stored_move == NO_MOVE)
+                    stored_move = uint16_t(data >> 32);
+                break;
+            }
+            const int worth = int(data >> 16 & 0xff) + (uint8_t(data >> 48) == generation ? 256 : 0);
+            if (worth < victim_worth)
+            {
+                victim = &bucket[i];
+                victim_worth = worth;
+            }
+        }
+        const uint64_t data = uint64_t(uint16_t(score)) | uint64_t(min(draft, 255)) << 16 | uint64_t(bound) << 24 |
+                              uint64_t(stored_move) << 32 | uint64_t(generation) << 48;
+        victim->check.store(key ^ data, memory_order_relaxed);
+        victim->data.store(data, memory_order_relaxed);
+    }
+
+    // Размер таблицы в байтах (его выбрал создатель сегмента)
+    size_t size() const
+    {
+        return size_t(header->buckets) * sizeof(Entry) * BUCKET;
+    }
+
+  private:
+    static const uint16_t NO_MOVE = 0xffff;
+
+    SharedCache() = default;
+
+    // Шаг хода — 4 бита на координату (доски до 10x10)
+    static uint16_t pack_move(const move_pos &mv)
+    {
+        if (mv.x < 0)
+            return NO_MOVE;
+        return uint16_t(mv.x | mv.y << 4 | mv.x2 << 8 | mv.y2 << 12);
+    }
+
+    static move_pos unpack_move(const uint16_t packed)
+    {
+        if (packed == NO_MOVE)
+            return move_pos();
+        return move_pos(POS_T(packed & 15), POS_T(packed >> 4 & 15), POS_T(packed >> 8 & 15), POS_T(packed >> 12));
+    }
+
+    // Открывает или создаёт сегмент и отображает его; возвращает текст ошибки
+    string map_segment(const string &name, const unsigned mb)
+    {
+        if (!mb)
+            return "size must be positive";
+        const uint64_t buckets = max<uint64_t>(1, uint64_t(mb) * 1024 * 1024 / (sizeof(Entry) * BUCKET));
+        size_t size = sizeof(Header) + size_t(buckets) * sizeof(Entry) * BUCKET;
+        bool creator = true;
+#ifdef _WIN32
+        const string object = "Local\\" + name.substr(1);
+        mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(uint64_t(size) >> 32),
+                                     DWORD(size), object.c_str());
+        if (!mapping)
+            return "CreateFileMapping " + object + ": error " + to_string(GetLastError());
+        creator = (GetLastError() != ERROR_ALREADY_EXISTS);
+        void *addr = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if (!addr)
+            return "MapViewOfFile " + object + ": error " + to_string(GetLastError());
+        MEMORY_BASIC_INFORMATION info = {};
+        VirtualQuery(addr, &info, sizeof(info));
+        size = size_t(info.RegionSize);
+#else
+        int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0 && errno == EEXIST)
+        {
+            creator = false;
+            fd = shm_open(name.c_str(), O_RDWR, 0);
+        }
+        if (fd < 0)
+            return "shm_open " + name + ": " + strerror(errno);
+        if (creator && ftruncate(fd, off_t(size)) != 0)
+        {
+            const string error = string("ftruncate: ") + strerror(errno);
+            close(fd);
+            shm_unlink(name.c_str());
+            return error;
+        }
+        if (!creator)
+        {
+            // Создатель мог ещё не задать размер
+            struct stat st = {};
+            const auto deadline = chrono::steady_clock::now() + chrono::seconds(1);
+            while (fstat(fd, &st) == 0 && size_t(st.st_size) <= sizeof(Header) && chrono::steady_clock::now() < deadline)
+                this_thread::sleep_for(chrono::milliseconds(1));
+            size = size_t(st.st_size);
+        }
+        void *addr = (size > sizeof(Header) ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED);
+        const int map_errno = errno;
+        close(fd);
+        if (addr == MAP_FAILED)
+            return "mmap " + name + ": " + (size > sizeof(Header) ? strerror(map_errno) : "segment is empty");
+#endif
+        header = static_cast<Header *>(addr);
+        mapped = size;
+        entries = reinterpret_cast<Entry *>(header + 1);
+        // Новый сегмент заполнен нулями: пустые записи не проходят проверку
+        if (creator)
+        {
+            header->version = VERSION;
+            header->buckets = buckets;
+            header->generation.store(0, memory_order_relaxed);
+            header->magic.store(MAGIC, memory_order_release);
+            return "";
+        }
+        const auto deadline = chrono::steady_clock::now() + chrono::seconds(1);
+        while (header->magic.load(memory_order_acquire) != MAGIC && chrono::steady_clock::now() < deadline)
+            this_thread::sleep_for(chrono::milliseconds(1));
+        if (header->magic.load(memory_order_acquire) != MAGIC || header->version != VERSION || !header->buckets ||
+            header->buckets > (size - sizeof(Header)) / (sizeof(Entry) * BUCKET))
+            return name + ": incompatible or unfinished segment, remove it (/dev/shm" + name + ")";
+        return "";
+    }
+
+    Header *header = nullptr;
+    Entry *entries = nullptr;
+    size_t mapped = 0; // байт отображено
+#ifdef _WIN32
+    HANDLE mapping = nullptr;
+#endif
+};
@@ -0,0 +1,168 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Минимальная обёртка над TCP-сокетами для локального сервера партий и его клиента.
+// Сервер слушает только 127.0.0.1; сообщения — строки, разделённые '\n'
+#ifdef _WIN32
+using socket_t = SOCKET;
+const socket_t BAD_SOCKET = INVALID_SOCKET;
+inline int poll_sockets(pollfd *fds, const size_t n, const int timeout_ms)
+{
+    return WSAPoll(fds, ULONG(n), timeout_ms);
+}
+#else
+using socket_t = int;
+const socket_t BAD_SOCKET = -1;
+inline int poll_sockets(pollfd *fds, const size_t n, const int timeout_ms)
+{
+    return poll(fds, nfds_t(n), timeout_ms);
+}
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// Один раз на процесс до работы с сокетами (нужно только Windows)
+inline bool sockets_startup()
+{
+#ifdef _WIN32
+    WSADATA data;
+    return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+#else
+    return true;
+#endif
+}
+
+inline void close_socket(const socket_t s)
+{
+#ifdef _WIN32
+    closesocket(s);
+#else
+    close(s);
+#endif
+}
+
+// Слушающий сокет на 127.0.0.1:port (port == 0 — любой свободный, см. local_port)
+inline socket_t listen_local(const uint16_t port)
+{
+    socket_t s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == BAD_SOCKET)
+        return BAD_SOCKET;
+    int yes = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&yes), sizeof(yes));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    if (::bind(s, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || listen(s, SOMAXCONN) != 0)
+    {
+        close_socket(s);
+        return BAD_SOCKET;
+    }
+    return s;
+}
+
+inline uint16_t local_port(const socket_t s)
+{
+    sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    if (getsockname(s, reinterpret_cast<sockaddr *>(&addr), &len) != 0)
+        return 0;
+    return ntohs(addr.sin_port);
+}
+
+// Сообщения короткие: без алгоритма Нейгла ответ уходит сразу, не дожидаясь накопления пакета
+inline void set_no_delay(const socket_t s)
+{
+    int yes = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&yes), sizeof(yes));
+}
+
+inline socket_t connect_local(const string &host, const uint16_t port)
+{
+    socket_t s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == BAD_SOCKET)
+        return BAD_SOCKET;
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1 ||
+        connect(s, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close_socket(s);
+        return BAD_SOCKET;
+    }
+    set_no_delay(s);
+    return s;
+}
+
+// Отправляет данные целиком, false — соединение закрыто
+inline bool send_all(const socket_t s, const string &data)
+{
+    size_t sent = 0;
+    while (sent < data.size())
+    {
+        const int n = int(send(s, data.data() + sent, int(data.size() - sent), MSG_NOSIGNAL));
+        if (n <= 0)
+            return false;
+        sent += size_t(n);
+    }
+    return true;
+}
+
+// Буфер входящих данных сокета с разбиением на строки
+class LineReader
+{
+  public:
+    // Читает то, что уже пришло (блокируется, если ничего нет); false — соединение закрыто
+    bool fill(const socket_t s)
+    {
+        char chunk[4096];
+        const int n = int(recv(s, chunk, sizeof(chunk), 0));
+        if (n <= 0)
+            return false;
+        buffer.append(chunk, size_t(n));
+        return true;
+    }
+
+    // Следующая полная строка без '\n' и '\r'
+    bool next(string &line)
+    {
+        const size_t end = buffer.find('\n', pos);
+        if (end == string::npos)
+        {
+            buffer.erase(0, pos);
+            pos = 0;
+            return false;
+        }
+        line.assign(buffer, pos, end - pos);
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        pos = end + 1;
+        return true;
+    }
+
+  private:
+    string buffer;
+    size_t pos = 0; // начало непрочитанной части buffer
+};
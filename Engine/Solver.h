@@ -0,0 +1,337 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "Logic.h"
+
+using namespace std;
+
+// Решатель: поиск по доказательным числам в глубину (df-pn) для тактических позиций и позиций с малым материалом.
+// Доказывает, что ходящая сторона выигрывает (или проигрывает) при любой защите, и возвращает доказывающий вариант.
+// Узел — позиция на границе хода, ребро — ход целиком. Атакующий должен выиграть, ничья засчитывается защите:
+// правило NoProgressTurns, повторение позиции на пути и партия длиннее MAX_SOLVE_PLY ходов опровергают выигрыш.
+// Эти ничьи зависят от пути, поэтому в таблицу не пишутся, а счётчик обратимых ходов входит в ключ таблицы:
+// доказанный результат верен, ошибка из-за пути может лишь помешать что-то доказать.
+// Таблица ограничена SolverTableMB: корзины по BUCKET записей, вытесняется нерешённая запись с наименьшей работой
+template <class Rules> class BasicSolver
+{
+    static constexpr POS_T N = Rules::size;
+    using Engine = BasicLogic<Rules>;
+    static const uint32_t PN_INF = 1u << 30; // доказательное число «бесконечность»
+    static const int MAX_SOLVE_PLY = 200;    // ходов от корня, дальше — ничья
+    static const int BUCKET = 4;             // записей в корзине таблицы
+
+    struct Entry
+    {
+        uint64_t key = 0; // 0 — пустая запись
+        uint32_t pn = 1, dn = 1;
+        uint32_t work = 0; // узлов, просмотренных под записью
+    };
+
+    struct Child
+    {
+        vector<move_pos> turn;
+        uint64_t hash;  // позиция после хода с очередью соперника
+        int reversible; // ходов подряд без взятий и ходов шашками
+    };
+
+  public:
+    explicit BasicSolver(const SettingsStore *config) : config(config)
+    {
+    }
+
+    /**
+     * Решает позицию mtx, ходит color: сначала доказывается выигрыш ходящего, если он опровергнут — проигрыш.
+     * Бюджет — limits.nodes, limits.deadline и limits.stop, без лимита узлов берётся SolverNodes из настроек.
+     * reversible — ходов подряд без взятий и ходов шашками перед позицией (для правила NoProgressTurns)
+     */
+    SolveInfo solve(const vector<vector<POS_T>> &mtx, const bool color,
+                    const SearchLimits &search_limits = SearchLimits(), const int reversible = 0)
+    {
+        TRACE_SCOPE_NAMED(trace, "solve", "search");
+        settings = config->snapshot();
+        limits = search_limits;
+        if (!limits.nodes)
+            limits.nodes = settings->solver_nodes;
+        const size_t buckets =
+            max<size_t>(1, size_t(settings->solver_table_mb) * 1024 * 1024 / sizeof(Entry) / BUCKET);
+        if (table.size() != buckets * BUCKET)
+            table.assign(buckets * BUCKET, Entry());
+        const auto start = chrono::steady_clock::now();
+        nodes = 0;
+        aborted = false;
+        for (POS_T i = 0; i < N; ++i)
+            for (POS_T j = 0; j < N; ++j)
+                board[i][j] = mtx[i][j];
+        const uint64_t hash = Zobrist::instance().hash(mtx, color);
+
+        SolveInfo info;
+        for (const bool side : {color, !color})
+        {
+            attacker = side;
+            path.clear();
+            uint32_t pn, dn;
+            mid(hash, color, reversible, 0, PN_INF, PN_INF, pn, dn);
+            if (!pn)
+            {
+                info.outcome = (side == color ? SolveOutcome::Win : SolveOutcome::Loss);
+                info.line = proof_line(hash, color, reversible);
+                break;
+            }
+            if (dn) // бюджет кончился
+                break;
+        }
+        info.nodes = nodes;
+        info.time_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+        TRACE_ARG(trace, "nodes", nodes);
+        return info;
+    }
+
+    // Забывает таблицу
+    void clear()
+    {
+        table.assign(table.size(), Entry());
+    }
+
+  private:
+    // Уточняет pn/dn узла, пока они не выйдут за пороги th_pn/th_dn; числа — для выигрыша attacker
+    void mid(const uint64_t hash, const bool color, const int reversible, const int ply, const uint32_t th_pn,
+             const uint32_t th_dn, uint32_t &pn, uint32_t &dn)
+    {
+        ++nodes;
+        const bool or_node = (color == attacker);
+        const uint64_t key = entry_key(hash, reversible);
+        vector<Child> children = gen_children(hash, color, reversible);
+        if (children.empty())
+        {
+            // Ходящий без ходов проиграл
+            pn = (or_node ? PN_INF : 0);
+            dn = (or_node ? 0 : PN_INF);
+            store(key, pn, dn, 1);
+            return;
+        }
+        const uint64_t start_nodes = nodes;
+        // Числа детей читаются из таблицы один раз, дальше обновляется только просмотренный ребёнок
+        vector<uint32_t> cpn(children.size()), cdn(children.size());
+        for (size_t i = 0; i < children.size(); ++i)
+            numbers(children[i], ply + 1, cpn[i], cdn[i]);
+        path.push_back(hash);
+        while (true)
+        {
+            // В узле атакующего хватает одного доказанного хода, в узле защиты нужно опровергнуть один
+            const vector<uint32_t> &pick = (or_node ? cpn : cdn);
+            const vector<uint32_t> &other = (or_node ? cdn : cpn);
+            size_t best = 0;
+            uint32_t second = PN_INF;
+            uint64_t sum = 0;
+            for (size_t i = 0; i < children.size(); ++i)
+            {
+                sum += other[i];
+                if (pick[i] < pick[best])
+                {
+                    second = pick[best];
+                    best = i;
+                }
+                else if (i != best && pick[i] < second)
+                    second = pick[i];
+            }
+            const uint32_t min_value = pick[best], sum_value = uint32_t(min<uint64_t>(sum, PN_INF));
+            pn = (or_node ? min_value : sum_value);
+            dn = (or_node ? sum_value : min_value);
+            if (pn >= th_pn || dn >= th_dn || out_of_limits())
+                break;
+            uint32_t child_th_pn, child_th_dn;
+            if (or_node)
+            {
+                child_th_pn = min(th_pn, second + 1);
+                child_th_dn = th_dn - dn + cdn[best];
+            }
+            else
+            {
+                child_th_dn = min(th_dn, second + 1);
+                child_th_pn = th_pn - pn + cpn[best];
+            }
+            const Child &c = children[best];
+            typename Engine::Undo undo[MAX_PLY];
+            play(c.turn, undo);
+            mid(c.hash, !color, c.reversible, ply + 1, child_th_pn, child_th_dn, cpn[best], cdn[best]);
+            unplay(c.turn, undo);
+        }
+        path.pop_back();
+        store(key, pn, dn, nodes - start_nodes);
+    }
+
+    // Доказательный вариант от корня: атакующий выбирает доказанный ход с наименьшей работой,
+    // защита — самый трудный для доказательства. Вытесненные из таблицы ходы доказываются заново
+    vector<move_pos> proof_line(uint64_t hash, bool color, int reversible)
+    {
+        POS_T saved[N][N];
+        memcpy(saved, board, sizeof(board));
+        limits.nodes = nodes + max<uint64_t>(nodes, 10000);
+        limits.deadline = chrono::steady_clock::time_point::max();
+        aborted = false;
+        path.clear();
+        vector<move_pos> line;
+        for (int ply = 0; ply < MAX_SOLVE_PLY; ++ply)
+        {
+            const vector<Child> children = gen_children(hash, color, reversible);
+            const bool or_node = (color == attacker);
+            int best = -1;
+            uint32_t best_work = 0;
+            for (int attempt = 0; attempt < 2 && best == -1; ++attempt)
+            {
+                for (size_t i = 0; i < children.size(); ++i)
+                {
+                    uint32_t pn, dn;
+                    numbers(children[i], ply + 1, pn, dn);
+                    if (attempt && pn && dn)
+                    {
+                        typename Engine::Undo undo[MAX_PLY];
+                        play(children[i].turn, undo);
+                        path.push_back(hash);
+                        mid(children[i].hash, !color, children[i].reversible, ply + 1, PN_INF, PN_INF, pn, dn);
+                        path.pop_back();
+                        unplay(children[i].turn, undo);
+                    }
+                    if (pn)
+                        continue;
+                    const Entry *e = lookup(entry_key(children[i].hash, children[i].reversible));
+                    const uint32_t work = (e ? e->work : 0);
+                    if (best == -1 || (or_node ? work < best_work : work > best_work))
+                    {
+                        best = int(i);
+                        best_work = work;
+                    }
+                }
+            }
+            if (best == -1)
+                break;
+            const Child &c = children[best];
+            typename Engine::Undo undo[MAX_PLY];
+            play(c.turn, undo);
+            line.insert(line.end(), c.turn.begin(), c.turn.end());
+            path.push_back(hash);
+            hash = c.hash;
+            color = !color;
+            reversible = c.reversible;
+        }
+        memcpy(board, saved, sizeof(board));
+        return line;
+    }
+
+    vector<Child> gen_children(const uint64_t hash, const bool color, const int reversible)
+    {
+        vector<Child> children;
+        const uint64_t side = Zobrist::instance().side();
+        Engine::for_each_turn(board, color, hash,
+                              [&](const vector<move_pos> &turn, const uint64_t after, const bool quiet_king) {
+                                  children.push_back({turn, after ^ side, quiet_king ? reversible + 1 : 0});
+                              });
+        return children;
+    }
+
+    // Числа ребёнка на уровне ply: ничья опровергает выигрыш, иначе — из таблицы (новый узел — 1/1)
+    void numbers(const Child &c, const int ply, uint32_t &pn, uint32_t &dn) const
+    {
+        if (is_draw(c, ply))
+        {
+            pn = PN_INF;
+            dn = 0;
+            return;
+        }
+        const Entry *e = lookup(entry_key(c.hash, c.reversible));
+        pn = (e ? e->pn : 1);
+        dn = (e ? e->dn : 1);
+    }
+
+    // Ничья по правилу обратимых ходов, по длине или повторение позиции на пути
+    bool is_draw(const Child &c, const int ply) const
+    {
+        if (ply >= MAX_SOLVE_PLY || (settings->no_progress_turns && c.reversible >= settings->no_progress_turns))
+            return true;
+        for (int k = 1; k <= c.reversible && k <= int(path.size()); ++k)
+            if (path[path.size() - k] == c.hash)
+                return true;
+        return false;
+    }
+
+    void play(const vector<move_pos> &turn, typename Engine::Undo *undo)
+    {
+        for (size_t i = 0; i < turn.size(); ++i)
+            Engine::make_step(board, turn[i], undo[i]);
+    }
+
+    void unplay(const vector<move_pos> &turn, const typename Engine::Undo *undo)
+    {
+        for (size_t i = turn.size(); i-- > 0;)
+            Engine::unmake_step(board, turn[i], undo[i]);
+    }
+
+    // Ключ таблицы: позиция, счётчик обратимых ходов (если правило включено) и атакующий
+    uint64_t entry_key(const uint64_t hash, const int reversible) const
+    {
+        const int r = (settings->no_progress_turns ? reversible : 0);
+        return hash ^ (uint64_t(r + 1) * 0x9E3779B97F4A7C15ull) ^ (attacker ? 0xD6E8FEB86659FD93ull : 0);
+    }
+
+    const Entry *lookup(const uint64_t key) const
+    {
+        const Entry *bucket = &table[key % (table.size() / BUCKET) * BUCKET];
+        for (int i = 0; i < BUCKET; ++i)
+            if (bucket[i].key == key)
+                return &bucket[i];
+        return nullptr;
+    }
+
+    void store(const uint64_t key, const uint32_t pn, const uint32_t dn, const uint64_t work)
+    {
+        Entry *bucket = &table[key % (table.size() / BUCKET) * BUCKET];
+        Entry *victim = nullptr;
+        for (int i = 0; i < BUCKET && !victim; ++i)
+            if (bucket[i].key == key || !bucket[i].key)
+                victim = &bucket[i];
+        if (!victim)
+        {
+            // Вытесняется нерешённая запись с наименьшей работой, решённые — в последнюю очередь
+            victim = &bucket[0];
+            for (int i = 1; i < BUCKET; ++i)
+                if (make_pair(solved(bucket[i]), bucket[i].work) < make_pair(solved(*victim), victim->work))
+                    victim = &bucket[i];
+        }
+        victim->key = key;
+        victim->pn = pn;
+        victim->dn = dn;
+        victim->work = uint32_t(min<uint64_t>(work, UINT32_MAX));
+    }
+
+    static bool solved(const Entry &e)
+    {
+        return !e.pn || !e.dn;
+    }
+
+    bool out_of_limits()
+    {
+        if (aborted)
+            return true;
+        if (nodes >= limits.nodes)
+            aborted = true;
+        else if ((nodes & 1023) == 0)
+            aborted = (limits.stop && limits.stop->load(memory_order_relaxed)) ||
+                      chrono::steady_clock::now() >= limits.deadline;
+        return aborted;
+    }
+
+    const SettingsStore *config;         // источник снимков настроек
+    shared_ptr<const Settings> settings; // снимок настроек текущего решения
+    SearchLimits limits;
+    vector<Entry> table;
+    vector<uint64_t> path;               // позиции (с очередью хода) от корня до текущего узла
+    POS_T board[N][N];
+    bool attacker = false;               // чей выигрыш доказывается
+    uint64_t nodes = 0;
+    bool aborted = false;
+};
+
+using Solver = BasicSolver<RussianRules>;
@@ -0,0 +1,86 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Trace.h"
+
+using namespace std;
+
+// Пул потоков с одной общей очередью: задания начинаются строго в порядке поступления, и задание ждёт только
+// поставленные раньше. Задания пула — целые поиски, так что одна блокировка на задание ничего не стоит.
+// Задание получает номер рабочего, чтобы пользоваться его собственными данными (например, своим Logic).
+// При уничтожении пул доделывает все поставленные задания
+class ThreadPool
+{
+  public:
+    explicit ThreadPool(const unsigned int threads)
+    {
+        for (unsigned int i = 0; i < max(1u, threads); ++i)
+            workers.emplace_back(&ThreadPool::run, this, i);
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            lock_guard<mutex> lock(mtx);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto &t : workers)
+            t.join();
+    }
+
+    // Ставит задание в очередь; можно вызывать из любого потока, в том числе из задания
+    void submit(function<void(unsigned int)> task)
+    {
+        {
+            lock_guard<mutex> lock(mtx);
+            tasks.push_back(move(task));
+        }
+        wake.notify_one();
+    }
+
+    unsigned int size() const
+    {
+        return unsigned(workers.size());
+    }
+
+    // Заданий в очереди (ещё не начатых)
+    size_t pending() const
+    {
+        lock_guard<mutex> lock(mtx);
+        return tasks.size();
+    }
+
+  private:
+    void run(const unsigned int index)
+    {
+        TRACE_THREAD_NAME("pool worker");
+        while (true)
+        {
+            function<void(unsigned int)> task;
+            {
+                unique_lock<mutex> lock(mtx);
+                wake.wait(lock, [this] { return !tasks.empty() || stopping; });
+                if (tasks.empty())
+                    return; // stopping, и всё поставленное доделано
+                task = move(tasks.front());
+                tasks.pop_front();
+            }
+            task(index);
+        }
+    }
+
+    vector<thread> workers;
+    mutable mutex mtx;
+    condition_variable wake;
+    deque<function<void(unsigned int)>> tasks;
+    bool stopping = false;
+};
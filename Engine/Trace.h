@@ -0,0 +1,200 @@
+#pragma once
+
+// Профилирование в формате Chrome Trace Event (открывается в chrome://tracing или ui.perfetto.dev).
+// Включается сборкой с -DCHECKERS_TRACE, без него макросы ниже пустые и ничего не стоят.
+//   TRACE_SCOPE(name, cat)              — отрезок времени от этой строки до конца блока
+//   TRACE_SCOPE_NAMED(var, name, cat)   — то же, к отрезку можно добавить до двух чисел: TRACE_ARG(var, name, value)
+//   TRACE_THREAD_NAME(name)             — подпись потока в трассе
+//   TRACE_WRITE(path)                   — сохранить трассу в JSON
+// name, cat и имена аргументов — строковые литералы (хранятся указатели).
+// У каждого потока свой кольцевой буфер: запись без блокировок, при переполнении затираются старые события.
+// TRACE_WRITE читает буферы всех потоков, поэтому вызывается, когда остальные потоки не пишут
+// (например, в конце программы)
+
+#ifdef CHECKERS_TRACE
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct TraceEvent
+{
+    const char *name;
+    const char *cat;
+    int64_t start_ns; // от начала программы
+    int64_t dur_ns;
+    const char *arg_names[2];
+    int64_t args[2];
+};
+
+class TraceBuffer
+{
+  public:
+    static const size_t CAPACITY = 1 << 15; // событий на поток
+
+    explicit TraceBuffer(const int tid) : tid(tid), events(new TraceEvent[CAPACITY])
+    {
+    }
+
+    void push(const TraceEvent &event)
+    {
+        const uint64_t n = written.load(memory_order_relaxed);
+        events[n % CAPACITY] = event;
+        written.store(n + 1, memory_order_release);
+    }
+
+    const int tid;
+    string thread_name;
+    unique_ptr<TraceEvent[]> events;
+    atomic<uint64_t> written{0}; // всего записано событий
+};
+
+// Буферы всех потоков. Буфер живёт до конца программы, даже если поток уже завершился
+class TraceRegistry
+{
+  public:
+    static TraceRegistry &instance()
+    {
+        static TraceRegistry registry;
+        return registry;
+    }
+
+    // Буфер текущего потока. Буфер завершившегося потока достаётся следующему новому потоку,
+    // так что короткоживущие потоки поиска не копят память
+    TraceBuffer &local()
+    {
+        struct Owner
+        {
+            TraceBuffer *buffer = nullptr;
+            ~Owner()
+            {
+                if (buffer)
+                    TraceRegistry::instance().release(buffer);
+            }
+        };
+        thread_local Owner owner;
+        if (!owner.buffer)
+        {
+            lock_guard<mutex> lock(mtx);
+            if (free_buffers.empty())
+            {
+                buffers.push_back(make_unique<TraceBuffer>(int(buffers.size()) + 1));
+                owner.buffer = buffers.back().get();
+            }
+            else
+            {
+                owner.buffer = free_buffers.back();
+                free_buffers.pop_back();
+            }
+        }
+        return *owner.buffer;
+    }
+
+    int64_t now_ns() const
+    {
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - origin).count();
+    }
+
+    bool write(const string &path)
+    {
+        ofstream out(path);
+        if (!out)
+            return false;
+        lock_guard<mutex> lock(mtx);
+        out << "{\"traceEvents\":[";
+        bool first = true;
+        for (const auto &b : buffers)
+        {
+            if (!b->thread_name.empty())
+            {
+                out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b->tid
+                    << ",\"args\":{\"name\":\"" << b->thread_name << "\"}}";
+                first = false;
+            }
+            const uint64_t n = b->written.load(memory_order_acquire);
+            for (uint64_t i = (n > TraceBuffer::CAPACITY ? n - TraceBuffer::CAPACITY : 0); i < n; ++i)
+            {
+                const TraceEvent &e = b->events[i % TraceBuffer::CAPACITY];
+                out << (first ? "" : ",") << "\n{\"name\":\"" << e.name << "\",\"cat\":\"" << e.cat
+                    << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << b->tid << ",\"ts\":" << e.start_ns / 1000 << '.'
+                    << to_string(1000 + e.start_ns % 1000).substr(1) << ",\"dur\":" << e.dur_ns / 1000 << '.'
+                    << to_string(1000 + e.dur_ns % 1000).substr(1);
+                if (e.arg_names[0])
+                {
+                    out << ",\"args\":{\"" << e.arg_names[0] << "\":" << e.args[0];
+                    if (e.arg_names[1])
+                        out << ",\"" << e.arg_names[1] << "\":" << e.args[1];
+                    out << "}";
+                }
+                out << "}";
+                first = false;
+            }
+        }
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return bool(out);
+    }
+
+  private:
+    TraceRegistry() : origin(chrono::steady_clock::now())
+    {
+    }
+
+    void release(TraceBuffer *buffer)
+    {
+        lock_guard<mutex> lock(mtx);
+        free_buffers.push_back(buffer);
+    }
+
+    const chrono::steady_clock::time_point origin;
+    mutex mtx;
+    vector<unique_ptr<TraceBuffer>> buffers;
+    vector<TraceBuffer *> free_buffers; // буферы завершившихся потоков
+};
+
+// Отрезок времени от создания до уничтожения
+class TraceScope
+{
+  public:
+    TraceScope(const char *name, const char *cat)
+        : event{name, cat, TraceRegistry::instance().now_ns(), 0, {nullptr, nullptr}, {0, 0}}
+    {
+    }
+
+    ~TraceScope()
+    {
+        TraceRegistry &registry = TraceRegistry::instance();
+        event.dur_ns = registry.now_ns() - event.start_ns;
+        registry.local().push(event);
+    }
+
+    void arg(const char *name, const int64_t value)
+    {
+        const int i = (event.arg_names[0] ? 1 : 0);
+        event.arg_names[i] = name;
+        event.args[i] = value;
+    }
+
+  private:
+    TraceEvent event;
+};
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(name, cat) TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name, cat)
+#define TRACE_SCOPE_NAMED(var, name, cat) TraceScope var(name, cat)
+#define TRACE_ARG(var, name, value) var.arg(name, int64_t(value))
+#define TRACE_THREAD_NAME(name) (TraceRegistry::instance().local().thread_name = (name))
+#define TRACE_WRITE(path) TraceRegistry::instance().write(path)
+#else
+#define TRACE_SCOPE(name, cat) ((void)0)
+#define TRACE_SCOPE_NAMED(var, name, cat) ((void)0)
+#define TRACE_ARG(var, name, value) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#define TRACE_WRITE(path) ((void)0)
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+using namespace std;
+
+// Ограниченная потокобезопасная очередь заданий: производитель блокируется, если очередь полна,
+// потребители — если пуста. После close() pop() возвращает false, когда задания закончились
+template <class T> class WorkQueue
+{
+  public:
+    explicit WorkQueue(const size_t capacity) : capacity(capacity)
+    {
+    }
+
+    void push(T item)
+    {
+        unique_lock<mutex> lock(mtx);
+        not_full.wait(lock, [this] { return items.size() < capacity; });
+        items.push_back(move(item));
+        lock.unlock();
+        not_empty.notify_one();
+    }
+
+    bool pop(T &item)
+    {
+        unique_lock<mutex> lock(mtx);
+        not_empty.wait(lock, [this] { return !items.empty() || closed; });
+        if (items.empty())
+            return false;
+        item = move(items.front());
+        items.pop_front();
+        lock.unlock();
+        not_full.notify_one();
+        return true;
+    }
+
+    // Новых заданий не будет
+    void close()
+    {
+        {
+            lock_guard<mutex> lock(mtx);
+            closed = true;
+        }
+        not_empty.notify_all();
+    }
+
+  private:
+    const size_t capacity;
+    deque<T> items;
+    mutex mtx;
+    condition_variable not_empty, not_full;
+    bool closed = false;
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "../Models/Move.h"
+
+using namespace std;
+
+// Хеширование позиций по Зобристу: по ключу на каждую (клетку, фигуру) и ключ для хода чёрных.
+// Ключи фиксированы (splitmix64 от номера), поэтому хеши совпадают между запусками и процессами.
+// Ключи есть для досок до 10x10; ключи поля 8x8 идут первыми, поэтому хеши русских шашек не зависят от размера таблицы
+class Zobrist
+{
+  public:
+    static const Zobrist &instance()
+    {
+        static const Zobrist z;
+        return z;
+    }
+
+    // Ключ фигуры type (1..4) на клетке (x, y)
+    uint64_t piece(const POS_T x, const POS_T y, const POS_T type) const
+    {
+        return keys[x][y][type];
+    }
+
+    uint64_t side() const
+    {
+        return black_to_move;
+    }
+
+    // Полный хеш позиции; color — кто ходит (true — чёрные)
+    uint64_t hash(const vector<vector<POS_T>> &mtx, const bool color) const
+    {
+        uint64_t h = color ? black_to_move : 0;
+        const POS_T n = POS_T(mtx.size());
+        for (POS_T i = 0; i < n; ++i)
+            for (POS_T j = 0; j < n; ++j)
+                if (mtx[i][j])
+                    h ^= keys[i][j][mtx[i][j]];
+        return h;
+    }
+
+  private:
+    Zobrist()
+    {
+        uint64_t state = 0x436865636b657273ull; // "Checkers"
+        for (int i = 0; i < 8; ++i)
+            for (int j = 0; j < 8; ++j)
+                for (auto &key : keys[i][j])
+                    key = next(state);
+        black_to_move = next(state);
+        for (int i = 0; i < MAX_SIZE; ++i)
+            for (int j = 0; j < MAX_SIZE; ++j)
+                if (i >= 8 || j >= 8)
+                    for (auto &key : keys[i][j])
+                        key = next(state);
+    }
+
+    static uint64_t next(uint64_t &state)
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    static const int MAX_SIZE = 10;
+    uint64_t keys[MAX_SIZE][MAX_SIZE][5];
+    uint64_t black_to_move;
+};
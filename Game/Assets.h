@@ -0,0 +1,174 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Engine/Trace.h"
+#include "Textures.h"
+
+#ifdef __APPLE__
+    #include <SDL2/SDL.h>
+    #include <SDL2/SDL_image.h>
+#else
+    #include <SDL.h>
+    #include <SDL_image.h>
+#endif
+
+using namespace std;
+
+// Декодирование встроенных текстур (Game/Textures.h) в поверхности SDL в фоновых потоках.
+// Не требует SDL_Init, поэтому запускается раньше создания окна. Текстуры из поверхностей создаёт
+// поток рендерера (take), сами поверхности освобождает вызвавший take
+class AssetDecoder
+{
+  public:
+    ~AssetDecoder()
+    {
+        join();
+        for (auto &slot : slots)
+            SDL_FreeSurface(slot.surface);
+    }
+
+    // Начать декодирование файлов names в этом порядке не более чем в threads потоках. Первые first файлов
+    // декодируются сразу, остальные — после release(): до первого кадра они не отнимают у него процессор
+    void start(const vector<string> &names, unsigned threads, const size_t first)
+    {
+        join();
+        gate = first;
+        released = false;
+        slots.assign(names.size(), Slot());
+        for (size_t i = 0; i < names.size(); ++i)
+            slots[i].name = names[i];
+        next = 0;
+        left = names.size();
+        decode_ns = 0;
+        started = chrono::steady_clock::now();
+        IMG_Init(IMG_INIT_PNG); // ленивая инициализация загрузчика PNG внутри IMG_Load_RW не потокобезопасна
+        thread_count = threads = max(1u, min(threads, unsigned(names.size())));
+        for (unsigned t = 0; t < threads; ++t)
+            workers.emplace_back([this] { work(); });
+    }
+
+    // Поверхность i (nullptr — ошибка, её текст в error(i)). wait = false: не ждать, пока не готова — тогда
+    // nullptr и ready(i) == false. Поверхность отдаётся один раз
+    SDL_Surface *take(const size_t i, const bool wait)
+    {
+        unique_lock<mutex> lock(mut);
+        if (wait)
+            done_cv.wait(lock, [&] { return slots[i].ready; });
+        SDL_Surface *surface = slots[i].surface;
+        slots[i].surface = nullptr;
+        return surface;
+    }
+
+    // Разрешить декодирование остальных файлов
+    void release()
+    {
+        {
+            lock_guard<mutex> lock(mut);
+            released = true;
+        }
+        release_cv.notify_all();
+    }
+
+    bool ready(const size_t i)
+    {
+        lock_guard<mutex> lock(mut);
+        return slots[i].ready;
+    }
+
+    string error(const size_t i)
+    {
+        lock_guard<mutex> lock(mut);
+        return slots[i].error;
+    }
+
+    // Все ли файлы декодированы (без блокировки: для опроса на каждом кадре)
+    bool all_ready() const
+    {
+        return left.load(memory_order_acquire) == 0;
+    }
+
+    // Время от start до конца декодирования последнего файла и суммарное время декодирования во всех потоках, мс
+    double elapsed_ms() const
+    {
+        return chrono::duration<double, milli>(finished - started).count();
+    }
+    double decode_ms() const
+    {
+        return decode_ns.load() / 1e6;
+    }
+    unsigned threads() const
+    {
+        return thread_count;
+    }
+
+    void join()
+    {
+        release();
+        for (auto &worker : workers)
+            worker.join();
+        workers.clear();
+    }
+
+  private:
+    struct Slot
+    {
+        string name;
+        SDL_Surface *surface = nullptr;
+        string error;
+        bool ready = false;
+    };
+
+    void work()
+    {
+        TRACE_THREAD_NAME("asset_decoder");
+        for (size_t i; (i = next.fetch_add(1)) < slots.size();)
+        {
+            if (i >= gate)
+            {
+                unique_lock<mutex> lock(mut);
+                release_cv.wait(lock, [this] { return released; });
+            }
+            const auto start = chrono::steady_clock::now();
+            SDL_Surface *surface = nullptr;
+            string error;
+            {
+                TRACE_SCOPE("decode_texture", "render");
+                const EmbeddedTexture *texture = find_embedded_texture(slots[i].name.c_str());
+                if (texture == nullptr)
+                    error = "no embedded texture " + slots[i].name;
+                else if (!(surface = IMG_Load_RW(SDL_RWFromConstMem(texture->data, int(texture->size)), 1)))
+                    error = SDL_GetError(); // текст ошибки SDL — свой у каждого потока
+            }
+            const auto end = chrono::steady_clock::now();
+            decode_ns += uint64_t(chrono::duration_cast<chrono::nanoseconds>(end - start).count());
+            {
+                lock_guard<mutex> lock(mut);
+                slots[i].surface = surface;
+                slots[i].error = error;
+                slots[i].ready = true;
+                if (left == 1)
+                    finished = end;
+            }
+            left.fetch_sub(1, memory_order_release);
+            done_cv.notify_all();
+        }
+    }
+
+    vector<Slot> slots;
+    vector<thread> workers;
+    mutex mut;
+    condition_variable done_cv, release_cv;
+    unsigned thread_count = 0;
+    size_t gate = 0;
+    bool released = false;
+    atomic<size_t> next{0}, left{0};
+    atomic<uint64_t> decode_ns{0};
+    chrono::steady_clock::time_point started, finished;
+};
@@ -1,10 +1,16 @@
 #pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <fstream>
 #include <vector>
 
+#include "../Engine/Log.h"
+#include "../Engine/Trace.h"
 #include "../Models/Move.h"
 #include "../Models/Project_path.h"
+#include "Assets.h"
 
 #ifdef __APPLE__
     #include <SDL2/SDL.h>
@@ -26,14 +32,22 @@ public:
     {
     }
 
-    // Инициализация SDL, загрузка текстур и отрисовка стартовой доски
+    // Инициализация SDL, текстуры и отрисовка стартовой доски. Доска и фигуры декодируются в фоне, пока
+    // создаются окно и рендерер, и только их ждёт первый кадр; остальные картинки (кнопки, экраны результата)
+    // декодируются после него, а их текстуры создаются на следующих кадрах или в poll_assets
     int start_draw()
     {
-        if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
+        TRACE_SCOPE("start_draw", "render");
+        startup.start = chrono::steady_clock::now();
+        decoder.start(vector<string>(begin(texture_files), end(texture_files)), thread::hardware_concurrency(),
+                      First_frame_textures);
+        // Только видео (вместе с ним — события): звук, джойстики и прочее игре не нужны
+        if (SDL_Init(SDL_INIT_VIDEO) != 0)
         {
-            print_exception("SDL_Init can't init SDL2 lib");
+            print_exception("SDL_Init can't init SDL2 video");
             return 1;
         }
+        startup.sdl_init = startup_ms();
         if (W == 0 || H == 0)
         {
             SDL_DisplayMode dm;
@@ -52,31 +66,64 @@ public:
             print_exception("SDL_CreateWindow can't create window");
             return 1;
         }
-        ren = SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        startup.window = startup_ms();
+        ren = SDL_CreateRenderer(win, -1,
+                                 software_renderer ? SDL_RENDERER_SOFTWARE
+                                                   : SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
         if (ren == nullptr)
         {
             print_exception("SDL_CreateRenderer can't create renderer");
             return 1;
         }
-        // Загрузка всех необходимых текстур
-        board = IMG_LoadTexture(ren, board_path.c_str());
-        w_piece = IMG_LoadTexture(ren, piece_white_path.c_str());
-        b_piece = IMG_LoadTexture(ren, piece_black_path.c_str());
-        w_queen = IMG_LoadTexture(ren, queen_white_path.c_str());
-        b_queen = IMG_LoadTexture(ren, queen_black_path.c_str());
-        back = IMG_LoadTexture(ren, back_path.c_str());
-        replay = IMG_LoadTexture(ren, replay_path.c_str());
-        if (!board || !w_piece || !b_piece || !w_queen || !b_queen || !back || !replay)
+        startup.renderer = startup_ms();
+        // Текстуры первого кадра: ждём их декодирования
         {
-            print_exception("IMG_LoadTexture can't load main textures from " + textures_path);
-            return 1;
+            TRACE_SCOPE("load_textures", "render");
+            for (size_t i = 0; i < First_frame_textures; ++i)
+                upload_texture(i, true);
         }
+        for (size_t i = 0; i < First_frame_textures; ++i)
+        {
+            if (!textures[i])
+                return 1;
+        }
+        startup.textures = startup_ms();
+        assets_pending = true;
         SDL_GetRendererOutputSize(ren, &W, &H);
         make_start_mtx(); // Формируем стартовую матрицу доски
         rerender();       // Перерисовываем всё
         return 0;
     }
 
+    // Досоздать текстуры, декодированные в фоне, и перерисовать окно, когда готовы все
+    // (вызывать в цикле ожидания ввода, чтобы кнопки появились и без действий игрока)
+    void poll_assets()
+    {
+        if (assets_pending && decoder.all_ready())
+            rerender();
+    }
+
+    // Дождаться всех текстур (render_bench: загрузки не попадают в измеряемые кадры)
+    void wait_assets()
+    {
+        if (!assets_pending)
+            return;
+        for (size_t i = First_frame_textures; i < Texture_count; ++i)
+            upload_texture(i, true);
+        finish_assets();
+    }
+
+    // Время этапов запуска в start_draw, мс от его начала start (assets — 0, пока не готовы все текстуры)
+    struct StartupTimes
+    {
+        chrono::steady_clock::time_point start;
+        double sdl_init = 0, window = 0, renderer = 0, textures = 0, first_frame = 0, assets = 0;
+    };
+    const StartupTimes &startup_times() const
+    {
+        return startup;
+    }
+
     // Сброс состояния доски к начальному (для новой партии или повтора)
     void redraw()
     {
@@ -84,6 +131,7 @@ public:
         history_mtx.clear();
         history_beat_series.clear();
         make_start_mtx();
+        hints.clear();
         clear_active();
         clear_highlight();
     }
@@ -140,6 +188,12 @@ public:
         return mtx;
     }
 
+    // Получить серии взятий для каждой записи history_mtx (для восстановления ходов партии)
+    const vector<int> &get_history_beat_series() const
+    {
+        return history_beat_series;
+    }
+
     // Подсветить клетки (например, возможные ходы)
     void highlight_cells(vector<pair<POS_T, POS_T>> cells)
     {
@@ -161,6 +215,22 @@ public:
         rerender();
     }
 
+    // Показать подсказки: ходы (шаги серии взятий подряд) от лучшего к худшему
+    void set_hints(vector<vector<move_pos>> turns)
+    {
+        hints = move(turns);
+        rerender();
+    }
+
+    // Убрать подсказки
+    void clear_hints()
+    {
+        if (hints.empty())
+            return;
+        hints.clear();
+        rerender();
+    }
+
     // Установить активную (выделенную) клетку
     void set_active(const POS_T x, const POS_T y)
     {
@@ -211,16 +281,46 @@ public:
         rerender();
     }
 
+    // Программный рендерер без vsync вместо аппаратного (вызывать до start_draw).
+    // Вместе с SDL_VIDEODRIVER=dummy или offscreen доска рисуется без дисплея (render_bench)
+    void set_software_renderer(const bool software)
+    {
+        software_renderer = software;
+    }
+
+    // Задержка после каждого кадра (10 мс, нужна для macOS); render_bench рисует без неё
+    void set_frame_delay(const unsigned int ms)
+    {
+        frame_delay_ms = ms;
+    }
+
+    // observer вызывается после каждого кадра с временем его отрисовки (без задержки кадра)
+    void set_frame_observer(function<void(chrono::nanoseconds)> observer)
+    {
+        frame_observer = move(observer);
+    }
+
+    // Кадров нарисовано с начала работы
+    uint64_t frames_drawn() const
+    {
+        return frames;
+    }
+
+    // Текстур создано с начала работы
+    uint64_t textures_loaded() const
+    {
+        return texture_loads;
+    }
+
     // Освободить все ресурсы SDL (вызывать при завершении работы)
     void quit()
     {
-        SDL_DestroyTexture(board);
-        SDL_DestroyTexture(w_piece);
-        SDL_DestroyTexture(b_piece);
-        SDL_DestroyTexture(w_queen);
-        SDL_DestroyTexture(b_queen);
-        SDL_DestroyTexture(back);
-        SDL_DestroyTexture(replay);
+        decoder.join();
+        for (auto &texture : textures)
+        {
+            SDL_DestroyTexture(texture);
+            texture = nullptr;
+        }
         SDL_DestroyRenderer(ren);
         SDL_DestroyWindow(win);
         SDL_Quit();
@@ -234,6 +334,58 @@ public:
     }
 
 private:
+    // Создаёт текстуру i из декодированной картинки, считая созданные текстуры.
+    // wait = false: если картинка ещё декодируется, ничего не делает и возвращает false
+    bool upload_texture(const size_t i, const bool wait)
+    {
+        if (uploaded[i])
+            return true;
+        if (!wait && !decoder.ready(i))
+            return false;
+        uploaded[i] = true;
+        SDL_Surface *surface = decoder.take(i, true);
+        if (surface == nullptr)
+        {
+            print_exception("IMG_Load_RW can't decode " + string(texture_files[i]) + ": " + decoder.error(i));
+            return true;
+        }
+        ++texture_loads;
+        textures[i] = SDL_CreateTextureFromSurface(ren, surface);
+        SDL_FreeSurface(surface);
+        if (textures[i] == nullptr)
+            print_exception("SDL_CreateTextureFromSurface can't create texture " + string(texture_files[i]));
+        return true;
+    }
+
+    // Создаёт готовые фоновые текстуры; когда созданы все — пишет время загрузки в журнал
+    void upload_pending()
+    {
+        if (!assets_pending)
+            return;
+        bool all = true;
+        for (size_t i = First_frame_textures; i < Texture_count; ++i)
+            all = upload_texture(i, false) && all;
+        if (all)
+            finish_assets();
+    }
+
+    void finish_assets()
+    {
+        assets_pending = false;
+        decoder.join();
+        startup.assets = startup_ms();
+        Logger::instance().info("assets_ready", {{"time_ms", startup.assets},
+                                                 {"decode_wall_ms", decoder.elapsed_ms()},
+                                                 {"decode_cpu_ms", decoder.decode_ms()},
+                                                 {"threads", int64_t(decoder.threads())},
+                                                 {"textures", int64_t(texture_loads)}});
+    }
+
+    double startup_ms() const
+    {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - startup.start).count();
+    }
+
     // Сохраняет текущее состояние доски и серию взятий в историю
     void add_history(const int beat_series = 0)
     {
@@ -260,9 +412,12 @@ private:
     // Перерисовывает всё содержимое окна (доска, фигуры, подсветка, результат и т.д.)
     void rerender()
     {
+        TRACE_SCOPE("frame", "render");
+        const auto frame_start = chrono::steady_clock::now();
+        upload_pending();
         // draw board
         SDL_RenderClear(ren);
-        SDL_RenderCopy(ren, board, NULL, NULL);
+        SDL_RenderCopy(ren, textures[BOARD_TEXTURE], NULL, NULL);
 
         // draw pieces
         for (POS_T i = 0; i < 8; ++i)
@@ -277,22 +432,36 @@ private:
 
                 SDL_Texture* piece_texture;
                 if (mtx[i][j] == 1)
-                    piece_texture = w_piece;
+                    piece_texture = textures[PIECE_WHITE_TEXTURE];
                 else if (mtx[i][j] == 2)
-                    piece_texture = b_piece;
+                    piece_texture = textures[PIECE_BLACK_TEXTURE];
                 else if (mtx[i][j] == 3)
-                    piece_texture = w_queen;
+                    piece_texture = textures[QUEEN_WHITE_TEXTURE];
                 else
-                    piece_texture = b_queen;
+                    piece_texture = textures[QUEEN_BLACK_TEXTURE];
 
                 SDL_RenderCopy(ren, piece_texture, NULL, &rect);
             }
         }
 
-        // draw hilight
-        SDL_SetRenderDrawColor(ren, 0, 255, 0, 0);
         const double scale = 2.5;
         SDL_RenderSetScale(ren, scale, scale);
+        // draw hints: путь фигуры через центры клеток, лучший ход — жёлтым, остальные — голубым
+        for (size_t k = hints.size(); k-- > 0;)
+        {
+            if (k == 0)
+                SDL_SetRenderDrawColor(ren, 255, 215, 0, 0);
+            else
+                SDL_SetRenderDrawColor(ren, 0, 160, 255, 0);
+            for (const auto &step : hints[k])
+            {
+                SDL_RenderDrawLine(ren, int(W * (step.y + 1.5) / 10 / scale), int(H * (step.x + 1.5) / 10 / scale),
+                                   int(W * (step.y2 + 1.5) / 10 / scale), int(H * (step.x2 + 1.5) / 10 / scale));
+            }
+        }
+
+        // draw hilight
+        SDL_SetRenderDrawColor(ren, 0, 255, 0, 0);
         for (POS_T i = 0; i < 8; ++i)
         {
             for (POS_T j = 0; j < 8; ++j)
@@ -315,43 +484,61 @@ private:
         }
         SDL_RenderSetScale(ren, 1, 1);
 
-        // draw arrows
+        // draw arrows (пока кнопки не декодированы — без них)
         SDL_Rect rect_left{ W / 40, H / 40, W / 15, H / 15 };
-        SDL_RenderCopy(ren, back, NULL, &rect_left);
+        if (textures[BACK_TEXTURE])
+            SDL_RenderCopy(ren, textures[BACK_TEXTURE], NULL, &rect_left);
         SDL_Rect replay_rect{ W * 109 / 120, H / 40, W / 15, H / 15 };
-        SDL_RenderCopy(ren, replay, NULL, &replay_rect);
+        if (textures[REPLAY_TEXTURE])
+            SDL_RenderCopy(ren, textures[REPLAY_TEXTURE], NULL, &replay_rect);
 
         // draw result
         if (game_results != -1)
         {
-            string result_path = draw_path;
+            size_t result_id = DRAW_TEXTURE;
             if (game_results == 1)
-                result_path = white_path;
+                result_id = WHITE_WINS_TEXTURE;
             else if (game_results == 2)
-                result_path = black_path;
-            SDL_Texture* result_texture = IMG_LoadTexture(ren, result_path.c_str());
-            if (result_texture == nullptr)
+                result_id = BLACK_WINS_TEXTURE;
+            // Экран результата нужен сейчас: если он ещё декодируется, ждём
             {
-                print_exception("IMG_LoadTexture can't load game result picture from " + result_path);
-                return;
+                TRACE_SCOPE("load_result_texture", "render");
+                upload_texture(result_id, true);
             }
+            SDL_Texture *result_texture = textures[result_id];
+            if (result_texture == nullptr)
+                return;
             SDL_Rect res_rect{ W / 5, H * 3 / 10, W * 3 / 5, H * 2 / 5 };
             SDL_RenderCopy(ren, result_texture, NULL, &res_rect);
-            SDL_DestroyTexture(result_texture);
         }
 
-        SDL_RenderPresent(ren);
+        {
+            TRACE_SCOPE("present", "render");
+            SDL_RenderPresent(ren);
+        }
+        if (++frames == 1)
+        {
+            startup.first_frame = startup_ms();
+            decoder.release(); // остальные картинки — после первого кадра
+        }
+        if (frame_observer)
+            frame_observer(chrono::steady_clock::now() - frame_start);
         // next rows for mac os
-        SDL_Delay(10);
-        SDL_Event windowEvent;
-        SDL_PollEvent(&windowEvent);
+        {
+            TRACE_SCOPE("frame_delay", "render");
+            if (frame_delay_ms)
+                SDL_Delay(frame_delay_ms);
+        }
+        {
+            TRACE_SCOPE("poll_events", "render");
+            SDL_Event windowEvent;
+            SDL_PollEvent(&windowEvent);
+        }
     }
 
     // Запись ошибки в лог-файл
     void print_exception(const string& text) {
-        ofstream fout(project_path + "log.txt", ios_base::app);
-        fout << "Error: " << text << ". "<< SDL_GetError() << endl;
-        fout.close();
+        Logger::instance().error("render_error", {{"message", text}, {"sdl_error", SDL_GetError()}});
     }
 
   public:
@@ -363,32 +550,43 @@ private:
   private:
     SDL_Window *win = nullptr; // окно SDL
     SDL_Renderer *ren = nullptr; // рендерер SDL
-    // textures
-    SDL_Texture *board = nullptr; // текстура доски
-    SDL_Texture *w_piece = nullptr; // текстура белой шашки
-    SDL_Texture *b_piece = nullptr; // текстура чёрной шашки
-    SDL_Texture *w_queen = nullptr; // текстура белой дамки
-    SDL_Texture *b_queen = nullptr; // текстура чёрной дамки
-    SDL_Texture *back = nullptr; // текстура кнопки "назад"
-    SDL_Texture *replay = nullptr; // текстура кнопки "повтор"
-    // texture files names
-    const string textures_path = project_path + "Textures/";
-    const string board_path = textures_path + "board.png";
-    const string piece_white_path = textures_path + "piece_white.png";
-    const string piece_black_path = textures_path + "piece_black.png";
-    const string queen_white_path = textures_path + "queen_white.png";
-    const string queen_black_path = textures_path + "queen_black.png";
-    const string white_path = textures_path + "white_wins.png";
-    const string black_path = textures_path + "black_wins.png";
-    const string draw_path = textures_path + "draw.png";
-    const string back_path = textures_path + "back.png";
-    const string replay_path = textures_path + "replay.png";
+    // textures: сначала нужные для первого кадра, затем кнопки и экраны результата
+    enum TextureId
+    {
+        BOARD_TEXTURE,
+        PIECE_WHITE_TEXTURE,
+        PIECE_BLACK_TEXTURE,
+        QUEEN_WHITE_TEXTURE,
+        QUEEN_BLACK_TEXTURE,
+        BACK_TEXTURE,
+        REPLAY_TEXTURE,
+        WHITE_WINS_TEXTURE,
+        BLACK_WINS_TEXTURE,
+        DRAW_TEXTURE,
+        Texture_count
+    };
+    static constexpr size_t First_frame_textures = BACK_TEXTURE;
+    // texture files names (встроены в программу, Game/Textures.h)
+    static constexpr const char *texture_files[Texture_count] = {
+        "board.png",  "piece_white.png", "piece_black.png", "queen_white.png", "queen_black.png",
+        "back.png",   "replay.png",      "white_wins.png",  "black_wins.png",  "draw.png"};
+    SDL_Texture *textures[Texture_count] = {};
+    bool uploaded[Texture_count] = {}; // текстура создана (или не удалась)
+    AssetDecoder decoder;              // фоновое декодирование картинок
+    bool assets_pending = false;       // первый кадр нарисован, часть текстур ещё не создана
+    StartupTimes startup;
     // coordinates of chosen cell
     int active_x = -1, active_y = -1; // координаты выделенной клетки
     // game result if exist
     int game_results = -1; // результат партии (-1 — не завершена)
     // matrix of possible moves
     vector<vector<bool>> is_highlighted_ = vector<vector<bool>>(8, vector<bool>(8, 0)); // подсветка клеток
+    vector<vector<move_pos>> hints; // подсказки: ходы от лучшего к худшему
+    // render settings and counters
+    bool software_renderer = false;
+    unsigned int frame_delay_ms = 10;
+    function<void(chrono::nanoseconds)> frame_observer; // время отрисовки каждого кадра
+    uint64_t frames = 0, texture_loads = 0;
     // matrix of possible moves
     // 1 - white, 2 - black, 3 - white queen, 4 - black queen
     vector<vector<POS_T>> mtx = vector<vector<POS_T>>(8, vector<POS_T>(8, 0)); // матрица доски
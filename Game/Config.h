@@ -1,11 +1,30 @@
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <filesystem>
 #include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
+#ifdef __linux__
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+#include "../Engine/Log.h"
+#include "../Engine/Settings.h"
 #include "../Models/Project_path.h"
 
-class Config
+using namespace std;
+
+// Настройки приложения из settings.json с горячей перезагрузкой
+class Config : public SettingsStore
 {
   public:
     Config()
@@ -13,21 +32,287 @@ class Config
         reload();
     }
 
-    // Загружает настройки из файла settings.json в объект config
+    ~Config()
+    {
+        stop_watch();
+    }
+
+    // Загружает настройки из файла settings.json и атомарно подменяет снимок.
+    // Если файл некорректен — бросает исключение, старый снимок остаётся в силе
     void reload()
     {
-        std::ifstream fin(project_path + "settings.json");
+        std::ifstream fin(path());
+        if (!fin)
+            throw runtime_error("can't open " + path());
+        json config;
         fin >> config;
         fin.close();
+        set(parse(config));
     }
 
-    // Позволяет обращаться к настройкам как к элементам двумерного массива:
-    // config("Bot", "IsWhiteBot") вернёт значение настройки IsWhiteBot из раздела Bot
-    auto operator()(const string &setting_dir, const string &setting_name) const
+    // Запускает фоновое отслеживание settings.json (inotify на Linux, опрос mtime на остальных ОС).
+    // При изменении файла снимок перечитывается без перезапуска партии
+    void start_watch()
     {
-        return config[setting_dir][setting_name];
+        if (watcher.joinable())
+            return;
+        stop_requested = false;
+#ifdef __linux__
+        stop_fd = eventfd(0, EFD_CLOEXEC);
+#endif
+        watcher = thread(&Config::watch_loop, this);
+    }
+
+    // Останавливает отслеживание файла
+    void stop_watch()
+    {
+        if (!watcher.joinable())
+            return;
+        stop_requested = true;
+#ifdef __linux__
+        uint64_t one = 1;
+        if (write(stop_fd, &one, sizeof(one)) < 0)
+        {
+        }
+#endif
+        watcher.join();
+#ifdef __linux__
+        close(stop_fd);
+        stop_fd = -1;
+#endif
     }
 
   private:
-    json config;
+    // Разбирает и проверяет json, при ошибке бросает runtime_error с именем настройки
+    static Settings parse(const json &j)
+    {
+        Settings s;
+        s.width = get_uint(j, "WindowSize", "Width");
+        // в settings.json исторически используется "Hight", поддерживаем оба написания
+        s.height = j.contains("WindowSize") && j["WindowSize"].contains("Height") ? get_uint(j, "WindowSize", "Height")
+                                                                                  : get_uint(j, "WindowSize", "Hight");
+        s.is_bot[0] = get_bool(j, "Bot", "IsWhiteBot");
+        s.is_bot[1] = get_bool(j, "Bot", "IsBlackBot");
+        s.bot_level[0] = get_uint(j, "Bot", "WhiteBotLevel");
+        s.bot_level[1] = get_uint(j, "Bot", "BlackBotLevel");
+        s.bot_delay_ms = get_uint(j, "Bot", "BotDelayMS");
+        s.no_random = get_bool(j, "Bot", "NoRandom");
+        s.max_num_turns = get_uint(j, "Game", "MaxNumTurns");
+        s.repetition_draw = get_uint_or(j, "Game", "RepetitionDraw", s.repetition_draw);
+        s.hint_moves = get_uint_or(j, "Game", "HintMoves", s.hint_moves);
+        s.hint_depth = get_uint_or(j, "Game", "HintDepth", s.hint_depth);
+        s.hint_time_ms = get_uint_or(j, "Game", "HintTimeMS", s.hint_time_ms);
+        if (j.contains("Log") && j["Log"].contains("Level"))
+        {
+            const string level = get_string(j, "Log", "Level");
+            if (level == "Debug")
+                s.log_level = LogLevel::Debug;
+            else if (level == "Info")
+                s.log_level = LogLevel::Info;
+            else if (level == "Warning")
+                s.log_level = LogLevel::Warning;
+            else if (level == "Error")
+                s.log_level = LogLevel::Error;
+            else
+                throw runtime_error("Log.Level: unknown value \"" + level + "\"");
+        }
+        s.log_max_kb = get_uint_or(j, "Log", "MaxKB", s.log_max_kb);
+        s.log_files = get_uint_or(j, "Log", "Files", s.log_files);
+        s.no_progress_turns = get_uint_or(j, "Game", "NoProgressTurns", s.no_progress_turns);
+
+        const string scoring = get_string(j, "Bot", "BotScoringType");
+        if (scoring == "NumberOnly")
+            s.scoring = ScoringMode::NumberOnly;
+        else if (scoring == "NumberAndPotential")
+            s.scoring = ScoringMode::NumberAndPotential;
+        else
+            throw runtime_error("Bot.BotScoringType: unknown value \"" + scoring + "\"");
+
+        const string opt = get_string(j, "Bot", "Optimization");
+        if (opt == "O0")
+            s.optimization = OptLevel::O0;
+        else if (opt == "O1")
+            s.optimization = OptLevel::O1;
+        else if (opt == "O2")
+            s.optimization = OptLevel::O2;
+        else
+            throw runtime_error("Bot.Optimization: unknown value \"" + opt + "\"");
+
+        // BotAlgorithm задаёт алгоритм обоим ботам, WhiteBotAlgorithm/BlackBotAlgorithm — отдельно
+        s.algorithm[0] = s.algorithm[1] = get_algorithm_or(j, "BotAlgorithm", BotAlgorithm::Minimax);
+        s.algorithm[0] = get_algorithm_or(j, "WhiteBotAlgorithm", s.algorithm[0]);
+        s.algorithm[1] = get_algorithm_or(j, "BlackBotAlgorithm", s.algorithm[1]);
+        s.mcts_time_ms = get_uint_or(j, "Bot", "MctsTimeMS", s.mcts_time_ms);
+        s.mcts_playouts = get_uint_or(j, "Bot", "MctsPlayouts", s.mcts_playouts);
+        s.mcts_threads = get_uint_or(j, "Bot", "MctsThreads", s.mcts_threads);
+        s.mcts_exploration = get_double_or(j, "Bot", "MctsExploration", s.mcts_exploration);
+        s.mcts_playout_turns = get_uint_or(j, "Bot", "MctsPlayoutTurns", s.mcts_playout_turns);
+        s.mcts_tree_mb = get_uint_or(j, "Bot", "MctsTreeMB", s.mcts_tree_mb);
+        if (!s.mcts_time_ms && !s.mcts_playouts)
+            throw runtime_error("Bot.MctsTimeMS, Bot.MctsPlayouts: at least one limit is required");
+        if (!s.mcts_tree_mb)
+            throw runtime_error("Bot.MctsTreeMB: must be positive");
+        s.solver_pieces = get_uint_or(j, "Bot", "SolverPieces", s.solver_pieces);
+        s.solver_nodes = get_uint_or(j, "Bot", "SolverNodes", unsigned(s.solver_nodes));
+        s.solver_table_mb = get_uint_or(j, "Bot", "SolverTableMB", s.solver_table_mb);
+        if (s.solver_pieces && (!s.solver_nodes || !s.solver_table_mb))
+            throw runtime_error("Bot.SolverNodes, Bot.SolverTableMB: must be positive when Bot.SolverPieces is set");
+
+        s.futility_margin = get_uint_or(j, "Bot", "O2FutilityMargin", s.futility_margin);
+        s.probcut_margin = get_uint_or(j, "Bot", "O2ProbCutMargin", s.probcut_margin);
+        s.probcut_depth = get_uint_or(j, "Bot", "O2ProbCutDepth", s.probcut_depth);
+        s.lmr_moves = get_uint_or(j, "Bot", "O2LmrMoves", s.lmr_moves);
+        s.lmr_depth = get_uint_or(j, "Bot", "O2LmrDepth", s.lmr_depth);
+
+        if (j.contains("Bot") && j["Bot"].contains("LevelTimeMS"))
+        {
+            const json &budgets = j["Bot"]["LevelTimeMS"];
+            if (!budgets.is_array())
+                throw runtime_error("Bot.LevelTimeMS: expected array of unsigned int");
+            for (const auto &budget : budgets)
+            {
+                if (!budget.is_number_unsigned())
+                    throw runtime_error("Bot.LevelTimeMS: expected array of unsigned int");
+                s.level_time_ms.push_back(budget.get<unsigned int>());
+            }
+        }
+
+        s.shared_cache_mb = get_uint_or(j, "Bot", "SharedCacheMB", s.shared_cache_mb);
+        if (j.contains("Bot") && j["Bot"].contains("SharedCacheName"))
+        {
+            s.shared_cache_name = get_string(j, "Bot", "SharedCacheName");
+            if (s.shared_cache_name.size() < 2 || s.shared_cache_name[0] != '/' ||
+                s.shared_cache_name.find('/', 1) != string::npos)
+                throw runtime_error("Bot.SharedCacheName: expected \"/name\" without other slashes");
+        }
+        return s;
+    }
+
+    static const json &get(const json &j, const string &dir, const string &name)
+    {
+        if (!j.contains(dir) || !j[dir].contains(name))
+            throw runtime_error(dir + "." + name + ": missing");
+        return j[dir][name];
+    }
+    static unsigned int get_uint(const json &j, const string &dir, const string &name)
+    {
+        const json &v = get(j, dir, name);
+        if (!v.is_number_unsigned())
+            throw runtime_error(dir + "." + name + ": expected unsigned int");
+        return v.get<unsigned int>();
+    }
+    // Необязательная настройка: при отсутствии берётся значение по умолчанию
+    static unsigned int get_uint_or(const json &j, const string &dir, const string &name, const unsigned int def)
+    {
+        return (j.contains(dir) && j[dir].contains(name)) ? get_uint(j, dir, name) : def;
+    }
+    static double get_double_or(const json &j, const string &dir, const string &name, const double def)
+    {
+        if (!j.contains(dir) || !j[dir].contains(name))
+            return def;
+        const json &v = j[dir][name];
+        if (!v.is_number() || v.get<double>() < 0)
+            throw runtime_error(dir + "." + name + ": expected non-negative number");
+        return v.get<double>();
+    }
+    static bool get_bool(const json &j, const string &dir, const string &name)
+    {
+        const json &v = get(j, dir, name);
+        if (!v.is_boolean())
+            throw runtime_error(dir + "." + name + ": expected true/false");
+        return v.get<bool>();
+    }
+    static string get_string(const json &j, const string &dir, const string &name)
+    {
+        const json &v = get(j, dir, name);
+        if (!v.is_string())
+            throw runtime_error(dir + "." + name + ": expected string");
+        return v.get<string>();
+    }
+
+    static BotAlgorithm get_algorithm_or(const json &j, const string &name, const BotAlgorithm def)
+    {
+        if (!j.contains("Bot") || !j["Bot"].contains(name))
+            return def;
+        const string value = get_string(j, "Bot", name);
+        if (value == "Minimax")
+            return BotAlgorithm::Minimax;
+        if (value == "MCTS")
+            return BotAlgorithm::Mcts;
+        throw runtime_error("Bot." + name + ": unknown value \"" + value + "\"");
+    }
+
+    static string path()
+    {
+        return project_path + "settings.json";
+    }
+
+    // Перечитывает настройки из фонового потока; ошибки пишутся в лог, игра продолжает со старым снимком
+    void try_reload()
+    {
+        try
+        {
+            reload();
+        }
+        catch (const exception &e)
+        {
+            Logger::instance().error("settings_reload_failed", {{"message", e.what()}});
+        }
+    }
+
+    void watch_loop()
+    {
+#ifdef __linux__
+        // Следим за каталогом, а не за файлом: редакторы часто сохраняют через переименование
+        string dir = project_path.empty() ? string(".") : project_path;
+        int fd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+        if (fd < 0 || inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            if (fd >= 0)
+                close(fd);
+            return;
+        }
+        alignas(inotify_event) char buf[4096];
+        while (!stop_requested)
+        {
+            pollfd fds[2] = {{fd, POLLIN, 0}, {stop_fd, POLLIN, 0}};
+            if (poll(fds, 2, -1) < 0 || (fds[1].revents & POLLIN))
+                break;
+            bool changed = false;
+            ssize_t len;
+            while ((len = read(fd, buf, sizeof(buf))) > 0)
+            {
+                for (char *p = buf; p < buf + len;)
+                {
+                    auto *ev = reinterpret_cast<inotify_event *>(p);
+                    if (ev->len && string(ev->name) == "settings.json")
+                        changed = true;
+                    p += sizeof(inotify_event) + ev->len;
+                }
+            }
+            if (changed)
+                try_reload();
+        }
+        close(fd);
+#else
+        error_code ec;
+        auto last = filesystem::last_write_time(path(), ec);
+        while (!stop_requested)
+        {
+            this_thread::sleep_for(chrono::milliseconds(500));
+            auto now = filesystem::last_write_time(path(), ec);
+            if (!ec && now != last)
+            {
+                last = now;
+                try_reload();
+            }
+        }
+#endif
+    }
+
+    thread watcher;                      // поток отслеживания settings.json
+    atomic<bool> stop_requested{false};
+#ifdef __linux__
+    int stop_fd = -1; // eventfd для пробуждения потока при остановке
+#endif
 };
@@ -2,19 +2,32 @@
 #include <chrono>
 #include <thread>
 
+#include "../Engine/Hints.h"
+#include "../Engine/Logic.h"
+#include "../Engine/Mcts.h"
+#include "../Engine/Pdn.h"
+#include "../Engine/Solver.h"
 #include "../Models/Project_path.h"
 #include "Board.h"
 #include "Config.h"
 #include "Hand.h"
-#include "Logic.h"
 
 class Game
 {
   public:
-    Game() : board(config("WindowSize", "Width"), config("WindowSize", "Hight")), hand(&board), logic(&board, &config)
+    Game()
+        : board(config.snapshot()->width, config.snapshot()->height), hand(&board), logic(&config), mcts(&config),
+          solver(&config)
     {
-        ofstream fout(project_path + "log.txt", ios_base::trunc);
-        fout.close();
+        auto settings = config.snapshot();
+        Logger::instance().open(project_path + "log.jsonl", settings->log_level, size_t(settings->log_max_kb) * 1024,
+                                settings->log_files);
+        settings_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - created).count();
+    }
+
+    ~Game()
+    {
+        Logger::instance().close(); // дописываем очередь журнала
     }
 
     // to start checkers
@@ -25,32 +38,46 @@ class Game
         // Если выбран режим повтора партии
         if (is_replay)
         {
-            logic = Logic(&board, &config); // пересоздаём объект логики
-            config.reload();                // перечитываем настройки
+            logic = Logic(&config);         // пересоздаём объект логики
+            mcts.clear();                   // дерево MCTS прошлой партии больше не нужно
             board.redraw();                 // перерисовываем доску
         }
         else
         {
-            board.start_draw();             // начальная отрисовка доски
+            if (board.start_draw() == 0)    // начальная отрисовка доски
+                log_startup();
+            config.start_watch();           // перечитываем settings.json на лету — уже после первого кадра
         }
         is_replay = false;
 
         int turn_num = -1;
         bool is_quit = false;
-        const int Max_turns = config("Game", "MaxNumTurns"); // максимальное число ходов
+        bool is_draw = false; // ничья по повторению или по правилу ходов без прогресса
+        const int Max_turns = config.snapshot()->max_num_turns; // максимальное число ходов
         // Основной игровой цикл
         while (++turn_num < Max_turns)
         {
             beat_series = 0; // сбрасываем серию взятий
-            logic.find_turns(turn_num % 2); // ищем возможные ходы для текущего игрока
+            // Передаём логике историю партии и проверяем ничейные правила
+            logic.set_history(turn_positions(), false);
+            if (logic.history_is_draw())
+            {
+                is_draw = true;
+                break;
+            }
+            logic.find_turns(turn_num % 2, board.get_board()); // ищем возможные ходы для текущего игрока
             if (logic.turns.empty())        // если ходов нет — конец игры
                 break;
+            // Берём актуальный снимок настроек: боты перенастраиваются без перезапуска партии
+            auto settings = config.snapshot();
+            Logger::instance().set_level(settings->log_level);
             // Устанавливаем уровень сложности бота для текущего цвета
-            logic.Max_depth = config("Bot", string((turn_num % 2) ? "Black" : "White") + string("BotLevel"));
+            logic.Max_depth = settings->bot_level[turn_num % 2];
             // Если ходит человек
-            if (!config("Bot", string("Is") + string((turn_num % 2) ? "Black" : "White") + string("Bot")))
+            if (!settings->is_bot[turn_num % 2])
             {
                 auto resp = player_turn(turn_num % 2); // обработка хода игрока
+                stop_hints();
                 if (resp == Response::QUIT)
                 {
                     is_quit = true; // игрок выбрал выход
@@ -64,7 +91,7 @@ class Game
                 else if (resp == Response::BACK)
                 {
                     // Откат ходов, если выбран возврат
-                    if (config("Bot", string("Is") + string((1 - turn_num % 2) ? "Black" : "White") + string("Bot")) &&
+                    if (settings->is_bot[1 - turn_num % 2] &&
                         !beat_series && board.history_mtx.size() > 2)
                     {
                         board.rollback();
@@ -84,9 +111,10 @@ class Game
         // Засекаем время окончания партии
         auto end = chrono::steady_clock::now();
         // Записываем время игры в лог
-        ofstream fout(project_path + "log.txt", ios_base::app);
-        fout << "Game time: " << (int)chrono::duration<double, milli>(end - start).count() << " millisec\n";
-        fout.close();
+        Logger::instance().info("game_time", {{"time_ms", int64_t(chrono::duration<double, milli>(end - start).count())},
+                                              {"turns", turn_num},
+                                              {"replay", is_replay},
+                                              {"quit", is_quit}});
 
         // Если был выбран повтор — запускаем партию заново
         if (is_replay)
@@ -94,16 +122,17 @@ class Game
         // Если был выход — возвращаем 0
         if (is_quit)
             return 0;
-        int res = 2; // результат партии: 0 — ничья, 1 — победа чёрных, 2 — победа белых
-        if (turn_num == Max_turns)
+        int res = 2; // результат партии: 0 — ничья, 1 — победа белых, 2 — победа чёрных
+        if (turn_num == Max_turns || is_draw)
         {
-            res = 0; // ничья по лимиту ходов
+            res = 0; // ничья по лимиту ходов, повторению или без прогресса
         }
         else if (turn_num % 2)
         {
-            res = 1; // победа чёрных
+            res = 1; // у чёрных нет ходов — победа белых
         }
         board.show_final(res); // показываем финальный экран
+        save_game(res);        // дописываем партию в games.pdn
         auto resp = hand.wait(); // ждём действия игрока (например, повтор)
         if (resp == Response::REPLAY)
         {
@@ -114,16 +143,113 @@ class Game
     }
 
   private:
+    // Время запуска до первого кадра по этапам, мс (запись startup в журнале; assets_ready пишет Board)
+    void log_startup()
+    {
+        const auto &t = board.startup_times();
+        const double total_ms = chrono::duration<double, milli>(t.start - created).count() + t.first_frame;
+        Logger::instance().info("startup", {{"settings_ms", settings_ms},
+                                            {"sdl_init_ms", t.sdl_init},
+                                            {"window_ms", t.window - t.sdl_init},
+                                            {"renderer_ms", t.renderer - t.window},
+                                            {"textures_ms", t.textures - t.renderer},
+                                            {"first_frame_ms", t.first_frame - t.textures},
+                                            {"total_ms", total_ms}});
+    }
+
+    // Запускает фоновый поиск подсказок для человека, играющего color (HintMoves)
+    void start_hints(const bool color)
+    {
+        auto settings = config.snapshot();
+        if (settings->hint_moves <= 0)
+            return;
+        SearchLimits limits;
+        limits.depth = settings->hint_depth;
+        if (settings->hint_time_ms)
+            limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(settings->hint_time_ms);
+        hints.start(logic, board.get_board(), color, settings->hint_moves, limits);
+    }
+
+    // Подсвечивает готовые подсказки: первый ход каждой найденной строки
+    void show_hints()
+    {
+        vector<vector<move_pos>> turns;
+        for (const auto &line : hints.take())
+            turns.push_back(split_line(line.pv).front());
+        board.set_hints(turns);
+    }
+
+    // Останавливает поиск подсказок и убирает их с доски
+    void stop_hints()
+    {
+        hints.stop();
+        board.clear_hints();
+    }
+
+    // Число шашек и дамок на доске
+    static int count_pieces(const vector<vector<POS_T>> &mtx)
+    {
+        int res = 0;
+        for (const auto &row : mtx)
+            for (const POS_T cell : row)
+                res += (cell != 0);
+        return res;
+    }
+
+    // Позиции на границах ходов из истории доски (без промежуточных шагов серий взятий)
+    vector<vector<vector<POS_T>>> turn_positions() const
+    {
+        const auto &history = board.history_mtx;
+        const auto &beat_series = board.get_history_beat_series();
+        vector<vector<vector<POS_T>>> res;
+        for (size_t i = 0; i < history.size(); ++i)
+        {
+            if (i + 1 == history.size() || beat_series[i + 1] <= 1)
+                res.push_back(history[i]);
+        }
+        return res;
+    }
+
+    // Дописывает завершённую партию в games.pdn, ходы восстанавливаются по истории доски
+    void save_game(const int res)
+    {
+        auto settings = config.snapshot();
+        GameRecord game = record_from_history(logic, board.history_mtx, board.get_history_beat_series());
+        game.result = GameResult(res);
+        game.tags = {{"Event", "Checkers"},
+                     {"Date", pdn_date()},
+                     {"White", settings->is_bot[0] ? "Bot level " + to_string(settings->bot_level[0]) : "Human"},
+                     {"Black", settings->is_bot[1] ? "Bot level " + to_string(settings->bot_level[1]) : "Human"}};
+        ofstream fout(project_path + "games.pdn", ios_base::app);
+        fout << write_pdn(game);
+        fout.close();
+    }
+
     void bot_turn(const bool color)
     {
+        TRACE_SCOPE("bot_turn", "game");
         // Засекаем время начала хода бота
         auto start = chrono::steady_clock::now();
 
-        auto delay_ms = config("Bot", "BotDelayMS");
+        auto settings = config.snapshot();
+        const unsigned int delay_ms = settings->bot_delay_ms;
+        const bool use_mcts = (settings->algorithm[color] == BotAlgorithm::Mcts);
         // Запускаем отдельный поток для задержки (имитация раздумий бота)
         thread th(SDL_Delay, delay_ms);
-        auto turns = logic.find_best_turns(color); // Получаем лучший(ие) ход(ы) для бота
-        th.join(); // Дожидаемся завершения задержки
+        // При малом материале сначала пробуем доказать выигрыш решателем
+        SolveInfo solved;
+        if (settings->solver_pieces && count_pieces(board.get_board()) <= settings->solver_pieces)
+            solved = solver.solve(board.get_board(), color, SearchLimits(), logic.reversible_turns());
+        vector<move_pos> turns;
+        if (solved.outcome == SolveOutcome::Win)
+            turns = split_line(solved.line).front();
+        else // Получаем лучший(ие) ход(ы) для бота выбранным алгоритмом
+            turns = use_mcts ? mcts.search(board.get_board(), color, SearchLimits(), logic.reversible_turns())
+                             : minimax_turns(color, *settings);
+        {
+            TRACE_SCOPE("bot_delay", "game");
+            th.join(); // Дожидаемся завершения задержки
+        }
         bool is_first = true;
         // Выполняем все ходы из найденной последовательности
         for (auto turn : turns)
@@ -140,13 +266,46 @@ class Game
         // Засекаем время окончания хода бота
         auto end = chrono::steady_clock::now();
         // Записываем время хода бота в лог
-        ofstream fout(project_path + "log.txt", ios_base::app);
-        fout << "Bot turn time: " << (int)chrono::duration<double, milli>(end - start).count() << " millisec\n";
-        fout.close();
+        vector<LogField> fields{{"color", color ? "black" : "white"},
+                                {"time_ms", int64_t(chrono::duration<double, milli>(end - start).count())}};
+        if (use_mcts && solved.outcome != SolveOutcome::Win)
+        {
+            fields.emplace_back("playouts", mcts.playouts());
+            fields.emplace_back("tree_nodes", uint64_t(mcts.tree_nodes()));
+        }
+        else if (settings->shared_cache_mb && solved.outcome != SolveOutcome::Win)
+        {
+            fields.emplace_back("cache_hits", logic.shared_cache_hits());
+            if (!logic.shared_cache_error().empty())
+                fields.emplace_back("cache_error", logic.shared_cache_error());
+        }
+        if (solved.nodes)
+        {
+            fields.emplace_back("solver", solved.outcome == SolveOutcome::Win    ? "win"
+                                          : solved.outcome == SolveOutcome::Loss ? "loss"
+                                                                                 : "unknown");
+            fields.emplace_back("solver_nodes", solved.nodes);
+        }
+        Logger::instance().info("bot_turn", fields);
+    }
+
+    // Ход бота перебором на глубину уровня. С бюджетом уровня (LevelTimeMS) — итеративное углубление до той же
+    // глубины с ограничением по времени: ход не дольше бюджета, но на редких тяжёлых позициях мельче
+    vector<move_pos> minimax_turns(const bool color, const Settings &settings)
+    {
+        const size_t level = size_t(logic.Max_depth);
+        if (level >= settings.level_time_ms.size() || !settings.level_time_ms[level])
+            return logic.find_best_turns(color, board.get_board());
+        SearchLimits limits;
+        limits.depth = logic.Max_depth;
+        limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(settings.level_time_ms[level]);
+        return logic.search(board.get_board(), color, limits);
     }
 
     Response player_turn(const bool color)
     {
+        TRACE_SCOPE("player_turn", "game");
+        start_hints(color);
         // Формируем список клеток, доступных для хода
         vector<pair<POS_T, POS_T>> cells;
         for (auto turn : logic.turns)
@@ -159,7 +318,12 @@ class Game
         // Цикл выбора первой клетки (фигуры для хода)
         while (true)
         {
-            auto resp = hand.get_cell(); // Получаем действие игрока
+            auto resp = hand.get_cell([this] { return hints.ready(); }); // Получаем действие игрока
+            if (get<0>(resp) == Response::HINT)
+            {
+                show_hints(); // фоновый поиск нашёл лучшие ходы
+                continue;
+            }
             if (get<0>(resp) != Response::CELL)
                 return get<0>(resp); // Если не клетка — возвращаем результат (выход, откат и т.д.)
             pair<POS_T, POS_T> cell{get<1>(resp), get<2>(resp)};
@@ -206,6 +370,7 @@ class Game
             }
             board.highlight_cells(cells2); // подсвечиваем возможные клетки для хода выбранной фигурой
         }
+        stop_hints();
         board.clear_highlight();
         board.clear_active();
         board.move_piece(pos, pos.xb != -1); // выполняем ход
@@ -215,7 +380,7 @@ class Game
         beat_series = 1;
         while (true)
         {
-            logic.find_turns(pos.x2, pos.y2); // ищем возможные взятия с новой позиции
+            logic.find_turns(pos.x2, pos.y2, board.get_board()); // ищем возможные взятия с новой позиции
             if (!logic.have_beats)
                 break; // если больше нет взятий — серия завершена
 
@@ -259,10 +424,15 @@ class Game
     }
 
   private:
+    const chrono::steady_clock::time_point created = chrono::steady_clock::now(); // до разбора settings.json
+    double settings_ms = 0; // settings.json, журнал и объекты движка
     Config config;
     Board board;
     Hand hand;
     Logic logic;
+    Mcts mcts; // бот на поиске Монте-Карло (BotAlgorithm = "MCTS")
+    Solver solver; // доказательство выигрыша при малом материале (SolverPieces)
+    HintSearch hints; // лучшие ходы для человека, ищутся в фоне на время его хода (HintMoves)
     int beat_series;
     bool is_replay = false;
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include <tuple>
 
 #include "../Models/Move.h"
@@ -12,15 +13,23 @@ class Hand
     Hand(Board *board) : board(board)
     {
     }
-    // Ожидает выбор клетки игроком или другое действие (выход, откат, повтор)
-    tuple<Response, POS_T, POS_T> get_cell() const
+    // Ожидает выбор клетки игроком или другое действие (выход, откат, повтор).
+    // Если hints_ready вернёт true, ожидание прерывается ответом HINT
+    tuple<Response, POS_T, POS_T> get_cell(const function<bool()> &hints_ready = nullptr) const
     {
+        TRACE_SCOPE("get_cell", "input");
         SDL_Event windowEvent;
         Response resp = Response::OK;
         int x = -1, y = -1;
         int xc = -1, yc = -1;
         while (true)
         {
+            if (hints_ready && hints_ready())
+            {
+                resp = Response::HINT;
+                break;
+            }
+            board->poll_assets(); // кнопки, декодированные после первого кадра
             if (SDL_PollEvent(&windowEvent))
             {
                 switch (windowEvent.type)
@@ -73,10 +82,12 @@ class Hand
     // Ожидает одно из действий: выход или повтор партии
     Response wait() const
     {
+        TRACE_SCOPE("wait", "input");
         SDL_Event windowEvent;
         Response resp = Response::OK;
         while (true)
         {
+            board->poll_assets();
             if (SDL_PollEvent(&windowEvent))
             {
                 switch (windowEvent.type)
@@ -0,0 +1,4909 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+
+// Сгенерировано embed_textures.cpp из Textures/*.png, вручную не править
+
+struct EmbeddedTexture
+{
+    const char *name;          // имя файла
+    const unsigned char *data; // содержимое PNG
+    size_t size;
+};
+
+inline const unsigned char texture_back[9180] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,3,212,0,0,3,108,8,4,0,0,0,16,68,40,23,0,0,0,4,103,65,77,65,0,0,177,
+    143,11,252,97,5,0,0,0,32,99,72,82,77,0,0,122,38,0,0,128,132,0,0,250,0,0,0,128,232,0,0,117,48,0,0,234,96,0,0,58,152,0,
+    0,23,112,156,186,81,60,0,0,0,2,98,75,71,68,0,255,135,143,204,191,0,0,0,9,112,72,89,115,0,0,0,96,0,0,0,96,0,240,107,66,
+    207,0,0,0,7,116,73,77,69,7,229,3,26,11,32,55,211,53,131,246,0,0,34,207,73,68,65,84,120,218,237,221,217,179,165,215,121,
+    208,225,117,78,244,31,164,74,186,231,10,85,113,203,13,96,76,171,201,96,39,20,25,138,80,132,12,16,192,146,99,59,30,101,
+    217,178,60,91,150,100,217,150,71,217,24,226,144,162,130,153,41,82,134,48,136,138,32,14,46,160,2,49,24,58,42,166,48,84,
+    98,5,108,39,193,206,224,65,135,11,181,91,61,156,97,239,181,215,247,190,107,120,158,59,119,187,206,254,134,218,251,167,
+    119,173,175,247,57,58,41,192,214,174,156,124,190,252,161,163,236,163,0,70,116,156,125,0,48,191,167,78,46,151,167,179,
+    15,2,24,148,80,195,198,158,58,185,84,126,181,88,187,2,234,8,53,108,234,217,76,23,161,6,42,9,53,108,232,27,153,46,229,
+    153,236,67,1,6,37,212,176,153,231,50,109,162,6,106,9,53,108,228,250,76,11,53,80,75,168,97,19,55,102,90,168,129,90,66,
+    13,27,184,57,211,66,13,212,18,106,104,238,214,76,123,152,12,168,37,212,208,216,105,153,54,81,3,181,132,26,154,58,61,
+    211,66,13,212,18,106,104,232,172,76,11,53,80,75,168,161,153,179,51,109,143,26,168,37,212,208,200,121,153,54,81,3,181,
+    132,26,154,56,63,211,66,13,212,18,106,104,224,162,76,11,53,80,75,168,225,96,23,103,90,168,129,90,66,13,7,218,37,211,
+    30,38,3,106,9,53,28,100,183,76,155,168,129,90,66,13,7,216,53,211,66,13,212,18,106,168,182,123,166,133,26,168,37,212,
+    80,105,159,76,219,163,6,106,9,53,84,217,47,211,38,106,160,150,80,67,133,125,51,45,212,64,45,161,134,189,237,159,105,
+    161,6,106,9,53,236,169,38,211,246,168,129,90,66,13,123,169,203,180,137,26,168,37,212,176,135,218,76,11,53,80,75,168,
+    97,103,245,153,22,106,160,150,80,195,142,14,201,180,80,3,181,132,26,118,114,88,166,61,76,6,212,18,106,216,193,161,153,
+    54,81,3,181,132,26,46,116,120,166,133,26,168,37,212,112,129,22,153,22,106,160,150,80,195,185,218,100,218,30,53,80,75,
+    168,225,28,173,50,109,162,6,106,9,53,156,169,93,166,133,26,168,37,212,112,134,150,153,22,106,160,150,80,195,169,218,
+    102,90,168,129,90,66,13,167,104,157,105,15,147,1,181,132,26,110,209,62,211,38,106,160,150,80,195,77,182,200,180,80,3,
+    181,132,26,110,176,77,166,133,26,168,37,212,112,157,173,50,45,212,64,45,161,134,107,182,203,180,135,201,128,90,66,13,
+    87,109,153,105,19,53,80,75,168,161,148,178,117,166,133,26,168,37,212,80,182,207,180,80,3,181,132,26,2,50,109,143,26,
+    168,37,212,44,47,34,211,38,106,160,150,80,179,184,152,76,11,53,80,75,168,89,90,84,166,133,26,168,37,212,44,44,46,211,
+    66,13,212,18,106,150,21,153,105,15,147,1,181,132,154,69,197,102,218,68,13,212,18,106,150,20,157,105,161,6,106,9,53,11,
+    138,207,180,80,3,181,132,154,229,100,100,218,30,53,80,75,168,89,76,78,166,77,212,64,45,161,102,41,89,153,22,106,160,
+    150,80,179,144,188,76,11,53,80,75,168,89,70,102,166,237,81,3,181,132,154,69,228,102,218,68,13,212,18,106,150,144,157,
+    105,161,6,106,9,53,11,200,207,180,80,3,181,132,154,233,245,144,105,161,6,106,9,53,147,235,35,211,30,38,3,106,9,53,83,
+    235,37,211,38,106,160,150,80,51,177,126,50,45,212,64,45,161,102,90,61,101,90,168,129,90,66,205,164,250,202,180,61,106,
+    160,150,80,51,165,222,50,109,162,6,106,9,53,19,234,47,211,66,13,212,18,106,166,211,99,166,133,26,168,37,212,76,166,207,
+    76,219,163,6,106,9,53,83,233,53,211,38,106,160,150,80,51,145,126,51,45,212,64,45,161,102,26,61,103,90,168,129,90,66,
+    205,36,250,206,180,80,3,181,132,154,41,244,158,105,15,147,1,181,132,154,9,244,159,105,19,53,80,75,168,25,222,8,153,22,
+    106,160,150,80,51,184,49,50,45,212,64,45,161,102,104,163,100,218,30,53,80,75,168,25,216,56,153,54,81,3,181,132,154,97,
+    141,148,105,161,6,106,9,53,131,26,43,211,66,13,212,18,106,134,52,90,166,133,26,168,37,212,12,104,188,76,123,152,12,168,
+    37,212,12,103,196,76,155,168,129,90,66,205,96,198,204,180,80,3,181,132,154,161,140,154,105,161,6,106,9,53,3,25,55,211,
+    246,168,129,90,66,205,48,70,206,180,137,26,168,37,212,12,226,202,201,243,131,51,125,87,211,159,38,212,64,29,161,102,
+    8,79,157,92,46,79,135,190,226,139,202,187,154,254,60,161,6,234,8,53,3,136,95,244,126,81,249,104,249,166,166,63,209,30,
+    53,80,71,168,233,94,78,166,143,142,218,190,57,76,212,64,29,161,166,115,241,153,190,187,124,180,28,29,149,114,212,244,
+    167,10,53,80,71,168,233,90,70,166,63,82,142,142,74,105,253,230,16,106,160,142,80,211,177,204,76,155,168,129,62,8,53,
+    221,202,205,116,235,55,135,135,201,128,58,66,77,167,178,51,109,162,6,250,32,212,116,41,63,211,246,168,129,62,8,53,29,
+    138,207,244,61,183,100,218,68,13,244,65,168,233,78,124,166,95,81,30,191,37,211,246,168,129,62,8,53,157,201,200,244,123,
+    79,201,180,137,26,232,131,80,211,149,126,50,109,143,26,232,195,109,217,7,0,207,201,200,244,99,103,14,206,66,13,244,192,
+    68,77,55,250,202,116,235,165,111,123,212,64,29,161,166,19,189,101,218,68,13,244,65,168,233,66,127,153,246,48,25,208,
+    7,161,166,3,61,102,218,68,13,244,65,168,73,23,159,233,87,238,144,105,19,53,208,7,161,38,89,70,166,223,187,83,131,125,
+    225,9,208,3,161,38,85,191,153,54,81,3,125,16,106,18,245,156,105,123,212,64,31,132,154,52,125,103,218,68,13,244,65,168,
+    73,210,123,166,237,81,3,125,16,106,82,196,103,250,85,123,102,218,68,13,244,65,168,73,144,145,233,247,236,221,93,123,
+    212,64,15,132,154,112,99,100,90,168,129,62,8,53,193,70,201,180,165,111,160,15,66,77,168,113,50,237,97,50,160,15,66,77,
+    160,145,50,109,162,6,250,32,212,132,137,207,244,171,15,200,180,61,106,160,15,66,77,144,140,76,191,251,160,161,216,68,
+    13,244,64,168,9,49,94,166,75,57,110,90,106,123,212,64,29,161,38,192,136,153,46,165,237,76,109,162,6,234,8,53,155,27,
+    53,211,66,13,244,64,168,217,216,184,153,110,251,246,16,106,160,142,80,179,169,248,76,191,166,89,166,219,78,212,246,168,
+    129,58,66,205,134,50,50,253,104,195,186,154,168,129,124,66,205,102,70,207,180,80,3,61,16,106,54,50,126,166,61,76,6,244,
+    64,168,217,196,12,153,54,81,3,61,16,106,54,48,71,166,61,76,6,244,64,168,105,46,62,211,247,110,146,105,19,53,208,3,161,
+    166,177,140,76,191,107,147,76,219,163,6,122,32,212,52,53,83,166,77,212,64,15,132,154,134,174,156,60,63,56,211,247,111,
+    152,233,182,111,15,123,212,64,29,161,166,153,167,78,46,151,167,67,95,241,222,242,224,134,153,110,253,139,46,1,106,8,
+    53,141,204,181,232,253,172,198,191,145,218,234,55,80,65,168,105,34,62,211,175,221,60,211,222,30,64,15,124,18,209,64,
+    70,166,31,9,88,151,110,60,81,111,127,192,192,132,132,154,131,205,154,233,214,111,15,161,6,106,8,53,7,154,55,211,38,106,
+    160,7,66,205,65,102,206,180,137,26,232,129,80,115,128,185,51,237,237,1,244,192,39,17,213,226,51,125,95,104,166,45,125,
+    3,61,16,106,42,101,100,250,225,224,111,32,177,244,13,228,19,106,170,172,144,105,19,53,208,3,161,166,194,26,153,54,81,
+    3,61,16,106,246,182,74,166,125,215,55,208,3,161,102,79,235,100,218,68,13,244,64,168,217,203,74,153,182,71,13,244,64,
+    168,217,67,124,166,223,146,152,105,19,53,208,3,161,102,103,25,153,126,115,234,54,177,137,26,200,39,212,236,104,189,76,
+    155,168,129,30,8,53,59,89,49,211,158,250,6,122,32,212,236,96,205,76,155,168,129,30,8,53,23,90,53,211,66,13,244,224,182,
+    236,3,160,119,241,153,126,107,121,83,23,153,246,48,25,208,3,19,53,231,90,57,211,38,106,160,7,66,205,57,214,206,180,135,
+    201,128,30,8,53,103,90,61,211,38,106,160,7,66,205,25,100,218,30,53,208,3,161,230,84,50,93,138,137,26,232,129,80,115,
+    10,153,126,150,137,26,200,231,159,103,113,139,248,76,191,173,188,177,195,76,251,239,88,160,7,62,137,184,137,76,63,199,
+    68,13,228,19,106,110,32,211,215,179,71,13,228,19,106,174,35,211,55,50,81,3,249,132,154,107,100,250,102,38,106,32,159,
+    80,115,149,76,223,202,68,13,228,243,212,55,165,148,140,76,191,189,60,208,121,166,253,119,44,208,3,159,68,20,153,62,139,
+    165,111,32,159,80,35,211,103,178,244,13,228,19,234,229,201,244,217,76,212,64,62,161,94,156,76,159,199,68,13,228,19,234,
+    165,201,244,249,188,61,128,124,158,250,94,88,124,166,223,81,222,48,80,166,77,212,64,15,140,12,203,146,233,139,217,163,
+    6,242,9,245,162,100,122,23,38,106,32,159,80,47,73,166,119,99,162,6,242,9,245,130,100,122,87,67,30,52,48,25,161,94,142,
+    76,239,206,68,13,228,243,212,247,98,226,51,253,96,185,127,208,76,219,163,6,122,96,162,94,138,76,239,199,68,13,228,19,
+    234,133,200,244,190,132,26,200,39,212,203,144,233,253,89,250,6,242,9,245,34,100,186,134,183,7,144,207,39,209,18,100,
+    186,142,137,26,200,231,169,239,5,196,103,250,157,229,245,19,100,218,30,53,208,3,19,245,244,100,186,158,137,26,200,39,
+    212,147,147,233,67,152,168,129,124,66,61,53,153,62,204,68,167,2,12,75,168,39,38,211,135,50,81,3,249,132,122,90,50,125,
+    56,123,212,64,62,79,125,79,42,62,211,15,149,215,77,150,105,19,53,208,3,19,245,148,100,186,13,19,53,144,79,168,39,36,
+    211,173,120,123,0,249,124,18,77,71,166,219,49,81,3,249,132,122,50,50,221,146,61,106,32,159,80,79,69,166,219,18,106,32,
+    159,167,190,39,18,159,233,135,203,125,19,103,218,210,55,208,3,19,245,52,100,186,61,19,53,144,207,68,61,137,43,39,151,
+    202,211,129,175,119,84,30,43,47,159,60,211,38,106,160,7,38,234,41,60,117,114,89,166,55,57,79,128,108,66,61,129,232,69,
+    239,85,50,109,162,6,122,32,212,195,147,233,45,207,181,37,161,6,106,216,163,30,92,124,166,223,87,126,108,145,76,11,53,
+    208,3,19,245,208,100,122,235,243,5,200,38,212,3,147,233,237,207,184,37,19,53,80,67,168,135,37,211,17,231,220,146,80,
+    3,53,132,122,80,50,29,115,214,45,9,53,80,67,168,135,36,211,81,231,221,146,80,3,53,60,245,61,160,248,111,33,123,127,121,
+    217,130,153,246,21,162,64,15,76,212,195,137,255,22,178,85,51,13,208,3,161,30,76,252,162,247,202,153,182,244,13,228,19,
+    234,161,200,116,44,161,6,242,9,245,64,100,58,154,80,3,249,132,122,24,50,29,111,241,211,7,186,224,169,239,65,196,103,
+    250,3,229,165,203,119,202,68,13,228,51,81,15,65,166,115,8,53,144,79,168,7,32,211,89,132,26,200,39,212,221,147,233,60,
+    66,13,228,19,234,206,201,116,38,161,6,242,9,117,215,100,58,151,75,1,228,243,212,119,199,226,51,253,193,242,18,109,186,
+    142,137,26,200,103,162,238,150,76,231,19,106,32,159,80,119,74,166,123,32,212,64,62,161,238,146,76,247,65,168,129,124,
+    66,221,33,153,238,133,139,2,228,19,234,238,200,116,63,76,212,64,62,79,125,119,38,62,211,31,42,63,42,211,103,16,106,32,
+    159,137,186,43,50,221,23,161,6,242,9,117,71,100,186,55,66,13,228,19,234,110,200,116,127,92,30,32,159,80,119,66,166,123,
+    100,162,6,242,9,117,23,100,186,79,66,13,228,19,234,14,200,116,175,132,26,200,39,212,233,100,186,95,66,13,228,19,234,
+    100,50,221,51,161,6,242,249,194,147,84,241,153,254,112,121,177,76,239,204,165,2,242,153,168,19,201,116,239,76,212,64,
+    62,161,78,35,211,253,107,251,246,16,106,160,134,80,39,145,233,17,152,168,129,124,66,157,66,166,199,32,212,64,62,161,
+    78,32,211,163,112,209,128,124,158,250,14,23,159,233,199,203,61,138,83,197,68,13,228,51,81,7,147,233,145,8,53,144,79,
+    168,67,201,244,88,132,26,200,39,212,129,100,122,52,66,13,228,19,234,48,50,61,30,151,15,200,39,212,65,100,122,68,38,106,
+    32,159,167,190,67,196,103,250,35,229,110,153,62,152,80,3,249,76,212,1,100,122,84,66,13,228,51,81,111,46,58,211,199,229,
+    199,203,159,145,233,38,132,26,200,39,212,27,139,207,244,199,203,15,203,116,35,66,13,228,179,244,189,41,153,30,155,75,
+    9,228,19,234,13,201,244,232,76,212,64,62,161,222,140,76,143,79,168,129,124,66,189,17,153,158,129,80,3,249,132,122,19,
+    50,61,7,161,6,242,121,234,123,3,87,78,46,149,167,3,95,239,184,252,68,249,33,153,222,128,80,3,249,76,212,205,61,117,114,
+    57,56,211,31,151,233,141,184,172,64,62,161,110,204,162,247,76,76,212,64,62,161,110,74,166,231,34,212,64,62,161,110,72,
+    166,103,35,212,64,62,161,110,70,166,231,227,242,2,249,132,186,17,153,158,145,137,26,200,39,212,77,200,244,156,132,26,
+    200,39,212,13,196,255,190,233,199,101,58,132,80,3,249,132,250,96,241,153,254,72,185,91,166,67,8,53,144,79,168,15,36,
+    211,51,19,106,32,159,80,31,68,166,231,230,82,3,249,132,250,0,25,123,211,50,29,201,68,13,228,19,234,106,25,153,190,71,
+    166,67,9,53,144,79,168,43,201,244,10,132,26,200,39,212,85,100,122,13,66,13,228,19,234,10,50,189,10,23,29,200,119,91,
+    246,1,140,231,202,201,165,224,223,55,253,177,242,231,20,35,69,219,203,254,147,229,211,134,106,96,111,66,189,167,167,
+    78,46,135,102,250,168,124,72,166,211,180,189,240,159,41,159,201,62,33,96,64,150,190,247,18,191,232,253,225,242,98,153,
+    78,227,210,3,249,132,122,15,50,189,26,23,31,200,39,212,59,147,233,245,184,252,64,62,161,222,145,76,175,200,13,0,242,
+    9,245,78,100,122,77,110,1,144,79,168,119,16,159,233,15,201,116,23,220,4,32,159,80,95,40,35,211,63,170,16,93,112,27,128,
+    124,66,125,1,153,94,153,27,1,228,19,234,115,201,244,218,220,10,32,159,80,159,67,166,87,231,102,0,249,132,250,76,50,141,
+    219,1,228,19,234,51,200,52,66,13,244,64,168,79,37,211,148,34,212,64,15,132,250,20,50,205,179,220,20,32,159,80,223,34,
+    62,211,31,148,233,78,185,45,64,62,161,190,73,70,166,95,162,7,157,114,99,128,124,66,125,3,153,230,122,110,13,144,79,168,
+    175,35,211,220,200,205,1,242,9,245,53,50,205,205,220,30,32,159,80,95,37,211,220,202,13,2,242,9,117,41,37,35,211,31,144,
+    233,1,184,69,64,62,161,46,57,153,126,169,6,12,192,77,2,242,9,181,76,115,38,183,9,200,183,124,168,101,154,179,185,81,
+    64,190,197,67,45,211,156,199,173,2,242,45,29,106,153,230,124,110,22,144,111,225,80,199,103,250,253,50,61,24,183,11,200,
+    183,108,168,51,50,253,50,159,251,131,113,195,128,124,139,134,90,166,217,197,162,111,15,160,43,75,126,18,201,52,187,113,
+    211,128,124,11,134,90,166,217,149,219,6,228,91,46,212,50,205,238,220,56,32,223,98,161,142,207,244,251,100,122,96,110,
+    29,144,111,169,80,103,100,250,199,124,214,15,204,205,3,242,45,20,106,153,102,95,110,31,144,111,153,80,203,52,251,115,
+    3,129,124,183,101,31,64,140,43,39,151,202,211,129,175,39,211,115,248,166,242,123,178,15,1,24,208,23,202,175,55,252,105,
+    71,39,217,231,19,192,52,13,64,156,7,78,30,108,248,211,22,88,250,142,207,244,99,50,13,64,35,211,135,58,35,211,47,151,
+    105,0,26,153,60,212,209,153,46,229,33,153,6,160,161,169,67,29,159,233,135,203,125,50,13,64,67,19,135,90,166,1,24,223,
+    180,161,150,105,0,102,48,105,168,51,246,166,101,26,128,246,166,12,117,70,166,95,39,211,0,108,96,194,80,203,52,0,243,
+    152,46,212,50,13,192,76,38,11,181,76,3,48,151,169,66,45,211,0,204,102,162,80,199,103,250,157,50,13,192,198,166,9,117,
+    70,166,95,47,211,0,108,108,146,80,203,52,0,115,154,34,212,50,13,192,172,38,8,181,76,3,48,175,225,67,45,211,0,204,108,
+    240,80,199,103,250,65,153,6,32,208,208,161,206,200,244,253,50,13,64,160,129,67,45,211,0,204,111,216,80,203,52,0,43,24,
+    52,212,50,13,192,26,134,12,181,76,3,176,138,1,67,29,159,233,119,200,52,0,73,134,11,117,70,166,223,32,211,0,36,25,44,
+    212,50,13,192,90,134,10,181,76,3,176,154,129,66,45,211,0,172,103,152,80,203,52,0,43,26,36,212,241,153,126,187,76,3,208,
+    129,33,66,157,145,233,7,100,26,128,14,12,16,106,153,6,96,93,221,135,90,166,1,88,89,231,161,150,105,0,214,214,117,168,
+    101,26,128,213,117,28,234,248,76,191,77,166,1,232,76,183,161,206,200,244,27,101,26,128,206,116,26,106,153,6,128,82,58,
+    13,181,76,3,192,179,58,12,181,76,3,192,55,116,23,106,153,6,128,231,116,22,234,248,76,191,85,166,1,232,88,87,161,206,
+    200,244,155,100,26,128,142,117,20,106,153,6,128,155,117,19,106,153,6,128,91,117,18,106,153,6,128,211,116,17,106,153,
+    6,128,211,117,16,234,248,76,191,69,166,1,24,68,122,168,51,50,253,102,153,6,96,16,201,161,150,105,0,56,79,106,168,101,
+    26,0,206,151,24,106,153,6,128,139,164,133,90,166,1,224,98,73,161,142,207,244,125,50,13,192,128,82,66,157,145,233,135,
+    101,26,128,1,37,132,90,166,1,96,87,225,161,150,105,0,216,93,112,168,101,26,0,246,17,26,234,248,76,191,86,166,1,24,90,
+    96,168,51,50,253,136,76,3,48,180,176,80,203,52,0,236,47,40,212,50,13,0,53,66,66,45,211,0,80,39,32,212,50,13,0,181,54,
+    15,117,124,166,239,149,105,0,166,177,113,168,51,50,253,46,153,6,96,26,155,134,90,166,1,224,48,27,134,90,166,1,224,80,
+    155,133,90,166,1,224,112,27,133,90,166,1,160,133,77,66,29,159,233,215,200,52,0,83,218,32,212,25,153,126,84,166,1,152,
+    82,243,80,203,52,0,180,211,56,212,50,13,0,45,53,13,181,76,3,64,91,13,67,45,211,0,208,90,179,80,199,103,250,213,50,13,
+    192,244,26,133,58,35,211,239,150,105,0,166,215,36,212,50,13,0,219,104,16,106,153,6,128,173,28,28,106,153,6,128,237,28,
+    24,106,153,6,128,45,29,20,234,248,76,191,74,166,1,88,202,1,161,206,200,244,123,100,26,128,165,84,135,90,166,1,96,123,
+    149,161,150,105,0,136,80,21,106,153,6,128,24,21,161,150,105,0,136,178,119,168,227,51,253,74,153,6,96,89,123,134,58,35,
+    211,239,149,105,0,150,181,87,168,101,26,0,98,237,17,106,153,6,128,104,59,135,90,166,1,32,222,142,161,150,105,0,200,176,
+    83,168,227,51,253,10,153,6,128,178,83,168,51,50,253,152,76,3,64,217,33,212,50,13,0,121,46,8,181,76,3,64,166,115,67,45,
+    211,0,144,235,156,80,203,52,0,100,59,51,212,50,13,0,249,206,8,181,76,3,64,15,78,13,117,202,191,155,206,190,18,0,208,
+    161,83,66,157,147,233,35,243,52,0,220,226,150,80,199,103,250,229,50,13,0,103,184,41,212,241,153,190,187,60,38,211,0,
+    112,134,27,66,157,145,233,143,200,52,0,156,233,186,80,203,52,0,244,230,90,168,101,26,0,250,115,53,212,50,13,0,61,58,
+    46,37,35,211,47,146,105,0,216,193,113,78,166,63,42,211,0,176,131,99,153,6,128,126,29,191,56,56,211,47,149,105,0,216,
+    217,241,39,202,157,129,47,247,188,242,1,153,6,128,157,29,223,113,244,100,249,125,97,47,247,115,229,145,236,51,6,128,
+    129,28,151,114,251,209,63,11,76,245,235,203,195,39,217,39,13,0,163,56,46,69,170,1,160,87,87,191,240,68,170,1,160,71,
+    215,190,66,84,170,1,160,63,215,253,82,14,169,6,128,222,220,240,107,46,165,26,0,250,114,124,227,255,148,106,0,232,201,
+    241,205,127,32,213,0,208,143,227,91,255,72,170,1,160,23,199,167,253,161,84,3,64,31,142,79,255,99,169,6,128,30,28,159,
+    245,23,82,13,0,249,142,207,254,43,169,6,128,108,199,231,253,165,84,3,64,174,227,243,255,90,170,1,32,211,241,69,255,7,
+    169,6,128,60,23,134,90,170,1,32,207,14,161,150,106,0,200,178,83,168,165,26,0,114,236,24,234,248,84,63,36,213,0,176,123,
+    168,163,83,125,191,84,3,192,62,161,150,106,0,136,182,87,168,165,26,0,98,237,25,106,169,6,128,72,123,135,90,170,1,32,
+    78,69,168,165,26,0,162,84,133,90,170,1,32,70,101,168,165,26,0,34,84,135,90,170,1,96,123,7,132,90,170,1,96,107,7,133,
+    90,170,1,96,91,7,134,90,170,1,96,75,7,135,90,170,1,96,59,13,66,45,213,0,176,149,38,161,150,106,0,216,70,163,80,75,53,
+    0,108,161,89,168,165,26,0,218,107,24,106,169,6,128,214,154,134,90,170,1,160,173,198,161,150,106,0,104,169,121,168,165,
+    26,0,218,217,32,212,82,13,0,173,108,18,106,169,6,128,54,54,10,181,84,3,64,11,155,133,90,170,1,224,112,27,134,90,170,
+    1,224,80,155,134,90,170,1,224,48,27,135,90,170,1,224,16,155,135,90,170,1,160,94,64,168,165,26,0,106,133,132,90,170,1,
+    160,78,80,168,165,26,0,106,132,133,90,170,1,96,127,129,161,150,106,0,216,87,104,168,165,26,0,246,19,28,106,169,6,128,
+    125,132,135,90,170,1,96,119,9,161,150,106,0,216,85,74,168,165,26,0,118,147,20,106,169,6,128,93,164,133,90,170,1,224,
+    98,137,161,150,106,0,184,72,106,168,165,26,0,206,151,28,106,169,6,128,243,164,135,90,170,1,224,108,29,132,90,170,1,224,
+    44,93,132,90,170,1,224,116,157,132,90,170,1,224,52,221,132,90,170,1,224,86,29,133,90,170,1,224,102,93,133,90,170,1,224,
+    70,157,133,90,170,1,224,122,221,133,90,170,1,224,57,29,134,90,170,1,224,27,186,12,181,84,3,192,179,58,13,181,84,3,64,
+    41,29,135,90,170,1,160,235,80,75,53,0,116,29,106,169,6,96,117,157,135,90,170,1,88,91,247,161,150,106,0,86,54,64,168,
+    165,26,128,117,13,17,106,169,6,96,85,131,132,90,170,1,88,211,48,161,150,106,0,86,52,80,168,165,26,128,245,12,21,106,
+    169,6,96,53,131,133,90,170,1,88,203,112,161,150,106,0,86,50,96,168,165,26,128,117,12,25,106,169,6,96,21,131,134,90,170,
+    1,88,195,176,161,150,106,0,86,48,112,168,165,26,128,249,13,29,106,169,6,96,118,131,135,90,170,1,152,219,240,161,150,
+    106,0,102,54,65,168,165,26,128,121,77,17,106,169,6,96,86,147,132,90,170,1,152,211,52,161,150,106,0,102,52,81,168,165,
+    26,128,249,76,21,106,169,6,96,54,147,133,90,170,1,152,203,116,161,150,106,0,102,50,97,168,227,83,253,78,169,6,96,35,
+    83,134,58,58,213,111,144,106,0,54,50,105,168,165,26,128,57,76,27,106,169,6,96,6,19,135,90,170,1,24,223,212,161,150,106,
+    0,70,55,121,168,165,26,128,177,77,31,106,169,6,96,100,71,107,84,229,215,78,46,151,207,134,189,218,131,229,254,163,236,
+    51,166,133,47,156,124,115,246,33,0,203,91,96,162,46,197,84,13,192,168,22,9,181,84,3,48,166,101,66,45,213,0,140,104,161,
+    80,75,53,0,227,89,42,212,82,13,192,104,22,11,181,84,3,48,150,229,66,45,213,0,140,100,193,80,75,53,0,227,88,50,212,82,
+    13,192,40,22,13,181,84,3,48,134,101,67,45,213,0,140,96,225,80,75,53,0,253,91,58,212,82,13,64,239,22,15,181,84,3,208,
+    183,229,67,45,213,0,244,76,168,139,84,3,208,47,161,46,165,72,53,0,189,18,234,171,164,26,128,30,9,245,53,82,13,64,127,
+    132,250,58,82,13,64,111,132,250,6,82,13,64,95,132,250,38,82,13,64,79,132,250,22,82,13,64,63,132,250,20,82,13,64,47,132,
+    250,84,82,13,64,31,132,250,12,82,13,64,15,132,250,76,82,13,64,62,161,62,135,84,3,144,77,168,207,37,213,0,228,18,234,
+    11,72,53,0,153,132,250,66,82,13,64,30,161,222,129,84,3,144,69,168,119,34,213,0,228,16,234,29,73,53,0,25,132,122,103,
+    82,13,64,60,161,222,131,84,3,16,77,168,247,34,213,0,196,58,82,130,125,61,125,114,169,92,9,123,181,71,203,107,142,178,
+    207,120,93,95,56,249,230,134,63,237,174,242,251,179,79,8,24,208,109,217,7,48,158,59,142,158,60,185,92,62,27,244,106,
+    247,150,175,156,220,47,213,83,120,97,121,181,59,9,236,205,210,119,5,11,224,0,68,17,234,42,82,13,64,12,161,174,36,213,
+    0,68,16,234,106,82,13,192,246,132,250,0,82,13,192,214,132,250,32,82,13,192,182,132,250,64,82,13,192,150,132,250,96,82,
+    13,192,118,132,186,1,169,6,96,43,66,221,132,84,3,176,13,161,110,68,170,1,216,130,80,55,35,213,0,180,39,212,13,73,53,
+    0,173,9,117,83,82,13,64,91,66,221,152,84,3,208,146,80,55,39,213,0,180,35,212,27,184,253,232,137,114,103,216,171,189,
+    161,60,42,213,0,211,18,234,77,220,113,244,100,224,84,253,218,242,160,84,3,76,74,168,55,18,187,0,254,128,84,3,76,74,168,
+    55,35,213,0,28,78,168,55,36,213,0,28,74,168,55,21,157,234,119,72,53,192,100,132,122,99,177,169,126,163,84,3,76,70,168,
+    55,39,213,0,212,19,234,0,82,13,64,45,161,14,17,157,234,183,75,53,192,36,132,58,72,108,170,223,36,213,0,147,16,234,48,
+    82,13,192,254,132,58,144,84,3,176,47,161,14,21,157,234,183,73,53,192,224,132,58,88,108,170,223,44,213,0,131,19,234,112,
+    82,13,192,238,132,58,129,84,3,176,43,161,78,17,157,234,183,74,53,192,160,132,58,73,108,170,223,34,213,0,131,18,234,52,
+    82,13,192,197,132,58,145,84,3,112,17,161,78,21,157,234,215,73,53,192,96,132,58,89,108,170,31,145,106,128,193,8,117,58,
+    169,6,224,108,66,221,1,169,6,224,44,66,221,5,169,6,224,116,66,221,137,232,84,223,39,213,0,67,16,234,110,196,166,250,
+    93,82,13,48,4,161,238,136,84,3,112,51,161,238,138,84,3,112,35,161,238,140,84,3,112,61,161,238,78,116,170,95,43,213,0,
+    29,19,234,14,197,166,250,81,169,6,232,152,80,119,73,170,1,120,150,80,119,74,170,1,40,69,168,59,22,157,234,123,165,26,
+    160,67,66,221,177,216,84,191,91,170,1,58,36,212,93,147,106,128,213,9,117,231,164,26,96,109,66,221,189,232,84,191,70,
+    170,1,58,34,212,3,136,77,245,123,164,26,160,35,66,61,4,169,6,88,149,80,15,66,170,1,214,36,212,195,136,78,245,171,165,
+    26,160,3,66,61,144,216,84,191,87,170,1,58,32,212,67,145,106,128,213,8,245,96,164,26,96,45,66,61,156,232,84,191,74,170,
+    1,18,9,245,128,98,83,253,152,84,3,36,18,234,33,73,53,192,42,132,122,80,82,13,176,6,161,30,86,116,170,95,41,213,0,9,132,
+    122,96,177,169,126,159,84,3,36,16,234,161,73,53,192,236,132,122,112,241,169,62,17,107,128,64,66,61,188,232,84,191,170,
+    72,53,64,28,161,158,128,84,3,204,75,168,167,112,251,209,19,229,206,176,87,123,95,121,165,84,3,4,17,234,73,220,113,244,
+    100,224,84,253,254,242,226,37,82,189,192,41,2,221,19,234,105,196,46,128,255,197,37,82,61,253,9,2,3,16,234,137,72,53,
+    192,124,132,122,42,82,221,214,212,39,7,12,66,168,39,19,157,234,123,166,78,245,196,167,6,12,67,168,167,19,155,234,143,
+    77,157,234,105,79,12,24,136,80,79,72,170,1,230,33,212,83,146,234,54,166,60,41,96,48,66,61,169,216,175,64,249,88,121,
+    217,148,169,158,240,148,128,225,8,245,180,98,191,2,229,195,229,238,242,204,116,93,155,238,132,128,1,9,245,196,98,23,
+    192,255,210,148,169,6,200,38,212,83,139,77,245,95,46,47,154,44,213,83,157,12,48,40,161,158,92,108,170,127,124,178,84,
+    79,116,42,192,176,132,122,122,209,169,254,11,83,165,26,32,155,80,47,32,54,213,31,47,127,126,154,84,79,114,26,192,208,
+    132,122,9,177,169,254,137,242,3,229,235,83,52,110,138,147,0,6,39,212,139,136,77,245,39,202,15,148,175,77,80,185,9,78,
+    1,24,158,80,47,35,54,213,127,189,252,224,20,169,6,200,38,212,11,137,78,245,248,83,245,224,135,15,76,65,168,151,18,155,
+    234,191,81,254,244,224,169,30,250,224,129,73,8,245,98,98,83,253,55,7,79,245,192,135,14,76,67,168,151,19,157,234,239,
+    31,58,213,0,217,132,122,65,177,169,254,91,229,79,149,175,14,154,234,65,15,27,152,138,80,47,41,54,213,127,187,124,255,
+    160,169,30,242,160,129,201,8,245,162,162,83,61,238,84,13,144,75,168,151,21,155,234,191,83,190,167,252,238,112,169,30,
+    238,128,129,9,9,245,194,98,83,253,201,242,189,195,165,122,176,195,5,166,36,212,75,139,77,245,63,24,110,170,30,234,96,
+    129,73,9,245,226,98,83,253,15,135,75,53,64,54,161,94,94,116,170,191,187,252,206,48,169,30,230,64,129,137,9,53,193,169,
+    254,153,129,82,61,200,97,2,83,19,106,74,116,170,255,209,48,169,30,226,32,129,201,9,53,165,148,248,84,127,215,32,169,
+    6,200,38,212,92,21,155,234,127,92,254,120,249,237,238,83,221,253,1,2,11,16,106,174,137,77,245,63,41,223,213,125,170,
+    59,63,60,96,9,66,205,117,162,83,61,194,84,13,144,75,168,185,65,108,170,255,105,249,246,242,165,142,83,221,241,161,1,
+    203,16,106,110,18,155,234,127,81,190,163,227,84,119,123,96,192,66,132,154,91,68,167,250,133,221,166,186,211,195,2,150,
+    34,212,156,34,54,213,63,215,113,170,1,178,9,53,167,138,78,245,11,202,255,235,48,213,29,30,18,176,28,161,230,12,177,169,
+    254,84,151,169,238,238,128,128,5,9,53,103,138,77,245,207,119,152,234,206,14,7,88,146,80,115,142,219,143,158,40,119,134,
+    189,218,207,151,23,118,151,106,128,108,66,205,185,238,56,122,50,116,1,252,219,203,111,118,148,234,175,103,31,0,128,80,
+    115,145,216,5,240,127,217,85,170,133,26,200,39,212,92,40,54,213,159,46,119,149,47,118,146,234,103,178,15,0,64,168,217,
+    69,108,170,127,161,124,75,249,66,23,169,22,106,32,159,80,179,147,53,83,109,233,27,200,39,212,236,40,54,213,255,182,139,
+    84,155,168,129,124,66,205,206,162,83,253,71,203,231,147,83,45,212,64,62,161,102,15,177,169,254,119,233,169,182,244,13,
+    228,19,106,246,18,155,234,95,76,78,181,137,26,200,39,212,236,41,62,213,255,55,45,213,66,13,228,19,106,246,182,78,170,
+    45,125,3,249,132,154,10,177,169,254,76,90,170,77,212,64,62,161,166,74,116,170,255,112,249,92,66,170,77,212,64,62,161,
+    166,82,108,170,175,148,75,9,169,54,81,3,249,132,154,106,177,169,254,165,114,169,252,106,112,170,133,26,200,39,212,28,
+    32,58,213,119,5,167,218,210,55,144,79,168,57,72,252,84,253,43,129,169,54,81,3,249,132,154,3,197,166,250,169,114,87,96,
+    170,133,26,200,39,212,28,236,246,163,39,202,157,97,175,246,84,185,28,182,0,46,212,64,62,161,166,129,59,142,158,12,93,
+    0,127,126,249,223,33,169,182,71,13,228,19,106,154,136,93,0,255,207,229,121,229,191,7,164,218,68,13,228,19,106,26,137,
+    77,245,47,151,75,229,191,109,158,106,19,53,144,79,168,105,38,54,213,255,163,92,42,255,117,227,84,155,168,129,124,66,
+    77,67,177,169,254,159,229,82,249,47,155,166,218,68,13,228,19,106,154,138,77,245,255,42,207,43,255,105,195,84,155,168,
+    129,124,66,77,99,177,169,254,92,185,171,252,199,205,82,45,212,64,62,161,166,185,216,84,63,93,46,151,207,110,148,106,
+    75,223,64,62,161,102,3,241,169,254,15,155,164,218,68,13,228,19,106,54,17,155,234,95,43,151,203,191,223,32,213,66,13,
+    228,19,106,54,18,155,234,255,83,254,72,249,55,205,83,109,233,27,200,39,212,108,38,54,213,95,44,223,90,254,117,227,84,
+    155,168,129,124,66,205,134,98,83,253,235,229,91,203,191,106,154,106,161,6,242,9,53,155,138,77,245,111,148,111,43,159,
+    110,152,106,161,6,242,9,53,27,139,78,245,183,148,39,155,165,90,168,129,124,66,205,230,98,83,253,229,242,157,229,103,
+    27,165,218,195,100,64,62,161,38,192,237,71,79,148,59,195,94,237,203,229,143,53,154,170,133,26,200,39,212,132,184,227,
+    232,201,208,169,250,59,202,19,13,82,253,213,176,35,6,56,139,80,19,36,118,1,252,183,202,119,150,79,30,156,234,175,132,
+    29,47,192,89,132,154,48,177,169,254,221,242,189,229,167,15,76,181,137,26,200,39,212,4,138,77,245,87,202,159,40,127,255,
+    160,84,11,53,144,79,168,9,21,157,234,239,43,127,239,128,84,11,53,144,79,168,9,22,157,234,63,89,254,110,117,170,237,81,
+    3,249,132,154,112,177,169,254,106,249,190,242,83,149,169,54,81,3,249,132,154,4,177,169,254,122,249,225,242,87,171,82,
+    45,212,64,62,161,38,69,116,170,255,108,249,201,138,84,91,250,6,242,9,53,73,162,83,253,35,229,175,236,157,106,19,53,144,
+    79,168,73,19,155,234,103,202,143,148,199,247,76,181,80,3,249,132,154,68,177,169,62,41,47,45,31,222,43,213,150,190,129,
+    124,66,77,170,232,84,191,172,124,112,143,84,155,168,129,124,66,77,178,232,84,191,188,188,127,231,84,11,53,144,79,168,
+    73,23,157,234,87,148,135,118,76,181,80,3,249,132,154,14,196,166,186,148,251,203,131,59,165,218,30,53,144,79,168,233,
+    66,116,170,31,40,111,223,33,213,38,106,32,159,80,211,137,232,84,191,169,188,245,194,84,11,53,144,79,168,233,70,116,170,
+    223,82,94,119,65,170,45,125,3,249,132,154,142,220,126,244,68,185,51,240,245,30,41,247,159,155,234,175,37,95,15,0,161,
+    166,51,119,28,61,25,58,85,63,84,94,114,114,114,102,172,77,212,64,62,161,166,51,209,11,224,143,151,123,202,51,103,164,
+    90,168,129,124,66,77,119,162,83,253,177,242,131,229,107,167,164,250,153,147,103,178,47,5,128,80,211,163,232,189,234,
+    191,86,126,232,148,84,155,167,129,30,8,53,93,138,222,171,254,68,249,238,242,59,55,165,250,203,217,23,1,160,8,53,221,
+    138,94,0,255,100,249,158,242,219,55,164,90,168,129,30,8,53,221,138,78,245,207,148,23,148,47,93,151,234,47,101,95,0,128,
+    34,212,116,45,58,213,255,188,188,160,252,230,181,84,11,53,208,3,161,166,107,209,169,254,84,185,171,124,254,106,170,133,
+    26,232,129,80,211,185,232,39,192,127,161,92,46,191,114,82,138,61,106,160,15,66,77,247,238,56,250,217,208,84,127,166,
+    252,193,242,75,39,165,252,70,246,137,3,20,161,102,8,209,255,88,235,151,203,31,40,159,58,249,92,246,105,3,20,161,102,
+    16,209,11,224,95,44,223,86,126,42,251,164,1,138,80,51,140,232,169,250,183,202,47,102,159,50,64,17,106,6,18,253,4,56,
+    64,15,132,154,129,72,53,176,30,161,102,40,82,13,172,70,168,25,140,84,3,107,17,106,134,35,213,192,74,132,154,1,73,53,
+    176,14,161,102,72,82,13,172,66,168,25,148,84,3,107,16,106,134,37,213,192,10,132,154,129,73,53,48,63,161,102,104,82,13,
+    204,78,168,25,156,84,3,115,19,106,134,39,213,192,204,132,154,9,72,53,48,47,161,102,10,82,13,204,74,168,153,132,84,3,
+    115,18,106,166,33,213,192,140,132,154,137,72,53,48,31,161,102,42,82,13,204,70,168,153,140,84,3,115,17,106,166,35,213,
+    192,76,132,154,9,73,53,48,15,161,102,74,82,13,204,66,168,153,148,84,3,115,16,106,166,37,213,192,12,132,154,137,73,53,
+    48,62,161,102,106,82,13,140,78,168,153,156,84,3,99,19,106,166,39,213,192,200,132,154,5,72,53,48,46,161,102,9,82,13,140,
+    74,168,89,132,84,3,99,18,106,150,33,213,192,136,132,154,133,72,53,48,30,161,102,41,82,13,140,70,168,89,140,84,3,99,17,
+    106,150,35,213,192,72,132,154,5,73,53,48,14,161,102,73,82,13,140,66,168,89,148,84,3,99,16,106,150,37,213,192,8,132,154,
+    133,73,53,208,63,161,102,105,82,13,244,78,168,89,156,84,3,125,19,106,150,39,213,64,207,132,26,164,26,232,152,80,67,145,
+    106,160,95,66,13,165,20,169,6,122,37,212,112,149,84,3,61,18,106,184,70,170,129,254,8,53,92,71,170,129,222,8,53,220,64,
+    170,129,190,8,53,220,68,170,129,158,8,53,220,66,170,129,126,8,53,156,66,170,129,94,8,53,156,74,170,129,62,8,53,156,65,
+    170,129,30,8,53,156,73,170,129,124,66,13,231,144,106,32,155,80,195,185,164,26,200,37,212,112,1,169,6,50,9,53,92,72,170,
+    129,60,66,13,59,144,106,32,139,80,195,78,164,26,200,33,212,176,35,169,6,50,8,53,236,76,170,129,120,66,13,123,144,106,
+    32,154,80,195,94,164,26,136,37,212,176,39,169,6,34,9,53,236,77,170,129,56,66,13,21,164,26,136,34,212,80,69,170,129,24,
+    66,13,149,164,26,136,32,212,80,77,170,129,237,9,53,28,64,170,129,173,9,53,28,68,170,129,109,9,53,28,72,170,129,45,9,
+    53,28,76,170,129,237,8,53,52,32,213,192,86,132,26,154,144,106,96,27,66,13,141,72,53,176,5,161,134,102,164,26,104,79,
+    168,161,33,169,6,90,19,106,104,74,170,129,182,132,26,26,147,106,160,37,161,134,230,164,26,104,71,168,97,3,82,13,180,
+    34,212,176,9,169,6,218,16,106,216,136,84,3,45,8,53,108,70,170,129,195,9,53,108,72,170,129,67,9,53,108,74,170,129,195,
+    8,53,108,76,170,129,67,8,53,108,78,170,129,122,66,13,1,110,63,122,162,252,222,236,131,0,134,244,255,1,251,72,199,184,
+    227,57,137,58,0,0,0,37,116,69,88,116,100,97,116,101,58,99,114,101,97,116,101,0,50,48,50,49,45,48,51,45,50,53,84,50,48,
+    58,48,56,58,48,52,43,48,48,58,48,48,16,113,105,0,0,0,0,37,116,69,88,116,100,97,116,101,58,109,111,100,105,102,121,0,
+    50,48,49,54,45,48,52,45,49,57,84,48,55,58,49,52,58,49,54,43,48,48,58,48,48,208,12,57,202,0,0,0,0,73,69,78,68,174,66,
+    96,130,
+};
+
+inline const unsigned char texture_black_wins[15413] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,5,220,0,0,3,132,8,6,0,0,0,187,56,243,196,0,0,0,9,112,72,89,115,0,0,
+    11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,
+    0,59,202,73,68,65,84,120,1,236,221,237,149,19,71,254,247,225,230,127,252,126,76,4,152,8,48,17,96,34,0,34,0,34,192,142,
+    192,56,2,32,2,76,4,64,4,54,17,96,34,192,68,128,137,128,123,191,218,187,188,242,120,70,82,87,255,36,117,143,174,235,156,
+    57,227,101,231,73,15,221,82,127,186,186,234,218,48,12,95,7,0,0,0,0,0,96,146,255,27,0,0,0,0,0,128,201,4,119,0,0,0,0,0,
+    40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,
+    0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,129,111,134,145,190,126,253,58,0,0,0,0,0,192,
+    85,119,237,218,181,81,95,111,132,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,
+    3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,
+    128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,
+    0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,
+    29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,
+    0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,
+    0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,
+    0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,
+    220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,
+    0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,
+    3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,
+    128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,
+    0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,
+    29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,
+    0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,
+    0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,
+    0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,
+    220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,
+    0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,
+    3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,
+    128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,
+    0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,
+    29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,
+    0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,
+    0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,
+    0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,
+    220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,
+    0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,
+    3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,
+    128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,
+    0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,
+    29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,
+    0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,
+    0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,
+    0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,
+    220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,
+    0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,
+    3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,
+    128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,
+    0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,
+    29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,
+    0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,
+    0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,
+    0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,
+    220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,
+    0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,
+    3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,
+    128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,
+    0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,
+    29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,
+    0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,
+    0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,3,0,0,0,0,0,211,9,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,
+    0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,
+    0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,
+    220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,
+    0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,
+    3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,
+    128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,
+    0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,
+    29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,
+    0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,
+    0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,
+    124,51,0,0,0,112,210,62,125,250,52,252,249,231,159,171,255,254,246,219,111,135,91,183,110,13,0,0,140,39,184,3,0,0,156,
+    160,4,246,23,47,94,12,191,254,250,235,240,215,95,127,253,227,255,251,238,187,239,134,31,126,248,97,248,249,231,159,87,
+    255,13,0,192,110,174,253,231,227,235,152,111,248,250,117,212,151,3,192,70,239,222,189,27,158,62,125,58,28,211,143,63,
+    254,56,220,187,119,111,0,134,225,213,171,87,171,248,54,198,247,223,127,63,60,123,246,108,0,150,227,151,95,126,217,249,
+    245,55,95,151,240,14,0,112,138,174,93,187,54,234,235,141,112,7,224,168,62,126,252,56,252,254,251,239,195,49,61,122,244,
+    104,0,254,43,35,94,143,189,77,2,251,245,248,241,227,81,39,214,90,152,23,221,1,0,182,179,104,42,0,0,192,137,200,200,246,
+    177,87,177,68,162,123,166,159,1,0,96,51,193,29,0,0,224,4,228,10,150,41,211,184,229,123,207,207,245,14,0,192,63,153,82,
+    6,0,0,224,4,100,116,251,20,137,237,25,229,110,106,25,24,231,143,63,254,24,62,124,248,48,234,123,110,221,186,181,90,35,
+    5,128,229,17,220,1,14,160,103,17,194,10,223,125,247,221,240,237,183,223,174,62,242,134,61,159,243,230,61,159,1,128,211,
+    82,241,94,36,63,67,112,135,113,222,190,125,59,250,234,146,124,189,224,14,176,76,130,59,192,1,204,109,17,194,188,121,
+    207,199,15,63,252,48,220,185,115,103,21,230,1,128,171,235,221,187,119,67,133,188,167,201,72,119,39,239,1,0,46,102,14,
+    119,128,19,148,203,90,51,66,237,209,163,71,195,205,155,55,135,187,119,239,174,70,225,155,151,21,0,216,230,203,151,47,
+    3,0,0,23,19,220,1,88,141,190,79,124,191,125,251,246,240,248,241,227,213,232,53,0,224,234,112,82,29,0,224,48,4,119,0,
+    254,150,208,158,145,239,25,241,158,69,209,0,128,171,225,198,141,27,67,149,179,179,179,1,0,128,139,9,238,0,252,75,194,
+    251,143,63,254,184,154,110,198,104,119,0,88,190,182,144,250,92,126,14,0,192,85,101,209,84,0,46,149,216,158,209,238,47,
+    95,190,92,45,176,186,15,247,239,223,47,253,217,249,123,157,36,0,128,127,74,36,207,130,233,83,23,113,223,215,251,1,224,
+    159,114,114,11,128,101,18,220,1,216,168,69,247,76,53,243,240,225,195,161,90,2,128,145,114,0,176,127,63,255,252,243,164,
+    224,158,215,235,252,12,0,0,46,103,74,25,0,118,146,69,85,167,142,138,3,0,142,39,163,211,51,101,92,175,196,118,163,110,
+    1,0,54,19,220,1,216,217,131,7,15,76,215,2,0,11,246,236,217,179,174,43,214,18,219,167,196,122,56,101,174,230,4,56,45,
+    130,59,0,59,251,235,175,191,134,199,143,31,15,0,192,114,101,154,184,93,167,134,73,40,76,164,127,250,244,233,0,244,57,
+    59,59,27,0,56,29,130,59,0,163,100,90,153,23,47,94,12,0,192,114,37,160,127,252,248,113,53,101,220,69,163,111,243,111,
+    25,209,254,254,253,123,35,219,1,0,70,176,104,42,192,76,229,32,184,87,155,246,229,195,135,15,171,255,254,227,143,63,74,
+    231,95,207,65,122,46,71,119,121,44,0,44,87,230,99,127,249,242,229,234,35,239,21,114,37,91,251,119,115,181,3,0,244,17,
+    220,1,102,106,202,129,110,251,222,44,142,214,228,32,250,205,155,55,171,209,233,57,168,158,34,63,235,213,171,87,195,147,
+    39,79,6,0,96,249,190,255,254,251,1,0,128,233,76,41,3,112,34,50,26,61,151,141,231,210,240,140,100,155,58,114,45,241,30,
+    0,0,0,128,255,17,220,1,78,80,11,239,247,239,223,31,122,101,138,154,79,159,62,13,0,0,0,0,252,151,224,14,112,162,50,226,
+    253,245,235,215,171,185,216,123,25,229,14,0,0,0,240,63,130,59,192,137,123,254,252,121,247,188,173,83,231,130,7,0,0,254,
+    45,131,99,0,88,38,193,29,224,196,229,205,252,179,103,207,134,30,130,59,0,0,212,59,59,59,27,0,88,38,193,29,128,225,135,
+    31,126,88,125,140,245,231,159,127,14,0,0,0,0,252,151,224,14,192,74,207,2,170,127,253,245,215,234,3,0,0,0,128,97,248,
+    102,0,128,255,184,115,231,206,208,227,203,151,47,230,152,132,255,239,211,167,79,171,43,63,218,213,31,23,93,5,242,221,
+    119,223,173,182,153,246,113,235,214,173,1,128,121,203,0,131,236,227,219,116,122,231,247,239,109,223,158,207,167,188,
+    95,207,125,20,185,127,214,7,102,108,27,164,209,94,19,215,255,187,125,220,184,113,99,0,128,37,17,220,1,88,201,1,34,203,
+    151,16,240,224,193,131,127,252,219,46,143,237,101,7,186,45,32,36,30,56,177,242,79,239,222,189,91,221,223,249,248,253,
+    247,223,39,77,177,148,133,139,243,145,169,157,114,242,203,246,184,155,196,155,15,31,62,12,99,37,222,184,143,247,39,219,
+    198,24,189,143,71,30,251,49,87,89,77,121,220,199,222,166,168,218,111,142,189,157,251,212,123,114,126,159,198,62,54,187,
+    222,134,182,127,249,245,215,95,187,246,241,217,159,103,191,254,232,209,163,43,23,224,115,223,228,126,207,125,146,215,
+    192,118,162,121,159,83,13,174,191,39,201,231,124,228,254,189,119,239,222,0,0,115,35,184,3,176,34,166,94,13,185,226,224,
+    252,1,111,213,1,112,158,35,231,195,240,41,61,111,214,227,203,155,55,111,74,3,88,11,247,249,217,209,34,77,66,130,48,124,
+    185,4,159,158,233,176,158,63,127,62,60,121,242,100,160,94,182,139,177,107,130,244,62,30,63,254,248,227,42,132,142,249,
+    250,158,69,194,123,110,83,124,253,250,117,168,48,246,118,238,83,213,109,170,52,246,177,249,252,249,243,198,215,174,60,
+    222,47,94,188,88,61,47,167,236,231,243,152,229,35,63,39,251,241,167,79,159,14,15,31,62,28,150,40,247,195,171,87,175,
+    74,78,48,79,249,27,218,213,5,77,30,199,60,158,0,48,55,230,112,7,96,146,179,179,179,129,249,248,248,241,227,176,47,57,
+    216,109,241,32,145,243,250,245,235,195,237,219,183,87,97,226,42,47,160,155,219,253,203,47,191,12,55,111,222,92,133,157,
+    68,241,125,143,54,77,84,72,100,203,239,124,252,248,113,215,232,218,83,112,62,190,236,202,52,62,251,179,126,181,204,174,
+    122,183,167,177,143,127,239,126,170,231,251,156,40,155,175,156,152,190,76,246,181,121,93,75,28,175,220,207,231,57,148,
+    147,168,217,167,39,92,47,65,59,241,112,247,238,221,213,235,125,94,147,242,250,55,167,215,251,156,156,6,128,57,18,220,
+    1,88,233,57,176,236,9,43,236,87,155,59,245,80,214,195,112,14,202,151,18,18,118,177,30,218,171,227,203,24,9,28,9,253,
+    9,239,87,249,196,70,143,222,224,158,199,148,253,25,27,155,123,158,215,61,139,118,247,110,63,155,2,237,101,4,247,249,
+    186,236,196,116,246,247,217,215,238,115,63,219,194,251,79,63,253,52,204,85,254,198,188,222,100,63,57,167,171,43,46,226,
+    61,40,0,115,37,184,3,176,210,51,15,178,160,48,63,199,156,231,55,7,229,75,27,193,119,153,140,234,59,118,104,63,47,225,
+    61,127,83,162,16,255,213,19,198,44,192,183,127,99,95,27,122,182,177,158,215,172,222,144,218,115,229,144,145,183,243,
+    117,209,137,233,236,87,179,191,63,148,92,41,150,145,244,115,58,137,154,237,48,39,2,242,58,115,136,43,185,42,120,31,10,
+    192,92,9,238,0,172,8,10,87,67,239,136,223,74,235,151,206,47,109,68,118,254,222,140,212,207,168,190,185,198,134,68,161,
+    37,222,183,251,208,243,124,183,223,218,191,177,163,78,123,71,184,247,124,79,207,85,64,61,223,35,4,206,215,249,231,78,
+    158,127,135,140,237,77,246,95,121,189,153,195,107,77,155,74,39,39,2,150,196,118,6,192,92,9,238,0,172,188,125,251,118,
+    24,171,103,177,66,78,71,34,198,146,70,100,183,248,49,231,203,231,155,118,98,96,14,39,88,142,165,119,94,123,193,125,255,
+    14,49,194,189,247,185,223,179,192,98,207,223,39,4,206,215,249,199,51,251,210,99,105,251,242,99,202,21,93,251,158,74,
+    103,95,108,103,0,204,149,224,14,192,234,32,235,205,155,55,163,190,39,7,57,247,238,221,27,152,151,57,6,216,140,28,156,
+    243,124,181,145,41,112,18,61,150,20,28,78,61,186,247,222,110,129,102,255,198,78,217,211,179,221,245,110,171,135,154,
+    138,198,180,69,243,181,254,120,230,196,221,177,247,251,217,151,29,235,53,50,177,61,87,116,45,149,237,12,128,185,18,220,
+    1,232,26,129,156,209,80,204,207,92,167,65,105,243,213,206,241,239,75,108,207,20,56,75,152,175,246,188,252,205,75,59,
+    81,80,165,247,74,132,91,183,110,13,236,87,207,162,180,135,90,0,245,80,211,215,184,146,98,190,214,31,207,204,85,62,7,
+    121,141,60,244,213,85,109,209,243,37,91,210,9,212,235,215,175,15,99,89,224,27,96,185,4,119,128,19,151,209,77,99,15,56,
+    51,63,239,207,63,255,60,48,47,115,143,174,57,184,127,240,224,193,48,39,249,155,18,219,151,172,69,247,37,158,48,152,162,
+    119,132,187,147,133,251,215,51,234,244,203,151,47,163,190,190,247,241,63,196,104,122,87,81,204,219,250,227,57,246,234,
+    190,125,58,228,244,107,121,189,152,219,235,241,88,121,47,58,118,189,136,99,90,210,223,10,192,116,130,59,192,9,203,200,
+    222,158,209,77,79,158,60,17,20,102,168,103,97,191,67,203,8,190,185,76,47,147,232,178,244,224,208,228,182,44,101,174,
+    252,10,185,189,61,225,84,108,63,140,158,215,135,49,11,119,39,22,246,158,96,234,9,245,130,251,213,210,158,59,121,46,204,
+    233,68,101,94,31,123,214,211,233,145,193,22,75,191,50,202,118,6,192,156,125,51,0,112,146,18,61,115,9,243,88,9,86,153,
+    147,155,249,249,250,245,235,223,7,160,115,62,144,206,243,238,206,157,59,71,95,116,119,31,83,177,100,4,91,30,131,76,39,
+    145,207,235,35,125,51,130,55,113,39,145,39,191,183,122,238,245,220,175,89,87,225,20,162,114,239,212,11,166,249,56,156,
+    60,255,199,108,95,99,78,24,78,217,110,199,126,239,28,166,147,201,190,178,58,46,230,126,88,194,2,209,251,208,30,211,93,
+    159,115,121,60,47,219,167,183,125,121,213,125,217,246,227,251,148,191,121,159,239,227,114,63,181,143,246,191,35,175,
+    143,103,103,103,151,126,95,123,141,140,118,82,109,253,228,218,249,19,173,70,140,3,48,103,130,59,192,9,201,65,75,46,159,
+    206,72,216,158,96,145,131,166,151,47,95,14,204,83,66,235,101,163,68,47,26,17,122,254,57,176,254,53,9,17,45,14,183,207,
+    149,114,194,39,127,239,177,14,152,123,183,129,139,228,54,228,170,143,220,158,49,177,187,5,175,140,52,172,186,127,115,
+    187,78,33,184,247,142,2,181,208,243,225,236,115,219,158,114,53,79,219,207,237,250,247,245,190,86,86,202,254,165,90,22,
+    11,61,213,43,62,242,248,231,246,111,154,78,38,247,205,195,135,15,87,39,59,118,121,174,180,253,249,212,215,150,252,140,
+    124,236,243,177,169,60,209,146,19,17,249,91,179,54,70,62,31,98,212,249,148,43,92,0,224,80,4,119,128,43,46,97,162,29,
+    192,229,224,178,247,32,37,7,85,175,95,191,118,9,239,66,93,52,215,233,152,199,178,69,247,132,206,60,143,166,198,234,124,
+    127,66,243,49,214,2,168,26,221,151,251,47,63,39,81,166,247,251,51,127,124,62,218,84,59,83,195,251,41,140,248,107,39,
+    14,199,202,125,99,74,153,195,201,243,123,204,243,121,204,62,165,98,255,179,235,40,244,177,115,203,135,215,201,249,187,
+    108,95,208,6,22,140,221,87,180,253,121,190,47,175,109,61,87,16,54,121,157,221,231,190,42,127,223,20,237,36,115,110,239,
+    49,158,235,75,155,187,29,128,211,36,184,3,204,212,205,155,55,135,169,170,70,240,38,40,230,224,209,1,206,233,106,177,
+    50,31,207,158,61,91,5,226,172,1,48,118,193,221,117,121,78,229,160,253,208,207,171,138,185,206,179,246,65,78,22,84,253,
+    237,185,95,223,191,127,191,186,63,123,71,72,230,113,233,89,147,97,105,122,23,57,20,219,15,107,108,136,171,12,238,57,
+    17,182,233,164,218,135,15,31,118,14,238,99,230,150,111,122,22,141,229,248,42,246,235,121,222,103,95,156,169,83,122,95,
+    107,178,143,203,207,216,135,169,211,153,85,191,246,1,192,85,37,184,3,204,84,85,44,159,34,7,84,137,162,189,35,120,185,
+    186,90,124,207,129,119,239,92,232,25,169,124,232,81,238,153,70,96,202,73,130,108,19,185,210,99,95,241,182,141,144,28,
+    115,159,38,240,228,111,58,149,249,201,115,162,167,199,177,215,12,56,53,99,131,251,152,171,175,54,5,195,108,7,57,145,
+    183,41,184,239,107,110,249,198,8,247,229,201,235,80,229,188,230,249,89,185,58,162,103,164,123,158,159,99,166,61,26,35,
+    39,155,122,85,223,71,0,112,149,253,223,0,0,231,228,32,47,7,86,25,217,39,182,179,73,194,82,158,39,189,209,124,202,101,
+    247,135,254,125,185,173,25,133,190,239,145,210,237,247,236,18,136,243,53,249,218,83,137,237,83,22,122,204,66,189,28,
+    206,166,197,17,47,82,53,194,61,219,207,182,41,39,198,252,174,177,211,176,153,238,98,121,178,31,221,71,72,158,50,18,60,
+    39,135,247,161,119,116,123,94,99,196,118,0,216,157,224,14,192,223,18,18,19,36,19,80,115,96,37,26,176,171,60,95,122,166,
+    51,73,204,170,92,192,109,147,68,182,222,233,72,218,200,246,67,141,92,109,191,111,83,116,207,148,3,249,154,83,218,78,
+    123,167,104,56,212,98,126,252,207,216,147,64,99,194,246,182,224,190,254,249,34,251,154,91,62,78,229,228,215,85,209,166,
+    128,217,135,236,155,123,167,249,170,94,168,188,233,189,122,82,108,7,128,113,4,119,128,19,150,131,193,4,189,22,217,127,
+    251,237,183,163,204,169,205,213,144,104,209,19,155,246,53,146,239,188,41,115,183,103,164,226,49,66,90,22,239,59,255,
+    123,219,8,248,83,152,175,125,93,66,81,239,116,64,153,170,135,195,26,251,58,178,107,112,223,22,34,91,104,223,180,189,
+    142,137,251,99,71,184,59,177,179,44,185,138,111,159,143,89,222,83,245,216,215,180,130,189,63,215,21,66,0,48,142,57,220,
+    1,78,68,226,71,162,83,14,44,179,160,91,98,132,48,64,181,68,247,204,63,62,70,70,184,31,98,30,247,222,145,244,217,110,
+    142,21,183,219,72,247,219,183,111,175,194,95,70,106,159,218,168,246,166,247,132,73,246,115,166,198,58,188,158,57,220,
+    119,153,183,58,243,98,111,114,235,214,173,173,191,127,204,28,217,99,3,165,215,213,229,104,239,139,246,253,59,178,223,
+    30,251,250,179,175,17,238,189,12,196,0,128,113,140,112,7,56,33,9,12,57,136,203,162,89,89,120,48,31,25,93,60,101,17,45,
+    88,215,22,83,29,227,16,97,33,207,243,222,145,125,135,92,212,245,34,9,120,249,27,114,50,35,87,161,156,98,248,152,50,186,
+    125,223,115,238,115,185,177,241,121,91,76,143,109,251,139,54,178,61,39,150,55,217,117,127,96,74,153,171,43,87,248,29,
+    226,4,73,207,115,98,236,149,21,251,54,183,191,231,84,108,219,143,1,48,95,70,184,3,156,136,28,44,109,10,86,137,120,57,
+    40,204,71,2,85,46,31,54,162,137,30,99,71,243,229,185,249,233,211,167,189,30,88,78,25,221,62,135,17,171,167,54,125,204,
+    121,99,175,154,88,119,236,19,38,167,108,236,107,200,231,207,159,39,133,242,245,5,75,183,69,206,236,115,182,125,77,79,
+    100,20,200,150,227,80,87,190,180,171,46,198,216,87,224,238,125,95,151,19,93,78,94,2,192,238,140,112,7,96,165,45,94,153,
+    249,220,51,234,235,250,245,235,171,200,149,81,240,70,54,49,70,207,92,175,251,94,56,181,247,231,139,181,199,151,169,100,
+    122,175,78,152,203,9,147,83,53,118,100,111,34,248,54,155,70,184,175,63,214,219,30,247,93,158,83,61,207,59,207,183,229,
+    56,212,213,8,121,63,53,214,220,130,251,79,63,253,52,0,0,187,19,220,1,184,84,34,101,130,213,205,155,55,135,199,143,31,
+    239,109,17,47,174,150,158,224,180,239,147,58,61,193,221,58,7,199,151,216,254,244,233,211,161,151,19,38,199,181,143,133,
+    83,55,125,205,250,246,154,223,189,105,251,221,101,42,171,93,166,184,89,183,62,194,158,121,203,254,253,80,143,213,156,
+    158,19,189,39,25,178,189,60,120,240,192,251,64,0,216,145,224,14,192,86,109,58,154,132,247,222,133,11,57,29,115,11,238,
+    189,115,196,239,123,49,61,54,123,241,226,197,164,216,110,116,251,241,141,189,255,119,137,121,155,182,231,243,49,113,
+    83,232,220,101,159,243,241,227,199,97,12,243,183,47,199,169,238,27,122,166,183,105,222,188,121,99,0,6,0,236,72,112,7,
+    96,148,4,176,28,112,57,216,162,210,62,159,79,187,76,83,113,145,41,97,130,105,114,98,111,234,188,245,70,183,31,223,217,
+    217,217,168,175,223,22,193,183,237,39,206,7,239,77,1,124,151,19,113,99,247,29,78,240,44,199,169,158,28,169,24,217,223,
+    6,96,220,190,125,123,53,213,76,22,37,7,0,254,201,162,169,0,51,245,245,235,215,97,170,245,56,145,255,78,204,248,240,225,
+    195,106,122,141,196,134,222,81,197,249,89,57,216,202,124,239,79,158,60,25,96,206,122,71,184,91,32,238,240,178,111,201,
+    232,201,169,115,250,39,182,139,159,199,55,54,106,110,123,77,218,22,192,207,7,254,77,191,127,151,147,124,99,95,35,61,
+    231,150,227,84,31,171,196,246,108,23,21,235,166,228,181,53,31,121,47,216,126,110,214,0,202,231,158,181,92,0,224,42,17,
+    220,1,174,176,139,22,144,203,193,80,27,249,153,3,174,44,138,154,209,74,61,50,2,53,65,194,72,210,101,75,196,74,124,106,
+    39,101,214,63,46,210,158,75,249,220,230,44,206,104,240,185,206,93,220,19,220,77,13,113,88,121,238,101,84,123,239,190,
+    104,93,158,151,83,166,162,161,206,216,125,194,182,8,190,109,91,62,191,221,110,139,170,217,247,221,184,113,99,232,253,
+    123,182,253,126,230,235,148,231,218,207,123,182,234,133,202,243,126,33,63,115,253,231,230,164,117,251,16,224,1,56,53,
+    130,59,192,9,107,7,66,57,248,234,141,93,45,108,137,238,203,144,192,212,14,138,19,175,90,100,175,208,22,41,156,219,200,
+    193,158,219,103,164,234,254,229,113,201,9,191,204,11,92,25,127,126,251,237,183,129,121,168,158,195,125,211,255,127,209,
+    130,165,219,166,133,202,62,112,83,112,31,187,239,24,59,133,14,199,115,202,143,85,222,247,101,240,69,246,189,251,116,
+    81,128,111,163,224,231,124,146,126,95,54,237,107,0,184,122,4,119,0,86,81,228,229,203,151,171,104,126,247,238,221,209,
+    163,250,18,221,115,240,148,131,40,230,39,243,171,230,192,58,31,251,156,43,61,113,170,93,98,62,39,130,251,241,228,190,
+    255,242,229,203,234,115,187,138,34,207,143,68,152,125,60,23,77,37,51,63,121,60,118,125,172,167,204,225,126,209,232,242,
+    109,65,111,74,224,223,245,111,128,57,202,123,190,118,210,253,80,90,128,207,20,52,177,30,224,141,128,7,224,170,17,220,
+    1,248,91,194,72,70,135,62,120,240,96,116,52,205,188,203,57,112,18,187,230,97,95,163,135,151,168,39,184,159,242,116,3,
+    61,242,28,187,118,237,218,112,76,137,54,166,146,153,159,67,5,247,139,182,217,118,213,205,101,223,87,25,220,47,26,97,
+    15,115,149,231,106,222,239,245,12,178,168,178,30,224,243,247,100,31,158,143,123,247,238,13,0,176,116,255,55,0,192,154,
+    22,221,199,134,243,132,146,159,126,250,105,224,248,50,53,80,22,181,205,28,251,167,30,219,163,39,38,56,113,180,44,237,
+    42,29,230,103,236,182,180,105,97,212,177,35,220,55,253,251,182,159,55,246,68,157,209,237,44,77,239,251,189,125,200,246,
+    150,247,46,9,238,121,255,146,65,28,199,58,17,0,0,21,4,119,0,254,165,141,124,26,59,90,207,104,234,227,202,193,105,70,
+    171,229,64,181,106,94,118,152,187,22,141,140,46,158,167,177,143,203,231,207,159,47,252,247,77,11,57,199,101,193,123,
+    83,76,220,116,37,215,216,216,231,249,199,18,101,251,248,248,241,227,172,214,225,201,182,215,6,14,156,114,120,183,79,
+    1,88,54,193,29,128,11,229,32,44,35,164,199,202,226,171,28,222,139,23,47,134,219,183,111,59,225,193,73,153,211,8,77,46,
+    86,53,194,253,195,135,15,27,191,239,178,5,9,55,253,254,77,33,47,107,15,140,97,132,59,75,150,233,184,18,222,31,61,122,
+    52,204,201,41,135,119,193,29,96,217,4,119,0,46,245,228,201,147,209,111,248,19,124,141,174,62,172,156,228,200,201,17,
+    247,59,167,36,11,238,189,127,255,94,108,159,185,158,233,201,46,146,24,216,243,123,182,253,254,203,2,255,182,223,119,
+    158,224,206,210,181,169,185,230,26,222,51,168,32,131,11,0,96,9,4,119,0,46,149,216,222,115,208,149,197,58,57,140,196,
+    118,11,69,214,115,242,98,254,18,56,141,0,156,191,203,70,158,95,230,178,109,111,211,220,238,9,133,151,61,23,110,221,186,
+    53,108,114,217,180,50,155,126,223,69,206,206,206,6,184,10,214,195,123,62,231,228,230,28,100,223,144,193,5,214,11,2,96,
+    9,4,119,0,54,186,119,239,222,48,214,166,121,113,169,35,182,239,166,39,202,10,238,243,247,252,249,115,83,40,45,192,216,
+    17,238,151,77,27,177,233,117,101,211,239,216,246,251,47,219,214,45,154,202,169,203,182,147,65,23,153,182,107,78,241,
+    61,251,254,76,49,3,0,115,38,184,3,176,81,79,68,16,193,246,47,81,74,108,223,77,79,112,63,213,69,218,150,198,154,17,243,
+    151,237,111,204,54,216,19,192,183,189,78,245,44,156,58,102,31,48,246,54,194,210,172,199,247,44,108,252,250,245,235,213,
+    104,243,99,157,104,202,20,51,70,186,3,48,103,223,12,0,176,65,34,66,14,180,198,196,135,124,109,226,136,0,177,63,119,239,
+    222,29,42,228,49,202,136,181,60,198,153,122,33,159,91,156,218,117,177,193,243,255,157,169,24,230,116,50,160,231,121,
+    232,42,141,101,200,201,189,204,233,155,245,38,152,175,108,131,187,142,24,175,30,225,30,137,130,151,253,220,203,254,125,
+    204,8,119,163,219,57,37,217,158,239,223,191,191,250,136,108,43,217,23,191,125,251,118,181,157,30,234,245,51,35,221,239,
+    220,185,243,247,223,49,119,185,223,198,188,55,242,30,26,96,217,4,119,0,182,234,29,33,44,66,236,71,70,118,77,25,129,221,
+    230,230,207,116,65,189,151,135,175,7,174,139,98,215,156,130,123,254,190,177,1,192,8,247,229,200,115,237,225,195,135,
+    226,196,140,141,57,105,123,209,215,37,232,109,10,224,219,230,105,223,245,228,225,46,255,126,17,207,61,78,217,249,0,159,
+    109,39,175,185,135,8,240,25,229,158,247,49,75,216,6,243,55,254,252,243,207,3,0,167,193,148,50,0,108,213,115,32,51,118,
+    193,57,118,55,101,26,141,28,236,101,46,214,103,207,158,205,102,33,180,125,27,59,135,116,36,238,121,14,31,206,148,88,
+    146,199,202,212,50,243,214,179,13,174,251,240,225,195,198,255,127,219,243,103,83,144,175,8,238,78,46,195,255,100,123,
+    79,124,207,156,239,239,223,191,255,123,254,247,156,232,159,186,47,56,47,219,233,171,87,175,6,0,152,27,35,220,1,216,11,
+    139,78,238,199,187,119,239,186,70,95,231,32,55,115,174,158,98,24,234,61,192,127,243,230,141,169,74,118,180,235,28,214,
+    121,44,218,215,230,191,111,220,184,241,247,148,70,83,22,1,206,212,2,83,174,216,96,191,198,108,131,151,141,112,223,100,
+    219,126,237,250,245,235,151,254,127,237,228,90,158,139,235,255,54,134,224,14,151,107,243,191,231,35,178,141,103,10,154,
+    188,159,201,235,236,212,247,139,94,171,1,152,35,193,29,128,173,196,243,249,200,116,50,99,229,96,55,11,157,85,143,44,
+    91,10,193,125,255,18,28,243,28,155,34,247,117,194,121,239,254,38,83,11,100,52,37,243,179,30,179,119,113,62,128,111,154,
+    146,98,151,216,189,109,202,153,44,2,185,254,251,198,158,212,60,59,59,27,128,221,172,7,248,140,124,207,251,154,156,112,
+    237,157,202,45,241,222,186,65,0,204,141,41,101,0,216,202,124,214,243,209,51,23,106,70,13,159,106,108,143,44,170,214,
+    35,247,181,147,77,135,147,88,146,169,142,122,229,241,202,2,170,204,207,166,17,230,187,216,244,26,52,230,202,138,203,
+    156,159,178,230,203,151,47,195,24,70,184,67,191,132,247,156,176,157,178,29,101,190,120,0,152,19,193,29,128,141,122,163,
+    227,146,70,26,45,229,132,66,30,135,177,193,61,83,108,100,65,201,67,154,91,164,110,211,151,140,149,219,33,224,30,86,194,
+    203,148,105,97,114,114,201,9,194,249,217,54,194,252,188,204,249,188,110,211,99,186,107,164,27,179,112,234,249,223,191,
+    201,174,211,41,1,151,155,122,37,158,253,62,0,115,35,184,3,176,81,207,136,234,56,214,37,246,189,97,117,9,182,45,28,120,
+    145,54,103,234,33,245,252,157,251,214,27,113,123,166,240,97,154,44,236,219,43,219,114,166,150,97,94,198,6,233,243,11,
+    22,111,122,29,218,117,159,191,41,204,159,143,117,99,22,76,54,186,29,106,100,63,241,227,143,63,14,61,4,119,0,230,70,112,
+    7,96,163,87,175,94,13,61,150,52,226,111,41,193,125,204,168,203,102,236,200,210,10,189,39,105,246,169,119,90,153,28,196,
+    27,229,126,88,57,57,50,229,68,81,230,222,207,156,190,204,199,216,81,224,235,251,228,252,247,166,125,244,174,251,184,
+    77,191,255,252,62,107,204,107,130,209,237,80,39,139,95,247,48,253,27,0,115,35,184,3,112,169,196,198,222,112,117,172,
+    81,127,61,35,220,231,24,136,47,50,102,212,101,115,140,199,33,193,115,110,238,223,191,63,244,50,77,201,225,101,46,247,
+    41,33,243,241,227,199,2,204,204,244,6,247,109,219,222,205,155,55,135,93,108,10,243,231,127,199,152,237,221,8,119,168,
+    211,59,165,140,253,61,0,115,35,184,3,112,169,187,119,239,14,61,142,25,32,122,34,157,197,49,235,228,190,156,227,232,226,
+    60,47,122,167,149,201,115,35,1,151,195,153,50,181,64,184,50,97,126,198,188,46,172,7,239,109,39,26,111,220,184,49,76,
+    253,253,231,71,209,143,121,61,16,220,1,0,56,79,112,7,224,66,191,252,242,75,247,168,222,222,17,74,21,122,127,247,82,70,
+    185,143,117,232,19,9,121,222,204,213,148,185,193,115,18,97,206,183,237,42,202,227,53,101,95,242,252,249,115,87,38,204,
+    200,62,70,184,143,137,221,219,158,75,235,191,103,204,243,230,88,235,149,192,85,116,85,223,139,93,38,39,20,223,189,123,
+    183,250,152,227,250,55,0,244,19,220,1,248,151,140,12,205,52,26,189,166,76,223,49,85,111,160,123,251,246,237,112,21,125,
+    249,242,101,56,148,44,48,58,199,233,100,154,140,112,159,50,77,73,182,9,209,253,176,94,190,124,57,244,114,101,194,188,
+    140,217,55,239,26,191,199,252,204,109,243,200,175,199,46,83,202,192,113,244,6,247,99,14,244,24,43,251,151,44,238,125,
+    253,250,245,213,223,157,247,38,249,200,190,36,83,100,229,117,203,201,98,128,229,19,220,1,248,135,4,197,41,83,57,68,239,
+    2,149,21,122,23,9,77,44,158,251,180,50,187,78,157,176,238,80,1,188,29,64,206,221,212,231,118,162,251,18,110,231,85,209,
+    66,68,175,92,153,96,1,213,121,24,179,255,90,223,23,111,10,112,99,99,247,166,40,215,2,215,216,5,83,45,154,10,53,178,237,
+    245,158,212,94,74,112,207,128,150,219,183,111,175,174,192,186,104,95,147,253,80,222,143,38,188,59,193,15,176,108,130,
+    59,0,43,137,26,153,179,125,202,200,246,72,0,57,246,148,50,61,1,100,202,129,222,161,100,52,212,88,135,8,238,57,64,204,
+    115,103,9,243,224,63,121,242,100,114,32,203,129,114,14,134,141,64,59,140,140,114,183,128,234,242,141,217,127,237,99,
+    132,123,108,10,244,237,247,24,221,14,199,145,147,217,189,175,171,75,216,22,219,128,150,93,95,143,92,85,7,176,108,130,
+    59,192,137,203,188,145,15,30,60,88,141,184,169,24,9,58,117,4,113,133,222,17,177,9,169,115,62,184,233,25,189,159,199,
+    116,159,209,61,207,159,196,246,243,7,201,143,30,61,26,190,126,253,58,204,77,194,237,148,185,220,155,220,94,151,126,31,
+    70,162,170,5,84,151,111,236,254,171,69,169,77,219,215,216,171,126,54,5,250,54,146,126,204,52,92,70,183,195,116,237,164,
+    125,70,118,247,234,189,186,241,80,242,222,178,103,64,75,190,199,235,23,192,50,9,238,0,39,36,1,35,243,212,190,122,245,
+    106,21,10,51,226,48,113,186,42,200,38,102,60,124,248,112,56,182,41,83,80,228,224,166,50,162,230,62,79,148,206,200,173,
+    156,212,152,178,32,88,239,232,253,220,158,234,133,200,114,187,114,155,114,95,95,116,95,205,249,242,238,196,219,41,207,
+    145,117,237,210,239,220,199,121,156,15,41,139,173,157,202,200,237,92,153,48,229,57,149,237,218,137,145,227,26,187,239,
+    74,248,222,182,223,26,59,170,117,83,160,111,219,210,199,143,31,135,93,25,225,206,210,100,155,74,252,205,186,53,121,205,
+    58,230,107,200,250,123,163,41,3,62,142,125,101,229,54,121,237,153,114,245,104,222,179,120,253,2,88,158,111,6,0,102,41,
+    17,175,210,33,222,172,79,157,142,166,202,189,123,247,38,141,136,77,68,205,71,70,105,103,1,216,204,73,191,107,44,74,4,
+    205,129,99,14,106,243,113,254,32,50,255,255,148,72,147,191,103,236,40,176,28,80,103,244,88,70,240,79,61,33,146,159,149,
+    209,86,151,205,63,218,180,121,252,115,16,188,203,115,47,183,41,247,85,59,169,144,251,104,253,115,245,232,181,76,83,146,
+    131,252,170,216,208,158,51,231,23,64,155,242,119,183,160,158,251,111,253,35,207,171,252,123,62,222,191,127,127,18,209,
+    175,93,153,48,101,17,212,124,239,111,191,253,54,112,28,109,190,243,93,183,185,132,239,107,215,174,109,253,121,99,108,
+    155,82,38,127,91,182,187,93,45,105,161,70,136,188,126,156,127,175,150,237,40,207,229,243,31,237,223,123,214,143,57,47,
+    219,85,123,253,202,71,6,122,84,189,254,230,125,209,156,85,92,57,153,247,93,207,158,61,27,0,88,14,193,29,96,166,150,54,
+    154,101,46,163,219,163,69,207,169,83,228,180,136,26,45,254,182,159,191,110,61,134,110,51,245,113,77,200,238,185,236,
+    58,7,182,57,129,208,78,36,140,121,172,218,149,17,57,64,222,117,113,217,158,8,188,126,31,94,116,213,69,123,12,114,255,
+    39,152,79,145,159,145,128,91,189,0,106,91,240,108,253,49,106,241,162,253,247,121,45,158,183,143,246,115,118,145,199,
+    229,84,70,217,230,121,155,171,115,122,183,235,124,95,190,127,46,251,169,83,148,231,255,174,87,219,108,187,130,163,231,
+    121,191,45,144,183,232,190,171,138,16,121,145,118,82,115,142,170,7,3,228,118,230,36,57,135,113,209,9,165,60,231,91,8,
+    191,76,59,193,181,190,13,93,182,61,157,127,77,219,247,251,217,185,239,211,43,166,107,204,123,10,193,29,96,89,4,119,0,
+    74,204,109,228,104,70,60,85,28,228,52,57,104,172,248,121,83,15,60,115,187,18,137,123,71,134,229,54,228,35,87,0,36,88,
+    181,128,189,62,82,116,253,32,57,7,224,99,35,84,78,118,236,99,110,227,246,24,84,141,42,109,139,151,237,123,222,254,93,
+    79,198,244,254,236,83,146,147,36,83,182,195,60,230,137,123,230,222,62,142,49,193,61,39,88,54,233,121,12,91,48,188,108,
+    187,201,85,47,99,236,235,100,215,33,34,101,175,234,191,203,130,198,135,213,59,189,220,161,226,249,88,217,79,204,249,
+    74,147,246,30,106,170,118,245,205,190,78,242,1,80,79,112,7,96,178,140,186,153,219,1,79,70,60,229,178,233,185,29,204,
+    79,61,240,74,48,74,52,156,58,125,79,139,215,149,39,37,154,245,69,73,191,219,113,74,153,99,105,115,123,103,228,243,18,
+    157,90,112,207,201,156,60,255,123,71,255,182,19,44,70,10,30,71,229,137,142,222,216,93,181,79,234,153,210,6,142,237,42,
+    157,224,104,87,170,205,217,152,69,152,183,201,52,91,130,59,192,114,88,52,21,128,73,114,176,51,101,190,244,125,105,115,
+    62,207,77,197,226,165,83,23,144,220,167,68,176,170,5,73,15,37,151,106,47,117,154,145,83,28,29,154,237,122,74,232,76,
+    172,223,199,137,38,182,171,220,111,77,9,238,21,230,60,170,22,46,115,149,78,210,206,113,176,7,0,52,130,59,0,221,18,190,
+    230,178,80,234,69,218,180,41,115,82,17,72,19,27,167,206,97,190,47,175,95,191,254,199,255,94,202,8,208,68,247,185,143,
+    148,187,72,197,9,156,165,169,56,153,182,239,105,132,184,88,229,232,204,179,179,179,161,71,213,107,130,208,199,18,93,
+    149,224,158,215,128,185,47,150,26,149,251,60,87,212,0,44,139,224,14,192,104,121,211,159,145,69,115,142,237,77,194,244,
+    156,14,82,218,60,156,83,101,20,249,220,2,241,69,163,205,150,116,128,152,231,115,110,195,146,254,230,83,155,82,166,153,
+    122,50,45,35,220,179,48,37,135,85,185,224,230,177,71,184,159,202,98,197,92,29,87,229,4,237,220,7,123,172,59,191,70,206,
+    148,159,99,159,3,176,44,130,59,0,163,36,244,102,129,212,57,78,35,115,145,28,160,204,109,190,230,207,159,63,15,21,114,
+    192,57,151,232,62,215,169,133,198,202,109,120,255,254,253,162,14,108,43,78,224,44,209,212,237,122,142,107,60,92,117,
+    85,163,61,167,204,159,126,235,214,173,161,130,17,238,44,77,229,124,226,199,208,174,238,91,74,108,111,182,45,0,189,139,
+    165,77,213,7,128,224,14,192,142,218,168,246,196,246,165,141,178,201,193,206,156,166,96,249,240,225,195,80,101,14,209,
+    125,211,104,179,37,94,2,157,144,150,232,158,231,204,18,162,90,22,82,59,69,9,16,83,34,68,91,64,149,195,153,195,232,242,
+    170,191,193,226,133,44,205,146,95,43,178,175,207,235,114,69,188,62,180,172,187,51,245,189,208,18,167,188,3,56,117,130,
+    59,0,27,37,108,100,145,193,28,168,45,121,4,115,14,210,114,176,54,135,128,90,61,13,72,98,247,49,226,112,126,95,78,192,
+    108,26,109,182,228,57,71,243,156,201,243,126,238,225,253,84,71,184,199,212,41,163,44,160,122,120,21,219,210,212,159,
+    81,241,55,152,222,129,165,89,226,107,69,187,170,50,31,75,189,170,36,127,247,148,96,158,239,117,69,13,192,242,8,238,0,
+    252,75,66,66,222,224,231,0,39,145,186,98,116,206,28,228,118,229,246,28,115,164,80,238,199,125,28,56,37,14,231,241,58,
+    196,109,107,139,86,230,190,60,133,203,156,215,195,251,28,111,239,169,206,227,30,217,150,166,158,8,252,233,167,159,6,
+    14,167,106,62,227,41,166,198,242,41,83,218,192,177,44,101,14,247,22,168,243,30,35,239,107,174,194,251,140,188,78,245,
+    188,63,91,210,124,245,0,252,211,55,3,0,39,169,5,139,132,135,132,131,124,206,37,242,57,176,185,202,33,33,183,45,7,47,
+    137,168,191,254,250,235,240,234,213,171,189,6,203,220,207,185,79,115,255,222,185,115,103,175,163,34,243,187,218,109,
+    107,139,66,86,30,96,231,118,220,191,127,127,120,248,240,225,206,207,145,171,52,237,66,238,215,124,228,249,146,251,247,
+    237,219,183,171,207,199,152,7,188,157,184,201,243,169,106,78,234,165,202,9,193,108,203,189,219,113,182,145,108,43,249,
+    57,236,95,158,183,83,247,75,83,247,163,115,24,33,15,135,150,215,238,200,190,114,78,241,61,175,103,109,138,176,123,247,
+    238,93,217,237,171,133,243,93,167,50,203,52,142,87,97,109,28,128,83,117,237,63,31,95,199,124,195,215,175,163,190,28,
+    0,102,47,7,158,239,222,189,91,197,211,158,3,209,28,28,182,147,22,249,156,0,154,255,110,255,126,76,45,14,231,246,229,
+    118,229,127,239,18,136,219,237,105,65,55,161,189,231,182,228,119,231,164,70,156,63,136,62,31,227,207,143,26,189,104,
+    20,233,28,15,196,219,253,218,238,227,220,191,83,99,70,187,157,249,220,158,71,249,156,251,172,61,183,0,160,87,123,237,
+    202,84,51,249,220,222,31,180,207,149,39,147,215,95,199,218,199,41,12,242,184,72,238,223,68,247,246,158,115,93,238,139,
+    156,216,207,9,96,175,243,0,243,114,237,218,181,113,95,63,8,238,0,240,47,155,14,56,219,65,208,82,167,21,104,183,235,162,
+    3,189,245,15,166,105,247,243,166,112,113,254,190,118,128,13,192,156,172,191,87,216,37,196,175,191,174,121,63,177,89,
+    59,73,31,237,68,4,0,243,36,184,3,0,0,0,0,64,129,177,193,221,162,169,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,
+    0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,
+    0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,
+    40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,
+    0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,
+    112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,
+    0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,
+    224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,
+    128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,
+    0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,
+    5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,
+    0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,
+    238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,
+    0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,
+    1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,
+    64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,
+    0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,
+    224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,
+    128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,
+    0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,
+    5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,
+    0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,
+    238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,
+    0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,
+    1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,
+    64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,
+    0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,
+    224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,
+    128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,
+    0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,
+    5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,
+    0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,
+    238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,
+    0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,
+    1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,
+    64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,
+    0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,
+    224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,
+    128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,
+    0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,
+    5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,
+    0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,
+    238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,
+    0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,
+    1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,
+    64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,
+    0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,
+    224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,0,0,
+    128,2,130,59,0,0,0,0,0,20,16,220,1,0,0,0,0,160,128,224,14,0,0,0,0,0,5,4,119,0,0,0,0,0,40,32,184,3,0,0,0,0,64,1,193,29,
+    0,0,0,0,0,10,8,238,0,0,0,0,0,80,64,112,7,0,0,224,255,181,107,7,53,0,192,48,12,3,55,254,160,183,114,168,159,119,82,72,
+    88,1,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,
+    0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,
+    29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,
+    7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,
+    1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,
+    119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,
+    1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,
+    64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,
+    16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,
+    0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,
+    0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,
+    0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,
+    0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,
+    130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,
+    128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,
+    32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,
+    0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,
+    0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,
+    0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,
+    0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,238,
+    236,29,0,0,0,0,0,96,197,195,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,
+    32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,
+    0,0,8,124,129,84,101,142,202,188,130,110,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+inline const unsigned char texture_board[69400] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,11,184,0,0,11,184,8,6,0,0,0,113,21,245,121,0,0,0,9,112,72,89,115,0,
+    0,11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,
+    0,1,14,173,73,68,65,84,120,1,236,221,205,85,20,93,215,6,224,163,203,185,24,1,24,1,24,1,56,124,71,96,4,96,4,98,4,106,
+    4,64,4,66,4,194,232,29,10,17,8,17,40,17,136,17,248,61,187,191,183,92,200,195,95,157,174,174,218,213,125,93,107,245,106,
+    20,232,110,7,238,117,126,238,179,207,147,223,255,40,0,0,0,0,0,0,0,0,0,0,0,48,176,167,5,0,0,0,0,0,0,0,0,0,0,0,18,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,133,103,5,0,
+    0,0,0,0,0,0,102,236,242,242,178,156,158,158,150,31,63,126,252,245,8,205,243,117,75,75,75,147,71,88,89,89,153,124,221,
+    60,175,173,173,77,158,87,87,87,255,252,12,0,0,0,48,31,158,252,254,71,1,0,0,90,123,251,246,237,173,27,111,247,217,221,
+    221,45,155,155,155,5,0,128,241,121,255,254,125,57,63,63,111,245,59,59,59,59,101,123,123,187,0,0,44,162,171,171,171,114,
+    116,116,84,142,143,143,39,227,168,248,243,44,68,232,253,203,151,47,147,208,59,0,192,172,196,184,230,240,240,176,205,
+    175,76,198,39,123,123,123,5,0,104,71,7,119,0,0,168,212,116,155,106,35,2,78,0,0,140,83,132,178,98,12,216,198,198,198,
+    70,1,0,88,52,39,39,39,101,127,127,191,245,216,169,86,172,209,189,120,241,162,0,0,204,82,140,57,250,26,223,0,192,162,
+    19,112,7,0,0,0,0,0,0,96,106,7,7,7,229,227,199,143,51,235,212,126,159,229,229,229,2,0,0,0,204,7,1,119,0,0,0,0,0,0,0,170,
+    157,157,157,77,110,46,108,123,219,97,87,214,214,214,10,0,0,0,48,63,158,22,0,0,0,0,0,0,0,168,240,254,253,251,178,177,
+    177,49,88,184,61,44,45,45,21,0,0,0,96,126,232,224,14,0,0,0,0,0,0,64,43,17,104,127,243,230,77,57,63,63,47,67,91,89,89,
+    41,0,0,0,192,252,16,112,7,0,0,0,0,0,0,224,209,34,220,254,250,245,235,65,187,182,95,39,224,14,0,0,0,243,229,105,1,0,0,
+    0,0,0,0,128,71,200,22,110,15,2,238,0,0,0,48,95,4,220,1,0,0,0,0,0,0,120,148,55,111,222,164,10,183,135,229,229,229,2,0,
+    0,0,204,15,1,119,0,0,0,0,0,0,0,30,244,254,253,251,114,126,126,94,178,89,90,90,42,0,0,0,192,252,120,86,0,0,0,0,0,0,0,
+    224,30,135,135,135,101,127,127,191,204,202,202,202,202,191,254,238,234,234,106,242,120,200,218,218,90,1,0,0,0,230,135,
+    128,59,0,0,0,0,0,0,0,247,250,244,233,83,233,74,4,210,55,54,54,202,250,250,250,228,235,219,194,237,55,253,248,241,227,
+    79,224,61,190,190,188,188,252,243,53,0,0,0,48,95,4,220,1,0,0,0,0,0,0,184,83,132,219,187,8,146,239,236,236,148,237,237,
+    237,73,184,189,173,199,132,224,1,0,0,128,249,32,224,14,0,0,0,0,0,0,192,173,34,216,126,120,120,88,166,17,93,218,63,127,
+    254,60,121,6,0,0,0,120,200,211,2,0,0,0,0,0,0,0,183,56,62,62,158,170,123,251,238,238,110,249,246,237,155,112,59,0,0,0,
+    240,104,2,238,0,0,0,0,0,0,0,220,234,224,224,160,212,250,240,225,67,217,219,219,43,0,0,0,0,109,8,184,3,0,0,0,0,0,0,240,
+    47,39,39,39,213,221,219,183,182,182,202,199,143,31,11,0,0,0,64,91,2,238,0,0,0,0,0,0,0,252,203,241,241,113,169,177,178,
+    178,162,115,59,0,0,0,80,77,192,29,0,0,0,0,0,0,128,127,169,13,184,71,231,246,8,185,3,0,0,0,212,16,112,7,0,0,0,0,0,0,224,
+    47,103,103,103,229,234,234,170,180,21,193,246,237,237,237,2,0,0,0,80,75,192,29,0,0,0,0,0,0,128,191,156,158,158,150,26,
+    209,189,29,0,0,0,96,26,2,238,0,0,0,0,0,0,0,252,165,54,224,190,185,185,89,0,0,0,0,166,33,224,14,0,0,0,0,0,0,192,95,206,
+    207,207,75,91,91,91,91,101,105,105,169,0,0,0,0,76,67,192,29,0,0,0,0,0,0,128,63,174,174,174,38,143,182,34,224,14,0,0,
+    0,48,45,1,119,0,0,0,0,0,0,0,254,184,184,184,40,53,86,87,87,11,0,0,0,192,180,4,220,1,0,0,0,0,0,0,248,227,252,252,188,
+    180,181,180,180,84,214,214,214,10,0,0,0,192,180,158,21,0,0,32,181,203,203,203,201,166,98,92,11,253,227,199,143,191,190,
+    23,27,135,43,43,43,127,158,151,151,151,11,64,223,162,62,69,173,138,26,213,92,99,127,243,42,251,168,83,77,173,10,209,
+    213,47,254,12,208,165,235,227,166,155,181,232,250,184,73,13,2,178,137,122,245,235,215,175,59,107,88,104,106,152,58,6,
+    244,225,102,13,122,12,225,118,96,72,230,131,192,188,121,168,174,53,181,77,93,3,96,94,9,184,3,48,10,111,223,190,45,167,
+    167,167,127,254,220,76,216,30,210,4,168,174,127,29,207,215,23,177,0,178,137,5,170,131,131,131,73,221,107,22,174,30,171,
+    233,148,21,143,173,173,173,178,190,190,94,0,186,20,53,233,228,228,100,82,159,154,71,77,240,33,52,53,107,99,99,99,242,
+    80,179,128,182,206,206,206,38,99,166,154,113,83,83,127,118,118,118,204,13,129,222,53,99,170,166,134,221,60,204,252,24,
+    205,88,42,230,126,241,108,44,5,116,169,182,46,1,244,101,218,249,96,51,142,218,220,220,124,244,239,69,109,140,192,233,
+    99,69,67,154,235,123,149,0,247,137,250,114,120,120,88,85,215,162,214,92,175,107,198,101,0,204,3,1,119,0,70,33,22,140,
+    106,22,212,31,35,38,122,49,225,107,130,85,130,13,192,80,162,206,125,250,244,105,178,120,85,43,22,187,154,69,253,253,
+    253,253,201,2,86,44,102,69,112,75,216,1,168,117,125,97,253,250,161,195,105,93,175,89,161,169,89,109,55,23,129,197,210,
+    28,6,140,177,78,237,1,155,208,28,210,137,215,105,130,238,219,219,219,5,96,86,162,102,29,29,29,149,227,227,227,78,198,
+    84,55,199,82,205,250,214,135,15,31,4,169,128,169,213,172,199,171,61,192,172,117,61,31,140,245,174,168,93,205,124,240,
+    161,58,214,188,247,99,125,252,248,113,50,54,3,184,79,28,216,137,122,49,205,60,177,201,83,196,124,51,68,93,51,55,4,96,
+    236,158,22,0,24,129,89,133,219,67,44,96,197,68,111,119,119,119,18,118,127,241,226,197,164,99,124,116,209,2,232,75,44,
+    140,191,122,245,106,170,112,251,109,98,145,63,94,51,66,14,175,95,191,158,44,146,1,60,86,212,140,168,29,177,8,62,237,
+    2,251,99,52,53,43,2,238,47,95,190,156,4,192,102,57,14,4,198,37,106,68,28,6,140,250,16,53,105,154,48,195,77,81,223,98,
+    227,47,230,130,234,14,208,181,235,245,43,214,159,102,53,166,138,250,21,99,169,120,31,245,12,24,130,78,161,192,172,204,
+    114,62,24,99,166,120,205,88,3,139,181,168,135,126,22,160,43,81,203,222,191,127,63,217,195,235,122,158,104,110,8,192,
+    60,16,112,7,96,20,250,156,116,221,12,86,153,244,1,179,22,11,243,17,114,232,114,81,254,54,177,56,22,139,100,234,26,240,
+    144,38,216,62,139,133,245,199,138,58,21,97,211,199,108,46,2,243,47,234,82,28,6,236,58,200,112,83,204,5,163,238,196,65,
+    104,128,46,196,97,230,89,4,177,30,210,132,25,34,44,209,231,251,2,243,163,166,118,8,184,3,179,208,215,124,176,89,139,
+    138,241,211,93,140,171,128,174,68,205,137,218,214,230,86,136,26,214,186,0,24,51,1,119,0,210,27,114,177,72,231,43,96,
+    214,34,220,30,11,243,125,106,22,179,4,70,129,155,98,172,51,116,176,253,166,102,115,49,198,99,198,98,176,152,98,188,20,
+    117,169,175,26,208,212,66,27,127,192,52,154,90,210,199,97,230,251,68,88,34,66,19,198,81,64,91,2,238,64,6,125,207,7,67,
+    140,159,98,28,119,27,1,119,160,11,205,124,177,207,181,174,152,23,198,1,108,0,24,19,1,119,0,210,187,184,184,40,25,52,
+    65,247,88,76,3,232,66,115,245,233,80,239,29,129,81,53,13,104,196,226,118,44,114,103,9,182,223,20,117,203,88,12,22,79,
+    28,52,30,98,188,20,161,133,62,55,26,129,249,210,116,25,205,116,96,48,198,81,194,12,0,192,152,12,53,31,12,49,142,139,
+    247,191,201,28,17,232,66,172,113,15,81,79,226,0,182,121,33,0,99,34,224,14,0,45,197,98,154,14,162,64,23,110,91,32,239,
+    91,212,180,251,174,92,5,22,67,212,129,161,187,139,62,150,186,5,139,35,198,74,113,208,120,40,81,19,51,140,215,128,113,
+    137,176,64,116,25,205,56,174,138,241,158,195,130,0,192,24,12,61,31,12,241,254,55,131,160,58,184,3,211,138,218,50,100,
+    125,139,121,225,241,241,113,1,128,49,16,112,7,32,189,140,215,194,187,178,30,152,86,212,145,44,221,252,226,202,85,97,
+    81,88,76,77,135,226,168,3,99,18,159,87,232,20,230,91,140,77,134,14,51,132,24,175,29,29,29,21,128,199,136,240,120,132,
+    5,50,139,195,130,58,246,1,0,153,101,153,15,134,24,59,53,161,118,141,175,128,46,100,88,103,138,181,117,53,13,128,49,16,
+    112,7,32,189,172,221,16,98,210,23,215,77,11,59,0,53,178,5,10,34,44,170,147,31,44,150,38,220,158,229,176,77,91,177,209,
+    233,112,14,204,167,24,39,101,58,120,19,129,6,128,135,68,7,188,177,212,139,8,225,143,117,12,8,0,204,183,108,243,193,88,
+    63,107,214,242,117,111,7,166,149,165,249,149,91,11,1,24,11,1,119,0,210,203,126,122,120,103,103,199,166,32,208,90,198,
+    186,17,97,12,245,12,22,71,44,96,143,253,54,154,216,240,212,129,20,230,75,204,255,178,5,68,51,221,188,3,228,20,117,98,
+    108,225,128,55,111,222,232,216,7,0,164,146,113,62,24,154,110,242,191,126,253,42,0,211,56,57,57,41,89,196,90,151,245,
+    46,0,178,123,86,0,32,185,49,108,182,197,166,224,183,111,223,202,202,202,74,1,120,72,116,70,104,27,42,141,250,178,180,
+    180,52,121,52,162,62,118,93,35,35,148,17,245,236,250,251,0,243,39,110,108,136,46,163,243,32,54,62,55,55,55,141,195,96,
+    78,196,205,12,93,119,197,107,198,80,215,235,68,219,113,84,108,64,110,108,108,20,128,155,154,91,113,198,214,209,179,233,
+    216,247,245,235,215,2,0,144,65,214,249,96,252,108,172,231,127,255,254,189,0,76,163,77,160,188,139,250,245,144,168,187,
+    177,39,8,0,89,9,184,3,144,94,51,113,139,69,173,172,155,133,241,185,154,144,59,192,67,30,179,248,20,1,170,173,173,173,
+    178,190,190,254,39,220,126,151,88,16,187,184,184,152,116,50,158,118,97,43,126,63,186,33,127,248,240,161,0,243,41,186,
+    78,205,162,27,86,212,170,181,181,181,201,115,60,158,63,127,254,231,123,151,151,151,127,14,247,196,163,203,49,157,112,
+    22,204,143,168,79,93,29,190,105,198,82,15,29,128,137,154,116,118,118,54,121,223,251,54,25,117,180,2,238,18,7,7,187,10,
+    24,196,88,42,234,215,234,234,234,159,49,85,163,89,23,139,185,95,212,164,168,95,211,190,111,188,206,209,209,81,217,222,
+    222,46,0,0,67,202,60,31,12,241,115,99,59,208,8,228,115,223,28,46,246,1,227,230,248,216,23,140,58,118,215,190,96,212,
+    162,168,89,209,140,161,185,97,162,86,212,193,120,45,77,29,0,200,234,201,239,127,20,0,24,169,155,147,192,219,66,240,205,
+    207,196,213,129,77,176,234,250,115,151,34,92,250,238,221,187,2,44,134,151,47,95,182,14,20,68,168,52,22,165,118,119,119,
+    255,245,189,248,251,168,33,241,189,218,14,234,177,152,53,109,192,34,222,59,186,209,232,226,14,243,39,106,67,116,24,237,
+    42,132,21,11,223,17,136,138,77,195,54,53,163,9,83,197,6,98,87,227,177,8,184,91,136,135,113,171,25,91,221,20,117,32,14,
+    234,213,212,131,120,239,232,92,117,91,168,34,106,92,252,125,140,211,218,222,196,19,227,63,135,7,97,62,69,221,136,218,
+    53,141,105,230,129,81,151,226,128,242,52,135,112,34,244,229,22,47,224,54,53,99,179,88,151,114,104,6,168,145,121,62,24,
+    98,237,43,180,13,225,155,15,194,252,137,61,184,182,13,100,226,48,115,228,8,110,171,79,211,204,9,163,118,69,243,151,105,
+    230,132,241,153,52,143,1,32,43,1,119,0,22,90,211,69,52,78,56,119,209,25,66,40,20,22,75,23,139,238,141,88,220,250,242,
+    229,203,189,29,101,218,136,197,248,88,44,171,101,225,29,230,83,44,118,79,219,213,37,68,39,153,168,17,211,214,172,168,
+    161,241,121,34,152,53,77,208,61,198,94,81,67,5,220,97,188,162,22,68,141,170,21,117,32,234,210,109,135,8,219,138,49,84,
+    140,165,186,98,92,5,243,43,14,14,78,19,36,136,154,21,245,97,218,117,164,105,15,58,171,83,192,109,4,220,129,190,152,15,
+    2,99,82,19,112,191,75,28,158,249,252,249,243,212,115,194,248,60,241,185,106,253,252,249,83,190,1,128,148,158,22,0,88,
+    96,17,40,141,128,86,4,162,34,152,30,19,200,105,130,90,17,204,138,128,22,64,27,177,241,23,29,243,186,10,183,135,189,189,
+    189,169,22,206,99,33,223,149,171,48,95,154,48,249,52,162,78,69,55,151,105,199,76,215,95,47,22,223,163,6,198,152,172,
+    70,140,231,226,247,133,219,97,220,226,86,135,90,177,1,23,181,169,139,48,67,136,215,209,205,24,120,200,217,217,89,117,
+    184,189,25,83,197,188,173,139,90,19,227,168,120,189,24,23,213,152,230,112,52,0,192,180,204,7,129,69,20,123,120,145,81,
+    232,162,222,196,26,251,52,117,48,154,1,2,64,70,207,10,0,48,17,155,139,177,33,24,143,105,78,57,199,166,96,92,35,102,241,
+    11,120,140,8,183,119,209,77,249,54,81,203,126,253,250,85,21,86,136,112,123,108,44,68,61,3,230,195,52,157,176,66,212,
+    171,168,39,179,24,227,196,56,44,66,243,203,203,203,173,198,96,177,104,31,193,48,96,220,226,0,206,52,29,144,167,9,117,
+    222,165,185,93,39,186,51,3,220,166,182,99,95,19,110,239,242,128,243,245,215,141,186,21,183,21,182,17,243,191,168,195,
+    14,12,194,120,77,115,139,195,93,106,26,31,196,26,215,52,227,186,54,54,55,55,39,93,79,129,113,51,31,4,22,81,147,71,232,
+    82,4,230,163,158,182,157,15,134,248,29,183,240,0,144,145,128,59,0,220,34,38,148,49,177,140,197,171,182,27,3,66,161,192,
+    99,69,0,97,86,225,246,70,4,63,99,97,170,102,147,224,248,248,88,45,131,57,81,91,7,26,177,56,222,245,130,251,109,226,61,
+    98,19,49,194,248,247,133,41,34,100,31,129,120,97,6,152,15,211,116,137,138,177,78,215,97,134,70,4,61,227,32,141,206,198,
+    192,77,181,65,172,89,133,219,27,77,7,211,87,175,94,181,94,207,138,112,172,128,59,140,87,212,164,190,130,229,247,233,
+    243,51,68,45,53,39,132,241,51,31,4,22,77,140,97,102,209,180,37,230,131,241,186,53,135,115,50,140,35,1,224,54,79,11,0,
+    112,171,102,211,177,166,75,105,132,66,1,30,18,53,166,15,17,2,173,17,11,90,53,221,186,128,124,14,14,14,74,173,232,220,
+    210,71,184,189,17,1,133,251,234,99,108,92,198,85,209,130,12,48,63,106,15,252,69,61,232,234,26,250,187,204,50,48,1,140,
+    87,237,173,127,81,83,102,21,110,111,196,58,86,116,28,109,43,14,68,154,255,1,0,125,51,31,4,22,77,172,181,207,234,38,248,
+    56,156,83,115,112,185,166,235,59,0,244,65,192,29,0,238,17,155,142,53,193,80,155,130,192,67,226,150,136,89,7,27,26,241,
+    62,241,126,53,166,233,160,3,228,16,221,59,107,55,11,163,126,12,209,169,42,54,15,111,27,131,197,198,101,132,219,251,170,
+    159,192,236,69,141,170,221,68,171,9,112,214,152,69,87,45,96,220,106,186,219,197,156,172,175,3,122,49,150,106,123,64,
+    49,214,177,132,26,0,128,62,153,15,2,139,38,214,181,163,161,204,44,213,222,204,117,121,121,89,0,32,27,1,119,0,120,64,
+    108,62,182,157,8,218,20,4,30,242,225,195,135,210,167,119,239,222,149,26,174,37,132,241,155,230,255,113,237,109,54,93,
+    136,16,88,211,137,43,62,67,4,222,109,42,194,252,169,173,81,49,79,235,235,176,75,109,247,43,96,62,157,157,157,77,194,
+    88,109,68,189,26,98,14,216,118,28,231,128,51,0,208,39,243,65,96,209,244,113,83,234,230,230,102,169,33,219,0,64,70,2,
+    238,0,240,8,53,155,144,23,23,23,5,224,54,209,77,175,239,238,195,241,158,53,11,241,2,238,48,126,71,71,71,165,70,159,55,
+    77,220,37,198,96,177,105,25,93,219,107,111,162,0,114,139,160,104,141,218,195,123,181,250,234,186,12,228,119,124,124,
+    92,218,138,14,125,125,143,171,34,220,222,118,252,100,254,7,0,244,201,124,16,88,52,181,225,243,54,98,63,176,134,219,233,
+    1,200,72,192,29,0,30,33,38,130,109,187,94,57,229,12,220,101,168,144,102,205,66,124,116,38,180,168,5,227,86,27,84,234,
+    187,203,232,109,98,252,21,87,78,15,29,180,7,102,167,102,222,20,53,161,239,14,122,179,190,62,26,24,143,154,186,53,212,
+    28,176,109,120,34,254,109,230,127,0,64,95,204,7,129,69,18,181,171,175,219,82,107,214,211,205,5,1,200,72,192,29,0,30,
+    33,38,155,109,79,59,235,122,5,220,101,117,117,181,12,97,125,125,189,212,136,144,59,48,78,181,157,176,50,116,111,7,22,
+    67,77,160,97,136,235,225,99,78,232,90,122,32,180,93,239,137,131,198,67,141,171,106,2,20,230,127,0,64,95,204,7,129,69,
+    210,231,109,16,53,65,122,1,119,0,50,18,112,7,128,71,106,187,25,105,18,8,220,101,168,197,240,154,219,40,194,197,197,69,
+    1,198,169,246,192,157,171,151,129,62,212,222,122,53,84,141,170,189,226,25,152,31,53,135,7,135,30,87,181,173,93,230,127,
+    0,64,31,204,7,129,69,211,103,243,171,190,58,197,3,192,172,9,184,3,192,35,9,184,3,93,24,122,33,220,181,132,176,88,106,
+    54,11,99,241,123,115,115,179,0,204,218,229,229,101,169,81,123,43,205,180,134,186,133,7,200,163,102,108,53,84,205,106,
+    180,157,131,234,224,14,0,244,193,124,16,88,52,14,202,0,64,123,2,238,0,48,67,181,11,116,192,252,26,234,106,250,70,205,
+    2,154,128,59,140,87,77,64,201,66,59,208,151,154,160,104,140,165,134,234,66,229,74,122,160,237,216,42,198,85,67,207,1,
+    219,134,177,4,220,1,128,62,152,15,2,139,70,87,117,0,104,79,192,29,0,0,122,52,116,184,161,102,1,77,192,1,198,171,102,
+    179,208,134,29,208,151,154,67,116,67,142,165,108,68,2,109,231,70,67,207,255,194,203,151,47,91,253,188,3,206,0,64,31,
+    204,7,129,69,146,97,110,8,0,99,244,172,0,192,28,138,133,177,232,158,30,27,143,241,117,179,1,121,215,70,100,44,76,93,
+    127,52,93,32,92,57,8,116,109,232,133,112,11,241,176,56,106,194,237,65,7,119,160,47,53,117,106,200,26,213,204,23,133,
+    63,97,113,213,116,112,31,218,243,231,207,91,253,188,26,7,227,244,245,235,215,210,181,56,32,211,182,238,29,30,30,150,
+    237,237,237,2,240,16,243,65,96,145,8,184,3,64,29,1,119,0,70,47,22,147,46,46,46,202,233,233,233,100,65,44,30,93,118,27,
+    142,9,103,60,44,90,1,0,99,242,235,215,175,82,99,121,121,185,0,100,149,225,54,28,115,67,88,92,109,255,255,103,8,49,180,
+    61,228,172,198,1,0,89,153,15,2,0,192,98,17,112,7,96,148,98,1,233,232,232,168,28,31,31,79,2,237,179,92,80,138,176,124,
+    151,129,121,0,128,62,212,142,143,116,147,1,250,82,51,207,202,16,104,0,22,87,219,186,85,123,163,78,151,218,142,9,133,
+    182,0,128,62,152,15,2,0,0,15,17,112,7,96,84,206,206,206,38,161,246,184,234,212,134,27,48,70,130,163,64,95,126,254,252,
+    89,106,216,172,3,50,123,254,252,121,25,146,26,9,180,177,191,191,95,0,0,232,134,249,32,0,0,44,22,1,119,0,70,33,58,57,
+    188,127,255,126,18,110,7,0,224,97,151,151,151,165,45,135,112,128,62,185,41,11,24,19,53,11,0,160,59,198,86,0,0,192,67,
+    158,22,0,72,238,224,224,160,188,122,245,74,184,29,0,0,96,193,189,124,249,178,0,0,0,176,120,204,7,1,0,96,177,232,224,
+    14,64,90,209,189,225,237,219,183,229,244,244,180,0,208,141,154,206,56,174,94,5,0,0,0,0,0,0,0,160,47,2,238,0,164,20,1,
+    204,215,175,95,187,162,16,160,99,2,238,0,0,0,220,197,252,15,0,0,0,0,200,224,105,1,128,100,132,219,1,102,231,234,234,
+    170,180,181,178,178,82,128,197,80,83,35,0,0,152,31,2,238,0,0,0,0,64,6,2,238,0,164,34,220,14,48,91,231,231,231,165,173,
+    229,229,229,2,140,79,77,56,73,192,29,0,224,118,130,223,0,0,0,0,0,253,17,112,7,32,149,79,159,62,9,183,3,204,72,77,184,
+    61,8,114,192,56,61,127,254,188,212,184,188,188,44,0,125,168,25,99,252,252,249,179,0,12,97,81,230,69,230,127,0,64,31,
+    204,7,1,0,128,135,60,43,0,144,196,225,225,225,228,209,133,181,181,181,63,143,232,60,188,178,178,50,89,44,107,30,183,
+    137,142,165,77,215,210,155,95,71,208,235,248,248,184,156,158,158,22,128,177,170,13,173,70,45,5,198,231,197,139,23,165,
+    70,28,134,113,115,3,208,135,152,155,181,189,57,194,77,19,192,144,106,234,214,216,8,184,3,0,125,48,31,4,0,0,30,34,224,
+    14,64,26,209,189,125,26,27,27,27,101,107,107,171,108,111,111,87,109,198,221,23,126,15,177,112,38,224,14,140,89,28,212,
+    105,43,106,43,48,78,181,33,117,183,233,0,153,13,125,203,132,26,9,139,173,109,16,43,126,126,108,7,134,215,215,215,11,
+    0,64,70,230,131,0,0,176,88,4,220,1,72,33,58,183,215,46,12,197,70,225,222,222,158,16,38,192,3,106,14,233,232,222,14,227,
+    21,55,216,212,136,14,238,0,125,136,58,213,118,30,56,116,199,62,129,6,88,108,49,63,106,91,7,190,126,253,90,0,0,248,155,
+    249,32,0,0,240,144,167,5,0,18,56,58,58,42,53,118,119,119,203,183,111,223,132,219,1,30,16,129,213,154,5,120,245,21,198,
+    235,161,219,105,238,82,115,219,3,64,141,154,131,56,67,30,194,25,58,76,1,12,175,109,221,138,186,49,116,167,81,0,128,140,
+    204,7,1,0,128,135,8,184,3,48,184,8,92,214,116,21,254,240,225,195,164,115,59,0,15,59,56,56,40,53,86,87,87,11,48,94,53,
+    155,133,177,97,87,51,54,3,104,171,230,16,206,144,129,134,139,139,139,2,44,182,154,249,81,220,90,8,0,192,223,204,7,1,
+    0,128,135,8,184,3,48,184,154,69,161,8,107,125,252,248,177,0,240,56,53,97,213,181,181,181,170,112,44,144,71,237,45,12,
+    103,103,103,5,96,214,106,198,25,67,94,9,255,253,251,247,2,44,182,152,35,181,229,224,32,0,192,191,153,15,2,0,0,15,17,
+    112,7,96,112,53,27,125,159,63,127,46,125,115,253,32,48,86,209,49,176,102,241,127,103,103,167,0,227,86,123,11,195,254,
+    254,190,177,15,48,115,99,187,101,194,225,31,32,234,86,219,110,163,81,179,132,220,1,0,254,102,62,8,0,0,60,68,192,29,128,
+    193,181,189,82,48,22,189,106,187,145,78,99,200,171,15,1,166,241,233,211,167,82,99,115,115,179,0,227,86,59,102,138,13,
+    195,147,147,147,2,48,75,181,135,112,134,10,22,8,168,2,17,110,175,233,226,94,59,39,3,0,152,87,230,131,0,0,192,67,4,220,
+    1,24,92,219,174,194,53,27,137,93,16,112,7,198,40,130,20,53,221,219,35,20,91,211,69,7,200,37,254,31,215,254,95,254,248,
+    241,163,46,238,192,76,213,116,66,14,67,4,11,98,62,88,51,166,2,230,79,205,1,66,93,220,1,0,254,102,62,8,0,0,60,68,192,
+    29,128,193,141,33,224,30,29,33,4,188,128,177,137,250,26,1,213,26,59,59,59,5,152,15,91,91,91,165,70,212,16,221,70,129,
+    89,171,153,223,13,17,20,61,56,56,40,0,161,246,166,171,183,111,223,90,91,2,0,184,198,124,16,0,0,184,143,128,59,0,60,194,
+    254,254,126,1,24,147,8,78,188,126,253,186,212,136,238,57,219,219,219,5,152,15,181,33,172,16,99,32,221,70,129,89,170,
+    61,132,115,116,116,84,250,164,22,2,141,8,98,213,116,113,119,120,16,0,224,111,230,131,0,0,192,125,4,220,1,24,157,190,
+    187,93,197,213,131,199,199,199,5,96,76,162,59,96,237,181,169,181,93,223,129,156,34,128,85,19,194,106,76,83,79,0,30,178,
+    186,186,90,106,28,30,30,246,86,155,250,124,47,96,28,106,199,86,113,120,80,7,80,0,128,255,103,62,8,0,0,220,71,192,29,
+    128,209,233,59,224,254,230,205,155,2,48,38,17,70,173,61,152,163,123,59,204,167,218,142,88,33,54,241,226,70,8,155,121,
+    192,44,68,72,116,105,105,169,212,136,49,207,172,233,184,12,220,230,221,187,119,213,181,107,119,119,87,200,29,0,160,152,
+    15,2,0,0,247,19,112,7,96,112,17,166,108,163,207,110,234,239,223,191,23,230,2,70,35,14,0,197,194,126,116,149,169,165,
+    123,59,204,167,56,184,82,187,97,24,154,144,123,220,108,3,208,181,157,157,157,82,35,174,137,159,117,72,52,194,12,230,
+    132,192,77,49,174,138,160,122,173,248,93,97,41,0,0,243,65,0,0,224,110,2,238,0,12,174,109,216,42,2,156,177,112,53,107,
+    177,112,21,87,71,3,140,65,19,62,157,38,220,30,155,9,186,183,195,124,154,54,132,21,162,206,188,122,245,74,24,11,232,220,
+    230,230,102,169,21,135,243,102,117,248,38,234,221,52,99,43,96,190,77,211,197,61,68,253,114,75,14,0,176,232,204,7,1,0,
+    128,187,8,184,3,48,184,181,181,181,210,86,116,86,159,149,8,208,199,235,223,214,197,56,54,29,117,55,6,178,137,197,246,
+    8,157,78,179,152,31,183,105,124,248,240,161,0,243,43,66,88,109,111,206,185,77,140,133,94,190,124,89,142,142,142,10,64,
+    23,226,90,250,154,121,97,136,249,91,4,68,187,62,4,29,227,43,115,63,224,62,93,28,32,140,218,21,227,42,221,65,1,128,69,
+    101,62,8,0,0,220,69,192,29,128,193,213,44,92,69,136,243,237,219,183,165,107,103,103,103,147,144,232,93,157,219,151,151,
+    151,11,64,6,177,120,31,29,100,34,12,17,139,237,241,231,105,236,237,237,117,18,124,5,242,138,16,214,231,207,159,75,23,
+    34,128,21,183,62,52,65,247,62,3,89,81,239,4,192,96,254,108,109,109,149,90,77,168,161,139,27,38,226,181,98,174,41,204,
+    0,60,70,151,7,8,163,142,69,253,233,123,92,5,0,48,52,243,65,0,0,224,54,2,238,0,12,174,246,250,193,8,118,190,121,243,166,
+    147,141,191,8,182,199,2,88,116,138,184,235,245,226,123,161,77,200,61,194,251,17,152,143,215,142,174,240,177,192,118,
+    114,114,50,121,63,155,136,64,141,168,31,81,79,34,84,218,85,248,33,58,183,79,179,137,0,140,71,140,103,166,237,52,122,
+    221,245,160,123,179,153,56,237,56,39,126,247,242,242,114,242,58,17,158,143,215,140,122,23,99,170,120,159,23,47,94,204,
+    244,54,31,96,24,17,18,141,131,56,211,152,230,134,137,168,61,81,111,226,247,111,187,134,62,62,219,239,223,191,39,53,15,
+    160,209,245,1,194,230,16,115,140,123,186,24,87,53,154,241,85,212,199,131,131,131,201,216,170,25,87,89,159,2,0,134,54,
+    150,249,96,179,79,8,0,0,244,227,89,1,128,129,69,167,171,120,212,132,52,143,143,143,39,221,220,99,81,41,2,154,109,186,
+    102,197,198,94,252,126,60,30,115,125,97,77,167,249,88,20,139,207,23,238,122,143,120,221,88,28,139,207,111,113,12,230,
+    95,212,186,168,63,225,249,243,231,183,46,220,71,237,248,245,235,215,159,26,18,191,19,207,81,71,186,14,31,68,237,209,
+    145,6,22,75,252,191,143,241,79,215,221,65,163,70,93,31,239,68,125,139,177,89,60,55,143,155,154,207,208,60,71,141,123,
+    76,157,107,198,87,192,252,104,230,68,211,30,96,105,14,222,196,248,38,230,87,241,136,90,180,186,186,250,87,29,138,241,
+    88,212,155,168,91,205,188,242,190,250,211,204,7,167,13,93,0,243,167,89,147,234,162,107,104,35,106,210,245,241,78,179,
+    118,212,60,63,118,108,213,212,182,251,198,125,241,189,154,53,47,0,128,174,140,101,62,8,0,0,244,75,192,29,128,20,154,
+    5,167,26,77,135,171,120,196,34,83,44,86,53,207,55,127,174,217,212,107,2,163,109,108,111,111,151,89,104,54,44,117,2,132,
+    197,16,181,46,75,160,60,234,154,112,59,44,158,216,208,251,250,245,235,164,227,122,215,33,247,235,174,31,244,235,218,
+    44,63,55,48,156,184,97,34,186,237,117,81,59,174,207,19,187,208,4,26,218,28,170,6,22,71,204,171,162,238,212,116,12,125,
+    140,135,154,39,76,227,226,226,66,104,11,0,24,220,24,230,131,0,0,64,191,4,220,1,72,33,174,31,220,223,223,159,186,51,113,
+    211,225,42,58,46,116,41,186,60,52,11,88,113,69,33,192,216,233,220,14,139,45,2,154,95,190,124,153,132,220,187,190,25,
+    162,47,209,109,107,121,121,185,0,243,229,243,231,207,229,213,171,87,37,155,205,205,205,201,115,220,192,3,112,155,88,
+    215,138,176,248,216,110,154,113,112,16,0,200,34,251,124,16,0,0,232,215,211,2,0,9,52,215,15,102,149,249,179,1,180,37,
+    220,14,132,56,188,23,157,220,175,95,209,60,38,63,127,254,44,192,252,137,218,180,183,183,87,50,137,67,65,113,232,57,56,
+    240,12,220,165,185,37,103,108,29,62,5,220,1,128,44,178,207,7,1,0,128,126,9,184,3,144,70,92,63,152,113,145,104,103,103,
+    231,175,207,165,99,31,48,86,77,224,66,184,29,104,196,198,225,183,111,223,38,155,117,99,19,29,82,129,249,20,115,195,237,
+    237,237,146,197,245,177,147,155,35,128,251,196,156,43,198,86,81,199,198,98,108,29,231,1,128,249,150,121,62,8,0,0,244,
+    75,192,29,128,84,226,250,193,76,1,171,248,44,55,187,69,140,181,203,41,176,216,226,160,78,4,45,116,155,1,110,138,241,
+    78,28,126,25,91,125,208,109,20,230,219,225,225,97,138,80,67,212,200,235,159,99,140,7,130,128,254,197,90,210,88,110,3,
+    52,166,2,0,178,201,58,31,4,0,0,250,37,224,14,64,42,77,192,42,67,104,160,249,44,2,237,192,152,69,45,251,242,229,75,154,
+    218,10,228,212,140,123,34,136,53,150,177,143,48,22,204,191,8,53,12,217,5,185,169,141,183,253,61,192,67,162,219,231,247,
+    239,223,211,215,140,171,171,171,201,3,0,32,147,172,243,65,0,0,160,63,2,238,0,164,147,33,228,126,223,103,16,120,7,198,
+    32,106,85,4,85,163,107,251,214,214,86,1,120,140,8,98,69,221,216,217,217,41,217,9,184,195,98,24,170,11,114,140,165,226,
+    144,160,57,33,48,141,168,33,17,114,143,90,150,57,232,110,92,5,0,100,148,113,62,8,0,0,244,71,192,29,128,148,154,128,249,
+    16,225,170,232,8,17,193,174,187,22,174,132,25,128,204,214,214,214,38,139,254,17,162,136,160,170,154,5,180,21,99,160,
+    207,159,63,79,234,72,230,160,187,32,22,44,142,190,187,32,199,251,196,156,48,198,85,119,125,31,160,141,88,107,106,110,
+    203,201,88,67,46,46,46,10,0,64,70,217,230,131,53,175,7,0,0,212,17,112,7,32,173,38,92,213,87,55,247,141,141,141,201,123,
+    69,71,8,129,80,96,76,162,102,53,129,137,88,124,23,108,7,186,112,51,232,158,109,67,78,192,29,22,75,211,5,57,234,210,44,
+    235,209,67,7,158,131,113,22,80,35,234,74,19,208,138,90,22,235,80,89,24,87,1,0,153,101,153,15,94,93,93,21,0,0,160,63,
+    207,10,0,36,23,27,126,177,112,117,122,122,90,142,142,142,202,241,241,113,103,139,72,17,76,136,192,214,230,230,102,171,
+    141,197,88,220,178,249,7,12,37,106,87,116,144,89,95,95,159,212,174,76,193,8,96,254,52,65,247,16,227,177,147,147,147,
+    201,243,249,249,121,25,66,124,158,168,129,241,28,99,66,65,83,88,44,49,127,139,199,225,225,225,164,30,197,252,112,90,
+    205,188,240,221,187,119,143,10,75,232,192,7,76,171,169,101,177,182,212,172,119,197,216,170,239,208,212,245,113,21,0,
+    64,118,67,207,7,107,198,106,203,203,203,5,0,0,168,243,228,247,63,10,0,140,76,108,254,157,157,157,77,158,99,51,240,177,
+    97,243,88,156,138,32,104,108,222,173,174,174,86,135,66,223,191,127,255,39,80,117,61,84,21,95,63,127,254,252,95,239,121,
+    223,159,111,190,6,48,46,77,8,33,234,208,229,229,229,159,175,227,185,121,212,30,136,105,234,67,19,56,136,186,213,124,
+    173,110,0,67,139,250,22,53,240,226,226,98,50,38,107,254,60,77,48,171,169,123,241,104,106,93,60,199,102,160,250,7,220,
+    38,106,78,51,63,140,26,244,152,58,212,212,150,152,15,198,97,231,168,47,109,106,75,19,70,109,230,118,77,96,225,122,13,
+    107,94,207,124,15,104,35,106,88,212,179,152,67,54,245,108,154,67,133,215,199,83,198,85,0,192,188,233,123,62,248,228,
+    201,147,210,86,220,186,170,65,13,0,0,212,17,112,7,96,110,92,15,148,94,215,132,14,116,163,2,134,116,189,62,221,23,120,
+    87,179,128,121,208,212,185,199,212,187,32,0,10,116,237,182,131,208,198,89,192,88,93,63,64,125,91,104,235,230,88,74,157,
+    3,0,22,217,44,230,131,17,158,127,245,234,85,105,43,62,135,46,238,0,0,80,71,192,29,0,0,0,0,0,0,0,0,110,113,114,114,82,
+    182,182,182,74,91,226,56,0,0,80,239,105,1,0,0,0,0,0,0,0,0,254,229,244,244,180,180,181,182,182,86,0,0,128,122,2,238,0,
+    0,0,0,0,0,0,0,112,139,243,243,243,210,214,202,202,74,1,0,0,234,9,184,3,0,0,0,0,0,0,0,192,13,63,126,252,208,193,29,0,
+    0,6,32,224,14,0,0,0,0,0,0,0,0,55,212,132,219,195,250,250,122,1,0,0,234,61,249,253,143,2,0,0,0,0,0,0,0,0,252,241,242,
+    229,203,73,23,247,182,126,254,252,89,150,150,150,10,0,0,80,71,7,119,0,0,0,0,0,0,0,0,184,230,240,240,176,42,220,190,177,
+    177,33,220,14,0,0,83,18,112,7,0,0,0,0,0,0,0,128,107,62,125,250,84,106,108,109,109,21,0,0,96,58,2,238,0,0,0,0,0,0,0,0,
+    240,63,17,110,175,233,222,30,54,55,55,11,0,0,48,157,39,191,255,81,0,0,0,0,0,0,0,0,96,193,29,29,29,149,157,157,157,82,
+    99,109,109,173,124,251,246,173,0,0,0,211,209,193,29,0,0,0,0,0,0,0,128,133,55,77,184,61,236,238,238,22,0,0,96,122,58,
+    184,3,0,0,0,0,0,0,0,176,208,62,125,250,84,62,126,252,88,106,173,172,172,148,239,223,191,23,0,0,96,122,207,10,0,0,0,0,
+    0,0,0,0,44,160,179,179,179,73,176,253,244,244,180,76,99,123,123,187,0,0,0,221,208,193,29,0,0,0,0,0,0,0,128,133,113,117,
+    117,85,78,78,78,202,225,225,225,212,193,246,160,123,59,0,0,116,75,7,119,0,0,0,0,0,0,0,0,230,82,132,217,127,253,250,85,
+    206,207,207,39,143,8,180,199,115,252,125,87,162,3,60,0,0,208,29,1,119,0,0,0,0,0,0,0,0,6,17,65,243,139,139,139,201,243,
+    205,208,249,143,31,63,254,245,179,247,253,204,205,239,223,246,243,93,219,217,217,41,219,219,219,5,0,0,232,206,147,223,
+    255,40,0,0,0,0,0,0,0,0,208,179,179,179,179,178,177,177,81,198,104,101,101,165,124,253,250,117,242,12,0,0,116,231,105,
+    1,0,0,0,0,0,0,0,128,1,44,47,47,151,49,90,90,90,18,110,7,0,128,25,17,112,7,0,0,0,0,0,0,0,128,71,18,110,7,0,128,217,18,
+    112,7,0,0,0,0,0,0,0,96,16,17,22,31,147,8,181,71,184,125,109,109,173,0,0,0,179,241,228,247,63,10,0,0,0,0,0,0,0,0,12,224,
+    201,147,39,101,12,34,212,254,229,203,23,157,219,1,0,96,198,116,112,7,0,0,0,0,0,0,0,128,123,236,238,238,150,111,223,190,
+    9,183,3,0,64,15,4,220,1,0,0,0,0,0,0,0,24,76,230,208,248,198,198,198,36,216,190,183,183,87,0,0,128,126,8,184,3,0,0,0,
+    0,0,0,0,192,53,17,108,255,250,245,235,228,177,182,182,86,0,0,128,254,60,43,0,0,0,0,0,0,0,0,48,144,165,165,165,146,65,
+    124,142,119,239,222,149,173,173,45,161,118,0,0,24,144,128,59,0,0,0,0,0,0,0,0,131,25,42,224,30,239,27,65,246,245,245,
+    245,73,199,246,120,0,0,0,195,19,112,7,0,0,0,0,0,0,0,96,48,179,14,184,199,235,55,97,246,149,149,149,178,186,186,58,249,
+    90,151,118,0,0,200,73,192,29,0,0,0,0,0,0,0,128,193,68,232,60,30,77,16,253,250,223,223,252,185,235,150,151,151,239,252,
+    126,243,245,205,223,1,0,0,242,123,242,251,31,5,0,0,0,0,0,0,0,0,0,0,0,6,246,180,0,0,0,0,0,0,0,0,0,0,0,64,2,2,238,0,0,
+    0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,
+    0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,
+    0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,207,10,192,72,60,121,242,164,0,0,0,0,0,0,0,0,0,208,222,239,
+    223,191,11,192,24,232,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,
+    64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,
+    0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,
+    0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,207,10,192,156,250,253,251,119,1,232,195,147,39,79,238,253,254,127,255,
+    251,223,2,144,193,127,254,243,159,123,191,111,252,4,100,97,124,5,140,133,241,21,48,22,198,87,192,88,24,95,1,99,97,124,
+    5,100,241,208,248,9,96,172,116,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,
+    0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,
+    0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,
+    0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,
+    0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,
+    0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,0,0,
+    0,0,82,16,112,7,0,0,0,0,0,0,0,0,0,0,32,5,1,119,0,0,0,0,0,0,0,128,255,99,239,110,142,155,74,179,0,12,159,166,8,64,25,
+    96,34,64,68,96,177,156,149,53,17,88,68,96,19,1,118,4,200,17,32,69,128,181,154,165,229,8,16,17,32,34,24,19,65,207,124,
+    154,82,15,77,55,96,125,250,59,247,222,231,169,82,209,116,131,126,22,58,229,197,123,250,0,0,0,144,130,192,29,0,0,0,0,
+    0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,
+    8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,120,26,176,161,79,
+    159,62,197,98,177,88,61,30,30,30,98,185,92,174,30,197,250,215,111,157,156,156,252,241,107,175,215,139,126,191,191,122,
+    148,223,191,120,241,34,0,0,0,0,0,0,0,0,0,0,200,69,47,202,177,8,220,249,165,50,148,166,211,105,220,222,222,254,49,164,
+    54,241,253,48,43,207,179,182,30,96,163,209,40,78,79,79,255,24,110,0,0,0,0,0,0,0,0,0,0,28,142,94,148,44,4,238,252,208,
+    108,54,139,241,120,28,243,249,60,246,165,12,191,242,252,235,215,24,12,6,171,225,117,126,126,30,0,0,0,0,0,0,0,0,0,0,236,
+    151,94,148,108,158,4,124,103,50,153,196,243,231,207,99,56,28,238,117,88,253,157,242,122,101,96,149,215,47,91,64,0,0,
+    0,0,0,0,0,0,0,0,236,158,94,148,172,4,238,252,161,156,147,120,245,234,85,188,126,253,250,143,243,16,199,82,94,127,61,
+    184,142,253,94,0,0,0,0,0,0,0,0,0,0,218,66,47,74,118,2,119,86,110,110,110,226,229,203,151,7,223,192,249,149,50,172,202,
+    208,186,190,190,14,0,0,0,0,0,0,0,0,0,0,234,233,69,105,2,129,59,171,13,156,203,203,203,200,236,234,234,42,222,188,121,
+    19,0,0,0,0,0,0,0,0,0,0,108,78,47,74,83,8,220,59,174,12,171,201,100,18,77,48,30,143,87,239,23,0,0,0,0,0,0,0,0,0,128,199,
+    211,139,210,36,2,247,14,43,27,46,77,25,86,107,229,253,218,204,1,0,0,0,0,0,0,0,0,0,120,28,189,40,77,35,112,239,168,155,
+    155,155,213,134,75,19,149,247,93,222,63,0,0,0,0,0,0,0,0,0,0,63,166,23,165,137,4,238,29,180,92,46,227,234,234,42,154,
+    172,188,255,242,57,0,0,0,0,0,0,0,0,0,0,248,43,189,40,77,245,52,232,156,235,235,235,120,120,120,136,93,58,57,57,137,193,
+    96,16,189,94,111,245,88,43,175,83,6,75,121,44,22,139,216,149,242,188,175,95,191,142,187,187,187,0,0,0,0,0,0,0,0,0,0,
+    224,207,244,162,52,149,192,189,99,202,224,152,76,38,177,11,195,225,48,46,46,46,162,223,239,255,105,72,253,72,25,50,243,
+    249,60,102,179,217,78,222,67,121,174,242,40,131,18,0,0,0,0,0,0,0,0,0,128,255,209,139,210,100,79,130,78,41,219,56,219,
+    26,141,70,241,249,243,231,248,240,225,195,31,91,56,143,81,254,92,25,114,239,223,191,95,253,253,242,60,219,186,185,185,
+    9,0,0,0,0,0,0,0,0,0,0,254,79,47,74,147,9,220,59,164,108,196,108,179,9,83,6,78,25,54,229,81,78,76,108,163,252,253,245,
+    115,61,118,224,253,157,178,145,179,235,243,25,0,0,0,0,0,0,0,0,0,0,77,165,23,165,233,4,238,29,114,127,127,31,181,202,
+    80,185,187,187,219,201,22,205,183,202,243,149,231,173,29,90,101,88,149,19,22,0,0,0,0,0,0,0,0,0,0,232,69,105,62,129,123,
+    135,220,222,222,70,173,241,120,28,253,126,63,246,161,60,239,187,119,239,162,214,98,177,8,0,0,0,0,0,0,0,0,0,0,244,162,
+    52,159,192,189,67,106,191,216,101,107,230,252,252,60,246,169,188,198,112,56,140,26,229,236,4,0,0,0,0,0,0,0,0,0,0,122,
+    81,154,79,224,222,33,181,3,235,237,219,183,113,8,181,91,57,203,229,50,0,0,0,0,0,0,0,0,0,0,208,139,210,124,2,247,142,
+    168,253,82,15,6,131,56,57,57,137,67,40,175,83,94,111,83,15,15,15,241,229,203,151,0,0,0,0,0,0,0,0,0,0,232,50,189,40,109,
+    32,112,239,136,242,165,174,81,123,6,162,86,237,235,253,251,223,255,14,0,0,0,0,0,0,0,0,0,128,46,211,139,210,6,2,247,142,
+    248,250,245,107,212,56,61,61,141,67,170,125,189,218,129,12,0,0,0,0,0,0,0,0,0,208,22,122,81,218,64,224,206,79,245,251,
+    253,56,164,67,157,183,0,0,0,0,0,0,0,0,0,0,224,127,244,162,100,34,112,231,135,122,189,94,28,90,121,205,99,188,46,0,0,
+    0,0,0,0,0,0,0,64,23,233,69,201,70,224,222,17,207,158,61,139,77,29,107,112,212,188,174,33,7,0,0,0,0,0,0,0,0,0,116,157,
+    94,148,54,16,184,119,68,219,191,208,78,85,0,0,0,0,0,0,0,0,0,0,93,167,23,165,13,4,238,29,81,115,202,225,225,225,33,142,
+    97,211,215,117,166,2,0,0,0,0,0,0,0,0,0,64,47,74,59,8,220,59,164,223,239,111,244,231,203,224,56,244,208,170,121,205,77,
+    63,23,0,0,0,0,0,0,0,0,0,64,91,233,69,105,58,129,123,135,12,6,131,216,212,253,253,125,28,210,167,79,159,98,83,195,225,
+    48,0,0,0,0,0,0,0,0,0,0,208,139,210,124,2,247,14,57,61,61,141,77,205,231,243,56,164,201,100,18,155,170,249,92,0,0,0,0,
+    0,0,0,0,0,0,109,164,23,165,233,4,238,29,82,54,114,54,221,202,41,3,228,80,103,39,150,203,101,220,222,222,110,244,119,
+    202,185,9,39,39,0,0,0,0,0,0,0,0,0,0,254,71,47,74,211,9,220,59,230,252,252,124,163,63,95,134,213,245,245,117,28,194,205,
+    205,205,198,195,241,242,242,50,0,0,0,0,0,0,0,0,0,0,248,63,189,40,77,38,112,239,152,209,104,180,241,86,206,120,60,222,
+    120,83,102,83,229,249,203,235,108,226,228,228,100,227,1,12,0,0,0,0,0,0,0,0,0,208,118,122,81,154,76,224,222,65,111,223,
+    190,141,77,189,126,253,58,22,139,69,236,195,253,253,253,234,249,55,117,119,119,23,0,0,0,0,0,0,0,0,0,0,252,149,94,148,
+    166,18,184,119,80,217,200,217,116,104,149,83,16,47,95,190,220,249,249,137,114,102,162,188,159,77,79,77,148,247,95,54,
+    114,0,0,0,0,0,0,0,0,0,0,248,43,189,40,77,37,112,239,168,171,171,171,170,115,13,229,239,61,127,254,60,166,211,105,108,
+    163,108,225,188,122,245,42,46,47,47,99,83,229,125,151,247,1,0,0,0,0,0,0,0,0,0,192,143,233,69,105,162,167,65,103,77,38,
+    147,213,175,155,14,159,229,114,25,163,209,104,53,52,202,54,205,112,56,92,109,199,188,120,241,226,111,255,124,217,182,
+    249,250,245,107,204,231,243,213,217,138,242,186,155,110,224,172,149,97,181,126,223,0,0,0,0,0,0,0,0,0,0,252,156,94,148,
+    166,17,184,119,92,249,242,151,97,83,115,74,162,12,174,242,247,191,29,32,189,94,111,245,88,43,131,169,118,56,125,175,
+    156,153,176,137,3,0,0,0,0,0,0,0,0,0,176,25,189,40,77,34,112,103,53,4,214,67,171,12,161,109,236,114,64,173,149,247,246,
+    254,253,251,213,246,15,0,0,0,0,0,0,0,0,0,0,155,211,139,210,20,79,2,254,171,156,144,184,187,187,139,203,203,203,200,162,
+    108,246,148,45,156,143,31,63,26,86,0,0,0,0,0,0,0,0,0,0,91,210,139,210,4,2,119,254,80,54,95,222,189,123,23,159,63,127,
+    94,13,176,242,251,99,88,15,170,242,62,202,182,208,183,39,44,0,0,0,0,0,0,0,0,0,0,168,167,23,37,187,167,1,223,89,159,120,
+    40,110,111,111,99,54,155,173,126,221,245,41,137,111,149,161,52,28,14,227,252,252,60,250,253,190,33,5,0,0,0,0,0,0,0,0,
+    0,176,71,122,81,178,18,184,243,83,101,136,148,71,25,96,139,197,34,94,189,122,181,243,193,85,78,74,148,33,5,0,0,0,0,0,
+    0,0,0,0,192,225,233,69,201,68,224,206,47,125,249,242,101,181,145,83,6,214,62,182,114,174,175,175,99,48,24,172,30,47,
+    94,188,8,0,0,0,0,0,0,0,0,0,0,14,75,47,74,22,2,119,254,214,253,253,125,204,231,243,152,76,38,177,92,46,99,159,202,48,
+    44,143,162,156,187,40,27,64,23,23,23,171,127,6,0,0,0,0,0,0,0,0,0,96,63,244,162,100,244,36,224,27,101,80,149,179,18,101,
+    59,230,234,234,106,239,195,234,123,229,245,198,227,113,60,127,254,124,245,62,102,179,89,0,0,0,0,0,0,0,0,0,0,176,59,122,
+    81,50,19,184,179,242,237,160,42,155,56,25,148,247,81,182,115,94,190,124,121,240,193,9,0,0,0,0,0,0,0,0,0,208,54,122,81,
+    154,64,224,222,113,15,15,15,241,230,205,155,84,131,234,123,139,197,98,181,161,83,222,39,0,0,0,0,0,0,0,0,0,0,155,209,
+    139,210,36,2,247,14,43,91,46,101,219,165,156,120,104,130,245,41,10,219,57,0,0,0,0,0,0,0,0,0,0,143,163,23,165,105,158,
+    6,157,84,182,92,202,137,137,178,145,179,141,126,191,191,218,230,121,241,226,69,244,122,189,56,57,57,89,253,186,86,158,
+    191,60,62,125,250,180,26,52,101,235,167,188,118,173,242,28,229,125,127,248,240,97,245,218,0,0,0,0,0,0,0,0,0,0,252,61,
+    189,40,77,36,112,239,160,50,48,202,38,78,173,50,148,46,47,47,227,252,252,252,79,195,233,103,202,80,91,91,15,174,235,
+    235,235,170,237,154,245,208,186,187,187,51,180,0,0,0,0,0,0,0,0,0,0,254,134,94,148,166,122,18,116,202,250,203,94,163,
+    12,167,201,100,18,159,63,127,142,139,139,139,71,15,171,239,149,129,55,26,141,86,207,243,254,253,251,213,239,55,85,182,
+    124,202,231,112,126,2,0,0,0,0,0,0,0,0,0,224,207,244,162,52,153,192,189,67,214,95,242,154,51,19,101,163,166,12,152,178,
+    133,179,75,101,112,149,205,154,111,55,118,30,107,155,207,3,0,0,0,0,0,0,0,0,0,208,70,122,81,154,78,224,222,33,181,39,
+    30,202,121,137,50,84,106,55,112,126,165,108,228,148,231,175,25,134,229,243,148,207,5,0,0,0,0,0,0,0,0,0,128,94,148,230,
+    19,184,119,68,249,98,143,199,227,216,212,112,56,140,119,239,222,197,33,148,115,22,53,155,57,229,115,57,61,1,0,0,0,0,
+    0,0,0,0,0,116,157,94,148,54,16,184,119,68,205,214,74,217,148,57,212,176,90,251,240,225,67,213,230,207,235,215,175,3,
+    0,0,0,0,0,0,0,0,0,160,203,244,162,180,129,192,189,3,202,182,74,217,118,217,212,213,213,213,106,104,29,82,25,86,53,67,
+    114,62,159,199,195,195,67,0,0,0,0,0,0,0,0,0,0,116,145,94,148,182,16,184,119,192,108,54,139,77,149,65,117,126,126,30,
+    199,48,26,141,162,223,239,199,166,110,110,110,2,0,0,0,0,0,0,0,0,0,160,139,244,162,180,133,192,189,3,106,183,113,142,
+    169,12,173,77,149,173,28,0,0,0,0,0,0,0,0,0,128,46,210,139,210,22,2,247,150,43,103,24,22,139,69,108,234,244,244,52,142,
+    169,102,27,200,217,9,0,0,0,0,0,0,0,0,0,160,139,244,162,180,137,192,189,229,62,125,250,20,155,42,231,30,202,201,137,99,
+    234,245,122,85,239,225,254,254,62,0,0,0,0,0,0,0,0,0,0,186,68,47,74,155,8,220,91,174,102,27,231,216,195,106,109,48,24,
+    196,166,150,203,101,0,0,0,0,0,0,0,0,0,0,116,137,94,148,54,17,184,183,92,205,23,184,108,228,100,80,51,56,107,6,52,0,0,
+    0,0,0,0,0,0,0,64,147,233,69,105,19,129,123,203,213,12,172,114,238,33,131,103,207,158,5,0,0,0,0,0,0,0,0,0,0,63,167,23,
+    165,77,4,238,45,247,240,240,16,155,202,50,176,106,56,57,1,0,0,0,0,0,0,0,0,0,116,141,94,148,54,17,184,3,0,0,0,0,0,0,0,
+    0,0,0,144,130,192,157,191,168,217,226,217,135,175,95,191,6,0,0,0,0,0,0,0,0,0,0,187,167,23,37,43,129,123,203,213,156,
+    143,200,114,182,33,203,224,4,0,0,0,0,0,0,0,0,0,200,76,47,74,155,8,220,91,174,201,3,107,177,88,196,166,78,78,78,2,0,0,
+    0,0,0,0,0,0,0,160,75,244,162,180,137,192,189,229,106,6,214,124,62,143,12,106,222,135,129,5,0,0,0,0,0,0,0,0,0,116,141,
+    94,148,54,17,184,183,220,139,23,47,98,83,229,212,195,177,135,214,253,253,125,213,201,137,154,1,13,0,0,0,0,0,0,0,0,0,
+    208,100,122,81,218,68,224,222,114,181,27,42,179,217,44,142,105,50,153,68,141,154,1,13,0,0,0,0,0,0,0,0,0,208,100,122,
+    81,218,68,224,222,114,253,126,63,106,148,129,177,92,46,227,24,202,235,214,14,172,218,207,11,0,0,0,0,0,0,0,0,0,208,84,
+    122,81,218,68,224,222,114,229,4,195,96,48,136,77,149,115,15,175,95,191,142,99,168,125,221,242,57,157,156,0,0,0,0,0,0,
+    0,0,0,0,186,70,47,74,155,8,220,59,160,102,96,21,243,249,60,174,175,175,227,144,202,235,149,215,173,49,28,14,3,0,0,0,
+    0,0,0,0,0,0,160,139,244,162,180,133,192,189,3,206,207,207,163,214,213,213,213,193,134,86,121,157,242,122,181,206,206,
+    206,2,0,0,0,0,0,0,0,0,0,160,139,244,162,180,133,192,189,3,78,78,78,170,183,114,138,125,15,173,114,222,226,205,155,55,
+    91,13,171,242,249,202,231,4,0,0,0,0,0,0,0,0,0,232,34,189,40,109,33,112,239,136,183,111,223,198,54,202,48,121,254,252,
+    121,76,167,211,216,165,219,219,219,120,249,242,101,140,199,227,216,198,104,52,10,0,0,0,0,0,0,0,0,0,128,46,211,139,210,
+    6,2,247,142,40,27,43,219,108,229,20,203,229,114,53,24,214,131,171,252,190,198,151,47,95,86,27,62,229,121,254,249,207,
+    127,86,63,207,90,217,196,217,230,172,6,0,0,0,0,0,0,0,0,0,64,27,232,69,105,131,167,65,103,148,173,156,249,124,30,219,
+    90,15,174,162,12,139,126,191,191,122,148,127,238,245,122,171,199,90,57,39,81,30,229,239,148,71,121,253,109,7,212,247,
+    238,238,238,2,0,0,0,0,0,0,0,0,0,0,189,40,205,39,112,239,144,178,145,115,121,121,185,245,121,135,111,173,7,81,57,29,113,
+    12,101,8,151,65,9,0,0,0,0,0,0,0,0,0,128,94,148,230,123,18,116,74,249,130,151,237,153,54,40,159,227,234,234,42,0,0,0,
+    0,0,0,0,0,0,0,248,63,189,40,77,38,112,239,152,114,14,226,195,135,15,141,223,98,41,239,191,124,14,0,0,0,0,0,0,0,0,0,0,
+    254,76,47,74,147,9,220,59,168,124,217,239,238,238,26,59,180,154,254,254,1,0,0,0,0,0,0,0,0,0,246,77,47,74,83,9,220,59,
+    170,169,95,250,114,102,194,176,2,0,0,0,0,0,0,0,0,0,248,53,189,40,77,36,112,239,176,242,165,255,248,241,99,92,94,94,70,
+    19,148,247,105,88,1,0,0,0,0,0,0,0,0,0,60,158,94,148,166,17,184,119,92,175,215,139,119,239,222,197,251,247,239,211,14,
+    130,245,246,80,121,159,229,253,2,0,0,0,0,0,0,0,0,0,240,120,122,81,154,68,224,206,202,104,52,138,207,159,63,199,219,183,
+    111,211,12,174,50,156,202,251,41,91,67,131,193,32,0,0,0,0,0,0,0,0,0,0,168,167,23,165,9,4,238,252,201,213,213,213,106,
+    251,229,152,27,58,101,56,141,199,227,213,0,45,239,199,22,14,0,0,0,0,0,0,0,0,0,192,238,232,69,201,236,105,192,119,202,
+    160,42,27,58,229,177,88,44,98,58,157,198,124,62,95,253,243,190,148,33,117,122,122,186,250,213,246,13,0,0,0,0,0,0,0,0,
+    0,192,126,233,69,201,74,224,206,79,245,251,253,213,163,120,120,120,88,13,173,251,251,251,213,175,203,229,114,245,40,
+    255,254,177,202,118,77,25,136,235,231,125,246,236,217,106,64,217,186,1,0,0,0,0,0,0,0,0,0,56,14,189,40,153,8,220,121,
+    180,50,84,126,180,49,179,30,92,127,55,188,214,167,43,142,117,194,2,0,0,0,0,0,0,0,0,0,128,199,209,139,114,108,2,119,118,
+    194,48,2,0,0,0,0,0,0,0,0,0,104,55,189,40,135,240,36,0,0,0,0,0,0,0,0,0,0,0,32,1,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,
+    0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,
+    0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,
+    0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,
+    0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,
+    0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,
+    0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,
+    0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,
+    0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,
+    0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,
+    0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,
+    0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,225,183,223,255,43,0,26,224,183,223,126,11,
+    0,0,0,0,0,0,0,0,0,54,39,23,5,154,194,255,193,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,
+    0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,
+    0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,120,26,0,45,245,175,127,253,43,0,14,225,31,255,248,199,79,255,251,239,191,255,
+    30,0,25,252,246,219,111,63,253,239,126,126,2,178,240,243,21,208,20,126,190,2,154,194,207,87,64,83,248,249,10,104,10,
+    63,95,1,89,252,234,231,39,128,166,242,127,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,
+    0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,
+    130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,
+    0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,
+    16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,
+    0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,
+    10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,
+    0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,
+    0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,
+    0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,
+    32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,
+    0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,
+    0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,
+    0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,
+    0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,
+    130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,
+    0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,
+    16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,
+    0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,
+    10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,
+    0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,
+    0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,
+    0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,
+    32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,79,131,86,123,
+    245,234,85,116,221,135,15,31,162,215,235,5,0,0,0,0,0,0,0,0,0,64,27,233,69,245,162,109,34,112,111,185,249,124,30,93,54,
+    28,14,13,43,0,0,0,0,0,0,0,0,0,160,213,244,162,122,209,54,121,18,208,98,101,96,1,0,0,0,0,0,0,0,0,0,208,94,122,209,118,
+    17,184,211,106,103,103,103,1,0,0,0,0,0,0,0,0,0,64,123,233,69,219,69,224,78,107,141,70,35,231,38,0,0,0,0,0,0,0,0,0,0,
+    90,76,47,218,62,2,119,90,203,185,9,0,0,0,0,0,0,0,0,0,128,118,211,139,182,143,192,157,86,42,155,56,206,77,0,0,0,0,0,0,
+    0,0,0,0,180,151,94,180,157,4,238,180,146,109,28,0,0,0,0,0,0,0,0,0,128,118,211,139,182,147,192,157,86,58,63,63,15,0,0,
+    0,0,0,0,0,0,0,0,218,75,47,218,78,2,119,90,231,228,228,36,6,131,65,0,0,0,0,0,0,0,0,0,0,208,78,122,209,246,18,184,211,
+    58,134,21,0,0,0,0,0,0,0,0,0,64,187,233,69,219,75,224,78,235,56,55,1,0,0,0,0,0,0,0,0,0,208,110,122,209,246,122,26,240,
+    157,241,120,28,103,103,103,113,76,211,233,52,174,174,174,98,83,206,77,0,0,0,0,0,0,0,0,0,0,252,154,94,148,172,4,238,252,
+    69,175,215,91,125,241,143,105,62,159,71,13,195,10,0,0,0,0,0,0,0,0,0,224,215,244,162,100,245,36,32,153,229,114,89,61,
+    176,156,155,0,0,0,0,0,0,0,0,0,0,200,79,47,202,143,8,220,73,167,118,88,57,55,1,0,0,0,0,0,0,0,0,0,208,12,122,81,126,68,
+    224,78,58,211,233,52,106,24,86,0,0,0,0,0,0,0,0,0,0,205,160,23,229,71,4,238,164,178,205,185,137,139,139,139,0,0,0,0,0,
+    0,0,0,0,0,32,55,189,40,63,35,112,39,149,109,206,77,244,251,253,0,0,0,0,0,0,0,0,0,0,32,55,189,40,63,35,112,39,149,155,
+    155,155,168,49,28,14,3,0,0,0,0,0,0,0,0,0,128,252,244,162,252,140,192,157,52,202,185,137,197,98,17,53,156,155,0,0,0,0,
+    0,0,0,0,0,0,200,79,47,202,175,8,220,73,99,54,155,69,141,114,106,162,156,156,0,0,0,0,0,0,0,0,0,0,32,55,189,40,191,34,
+    112,39,141,241,120,28,53,70,163,81,0,0,0,0,0,0,0,0,0,0,144,159,94,148,95,17,184,147,66,57,53,81,78,78,212,56,59,59,11,
+    0,0,0,0,0,0,0,0,0,0,114,211,139,242,24,2,119,82,152,78,167,81,195,185,9,0,0,0,0,0,0,0,0,0,128,102,208,139,242,24,2,119,
+    82,184,189,189,141,26,151,151,151,1,0,0,0,0,0,0,0,0,0,64,126,122,81,30,67,224,206,209,109,115,110,226,244,244,52,0,0,
+    0,0,0,0,0,0,0,0,200,77,47,202,99,9,220,57,186,155,155,155,168,49,24,12,156,155,0,0,0,0,0,0,0,0,0,0,104,0,189,40,143,
+    37,112,231,232,230,243,121,212,24,141,70,1,0,0,0,0,0,0,0,0,0,64,126,122,81,30,75,224,206,81,221,223,223,59,55,1,0,0,
+    0,0,0,0,0,0,0,208,98,122,81,54,33,112,231,168,38,147,73,212,112,110,2,0,0,0,0,0,0,0,0,0,160,25,244,162,108,226,105,208,
+    106,239,223,191,143,77,29,114,211,197,185,9,0,0,0,0,0,0,0,0,0,128,237,232,69,105,19,129,123,203,101,254,98,59,55,1,0,
+    0,0,0,0,0,0,0,0,176,61,189,40,109,242,36,224,72,106,207,77,12,135,67,231,38,0,0,0,0,0,0,0,0,0,0,26,64,47,202,166,4,238,
+    28,77,237,185,137,50,176,0,0,0,0,0,0,0,0,0,0,200,79,47,202,166,4,238,28,197,108,54,171,62,55,113,118,118,22,0,0,0,0,
+    0,0,0,0,0,0,228,166,23,165,134,192,157,163,184,189,189,141,26,163,209,40,122,189,94,0,0,0,0,0,0,0,0,0,0,144,155,94,148,
+    26,2,119,142,162,118,96,57,55,1,0,0,0,0,0,0,0,0,0,208,12,122,81,106,8,220,57,184,201,100,18,15,15,15,177,169,178,137,
+    227,220,4,0,0,0,0,0,0,0,0,0,64,126,122,81,106,9,220,57,184,217,108,22,53,108,227,0,0,0,0,0,0,0,0,0,0,52,131,94,148,90,
+    2,119,14,170,108,226,56,55,1,0,0,0,0,0,0,0,0,0,208,94,122,81,182,33,112,231,160,106,135,213,201,201,137,115,19,0,0,0,
+    0,0,0,0,0,0,0,13,160,23,101,27,2,119,14,170,246,220,196,96,48,8,0,0,0,0,0,0,0,0,0,0,242,211,139,178,13,129,59,7,179,
+    92,46,171,55,114,206,207,207,3,0,0,0,0,0,0,0,0,0,128,220,244,162,108,75,224,206,193,204,231,243,168,81,206,77,216,200,
+    1,0,0,0,0,0,0,0,0,0,200,79,47,202,182,4,238,28,204,116,58,141,26,134,21,0,0,0,0,0,0,0,0,0,64,51,232,69,217,150,192,157,
+    131,40,231,38,106,55,114,156,155,0,0,0,0,0,0,0,0,0,0,200,79,47,202,46,8,220,57,8,231,38,0,0,0,0,0,0,0,0,0,0,218,77,47,
+    202,46,8,220,57,8,231,38,0,0,0,0,0,0,0,0,0,0,218,77,47,202,46,8,220,217,187,109,206,77,92,92,92,4,0,0,0,0,0,0,0,0,0,
+    0,185,233,69,217,21,129,59,123,183,205,185,137,126,191,31,0,0,0,0,0,0,0,0,0,0,228,166,23,101,87,4,238,236,221,205,205,
+    77,212,24,14,135,1,0,0,0,0,0,0,0,0,0,64,126,122,81,118,69,224,206,94,149,115,19,139,197,34,106,56,55,1,0,0,0,0,0,0,0,
+    0,0,144,159,94,148,93,18,184,179,87,179,217,44,106,148,83,19,229,228,4,0,0,0,0,0,0,0,0,0,0,185,233,69,217,37,129,59,
+    123,53,30,143,163,198,104,52,10,0,0,0,0,0,0,0,0,0,0,242,211,139,178,75,2,119,246,166,156,154,40,39,39,106,156,157,157,
+    5,0,0,0,0,0,0,0,0,0,0,185,233,69,217,53,129,59,123,51,157,78,163,134,115,19,0,0,0,0,0,0,0,0,0,0,205,160,23,101,215,4,
+    238,236,205,237,237,109,212,184,188,188,12,0,0,0,0,0,0,0,0,0,0,242,211,139,178,107,2,119,246,98,155,115,19,167,167,167,
+    1,0,0,0,0,0,0,0,0,0,64,110,122,81,246,65,224,206,94,220,220,220,68,141,193,96,224,220,4,0,0,0,0,0,0,0,0,0,64,3,232,69,
+    217,7,129,59,123,49,159,207,163,198,104,52,10,0,0,0,0,0,0,0,0,0,0,242,211,139,178,15,2,119,118,238,254,254,222,185,9,
+    0,0,0,0,0,0,0,0,0,128,22,211,139,178,47,2,119,118,110,50,153,68,13,231,38,0,0,0,0,0,0,0,0,0,0,154,65,47,202,190,8,220,
+    217,57,231,38,0,0,0,0,0,0,0,0,0,0,218,77,47,202,190,8,220,217,41,231,38,0,0,0,0,0,0,0,0,0,0,218,77,47,202,62,9,220,217,
+    169,218,115,19,195,225,208,185,9,0,0,0,0,0,0,0,0,0,128,6,208,139,178,79,2,119,118,170,246,220,68,25,88,0,0,0,0,0,0,0,
+    0,0,0,228,167,23,101,159,4,238,236,204,108,54,171,62,55,113,118,118,22,0,0,0,0,0,0,0,0,0,0,228,166,23,101,223,4,238,
+    236,204,237,237,109,212,40,219,56,189,94,47,0,0,0,0,0,0,0,0,0,0,200,77,47,202,190,9,220,217,153,218,129,53,26,141,2,
+    0,0,0,0,0,0,0,0,0,128,252,244,162,236,155,192,157,157,40,231,38,30,30,30,98,83,101,19,199,185,9,0,0,0,0,0,0,0,0,0,128,
+    252,244,162,28,130,192,157,157,152,76,38,81,163,156,155,0,0,0,0,0,0,0,0,0,0,32,63,189,40,135,32,112,103,107,101,19,167,
+    246,220,132,129,5,0,0,0,0,0,0,0,0,0,144,159,94,148,67,17,184,179,181,218,97,117,114,114,226,220,4,0,0,0,0,0,0,0,0,0,
+    64,3,232,69,57,20,129,59,91,155,205,102,81,99,48,24,4,0,0,0,0,0,0,0,0,0,0,249,233,69,57,20,129,59,91,89,46,151,213,27,
+    57,231,231,231,1,0,0,0,0,0,0,0,0,0,64,110,122,81,14,73,224,206,86,230,243,121,212,40,231,38,108,228,0,0,0,0,0,0,0,0,
+    0,0,228,167,23,229,144,4,238,108,101,58,157,70,13,195,10,0,0,0,0,0,0,0,0,0,160,25,244,162,28,146,192,157,106,229,220,
+    68,237,70,142,115,19,0,0,0,0,0,0,0,0,0,0,249,233,69,57,52,129,59,213,156,155,0,0,0,0,0,0,0,0,0,0,104,55,189,40,135,38,
+    112,167,154,115,19,0,0,0,0,0,0,0,0,0,0,237,166,23,229,208,4,238,84,217,230,220,196,197,197,69,0,0,0,0,0,0,0,0,0,0,144,
+    155,94,148,99,16,184,83,101,155,115,19,253,126,63,0,0,0,0,0,0,0,0,0,0,200,77,47,202,49,8,220,169,114,115,115,19,53,134,
+    195,97,0,0,0,0,0,0,0,0,0,0,144,159,94,148,99,16,184,179,177,114,110,98,177,88,68,141,243,243,243,0,0,0,0,0,0,0,0,0,0,
+    32,55,189,40,199,34,112,103,99,179,217,44,106,148,83,19,206,77,0,0,0,0,0,0,0,0,0,0,228,167,23,229,88,4,238,108,108,50,
+    153,68,141,209,104,20,0,0,0,0,0,0,0,0,0,0,228,167,23,229,88,4,238,108,164,156,154,168,61,55,113,118,118,22,0,0,0,0,0,
+    0,0,0,0,0,228,166,23,229,152,4,238,108,100,58,157,70,141,114,106,226,228,228,36,0,0,0,0,0,0,0,0,0,0,200,77,47,202,49,
+    9,220,217,200,187,119,239,226,247,223,127,223,248,241,241,227,199,0,0,0,0,0,0,0,0,0,0,32,63,189,40,199,36,112,7,0,0,
+    0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,
+    10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,
+    0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,
+    0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,
+    0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,255,97,239,254,174,154,218,22,54,14,79,28,222,203,174,
+    64,168,192,88,129,225,210,43,176,2,160,2,177,2,160,2,177,2,176,2,227,149,151,66,5,134,10,128,14,98,5,126,103,174,239,
+    196,179,253,7,102,37,144,119,101,61,207,24,107,196,189,21,129,11,222,145,139,223,116,2,0,0,0,0,0,0,0,0,0,0,16,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,
+    0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,
+    68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,
+    0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,
+    4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,
+    0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,
+    0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,
+    0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,
+    0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,132,181,111,255,81,0,58,96,109,109,173,0,0,0,0,0,0,0,0,0,48,59,185,40,
+    208,21,254,5,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,
+    0,32,194,227,2,176,162,190,125,251,86,0,30,194,218,218,218,173,191,255,233,211,167,2,144,224,229,203,151,183,254,190,
+    247,79,64,10,239,175,128,174,240,254,10,232,10,239,175,128,174,240,254,10,232,10,239,175,128,20,119,189,127,2,232,42,
+    255,130,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,
+    0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,
+    0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,
+    68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,
+    0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,
+    4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,
+    0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,
+    0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,
+    0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,
+    0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,78,167,220,220,220,20,0,0,0,0,0,0,0,0,0,0,86,
+    151,94,180,223,30,23,8,81,199,104,60,30,151,235,235,235,31,158,201,100,242,253,169,70,163,81,217,222,222,46,0,0,0,0,
+    0,0,0,0,0,0,116,139,94,148,187,8,220,121,112,117,120,46,47,47,155,113,170,207,249,249,121,51,76,127,107,150,63,11,0,
+    0,0,0,0,0,0,0,0,192,195,211,139,210,150,192,157,7,113,113,113,209,12,211,244,153,199,244,100,14,0,0,0,0,0,0,0,0,0,0,
+    57,244,162,44,130,192,157,123,83,71,234,236,236,172,185,34,98,145,35,227,68,14,0,0,0,0,0,0,0,0,0,64,6,189,40,139,38,
+    112,103,161,234,72,213,129,170,67,117,95,39,103,12,22,0,0,0,0,0,0,0,0,0,192,242,232,69,185,79,2,119,22,162,14,213,209,
+    209,209,220,215,73,252,13,131,5,0,0,0,0,0,0,0,0,0,240,240,244,162,60,4,129,59,115,121,200,161,154,186,175,147,62,0,0,
+    0,0,0,0,0,0,0,0,252,74,47,202,67,122,84,160,133,58,84,91,91,91,101,56,28,62,232,88,85,117,176,140,22,0,0,0,0,0,0,0,0,
+    0,192,253,210,139,178,12,2,119,102,82,135,98,127,127,127,41,67,245,111,95,191,126,45,0,0,0,0,0,0,0,0,0,0,44,158,94,148,
+    101,18,184,243,215,70,163,81,217,220,220,44,103,103,103,101,217,174,174,174,10,0,0,0,0,0,0,0,0,0,0,139,165,23,101,217,
+    4,238,220,169,158,194,121,243,230,77,121,245,234,85,204,85,15,55,55,55,5,0,0,0,0,0,0,0,0,0,128,197,208,139,146,226,113,
+    129,91,92,95,95,55,67,53,30,143,203,178,173,175,175,127,127,190,125,251,86,0,0,0,0,0,0,0,0,0,0,152,159,94,148,36,2,119,
+    254,168,142,84,29,171,58,90,15,161,14,209,198,198,70,25,12,6,205,243,228,201,147,230,117,250,255,1,0,0,0,0,0,0,0,0,0,
+    88,44,189,40,105,4,238,252,86,29,171,173,173,173,123,189,98,162,14,209,206,206,78,51,74,47,94,188,104,94,1,0,0,0,0,0,
+    0,0,0,0,120,24,122,81,18,9,220,249,197,125,142,213,112,56,108,198,169,190,214,7,0,0,0,0,0,0,0,0,0,128,135,167,23,37,
+    149,192,157,31,212,235,37,22,61,86,245,228,205,222,222,94,217,222,222,54,82,0,0,0,0,0,0,0,0,0,0,75,166,23,37,153,192,
+    157,239,22,61,86,117,168,94,191,126,93,14,14,14,154,95,3,0,0,0,0,0,0,0,0,0,176,92,122,81,210,9,220,249,238,213,171,87,
+    205,104,205,203,80,1,0,0,0,0,0,0,0,0,0,100,210,139,146,78,224,78,227,248,248,184,140,199,227,50,175,157,157,157,114,
+    122,122,106,168,0,0,0,0,0,0,0,0,0,0,194,232,69,233,2,129,59,101,52,26,149,163,163,163,50,143,58,80,117,168,234,96,1,
+    0,0,0,0,0,0,0,0,0,144,69,47,74,87,8,220,123,110,50,153,148,55,111,222,148,121,108,108,108,148,207,159,63,55,175,0,0,
+    0,0,0,0,0,0,0,0,100,209,139,210,37,143,10,189,86,175,154,184,190,190,46,109,13,135,195,242,229,203,23,99,5,0,0,0,0,0,
+    0,0,0,0,16,74,47,74,151,8,220,123,172,14,213,201,201,73,105,107,119,119,183,57,137,83,175,155,0,0,0,0,0,0,0,0,0,0,32,
+    143,94,148,174,17,184,247,88,61,141,211,214,96,48,40,103,103,103,5,0,0,0,0,0,0,0,0,0,128,92,122,81,186,70,224,222,83,
+    245,52,78,219,193,169,215,75,124,248,240,161,0,0,0,0,0,0,0,0,0,0,144,75,47,74,23,9,220,123,170,237,105,156,122,189,68,
+    189,102,162,142,22,0,0,0,0,0,0,0,0,0,0,185,244,162,116,145,192,189,135,230,57,141,115,120,120,104,172,0,0,0,0,0,0,0,
+    0,0,0,194,233,69,233,42,129,123,15,181,61,141,51,24,12,202,193,193,65,1,0,0,0,0,0,0,0,0,0,32,155,94,148,174,18,184,247,
+    208,249,249,121,105,227,195,135,15,5,0,0,0,0,0,0,0,0,0,128,124,122,81,186,74,224,222,51,245,170,137,122,229,196,172,
+    246,246,246,92,53,1,0,0,0,0,0,0,0,0,0,208,1,122,81,186,76,224,222,51,31,63,126,44,109,28,30,30,22,0,0,0,0,0,0,0,0,0,
+    0,242,233,69,233,50,129,123,143,76,38,147,50,26,141,202,172,134,195,161,211,56,0,0,0,0,0,0,0,0,0,0,29,160,23,165,235,
+    30,23,122,227,226,226,162,180,81,175,155,152,71,29,202,175,95,191,54,175,245,153,90,95,95,47,79,159,62,109,94,1,0,0,
+    0,0,0,0,0,0,0,152,159,94,148,174,19,184,247,72,155,211,56,117,76,118,119,119,103,250,152,58,140,231,231,231,101,60,30,
+    55,207,245,245,245,157,31,51,24,12,154,167,158,254,121,241,226,133,19,64,0,0,0,0,0,0,0,0,0,0,45,232,69,233,58,129,123,
+    143,212,17,153,213,206,206,206,95,253,185,58,76,239,223,191,47,103,103,103,63,156,186,249,91,211,113,171,31,95,213,241,
+    58,56,56,40,219,219,219,78,236,0,0,0,0,0,0,0,0,0,0,252,37,189,40,93,39,112,239,137,122,42,230,111,78,198,252,236,174,
+    193,170,127,231,254,254,126,171,49,188,77,29,175,122,213,69,61,153,83,95,15,15,15,11,0,0,0,0,0,0,0,0,0,0,127,166,23,
+    101,21,60,42,244,194,229,229,101,105,227,217,179,103,127,252,189,119,239,222,149,231,207,159,47,124,172,254,173,14,226,
+    209,209,81,217,220,220,188,215,207,3,0,0,0,0,0,0,0,0,0,208,117,122,81,86,129,192,189,39,218,252,176,215,107,31,234,137,
+    152,159,213,17,217,218,218,106,174,132,104,115,189,68,27,211,207,121,124,124,92,0,0,0,0,0,0,0,0,0,0,248,149,94,148,85,
+    240,184,208,11,245,10,135,89,221,54,86,109,174,175,88,132,122,58,167,142,228,219,183,111,11,0,0,0,0,0,0,0,0,0,0,255,
+    163,23,101,21,248,23,220,123,162,205,96,213,19,57,255,182,236,177,154,58,57,57,41,251,251,251,5,0,0,0,0,0,0,0,0,0,128,
+    255,209,139,178,10,4,238,61,80,79,176,180,185,26,226,231,193,170,35,177,236,177,154,58,59,59,115,253,4,0,0,0,0,0,0,0,
+    0,0,192,127,233,69,89,21,2,247,30,184,188,188,44,109,60,121,242,228,251,175,235,56,156,159,159,151,36,245,250,137,209,
+    104,84,0,0,0,0,0,0,0,0,0,0,250,78,47,202,170,16,184,247,192,213,213,85,105,99,115,115,179,121,173,167,112,234,56,36,
+    170,167,132,218,156,54,2,0,0,0,0,0,0,0,0,0,88,37,122,81,86,133,192,189,7,110,110,110,74,27,79,159,62,109,94,147,175,
+    118,168,99,229,234,9,0,0,0,0,0,0,0,0,0,160,239,244,162,172,138,199,133,149,87,79,212,204,243,177,103,103,103,119,254,
+    185,141,141,141,50,28,14,155,215,58,116,235,235,235,205,51,85,135,165,14,103,253,251,234,213,21,227,241,184,44,202,201,
+    201,73,121,253,250,117,243,185,1,0,0,0,0,0,0,0,0,0,250,72,47,202,170,16,184,247,64,155,43,25,166,63,252,117,92,254,100,
+    48,24,148,237,237,237,178,183,183,55,243,88,76,135,171,158,166,153,103,80,167,234,223,115,122,122,90,0,0,0,0,0,0,0,0,
+    0,0,250,72,47,202,170,120,84,88,121,109,6,107,234,253,251,247,191,252,191,58,78,159,63,127,46,95,190,124,41,71,71,71,
+    173,78,194,212,143,169,67,119,117,117,213,12,205,188,167,105,70,163,209,92,223,39,0,0,0,0,0,0,0,0,0,64,151,233,69,89,
+    21,2,247,30,104,243,131,92,63,102,107,107,235,151,19,57,7,7,7,205,80,213,235,37,22,165,14,87,29,192,121,70,171,126,189,
+    191,27,87,0,0,0,0,0,0,0,0,0,128,62,208,139,178,42,4,238,61,208,118,176,126,30,171,122,114,230,237,219,183,101,125,125,
+    189,44,90,29,171,58,132,245,26,139,182,234,169,28,0,0,0,0,0,0,0,0,0,128,62,210,139,178,42,4,238,61,176,136,171,24,234,
+    80,213,147,51,247,169,14,225,60,39,115,234,192,186,118,2,0,0,0,0,0,0,0,0,0,232,35,189,40,171,66,224,222,3,243,254,16,
+    31,30,30,54,87,77,60,132,58,90,245,228,79,91,23,23,23,5,0,0,0,0,0,0,0,0,0,160,111,244,162,172,10,129,59,183,170,167,
+    99,142,142,142,202,67,26,14,135,173,79,255,252,124,77,6,0,0,0,0,0,0,0,0,0,0,183,211,139,146,68,224,206,173,30,122,172,
+    166,94,191,126,93,218,184,190,190,46,0,0,0,0,0,0,0,0,0,0,252,61,189,40,73,4,238,252,81,61,141,179,187,187,91,150,97,
+    48,24,52,39,115,102,53,30,143,11,0,0,0,0,0,0,0,0,0,0,127,71,47,74,26,129,59,127,180,172,211,56,83,59,59,59,101,86,245,
+    68,206,100,50,41,0,0,0,0,0,0,0,0,0,0,220,77,47,74,26,129,59,127,244,226,197,139,178,76,109,63,255,215,175,95,11,0,0,
+    0,0,0,0,0,0,0,0,119,211,139,146,70,224,206,111,213,235,38,234,179,236,175,161,141,171,171,171,2,0,0,0,0,0,0,0,0,0,192,
+    237,244,162,36,18,184,243,91,131,193,160,44,219,250,250,122,171,209,114,34,7,0,0,0,0,0,0,0,0,0,224,110,122,81,18,9,220,
+    249,173,101,159,198,153,170,163,53,171,201,100,82,0,0,0,0,0,0,0,0,0,0,184,157,94,148,68,2,119,126,171,203,131,5,0,0,
+    0,0,0,0,0,0,0,192,221,244,162,36,18,184,243,91,134,2,0,0,0,0,0,0,0,0,0,96,181,233,69,73,36,112,239,1,227,3,0,0,0,0,0,
+    0,0,0,0,176,218,244,162,172,10,129,123,15,116,121,176,38,147,73,153,149,129,6,0,0,0,0,0,0,0,0,0,250,70,47,202,170,16,
+    184,243,91,109,134,226,62,92,95,95,151,89,61,121,242,164,0,0,0,0,0,0,0,0,0,0,112,59,189,40,137,4,238,61,176,177,177,
+    81,102,213,102,40,22,173,142,166,19,57,0,0,0,0,0,0,0,0,0,0,119,211,139,178,42,4,238,61,208,213,193,186,188,188,44,109,
+    180,249,126,1,0,0,0,0,0,0,0,0,0,186,76,47,202,170,16,184,247,64,155,31,224,241,120,92,150,173,205,215,80,79,227,56,145,
+    3,0,0,0,0,0,0,0,0,0,244,141,94,148,85,33,112,239,129,167,79,159,150,89,213,19,57,55,55,55,101,153,206,207,207,203,172,
+    6,131,65,1,0,0,0,0,0,0,0,0,0,232,27,189,40,171,66,224,222,3,109,127,136,71,163,81,89,150,58,152,109,62,191,193,2,0,0,
+    0,0,0,0,0,0,0,250,72,47,202,170,16,184,247,64,189,114,162,205,53,12,203,28,172,54,167,113,170,225,112,88,0,0,0,0,0,0,
+    0,0,0,0,250,70,47,202,170,16,184,247,64,29,171,54,39,85,234,104,180,29,142,121,29,31,31,151,54,158,61,123,86,0,0,0,0,
+    0,0,0,0,0,0,250,70,47,202,170,16,184,247,68,219,171,24,218,14,199,60,222,189,123,215,92,57,49,171,250,61,214,211,71,
+    0,0,0,0,0,0,0,0,0,0,125,164,23,101,21,8,220,123,98,123,123,187,180,81,79,228,212,1,121,40,117,168,142,142,142,74,27,
+    123,123,123,5,0,0,0,0,0,0,0,0,0,160,175,244,162,172,2,129,123,79,12,135,195,230,234,137,54,14,14,14,30,228,234,137,201,
+    100,82,182,182,182,154,215,54,218,142,50,0,0,0,0,0,0,0,0,0,192,42,208,139,178,10,4,238,61,50,207,137,149,87,175,94,149,
+    241,120,92,238,203,116,172,218,92,53,81,213,239,205,117,19,0,0,0,0,0,0,0,0,0,64,223,233,69,233,58,129,123,143,204,115,
+    98,165,14,202,243,231,207,239,229,250,137,58,82,117,172,230,25,196,221,221,221,2,0,0,0,0,0,0,0,0,0,208,119,122,81,186,
+    78,224,222,35,245,218,137,250,204,163,94,63,177,191,191,223,250,228,204,207,142,143,143,155,33,156,103,172,234,105,156,
+    121,191,47,0,0,0,0,0,0,0,0,0,128,85,160,23,165,235,4,238,61,115,120,120,88,230,117,118,118,86,54,55,55,155,107,40,62,
+    126,252,88,102,85,79,247,212,161,250,231,159,127,202,209,209,81,243,223,243,88,196,247,4,0,0,0,0,0,0,0,0,0,176,42,244,
+    162,116,217,227,66,175,76,79,229,156,159,159,151,121,141,70,163,230,153,254,189,131,193,160,108,108,108,52,207,250,250,
+    250,247,63,87,79,239,212,81,170,167,110,234,231,93,212,105,158,170,142,85,253,124,0,0,0,0,0,0,0,0,0,0,252,63,189,40,
+    93,38,112,239,161,211,211,211,230,154,135,121,79,194,252,91,29,162,69,140,224,44,234,64,214,19,61,0,0,0,0,0,0,0,0,0,
+    0,252,72,47,74,87,61,42,244,78,61,193,210,245,107,26,234,247,240,225,195,135,2,0,0,0,0,0,0,0,0,0,192,175,244,162,116,
+    149,192,189,167,14,14,14,202,238,238,110,233,162,58,86,159,63,127,118,213,4,0,0,0,0,0,0,0,0,0,192,45,244,162,116,145,
+    192,189,199,78,78,78,154,107,27,186,100,122,18,199,88,1,0,0,0,0,0,0,0,0,0,220,77,47,74,215,8,220,123,108,125,125,189,
+    57,217,210,149,209,154,158,196,233,218,200,2,0,0,0,0,0,0,0,0,0,44,139,94,148,174,17,184,247,92,29,173,47,95,190,52,87,
+    80,36,27,14,135,205,215,233,36,14,0,0,0,0,0,0,0,0,0,192,108,244,162,116,137,192,157,198,219,183,111,203,233,233,105,
+    220,32,212,65,173,95,91,61,137,83,127,13,0,0,0,0,0,0,0,0,0,64,59,122,81,186,64,224,206,119,123,123,123,205,48,164,156,
+    206,169,95,199,213,213,85,252,105,33,0,0,0,0,0,0,0,0,0,128,174,208,139,146,78,224,206,15,234,137,156,122,2,166,14,69,
+    29,176,135,62,161,83,79,221,28,30,30,54,159,191,126,29,78,225,0,0,0,0,0,0,0,0,0,0,44,150,94,148,100,143,11,252,70,29,
+    170,122,5,69,53,26,141,202,199,143,31,203,249,249,121,185,190,190,46,139,86,71,105,56,28,150,237,237,237,178,179,179,
+    99,164,0,0,0,0,0,0,0,0,0,0,30,128,94,148,68,2,119,238,84,71,164,62,213,120,60,110,70,235,226,226,162,249,245,100,50,
+    105,94,255,86,29,163,58,134,131,193,160,121,158,61,123,214,140,21,0,0,0,0,0,0,0,0,0,0,203,163,23,37,133,192,157,153,
+    76,135,102,58,96,83,117,184,234,243,187,19,59,117,164,254,253,0,0,0,0,0,0,0,0,0,0,144,75,47,202,50,9,220,89,136,233,
+    24,213,211,54,0,0,0,0,0,0,0,0,0,0,172,30,189,40,15,225,81,1,0,0,0,0,0,0,0,0,0,0,128,0,2,119,0,0,0,0,0,0,0,0,0,0,0,34,
+    8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,
+    0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,
+    2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,
+    0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,
+    29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,
+    0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,
+    0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,
+    0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,
+    0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,
+    0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,
+    0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,
+    0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,
+    0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,
+    112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,
+    0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,
+    0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,
+    0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,
+    0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,
+    136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,
+    0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,
+    34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,
+    0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,176,246,237,63,10,64,7,172,173,173,21,0,0,0,0,0,0,0,0,0,102,39,23,
+    5,186,194,191,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,120,92,0,86,212,167,79,159,10,192,67,120,249,242,229,173,191,255,237,219,183,2,144,96,109,109,237,214,223,247,
+    254,9,72,225,253,21,208,21,222,95,1,93,225,253,21,208,21,222,95,1,93,225,253,21,144,226,174,247,79,0,93,229,95,112,7,
+    0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,
+    0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,
+    0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,
+    0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,
+    0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,
+    0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,
+    0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,
+    112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,
+    0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,34,8,220,249,63,246,238,38,41,138,236,107,224,240,209,96,110,237,192,114,5,85,189,2,202,161,51,92,129,184,2,113,
+    5,192,10,180,87,32,172,0,28,57,180,88,65,83,43,32,89,129,201,10,250,237,91,17,118,251,247,245,43,83,148,115,243,62,79,
+    68,6,8,36,20,3,78,228,224,119,188,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,
+    0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,
+    0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,
+    0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,
+    0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,
+    0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,
+    0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,236,4,205,234,251,62,158,62,125,26,181,90,46,151,241,234,
+    213,171,0,0,0,0,0,0,0,0,0,0,224,203,244,162,212,70,224,222,176,50,176,214,235,117,0,0,0,0,0,0,0,0,0,0,48,77,122,81,106,
+    115,63,104,86,25,88,0,0,0,0,0,0,0,0,0,0,76,151,94,148,218,8,220,27,118,115,115,19,0,0,0,0,0,0,0,0,0,0,76,151,94,148,
+    218,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,55,172,
+    239,251,0,0,0,0,0,0,0,0,0,0,96,186,244,162,212,70,224,222,176,15,31,62,4,0,0,0,0,0,0,0,0,0,0,211,165,23,165,54,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,194,78,208,172,155,155,155,24,99,62,159,71,6,15,30,60,8,0,
+    0,0,0,0,0,0,0,0,0,190,78,47,74,109,4,238,13,235,251,62,134,42,195,234,234,234,42,0,0,0,0,0,0,0,0,0,0,200,79,47,74,109,
+    238,7,12,48,155,205,2,0,0,0,0,0,0,0,0,0,128,233,210,139,114,151,4,238,12,98,96,1,0,0,0,0,0,0,0,0,0,76,155,94,148,187,
+    36,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,123,195,250,190,15,0,0,0,0,0,0,0,0,0,0,166,75,47,74,109,4,238,13,51,176,0,0,0,
+    0,0,0,0,0,0,0,166,77,47,74,109,4,238,12,50,159,207,3,0,0,0,0,0,0,0,0,0,128,233,210,139,114,151,4,238,0,0,0,0,0,0,0,0,
+    0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,123,195,186,174,139,161,102,179,89,0,0,0,0,0,0,0,0,0,0,80,7,189,40,181,
+    17,184,51,136,129,5,0,0,0,0,0,0,0,0,0,48,109,122,81,238,146,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,
+    0,0,0,164,32,112,103,16,71,78,0,0,0,0,0,0,0,0,0,0,76,155,94,148,187,36,112,111,88,215,117,49,148,129,5,0,0,0,0,0,0,0,
+    0,0,80,15,189,40,181,17,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,12,242,240,225,195,
+    0,0,0,0,0,0,0,0,0,0,96,186,244,162,220,37,129,123,195,186,174,11,0,0,0,0,0,0,0,0,0,0,166,75,47,74,109,118,2,126,82,223,
+    247,113,125,125,29,151,151,151,219,33,88,174,242,177,143,111,63,53,155,205,254,189,230,243,249,246,90,46,151,177,187,
+    187,27,0,0,0,0,0,0,0,0,0,0,228,164,23,229,119,17,184,51,88,25,66,167,167,167,219,1,181,94,175,111,109,179,103,181,90,
+    197,254,254,254,118,120,149,65,6,0,0,0,0,0,0,0,0,0,192,221,208,139,114,87,4,238,12,242,242,229,203,237,160,250,21,202,
+    240,43,87,81,6,215,199,225,5,0,0,0,0,0,0,0,0,0,192,239,163,23,229,46,221,15,24,224,87,13,171,207,157,156,156,108,55,
+    116,30,63,126,124,107,27,63,0,0,0,0,0,0,0,0,0,0,124,159,94,148,187,36,112,111,84,45,67,160,108,232,60,122,244,40,142,
+    143,143,3,0,0,0,0,0,0,0,0,0,128,31,167,23,165,70,2,119,170,112,116,116,180,29,92,182,115,0,0,0,0,0,0,0,0,0,0,166,73,
+    47,74,33,112,167,26,101,88,57,130,2,0,0,0,0,0,0,0,0,0,96,186,244,162,8,220,169,138,161,5,0,0,0,0,0,0,0,0,0,48,109,122,
+    209,182,9,220,27,213,247,125,212,202,208,2,0,0,0,0,0,0,0,0,0,248,62,189,40,53,18,184,55,234,230,230,38,106,86,134,213,
+    243,231,207,3,0,0,0,0,0,0,0,0,0,128,47,211,139,82,35,129,59,213,90,175,215,113,124,124,28,0,0,0,0,0,0,0,0,0,0,76,147,
+    94,180,61,59,1,35,205,102,179,152,207,231,177,92,46,183,239,151,235,225,195,135,255,243,53,215,215,215,219,227,45,46,
+    47,47,183,215,109,31,117,113,116,116,20,207,158,61,219,190,14,0,0,0,0,0,0,0,0,0,0,110,151,94,148,223,77,224,206,15,43,
+    3,105,181,90,109,175,221,221,221,237,160,26,170,12,173,139,139,139,120,253,250,245,246,216,136,219,80,142,158,120,255,
+    254,125,0,0,0,0,0,0,0,0,0,0,240,115,244,162,220,181,251,65,147,134,108,198,148,1,85,6,194,213,213,85,156,157,157,197,
+    139,23,47,70,13,171,162,220,87,238,47,223,235,205,155,55,183,178,73,83,142,158,40,23,0,0,0,0,0,0,0,0,0,0,255,209,139,
+    82,35,129,123,163,62,124,248,240,205,207,151,237,155,195,195,195,237,215,149,97,85,134,86,249,216,109,218,223,223,223,
+    14,174,242,115,126,214,241,241,113,0,0,0,0,0,0,0,0,0,0,240,31,189,40,53,218,9,154,84,54,99,142,142,142,190,248,185,50,
+    152,158,61,123,118,235,3,234,107,202,235,216,219,219,139,199,143,31,15,218,20,250,84,217,200,41,247,254,174,215,12,0,
+    0,0,0,0,0,0,0,0,144,157,94,148,26,9,220,27,85,6,214,216,99,35,126,133,242,90,202,230,207,207,12,173,211,211,211,237,
+    113,22,0,0,0,0,0,0,0,0,0,0,232,69,169,211,253,128,36,202,208,58,59,59,139,177,206,207,207,3,0,0,0,0,0,0,0,0,0,128,188,
+    244,162,124,143,192,157,84,86,171,85,28,28,28,196,24,31,143,157,0,0,0,0,0,0,0,0,0,0,32,47,189,40,223,34,112,39,157,195,
+    195,195,152,205,102,49,198,197,197,69,0,0,0,0,0,0,0,0,0,0,144,155,94,148,175,17,184,147,78,25,86,63,179,149,3,0,0,0,
+    0,0,0,0,0,0,64,110,122,81,190,70,224,78,74,47,94,188,24,181,149,211,117,93,0,0,0,0,0,0,0,0,0,0,144,159,94,148,47,17,
+    184,147,82,25,86,203,229,50,134,186,188,188,12,0,0,0,0,0,0,0,0,0,0,242,211,139,242,37,2,119,210,218,219,219,139,161,
+    202,70,78,223,247,1,0,0,0,0,0,0,0,0,0,64,126,122,81,62,39,112,39,173,221,221,221,24,227,230,230,38,0,0,0,0,0,0,0,0,0,
+    0,200,79,47,202,231,4,238,164,53,159,207,99,140,171,171,171,0,0,0,0,0,0,0,0,0,0,32,63,189,40,159,19,184,147,214,108,
+    54,27,53,180,108,228,0,0,0,0,0,0,0,0,0,0,212,65,47,202,231,4,238,164,86,134,214,80,125,223,7,0,0,0,0,0,0,0,0,0,0,117,
+    208,139,242,41,129,59,169,141,25,88,0,0,0,0,0,0,0,0,0,0,212,67,47,202,167,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,
+    0,0,0,0,0,0,0,0,0,32,5,129,59,169,245,125,31,67,57,166,2,0,0,0,0,0,0,0,0,0,160,30,122,81,62,37,112,39,181,49,3,235,193,
+    131,7,1,0,0,0,0,0,0,0,0,0,64,29,244,162,124,106,39,152,188,167,79,159,198,229,229,229,160,123,246,246,246,226,213,171,
+    87,113,215,186,174,11,0,0,0,0,0,0,0,0,0,0,190,77,47,202,84,8,220,27,80,182,90,134,254,225,143,217,132,185,109,67,135,
+    236,71,203,229,50,0,0,0,0,0,0,0,0,0,0,90,162,23,101,42,238,7,147,55,159,207,99,168,177,195,226,54,141,125,13,179,217,
+    44,0,0,0,0,0,0,0,0,0,0,90,162,23,101,42,4,238,124,81,134,163,30,222,190,125,27,67,217,198,1,0,0,0,0,0,0,0,0,0,248,49,
+    122,81,50,18,184,55,96,204,70,78,57,114,226,250,250,58,238,210,122,189,142,161,12,44,0,0,0,0,0,0,0,0,0,160,69,122,81,
+    166,66,224,222,128,135,15,31,198,24,231,231,231,113,87,78,78,78,182,67,115,168,213,106,21,0,0,0,0,0,0,0,0,0,0,173,209,
+    139,50,21,2,247,6,140,253,35,190,203,129,117,124,124,28,99,44,22,139,0,0,0,0,0,0,0,0,0,0,104,141,94,148,169,16,184,55,
+    160,28,57,49,155,205,98,168,114,228,195,152,99,31,126,86,217,198,233,186,46,134,42,191,167,35,39,0,0,0,0,0,0,0,0,0,128,
+    22,233,69,153,10,129,123,35,198,110,229,60,127,254,124,212,209,15,99,149,65,53,118,27,199,113,19,0,0,0,0,0,0,0,0,0,64,
+    203,244,162,76,129,192,189,17,99,255,152,127,102,128,140,81,6,228,152,109,156,226,197,139,23,1,0,0,0,0,0,0,0,0,0,208,
+    42,189,40,83,32,112,111,196,179,103,207,70,29,59,81,188,126,253,250,183,12,173,50,172,198,30,113,81,142,154,112,220,
+    4,0,0,0,0,0,0,0,0,0,208,50,189,40,83,32,112,111,68,25,86,63,115,36,195,209,209,209,47,59,126,162,124,207,199,143,31,
+    199,201,201,73,140,117,112,112,16,0,0,0,0,0,0,0,0,0,0,45,211,139,50,5,2,247,134,252,236,145,12,101,160,252,241,199,31,
+    113,122,122,26,183,165,124,207,71,143,30,141,222,196,41,230,243,249,118,227,8,0,0,0,0,0,0,0,0,0,160,117,122,81,106,39,
+    112,111,72,217,200,249,153,173,156,162,235,186,216,223,223,223,14,153,63,255,252,115,251,239,161,202,6,78,185,183,108,
+    225,220,198,150,79,217,22,2,0,0,0,0,0,0,0,0,0,64,47,74,253,238,253,253,143,160,25,101,192,148,173,154,219,60,58,162,
+    108,196,44,151,203,237,85,222,47,199,91,148,235,211,159,89,126,94,121,91,54,111,46,47,47,227,182,148,225,249,230,205,
+    155,160,13,247,238,221,27,244,245,239,222,189,11,128,223,225,201,147,39,223,252,188,199,45,32,139,239,61,79,121,126,
+    2,178,240,124,5,212,194,243,21,80,11,207,87,64,45,60,95,1,181,240,124,5,100,49,180,167,50,159,218,162,23,165,102,59,
+    65,83,202,64,57,60,60,140,151,47,95,198,109,41,131,168,92,231,231,231,241,59,125,252,93,0,0,0,0,0,0,0,0,0,0,248,143,
+    94,148,154,221,15,154,115,112,112,16,207,158,61,139,218,149,77,156,50,180,0,0,0,0,0,0,0,0,0,0,248,95,122,81,106,37,112,
+    111,212,235,215,175,183,71,68,212,170,108,226,172,86,171,0,0,0,0,0,0,0,0,0,0,224,203,244,162,212,72,224,222,168,217,
+    108,22,103,103,103,85,110,180,148,97,117,116,116,20,0,0,0,0,0,0,0,0,0,0,124,157,94,148,26,9,220,27,86,134,213,95,127,
+    253,85,213,102,203,171,87,175,12,43,0,0,0,0,0,0,0,0,0,128,31,164,23,165,54,2,247,198,149,205,156,247,239,223,111,183,
+    92,50,43,195,181,188,206,131,131,131,0,0,0,0,0,0,0,0,0,0,224,199,233,69,169,137,192,157,173,178,229,82,6,66,198,35,40,
+    246,246,246,170,219,28,2,0,0,0,0,0,0,0,0,0,200,70,47,74,13,4,238,252,171,12,132,171,171,171,120,243,230,77,138,193,85,
+    94,79,25,162,103,103,103,219,205,33,0,0,0,0,0,0,0,0,0,0,126,142,94,148,236,4,238,252,63,251,251,251,255,14,174,229,114,
+    25,191,219,199,65,85,46,91,56,0,0,0,0,0,0,0,0,0,0,183,79,47,74,86,59,1,95,81,6,87,185,46,47,47,227,244,244,52,214,235,
+    245,246,253,95,161,12,166,221,221,221,237,207,203,120,236,5,0,0,0,0,0,0,0,0,0,192,20,233,69,201,70,224,206,119,149,173,
+    156,143,155,57,125,223,111,135,214,197,197,197,246,109,215,117,219,171,124,252,71,149,129,84,190,95,121,91,134,84,25,
+    86,142,148,0,0,0,0,0,0,0,0,0,0,184,59,122,81,178,16,184,51,72,25,44,101,192,124,233,40,136,143,131,235,243,225,85,238,
+    249,244,2,0,0,0,0,0,0,0,0,0,32,47,189,40,119,73,224,206,173,113,84,4,0,0,0,0,0,0,0,0,0,192,180,233,69,249,213,238,7,
+    0,0,0,0,0,0,0,0,0,0,0,36,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,
+    0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,
+    0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,
+    0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,
+    0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,
+    0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,
+    0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,
+    0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,
+    0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,
+    0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,
+    0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,
+    0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,220,251,251,31,1,80,129,123,247,238,5,0,0,0,0,0,0,0,0,0,195,201,69,129,90,248,31,220,1,0,
+    0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,
+    144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,133,157,0,
+    152,168,191,255,254,59,0,126,135,123,247,238,125,243,243,239,222,189,11,128,12,158,60,121,242,205,207,123,126,2,178,
+    240,124,5,212,194,243,21,80,11,207,87,64,45,60,95,1,181,240,124,5,100,241,189,231,39,128,90,249,31,220,1,0,0,0,0,0,0,
+    0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,
+    29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,
+    0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,
+    0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,
+    0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,
+    7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,
+    0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,
+    0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,
+    0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,
+    0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,
+    0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,29,0,0,0,0,0,0,
+    0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,
+    0,0,144,130,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,238,0,0,0,0,0,0,0,0,0,0,0,164,32,112,7,0,0,0,0,0,0,0,0,0,0,32,5,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,82,16,184,3,0,0,0,0,0,0,0,0,0,0,144,194,78,192,29,187,184,184,136,163,163,163,33,183,196,106,181,138,195,195,195,
+    0,0,0,0,0,0,0,0,0,0,32,63,189,40,63,74,224,206,157,187,186,186,138,245,122,61,228,150,152,207,231,1,0,0,0,0,0,0,0,0,
+    0,64,29,244,162,252,168,251,1,0,0,0,0,0,0,0,0,0,0,0,9,8,220,1,0,0,0,0,0,0,0,0,0,0,72,65,224,14,0,0,0,0,0,0,0,0,0,0,64,
+    10,59,1,255,120,250,244,105,244,125,63,232,158,189,189,189,120,241,226,69,0,0,0,0,0,0,0,0,0,0,144,159,94,148,26,8,220,
+    137,174,235,226,252,252,60,134,218,223,223,15,0,0,0,0,0,0,0,0,0,0,242,211,139,82,139,251,65,243,54,155,77,140,177,88,
+    44,2,0,0,0,0,0,0,0,0,0,128,252,244,162,212,66,224,78,92,94,94,198,24,203,229,50,0,0,0,0,0,0,0,0,0,0,200,79,47,74,45,
+    4,238,196,122,189,142,161,86,171,85,0,0,0,0,0,0,0,0,0,0,80,7,189,40,181,16,184,51,106,35,199,54,14,0,0,0,0,0,0,0,0,0,
+    64,61,244,162,212,66,224,222,184,190,239,183,215,80,6,22,0,0,0,0,0,0,0,0,0,64,29,244,162,212,68,224,222,184,205,102,
+    19,99,44,22,139,0,0,0,0,0,0,0,0,0,0,32,63,189,40,53,17,184,55,110,189,94,199,24,54,114,0,0,0,0,0,0,0,0,0,0,234,160,23,
+    165,38,2,247,198,93,94,94,198,80,171,213,42,0,0,0,0,0,0,0,0,0,0,168,131,94,148,154,8,220,27,55,102,96,217,198,1,0,0,
+    0,0,0,0,0,0,0,168,135,94,148,154,8,220,27,214,247,125,116,93,23,67,205,231,243,0,0,0,0,0,0,0,0,0,0,32,63,189,40,181,
+    17,184,55,108,179,217,196,24,139,197,34,0,0,0,0,0,0,0,0,0,0,200,79,47,74,109,4,238,13,27,115,220,68,177,90,173,2,0,0,
+    0,0,0,0,0,0,0,128,252,244,162,212,70,224,222,176,245,122,29,67,45,151,203,0,0,0,0,0,0,0,0,0,0,160,14,122,81,106,35,112,
+    111,88,215,117,49,148,129,5,0,0,0,0,0,0,0,0,0,80,15,189,40,181,17,184,55,170,239,251,81,71,78,24,88,0,0,0,0,0,0,0,0,
+    0,0,117,208,139,82,35,129,123,163,54,155,77,140,177,88,44,2,0,0,0,0,0,0,0,0,0,128,252,244,162,212,72,224,222,168,49,
+    219,56,197,106,181,10,0,0,0,0,0,0,0,0,0,0,242,211,139,82,35,129,123,163,214,235,117,12,229,184,9,0,0,0,0,0,0,0,0,0,128,
+    122,232,69,169,145,192,189,81,93,215,197,80,6,22,0,0,0,0,0,0,0,0,0,64,61,244,162,212,72,224,222,160,190,239,71,29,57,
+    97,96,1,0,0,0,0,0,0,0,0,0,212,65,47,74,173,4,238,13,218,108,54,49,198,98,177,8,0,0,0,0,0,0,0,0,0,0,242,211,139,82,43,
+    129,123,131,198,108,227,20,54,114,0,0,0,0,0,0,0,0,0,0,234,160,23,165,86,2,247,6,141,61,110,98,54,155,5,0,0,0,0,0,0,0,
+    0,0,0,249,233,69,169,149,192,189,65,99,6,214,124,62,15,0,0,0,0,0,0,0,0,0,0,234,160,23,165,86,2,247,6,141,25,88,171,213,
+    42,0,0,0,0,0,0,0,0,0,0,168,131,94,148,90,9,220,27,115,113,113,17,99,44,22,139,0,0,0,0,0,0,0,0,0,0,32,63,189,40,53,19,
+    184,55,102,204,54,78,177,92,46,3,0,0,0,0,0,0,0,0,0,128,252,244,162,212,76,224,222,152,174,235,98,168,50,172,102,179,
+    89,0,0,0,0,0,0,0,0,0,0,144,159,94,148,154,9,220,27,51,102,35,103,62,159,7,0,0,0,0,0,0,0,0,0,0,117,208,139,82,51,129,
+    123,99,214,235,117,12,181,90,173,2,0,0,0,0,0,0,0,0,0,128,58,232,69,169,153,192,189,33,99,182,113,138,197,98,17,0,0,0,
+    0,0,0,0,0,0,0,228,167,23,165,118,2,247,134,140,29,88,203,229,50,0,0,0,0,0,0,0,0,0,0,200,79,47,74,237,4,238,13,217,108,
+    54,49,84,25,86,179,217,44,0,0,0,0,0,0,0,0,0,0,200,79,47,74,237,4,238,13,25,179,145,51,159,207,3,0,0,0,0,0,0,0,0,0,128,
+    58,232,69,169,157,192,189,33,99,6,214,106,181,10,0,0,0,0,0,0,0,0,0,0,234,160,23,165,118,2,247,70,148,97,213,247,125,
+    12,181,88,44,2,0,0,0,0,0,0,0,0,0,128,252,244,162,76,129,192,189,17,215,215,215,49,198,114,185,12,0,0,0,0,0,0,0,0,0,0,
+    242,211,139,50,5,2,247,70,172,215,235,24,170,12,171,217,108,22,0,0,0,0,0,0,0,0,0,0,228,167,23,101,10,4,238,141,40,71,
+    78,12,53,159,207,3,0,0,0,0,0,0,0,0,0,128,58,232,69,153,2,129,123,35,198,12,172,213,106,21,0,0,0,0,0,0,0,0,0,0,212,65,
+    47,202,20,8,220,27,80,134,85,223,247,49,212,98,177,8,0,0,0,0,0,0,0,0,0,0,242,211,139,50,21,2,247,6,92,95,95,199,24,203,
+    229,50,0,0,0,0,0,0,0,0,0,0,200,79,47,202,84,8,220,27,176,94,175,99,168,249,124,30,179,217,44,0,0,0,0,0,0,0,0,0,0,200,
+    79,47,202,84,8,220,27,80,142,156,24,202,54,14,0,0,0,0,0,0,0,0,0,64,61,244,162,76,133,192,189,1,6,22,0,0,0,0,0,0,0,0,
+    0,192,180,233,69,153,10,129,251,196,117,93,23,125,223,199,80,187,187,187,1,0,0,0,0,0,0,0,0,0,64,126,122,81,166,68,224,
+    62,113,155,205,38,198,176,145,3,0,0,0,0,0,0,0,0,0,80,7,189,40,83,34,112,159,184,49,199,77,204,231,243,152,205,102,1,
+    0,0,0,0,0,0,0,0,0,64,126,122,81,166,68,224,62,113,235,245,58,134,178,141,3,0,0,0,0,0,0,0,0,0,80,15,189,40,83,34,112,
+    159,184,49,27,57,6,22,0,0,0,0,0,0,0,0,0,64,61,244,162,76,201,78,48,89,125,223,111,175,161,186,174,139,227,227,227,248,
+    93,198,12,213,114,207,247,94,227,225,225,97,0,0,0,0,0,0,0,0,0,0,76,153,94,84,47,58,53,2,247,9,219,108,54,49,198,201,
+    201,73,100,87,6,214,247,6,157,129,5,0,0,0,0,0,0,0,0,0,76,157,94,84,47,58,53,247,131,201,90,175,215,1,0,0,0,0,0,0,0,0,
+    0,192,116,233,69,153,26,129,251,132,141,57,202,1,0,0,0,0,0,0,0,0,0,128,122,232,69,153,26,129,251,132,25,88,0,0,0,0,0,
+    0,0,0,0,0,211,166,23,101,106,4,238,19,213,247,125,116,93,23,0,0,0,0,0,0,0,0,0,0,76,147,94,148,41,18,184,79,212,102,179,
+    9,0,0,0,0,0,0,0,0,0,0,166,75,47,202,20,9,220,39,202,113,19,0,0,0,0,0,0,0,0,0,0,211,166,23,101,138,4,238,19,181,94,175,
+    3,0,0,0,0,0,0,0,0,0,128,233,210,139,50,69,2,247,137,234,186,46,0,0,0,0,0,0,0,0,0,0,152,46,189,40,83,36,112,159,160,190,
+    239,29,57,1,0,0,0,0,0,0,0,0,0,48,97,122,81,166,74,224,62,65,155,205,38,0,0,0,0,0,0,0,0,0,0,152,46,189,40,83,181,19,76,
+    206,98,177,136,171,171,171,168,197,219,183,111,227,224,224,96,208,61,123,123,123,241,234,213,171,0,0,0,0,0,0,0,0,0,0,
+    104,145,94,148,169,18,184,79,208,108,54,219,94,181,120,240,224,65,12,85,126,191,249,124,30,0,0,0,0,0,0,0,0,0,0,45,210,
+    139,50,85,247,3,0,0,0,0,0,0,0,0,0,0,0,18,16,184,3,0,0,0,0,0,0,0,0,0,0,144,130,192,157,255,99,239,14,146,154,204,22,48,
+    12,31,44,231,166,119,16,87,96,92,1,97,232,8,92,1,184,2,112,5,192,10,148,21,128,43,144,30,57,36,89,129,97,5,134,21,24,
+    87,224,189,231,239,202,189,221,182,4,18,8,249,254,228,121,170,254,10,74,11,76,250,171,12,222,195,1,0,0,0,0,0,0,0,0,0,
+    0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,
+    0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,
+    0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,
+    0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,60,47,176,98,7,7,7,205,3,0,0,0,0,0,0,0,0,0,192,122,210,139,114,95,126,131,59,0,
+    0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,
+    64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,
+    224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,
+    0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,5,0,0,0,0,0,
+    18,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,
+    0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,
+    8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,
+    0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,
+    192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,
+    0,0,0,0,32,194,214,207,255,42,0,45,176,181,181,85,0,0,0,0,0,0,0,0,0,152,159,92,20,104,11,191,193,29,0,0,0,0,0,0,0,0,
+    0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,240,188,0,172,169,47,95,190,
+    20,128,167,240,230,205,155,153,159,255,249,243,103,1,72,176,181,181,53,243,243,222,63,1,41,188,191,2,218,194,251,43,
+    160,45,188,191,2,218,194,251,43,160,45,188,191,2,82,220,245,254,9,160,173,252,6,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,
+    0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,
+    0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,
+    0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,
+    0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,
+    0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,
+    32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,
+    0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,
+    32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,
+    0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,
+    8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,
+    0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,
+    2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,
+    0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,
+    29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,
+    0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,
+    0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,
+    0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,
+    0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,
+    0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,
+    0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,
+    0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,
+    0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,
+    112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,
+    0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,194,243,2,115,186,185,185,41,163,209,168,140,
+    199,227,230,117,50,153,52,31,215,215,233,243,119,157,78,167,121,186,221,110,243,231,94,175,215,124,92,95,95,189,122,
+    213,124,14,0,0,0,0,0,0,0,0,0,128,28,122,81,86,69,224,206,157,234,64,93,94,94,150,193,96,208,60,191,14,210,93,166,35,
+    86,71,173,170,95,227,239,250,253,126,217,219,219,43,187,187,187,255,27,53,0,0,0,0,0,0,0,0,0,0,158,142,94,148,20,2,119,
+    126,171,142,212,197,197,69,243,76,135,102,89,166,67,120,116,116,212,140,215,193,193,65,217,223,223,47,0,0,0,0,0,0,0,
+    0,0,0,44,143,94,148,68,207,10,252,205,112,56,44,59,59,59,205,201,152,147,147,147,165,143,213,175,234,112,213,193,122,
+    249,242,101,249,244,233,83,1,0,0,0,0,0,0,0,0,0,224,113,233,69,73,38,112,167,81,135,170,142,68,61,17,243,235,149,16,171,
+    80,135,178,14,215,187,119,239,158,124,52,1,0,0,0,0,0,0,0,0,0,214,145,94,148,54,16,184,111,184,209,104,212,156,192,169,
+    67,149,56,12,245,202,139,250,243,213,159,19,0,0,0,0,0,0,0,0,0,128,249,233,69,105,19,129,251,6,59,61,61,45,175,95,191,
+    142,56,129,51,75,29,210,58,90,174,160,0,0,0,0,0,0,0,0,0,0,152,143,94,148,182,17,184,111,160,233,0,156,156,156,148,182,
+    152,76,38,229,232,232,200,201,28,0,0,0,0,0,0,0,0,0,128,123,208,139,210,86,2,247,13,51,189,98,34,253,20,206,239,212,209,
+    122,251,246,109,228,213,24,0,0,0,0,0,0,0,0,0,0,41,244,162,180,153,192,125,131,212,43,27,234,88,181,249,127,248,250,179,
+    191,123,247,174,0,0,0,0,0,0,0,0,0,0,240,111,122,81,218,78,224,190,33,234,88,29,28,28,52,167,90,218,174,158,38,106,227,
+    137,34,0,0,0,0,0,0,0,0,0,128,101,210,139,178,14,158,23,214,222,116,172,150,165,211,233,148,94,175,87,186,221,110,243,
+    76,213,113,172,39,104,234,83,175,186,120,76,167,167,167,165,223,239,23,0,0,0,0,0,0,0,0,0,0,244,162,172,15,129,251,154,
+    171,163,113,114,114,82,30,91,29,139,189,189,189,178,187,187,251,143,145,154,165,158,162,169,227,121,113,113,81,30,170,
+    126,173,58,130,117,40,1,0,0,0,0,0,0,0,0,0,54,153,94,148,117,242,172,176,214,234,105,153,171,171,171,123,143,202,44,245,
+    107,28,31,31,151,239,223,191,55,95,243,240,240,112,174,175,91,71,238,252,252,188,124,251,246,237,81,78,8,253,249,231,
+    159,5,0,0,0,0,0,0,0,0,0,96,211,233,69,89,39,2,247,13,80,71,229,33,163,85,255,93,61,69,83,135,166,158,238,169,35,248,
+    208,159,167,14,87,29,191,135,168,167,114,0,0,0,0,0,0,0,0,0,0,208,139,178,62,4,238,27,98,145,209,170,195,244,225,195,
+    135,102,168,246,247,247,203,99,171,227,87,135,107,81,245,202,9,0,0,0,0,0,0,0,0,0,0,254,162,23,101,29,8,220,55,200,60,
+    163,85,175,135,248,250,245,107,57,58,58,42,203,84,175,158,88,244,123,76,38,147,114,115,115,83,0,0,0,0,0,0,0,0,0,0,248,
+    139,94,148,182,19,184,111,152,251,140,86,61,133,243,144,43,42,230,85,175,158,88,244,26,139,122,90,8,0,0,0,0,0,0,0,0,
+    0,128,255,211,139,210,102,2,247,13,116,219,104,213,209,168,127,191,236,83,56,191,170,223,119,209,239,233,68,14,0,0,0,
+    0,0,0,0,0,0,192,191,233,69,105,43,129,251,134,250,117,180,234,107,189,98,162,94,53,177,10,219,219,219,5,0,0,0,0,0,0,
+    0,0,0,128,199,163,23,165,141,4,238,27,108,58,90,117,164,158,242,138,137,223,169,63,195,162,215,78,0,0,0,0,0,0,0,0,0,
+    0,240,123,122,81,218,230,121,97,163,77,71,43,65,29,172,201,100,50,247,191,1,0,0,0,0,0,0,0,0,0,224,118,122,81,218,196,
+    111,112,39,198,34,39,130,94,188,120,81,0,0,0,0,0,0,0,0,0,0,104,7,189,40,119,17,184,211,106,189,94,175,0,0,0,0,0,0,0,
+    0,0,0,176,190,244,162,155,69,224,78,140,69,174,155,112,229,4,0,0,0,0,0,0,0,0,0,64,123,232,69,185,139,192,157,24,163,
+    209,104,174,255,190,223,239,23,0,0,0,0,0,0,0,0,0,0,218,67,47,202,93,4,238,68,24,14,135,101,94,123,123,123,5,0,0,0,0,
+    0,0,0,0,0,128,118,208,139,114,31,2,119,34,92,92,92,148,121,109,111,111,23,0,0,0,0,0,0,0,0,0,0,218,65,47,202,125,8,220,
+    89,185,241,120,92,6,131,193,60,255,164,28,28,28,148,110,183,91,0,0,0,0,0,0,0,0,0,0,200,167,23,229,190,4,238,172,220,
+    167,79,159,154,209,154,199,241,241,113,1,0,0,0,0,0,0,0,0,0,160,29,244,162,220,151,192,157,149,170,67,117,114,114,50,
+    207,63,113,26,7,0,0,0,0,0,0,0,0,0,160,69,244,162,204,67,224,206,202,212,177,218,217,217,153,235,223,212,161,114,26,7,
+    0,0,0,0,0,0,0,0,0,160,29,244,162,204,75,224,206,74,76,199,106,222,171,38,234,233,29,167,113,0,0,0,0,0,0,0,0,0,0,242,
+    233,69,89,132,192,157,39,183,232,88,213,147,56,251,251,251,5,0,0,0,0,0,0,0,0,0,128,108,122,81,22,37,112,231,73,157,157,
+    157,149,215,175,95,207,61,86,71,71,71,205,105,28,0,0,0,0,0,0,0,0,0,0,178,233,69,121,136,231,5,158,192,112,56,108,6,103,
+    48,24,148,121,213,177,250,240,225,67,1,0,0,0,0,0,0,0,0,0,32,151,94,148,199,32,112,103,169,234,80,93,92,92,52,207,34,
+    234,53,19,78,226,0,0,0,0,0,0,0,0,0,0,228,210,139,242,152,4,238,44,197,67,78,224,84,157,78,167,156,159,159,151,189,189,
+    189,2,0,0,0,0,0,0,0,0,0,64,30,189,40,203,32,112,231,81,76,38,147,114,125,125,93,46,47,47,155,211,55,245,207,139,170,
+    35,85,175,152,232,118,187,5,0,0,0,0,0,0,0,0,0,128,12,122,81,158,130,192,157,133,213,83,55,163,209,168,25,169,250,250,
+    144,145,170,250,253,126,115,197,68,125,5,0,0,0,0,0,0,0,0,0,96,245,244,162,60,53,129,59,119,170,67,116,115,115,211,140,
+    82,125,234,53,18,227,241,248,193,3,53,101,168,0,0,0,0,0,0,0,0,0,0,86,75,47,74,10,129,59,183,122,255,254,253,131,175,
+    143,184,77,29,167,122,181,196,254,254,126,233,116,58,5,0,0,0,0,0,0,0,0,0,128,167,167,23,37,141,192,157,153,150,49,86,
+    221,110,183,92,93,93,21,0,0,0,0,0,0,0,0,0,0,86,79,47,74,146,103,5,110,241,234,213,171,178,12,117,4,119,118,118,202,233,
+    233,105,25,14,135,5,0,0,0,0,0,0,0,0,0,128,213,208,139,146,198,111,112,231,86,245,90,136,101,168,131,53,24,12,154,167,
+    170,87,78,212,235,39,234,179,187,187,91,0,0,0,0,0,0,0,0,0,0,120,26,122,81,210,248,13,238,220,170,94,13,81,199,100,217,
+    234,128,93,92,92,52,131,245,242,229,203,242,233,211,167,2,0,0,0,0,0,0,0,0,0,192,242,233,69,73,35,112,103,166,58,90,79,
+    105,60,30,151,131,131,3,195,5,0,0,0,0,0,0,0,0,0,240,68,244,162,36,17,184,51,211,178,174,157,184,203,116,184,118,118,
+    118,154,143,1,0,0,0,0,0,0,0,0,0,88,14,189,40,73,4,238,204,244,212,39,114,126,53,24,12,154,209,186,188,188,44,0,0,0,0,
+    0,0,0,0,0,0,60,62,189,40,73,158,23,152,97,127,127,191,188,120,241,226,31,127,247,227,199,143,50,153,76,154,143,235,105,
+    153,250,212,63,79,95,31,91,253,186,111,223,190,45,39,39,39,229,248,248,184,0,0,0,0,0,0,0,0,0,0,240,120,244,162,36,17,
+    184,51,83,167,211,105,174,126,184,175,209,104,212,12,204,245,245,117,115,154,166,62,143,165,14,86,101,180,0,0,0,0,0,
+    0,0,0,0,0,30,143,94,148,36,207,10,60,162,94,175,87,246,246,246,154,81,185,186,186,42,223,191,127,47,159,63,127,158,107,
+    244,102,169,163,117,118,118,86,0,0,0,0,0,0,0,0,0,0,88,13,189,40,203,36,112,103,169,234,137,158,58,96,231,231,231,229,
+    219,183,111,205,144,117,187,221,242,16,117,180,234,201,31,0,0,0,0,0,0,0,0,0,0,86,79,47,202,99,18,184,243,100,234,80,
+    213,177,169,39,117,30,114,66,103,50,153,148,183,111,223,22,0,0,0,0,0,0,0,0,0,0,178,232,69,121,40,129,59,79,174,14,87,
+    61,161,83,135,107,209,211,57,227,241,184,156,158,158,22,0,0,0,0,0,0,0,0,0,0,242,232,69,89,148,192,157,149,233,247,251,
+    15,26,173,143,31,63,54,167,115,0,0,0,0,0,0,0,0,0,0,200,164,23,101,94,2,119,86,170,142,213,162,163,85,199,234,236,236,
+    172,0,0,0,0,0,0,0,0,0,0,144,75,47,202,60,4,238,172,92,29,171,207,159,63,151,69,92,94,94,22,0,0,0,0,0,0,0,0,0,0,178,233,
+    69,185,47,129,59,17,122,189,94,57,57,57,41,243,26,141,70,205,3,0,0,0,0,0,0,0,0,0,64,54,189,40,247,33,112,39,198,225,
+    225,97,233,116,58,101,94,195,225,176,0,0,0,0,0,0,0,0,0,0,144,79,47,202,93,4,238,196,168,99,117,112,112,80,230,53,24,
+    12,10,0,0,0,0,0,0,0,0,0,0,249,244,162,220,69,224,78,148,126,191,95,230,229,202,9,0,0,0,0,0,0,0,0,0,128,246,208,139,50,
+    139,192,157,40,219,219,219,101,94,227,241,184,0,0,0,0,0,0,0,0,0,0,208,14,122,81,102,17,184,19,165,94,59,81,159,121,221,
+    220,220,20,0,0,0,0,0,0,0,0,0,0,242,233,69,153,69,224,78,156,69,6,235,251,247,239,5,0,0,0,0,0,0,0,0,0,128,118,208,139,
+    114,27,129,59,107,97,50,153,20,0,0,0,0,0,0,0,0,0,0,214,151,94,116,51,8,220,137,99,124,0,0,0,0,0,0,0,0,0,0,214,155,94,
+    148,219,8,220,137,82,199,202,96,1,0,0,0,0,0,0,0,0,0,172,47,189,40,179,8,220,137,114,125,125,93,22,209,233,116,10,0,0,
+    0,0,0,0,0,0,0,0,249,244,162,204,34,112,39,202,229,229,101,89,68,183,219,45,0,0,0,0,0,0,0,0,0,0,228,211,139,50,139,192,
+    157,40,139,12,86,61,141,227,68,14,0,0,0,0,0,0,0,0,0,64,59,232,69,153,69,224,78,140,139,139,139,50,30,143,203,188,122,
+    189,94,1,0,0,0,0,0,0,0,0,0,32,159,94,148,187,8,220,137,80,135,234,244,244,180,44,194,96,1,0,0,0,0,0,0,0,0,0,228,211,
+    139,114,31,2,119,34,188,127,255,126,161,211,56,85,191,223,47,0,0,0,0,0,0,0,0,0,0,100,211,139,114,31,2,119,86,174,142,
+    213,229,229,101,89,68,167,211,41,187,187,187,5,0,0,0,0,0,0,0,0,0,128,92,122,81,238,235,121,129,21,153,76,38,229,221,
+    187,119,11,143,85,181,183,183,87,0,0,0,0,0,0,0,0,0,0,200,164,23,101,94,126,131,251,6,169,3,81,79,191,12,135,195,178,
+    106,245,103,120,253,250,245,131,198,170,58,60,60,44,0,0,0,0,0,0,0,0,0,0,252,69,47,74,219,9,220,55,200,245,245,117,249,
+    248,241,99,233,247,251,229,143,63,254,40,59,59,59,229,236,236,172,249,251,167,82,135,170,126,223,250,51,140,199,227,
+    242,16,245,107,244,122,189,2,0,0,0,0,0,0,0,0,0,192,95,244,162,180,221,243,194,198,168,39,114,254,254,241,96,48,104,158,
+    170,211,233,52,3,48,29,129,237,237,237,242,24,234,247,169,131,88,79,222,92,92,92,252,227,103,120,168,243,243,243,2,0,
+    0,0,0,0,0,0,0,0,192,255,233,69,105,59,129,251,6,25,141,70,183,126,174,14,73,29,149,191,95,1,81,135,171,14,217,244,117,
+    250,116,187,221,223,126,141,233,9,155,250,125,166,131,248,208,83,55,183,57,62,62,190,245,231,0,0,0,0,0,0,0,0,0,0,216,
+    84,122,81,218,78,224,190,65,230,29,143,233,192,77,79,237,164,168,67,117,114,114,82,0,0,0,0,0,0,0,0,0,0,248,39,189,40,
+    109,247,172,176,49,150,117,58,230,41,213,177,186,186,186,42,0,0,0,0,0,0,0,0,0,0,252,155,94,148,182,19,184,111,144,182,
+    15,214,116,172,92,53,1,0,0,0,0,0,0,0,0,0,240,123,122,81,218,78,224,190,65,218,60,88,198,10,0,0,0,0,0,0,0,0,0,224,110,
+    122,81,218,78,224,190,33,70,163,81,105,171,126,191,95,190,126,253,106,172,0,0,0,0,0,0,0,0,0,0,102,208,139,178,14,4,238,
+    27,226,199,143,31,165,109,58,157,78,249,240,225,67,115,18,167,126,12,0,0,0,0,0,0,0,0,0,192,237,244,162,172,131,231,133,
+    141,240,237,219,183,210,38,245,20,206,249,249,185,83,56,0,0,0,0,0,0,0,0,0,0,247,164,23,101,29,248,13,238,27,226,230,
+    230,166,180,65,29,170,122,2,167,62,198,10,0,0,0,0,0,0,0,0,0,224,254,244,162,172,3,191,193,125,67,236,238,238,150,241,
+    120,92,6,131,65,243,154,164,94,39,113,120,120,88,14,14,14,140,20,0,0,0,0,0,0,0,0,0,192,130,244,162,172,3,129,251,134,
+    232,245,122,205,21,14,85,29,172,209,104,84,134,195,97,243,90,159,201,100,82,158,82,61,121,179,189,189,221,188,214,7,
+    0,0,0,0,0,0,0,0,0,128,135,209,139,178,14,4,238,27,168,158,122,169,207,222,222,222,255,254,110,58,90,215,215,215,205,
+    160,213,167,254,121,250,241,34,234,73,155,250,212,177,156,126,207,58,82,245,181,254,61,0,0,0,0,0,0,0,0,0,0,203,161,23,
+    165,173,4,238,52,234,168,84,179,78,199,76,135,107,214,128,77,175,140,152,142,21,0,0,0,0,0,0,0,0,0,0,25,244,162,180,129,
+    192,157,123,155,142,209,244,21,0,0,0,0,0,0,0,0,0,128,245,162,23,101,213,158,21,0,0,0,0,0,0,0,0,0,0,0,8,32,112,7,0,0,
+    0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,
+    32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,
+    0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,
+    8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,
+    0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,
+    2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,
+    0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,
+    29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,
+    0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,
+    0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,
+    0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,
+    0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,
+    0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,
+    0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,
+    0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,
+    0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,
+    112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,
+    0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,
+    0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,
+    0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,
+    0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,
+    136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,91,63,255,171,0,180,192,214,214,86,1,0,0,0,
+    0,0,0,0,0,96,126,114,81,160,45,252,6,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,
+    0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,
+    112,7,0,0,0,0,0,0,0,0,0,0,32,194,243,2,176,166,126,254,252,89,0,158,194,214,214,214,204,207,127,249,242,165,0,36,120,
+    243,230,205,204,207,123,255,4,164,240,254,10,104,11,239,175,128,182,240,254,10,104,11,239,175,128,182,240,254,10,72,
+    113,215,251,39,128,182,242,27,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,
+    0,0,0,128,8,2,119,254,195,222,29,28,181,117,61,108,28,62,246,120,31,149,32,87,96,185,2,139,101,86,224,10,12,21,68,174,
+    64,162,2,160,2,160,2,240,42,75,160,2,228,10,44,42,136,58,240,247,29,229,143,39,118,98,131,174,4,122,239,213,243,204,
+    220,193,14,99,80,54,239,104,241,59,58,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,
+    0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,
+    0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,
+    0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,
+    0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,
+    4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,
+    0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,
+    0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,
+    0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,
+    0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,132,
+    87,5,150,112,119,119,87,174,175,175,203,116,58,45,179,217,108,241,204,231,243,111,207,63,245,251,253,111,95,123,189,
+    94,25,12,6,139,167,254,253,205,155,55,5,0,0,0,0,0,0,0,0,0,128,60,122,81,54,73,224,206,47,213,17,58,63,63,95,140,84,125,
+    126,28,165,95,169,99,246,207,175,151,151,151,223,190,87,7,108,56,28,150,189,189,189,242,238,221,187,111,227,6,0,0,0,
+    0,0,0,0,0,0,192,243,210,139,146,68,224,206,191,220,143,84,29,152,58,82,79,245,59,234,207,191,31,177,58,94,163,209,168,
+    236,238,238,22,0,0,0,0,0,0,0,0,0,0,158,150,94,148,84,47,11,252,79,29,145,195,195,195,242,250,245,235,197,120,60,213,
+    88,253,151,250,187,234,233,156,250,187,235,88,2,0,0,0,0,0,0,0,0,0,176,126,122,81,210,9,220,249,110,168,38,147,201,82,
+    215,74,172,91,189,158,98,127,127,191,28,28,28,124,187,170,2,0,0,0,0,0,0,0,0,0,128,213,232,69,105,11,129,251,150,59,57,
+    57,137,24,170,31,157,157,157,149,157,157,157,50,157,78,11,0,0,0,0,0,0,0,0,0,0,205,233,69,105,19,129,251,150,170,167,
+    93,222,190,125,187,184,90,34,105,168,254,233,254,53,186,130,2,0,0,0,0,0,0,0,0,0,96,121,122,81,218,72,224,190,133,234,
+    41,156,58,4,109,57,237,82,175,160,48,90,0,0,0,0,0,0,0,0,0,0,143,167,23,165,173,4,238,91,230,227,199,143,209,167,112,
+    126,166,190,102,215,79,0,0,0,0,0,0,0,0,0,0,60,76,47,74,155,9,220,183,68,29,168,247,239,223,151,227,227,227,210,70,247,
+    175,191,109,67,11,0,0,0,0,0,0,0,0,0,240,92,244,162,116,129,192,125,75,236,236,236,148,203,203,203,210,102,179,217,172,
+    28,30,30,22,0,0,0,0,0,0,0,0,0,0,254,77,47,74,23,188,42,116,222,193,193,193,147,93,215,208,239,247,203,96,48,40,189,94,
+    111,241,231,123,117,92,234,233,153,250,117,157,191,187,158,40,218,221,221,45,195,225,176,0,0,0,0,0,0,0,0,0,0,240,55,
+    189,40,93,33,112,239,184,122,130,229,236,236,172,172,83,29,139,189,189,189,197,112,252,115,164,126,166,14,215,245,245,
+    117,249,244,233,211,90,94,75,253,127,50,88,0,0,0,0,0,0,0,0,0,0,127,211,139,210,37,47,11,157,85,79,195,76,38,147,178,
+    14,245,196,205,120,60,46,127,253,245,87,185,186,186,42,127,252,241,199,163,198,234,254,223,214,129,59,61,61,45,95,190,
+    124,41,251,251,251,101,21,117,252,234,3,0,0,0,0,0,0,0,0,0,176,237,244,162,116,141,192,189,195,234,160,212,145,89,197,
+    253,80,213,161,169,227,87,255,190,234,107,170,195,85,159,85,126,86,61,221,3,0,0,0,0,0,0,0,0,0,176,237,244,162,116,141,
+    192,189,227,234,200,52,29,173,122,173,195,237,237,237,90,134,234,71,245,84,78,61,217,211,244,231,174,251,26,13,0,0,0,
+    0,0,0,0,0,0,128,182,210,139,210,37,2,247,45,176,236,104,213,17,57,58,58,90,12,202,99,175,149,104,98,48,24,52,30,211,
+    249,124,238,218,9,0,0,0,0,0,0,0,0,0,128,255,209,139,210,21,2,247,45,241,216,209,170,3,85,79,225,140,70,163,242,28,234,
+    239,169,39,127,154,248,252,249,115,1,0,0,0,0,0,0,0,0,0,224,111,122,81,186,64,224,190,69,30,26,173,122,66,166,142,213,
+    83,158,194,249,47,77,79,229,56,145,3,0,0,0,0,0,0,0,0,0,240,61,189,40,109,39,112,223,50,63,27,173,58,86,245,138,137,122,
+    221,196,115,171,39,114,154,156,202,49,88,0,0,0,0,0,0,0,0,0,0,255,166,23,165,205,4,238,91,232,199,209,218,228,88,221,
+    219,219,219,43,203,154,207,231,139,7,0,0,0,0,0,0,0,0,0,128,239,233,69,105,43,129,251,150,186,31,173,122,189,196,166,
+    199,170,218,221,221,45,77,204,102,179,2,0,0,0,0,0,0,0,0,0,192,191,233,69,105,35,129,251,22,171,163,117,123,123,187,241,
+    177,170,234,112,54,121,29,119,119,119,5,0,0,0,0,0,0,0,0,0,128,255,166,23,165,109,4,238,91,46,97,172,238,213,209,90,150,
+    43,39,0,0,0,0,0,0,0,0,0,0,126,77,47,74,155,8,220,137,97,176,0,0,0,0,0,0,0,0,0,0,186,77,47,202,67,4,238,196,104,114,58,
+    200,96,1,0,0,0,0,0,0,0,0,0,180,135,94,148,135,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,
+    157,24,174,143,0,0,0,0,0,0,0,0,0,0,232,54,189,40,15,17,184,19,163,201,96,245,251,253,2,0,0,0,0,0,0,0,0,0,64,59,232,69,
+    121,136,192,157,24,77,6,171,215,235,21,0,0,0,0,0,0,0,0,0,0,218,65,47,202,67,4,238,196,152,78,167,101,89,191,253,246,
+    91,1,0,0,0,0,0,0,0,0,0,160,29,244,162,60,68,224,78,132,38,99,85,13,6,131,2,0,0,0,0,0,0,0,0,0,64,62,189,40,143,33,112,
+    39,194,221,221,93,89,86,189,110,194,149,19,0,0,0,0,0,0,0,0,0,0,237,160,23,229,49,4,238,68,184,190,190,46,203,114,26,
+    7,0,0,0,0,0,0,0,0,0,160,61,244,162,60,134,192,157,8,77,174,156,48,88,0,0,0,0,0,0,0,0,0,0,237,161,23,229,49,4,238,108,
+    220,108,54,107,116,34,103,56,28,22,0,0,0,0,0,0,0,0,0,0,242,233,69,121,44,129,59,27,215,100,172,170,55,111,222,20,0,0,
+    0,0,0,0,0,0,0,0,242,233,69,121,44,129,59,27,119,126,126,94,150,85,175,155,232,247,251,5,0,0,0,0,0,0,0,0,0,128,124,122,
+    81,30,75,224,206,70,53,189,110,98,127,127,191,0,0,0,0,0,0,0,0,0,0,144,79,47,202,50,4,238,108,212,225,225,97,105,98,119,
+    119,183,0,0,0,0,0,0,0,0,0,0,144,79,47,202,50,4,238,108,76,211,211,56,174,155,0,0,0,0,0,0,0,0,0,0,104,7,189,40,203,18,
+    184,179,49,117,172,234,104,45,107,52,26,21,0,0,0,0,0,0,0,0,0,0,242,233,69,89,150,192,157,141,168,67,213,228,186,137,
+    122,18,199,117,19,0,0,0,0,0,0,0,0,0,0,249,244,162,52,33,112,103,35,206,207,207,27,157,198,25,14,135,165,215,235,21,0,
+    0,0,0,0,0,0,0,0,0,178,233,69,105,66,224,206,179,171,67,53,153,76,74,19,227,241,184,0,0,0,0,0,0,0,0,0,0,144,77,47,74,
+    83,2,119,158,93,147,171,38,170,253,253,253,197,149,19,0,0,0,0,0,0,0,0,0,0,100,211,139,210,148,192,157,103,117,118,118,
+    182,120,154,112,26,7,0,0,0,0,0,0,0,0,0,32,159,94,148,85,8,220,121,54,245,170,137,166,167,113,234,88,57,141,3,0,0,0,0,
+    0,0,0,0,0,144,77,47,202,170,4,238,60,155,131,131,131,197,104,45,171,14,213,100,50,41,0,0,0,0,0,0,0,0,0,0,100,211,139,
+    178,42,129,59,207,162,158,196,185,190,190,46,77,24,43,0,0,0,0,0,0,0,0,0,128,124,122,81,214,65,224,206,147,187,188,188,
+    108,60,58,251,251,251,229,195,135,15,5,0,0,0,0,0,0,0,0,0,128,92,122,81,214,69,224,206,147,170,87,76,212,171,38,154,168,
+    87,77,140,199,227,2,0,0,0,0,0,0,0,0,0,64,46,189,40,235,36,112,231,201,212,177,218,217,217,41,243,249,188,52,113,116,
+    116,180,24,45,0,0,0,0,0,0,0,0,0,0,50,233,69,89,55,129,59,79,162,142,84,29,171,58,90,77,212,147,56,123,123,123,5,0,0,
+    0,0,0,0,0,0,0,128,76,122,81,158,130,192,157,181,91,117,172,6,131,65,153,76,38,5,0,0,0,0,0,0,0,0,0,128,76,122,81,158,
+    138,192,157,181,186,31,171,233,116,90,154,168,87,76,92,92,92,20,0,0,0,0,0,0,0,0,0,0,50,233,69,121,74,2,119,214,102,213,
+    177,234,245,122,229,234,234,106,49,90,0,0,0,0,0,0,0,0,0,0,228,209,139,242,212,4,238,172,197,170,99,85,157,158,158,26,
+    43,0,0,0,0,0,0,0,0,0,128,80,122,81,158,131,192,157,149,205,102,179,242,246,237,219,149,198,234,232,232,168,236,237,237,
+    21,0,0,0,0,0,0,0,0,0,0,242,232,69,121,46,2,119,86,82,199,170,158,196,169,95,155,26,143,199,101,52,26,21,0,0,0,0,0,0,
+    0,0,0,0,242,232,69,121,78,2,119,26,187,188,188,92,156,196,89,117,172,38,147,73,1,0,0,0,0,0,0,0,0,0,32,143,94,148,231,
+    38,112,167,145,195,195,195,242,254,253,251,50,159,207,75,83,198,10,0,0,0,0,0,0,0,0,0,32,151,94,148,77,120,85,96,9,117,
+    160,62,126,252,88,206,206,206,202,42,140,21,0,0,0,0,0,0,0,0,0,64,38,189,40,155,36,112,231,209,234,213,18,59,59,59,43,
+    93,49,81,157,158,158,150,253,253,253,2,0,0,0,0,0,0,0,0,0,64,22,189,40,155,246,178,192,35,156,156,156,148,183,111,223,
+    174,52,86,189,94,175,92,92,92,24,43,0,0,0,0,0,0,0,0,0,128,64,122,81,18,248,4,119,126,105,93,87,76,244,251,253,197,88,
+    13,6,131,2,0,0,0,0,0,0,0,0,0,64,14,189,40,73,4,238,252,212,205,205,205,226,244,204,170,87,76,212,145,170,99,85,71,11,
+    0,0,0,0,0,0,0,0,0,128,28,122,81,210,188,44,240,131,251,83,56,195,225,112,229,177,250,240,225,67,185,186,186,50,86,0,
+    0,0,0,0,0,0,0,0,0,65,244,162,164,242,9,238,124,103,93,167,112,170,163,163,163,50,26,141,10,0,0,0,0,0,0,0,0,0,0,57,244,
+    162,36,243,9,238,44,172,243,20,78,61,125,83,79,225,24,43,0,0,0,0,0,0,0,0,0,128,28,122,81,218,192,39,184,83,46,47,47,
+    23,99,181,142,83,56,117,240,78,79,79,93,49,1,0,0,0,0,0,0,0,0,0,16,68,47,74,91,8,220,183,88,29,168,131,131,131,114,125,
+    125,93,214,193,21,19,0,0,0,0,0,0,0,0,0,0,89,244,162,180,141,192,125,11,213,235,37,78,78,78,202,241,241,241,226,207,171,
+    170,167,111,46,46,46,202,96,48,40,0,0,0,0,0,0,0,0,0,0,108,158,94,148,182,18,184,111,153,179,179,179,197,245,18,235,24,
+    170,170,158,192,25,143,199,165,215,235,21,0,0,0,0,0,0,0,0,0,0,54,79,47,74,155,9,220,183,196,116,58,93,12,213,186,174,
+    151,168,167,112,78,79,79,203,112,56,44,0,0,0,0,0,0,0,0,0,0,108,158,94,148,46,16,184,111,137,79,159,62,173,109,172,170,
+    219,219,91,167,112,0,0,0,0,0,0,0,0,0,0,130,232,69,233,130,151,5,26,48,86,0,0,0,0,0,0,0,0,0,0,221,166,23,101,19,124,130,
+    59,141,188,126,253,186,36,186,184,184,40,131,193,160,0,0,0,0,0,0,0,0,0,0,176,26,189,40,155,32,112,167,145,217,108,86,
+    18,205,231,243,2,0,0,0,0,0,0,0,0,0,192,234,244,162,108,194,203,2,0,0,0,0,0,0,0,0,0,0,0,1,4,238,0,0,0,0,0,0,0,0,0,0,0,
+    68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,
+    0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,
+    4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,111,137,241,120,92,190,126,253,218,249,103,56,28,22,0,0,0,0,0,0,0,0,0,128,109,
+    164,23,165,11,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,
+    17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,
+    0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,
+    59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,
+    0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,
+    65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,
+    0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,
+    3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,
+    0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,
+    0,0,0,0,0,0,0,0,0,68,120,241,245,255,21,128,22,120,241,226,69,1,0,0,0,0,0,0,0,0,96,121,114,81,160,45,124,130,59,0,0,
+    0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,
+    4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,16,225,85,1,232,168,63,
+    255,252,179,0,60,135,223,127,255,253,151,223,255,250,245,107,1,72,240,226,197,139,95,126,223,251,39,32,133,247,87,64,
+    91,120,127,5,180,133,247,87,64,91,120,127,5,180,133,247,87,64,138,135,222,63,1,180,149,79,112,7,0,0,0,0,0,0,0,0,0,0,
+    32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,
+    0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,
+    32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,
+    0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,
+    8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,
+    0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,
+    2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,
+    0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,
+    29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,
+    0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,
+    0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,
+    0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,
+    0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,
+    0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,
+    0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,
+    0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,
+    130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,
+    0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,
+    112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,
+    0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,
+    1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,
+    0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,
+    0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,
+    0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,
+    0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,
+    0,0,0,0,0,0,0,0,0,32,130,192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,0,0,0,0,0,0,0,0,0,0,0,34,8,220,1,0,0,0,0,0,0,0,0,0,0,
+    136,240,170,192,10,110,110,110,202,229,229,101,153,78,167,75,253,187,94,175,87,46,46,46,10,0,0,0,0,0,0,0,0,0,0,217,244,
+    162,60,39,129,59,75,171,35,117,125,125,93,142,143,143,203,124,62,47,77,244,251,253,2,0,0,0,0,0,0,0,0,0,64,38,189,40,
+    155,34,112,231,81,234,48,157,156,156,44,134,170,62,0,0,0,0,0,0,0,0,0,0,116,139,94,148,4,2,119,126,170,142,212,249,249,
+    249,226,74,9,35,5,0,0,0,0,0,0,0,0,0,208,61,122,81,210,8,220,249,78,29,169,207,159,63,151,201,100,82,166,211,105,227,
+    43,37,0,0,0,0,0,0,0,0,0,0,200,164,23,37,153,192,157,133,155,155,155,197,201,155,179,179,51,35,5,0,0,0,0,0,0,0,0,0,208,
+    65,122,81,218,64,224,190,197,234,72,213,171,36,142,143,143,141,20,0,0,0,0,0,0,0,0,0,64,7,233,69,105,27,129,251,22,58,
+    60,60,92,12,85,125,0,0,0,0,0,0,0,0,0,0,232,30,189,40,109,37,112,223,50,179,217,172,76,38,147,2,0,0,0,0,0,0,0,0,0,64,
+    55,233,69,105,179,151,5,0,0,0,0,0,0,0,0,0,0,0,2,8,220,1,0,0,0,0,0,0,0,0,0,0,136,32,112,7,0,0,0,0,0,0,0,0,0,0,32,130,
+    192,29,0,0,0,0,0,0,0,0,0,0,128,8,2,119,26,235,245,122,101,52,26,149,211,211,211,2,0,0,0,0,0,0,0,0,0,64,247,232,69,121,
+    110,175,10,44,161,142,212,222,222,94,249,240,225,67,25,14,135,139,255,54,155,205,10,0,0,0,0,0,0,0,0,0,0,221,160,23,101,
+    147,4,238,60,168,142,212,96,48,40,227,241,120,241,181,254,29,0,0,0,0,0,0,0,0,0,128,238,208,139,146,66,224,206,79,213,
+    19,55,245,228,77,61,129,99,164,0,0,0,0,0,0,0,0,0,0,186,71,47,74,26,129,59,223,169,35,117,127,165,132,145,2,0,0,0,0,0,
+    0,0,0,0,232,30,189,40,201,4,238,24,41,0,0,0,0,0,0,0,0,0,128,142,211,139,210,22,2,247,45,85,71,234,221,187,119,101,52,
+    26,25,41,0,0,0,0,0,0,0,0,0,128,14,210,139,210,70,2,247,45,83,199,233,203,151,47,165,223,239,23,0,0,0,0,0,0,0,0,0,0,186,
+    71,47,74,155,9,220,183,76,29,44,39,112,0,0,0,0,0,0,0,0,0,0,186,75,47,74,155,189,44,0,0,0,0,0,0,0,0,0,0,0,16,64,224,14,
+    0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,0,0,0,0,0,0,0,
+    16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,184,3,0,0,0,
+    0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,59,0,0,0,0,0,0,0,0,0,0,0,17,4,238,0,0,0,0,0,0,0,0,0,0,0,68,16,
+    184,3,0,0,0,0,0,0,0,0,0,0,16,65,224,14,0,0,0,0,0,0,0,0,0,0,64,4,129,251,255,177,119,183,87,77,124,209,30,128,143,46,
+    191,139,21,128,21,128,21,128,21,128,21,128,21,136,21,168,21,40,21,8,21,8,21,8,21,8,21,40,21,136,21,120,255,59,247,142,
+    23,49,188,204,201,100,102,79,242,60,107,101,5,5,146,248,193,189,206,203,239,236,3,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,
+    0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,
+    0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,79,10,75,227,228,228,164,236,239,239,151,12,126,
+    252,248,81,158,63,127,94,186,178,181,181,85,62,127,254,92,0,0,0,0,0,0,0,0,0,0,150,153,188,40,99,39,224,190,68,126,254,
+    252,57,41,20,89,116,249,89,50,253,187,0,0,0,0,0,0,0,0,0,0,134,34,47,202,216,61,46,0,0,0,0,0,0,0,0,0,0,0,144,128,128,
+    59,0,0,0,0,0,0,0,0,0,0,0,41,8,184,3,0,0,0,0,0,0,0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,41,8,184,3,0,0,0,0,0,0,
+    0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,41,8,184,3,0,0,0,0,0,0,0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,41,
+    8,184,3,0,0,0,0,0,0,0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,41,60,41,44,141,189,189,189,201,3,0,0,0,0,0,0,0,0,0,
+    128,197,36,47,202,216,233,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,
+    0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,
+    0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,
+    0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,
+    0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,
+    0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,
+    14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,
+    0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,
+    164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,143,126,255,167,0,140,192,163,71,143,10,0,0,0,0,0,0,0,0,0,237,137,139,2,99,161,
+    131,59,0,0,0,0,0,0,0,0,0,0,0,41,8,184,3,0,0,0,0,0,0,0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,41,8,184,3,0,0,0,0,
+    0,0,0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,41,8,184,3,0,0,0,0,0,0,0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,
+    41,8,184,3,0,0,0,0,0,0,0,0,0,0,144,130,128,59,0,0,0,0,0,0,0,0,0,0,0,41,8,184,3,0,0,0,0,0,0,0,0,0,0,144,130,128,59,0,
+    0,0,0,0,0,0,0,0,0,0,41,60,41,0,35,241,251,247,239,2,0,0,0,0,0,0,0,0,0,192,226,210,193,29,0,0,0,0,0,0,0,0,0,0,128,20,
+    4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,
+    0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,
+    65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,
+    0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,
+    0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,
+    220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,
+    0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,
+    65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,
+    0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,
+    0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,
+    220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,
+    0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,
+    65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,
+    0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,
+    0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,
+    220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,
+    0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,
+    65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,
+    0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,
+    128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,
+    0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,
+    0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,220,1,0,0,0,0,0,0,0,0,0,0,72,65,192,29,0,0,0,0,0,0,0,0,0,0,128,20,4,
+    220,1,0,0,0,0,0,0,0,0,0,0,72,225,73,1,0,0,0,0,0,0,128,57,187,188,188,44,167,167,167,229,199,143,31,127,61,66,243,124,
+    221,202,202,202,228,17,214,214,214,38,95,55,207,27,27,27,147,231,245,245,245,63,63,3,0,0,0,44,134,71,191,255,83,0,0,
+    128,214,94,191,126,61,117,227,237,46,251,251,251,101,123,123,187,0,0,48,62,111,223,190,45,231,231,231,173,126,103,111,
+    111,175,236,238,238,22,0,128,101,116,117,117,85,142,142,142,202,241,241,241,100,28,21,127,158,135,8,189,127,249,242,
+    101,18,122,7,0,152,151,24,215,28,30,30,182,249,149,201,248,228,227,199,143,5,0,104,71,7,119,0,0,168,212,116,155,106,
+    35,2,78,0,0,140,83,132,178,98,12,216,198,214,214,86,1,0,88,54,39,39,39,229,211,167,79,173,199,78,181,98,141,238,217,
+    179,103,5,0,96,158,98,204,209,215,248,6,0,150,157,128,59,0,0,0,0,0,0,0,51,59,56,56,40,239,223,191,159,91,167,246,187,
+    172,174,174,22,0,0,0,96,49,8,184,3,0,0,0,0,0,0,80,237,236,236,108,114,115,97,219,219,14,187,178,177,177,81,0,0,0,128,
+    197,241,184,0,0,0,0,0,0,0,64,133,183,111,223,150,173,173,173,193,194,237,97,101,101,165,0,0,0,0,139,67,7,119,0,0,0,0,
+    0,0,0,90,137,64,251,171,87,175,202,249,249,121,25,218,218,218,90,1,0,0,0,22,135,128,59,0,0,0,0,0,0,0,15,22,225,246,151,
+    47,95,14,218,181,253,58,1,119,0,0,0,88,44,143,11,0,0,0,0,0,0,0,60,64,182,112,123,16,112,7,0,0,128,197,34,224,14,0,0,
+    0,0,0,0,192,131,188,122,245,42,85,184,61,172,174,174,22,0,0,0,96,113,8,184,3,0,0,0,0,0,0,112,175,183,111,223,150,243,
+    243,243,146,205,202,202,74,1,0,0,0,22,199,147,2,0,0,0,0,0,0,0,119,56,60,60,44,159,62,125,42,243,178,182,182,246,207,
+    223,93,93,93,77,30,247,217,216,216,40,0,0,0,192,226,16,112,7,0,0,0,0,0,0,224,78,31,62,124,40,93,137,64,250,214,214,86,
+    217,220,220,156,124,61,45,220,126,211,143,31,63,254,4,222,227,235,203,203,203,63,95,3,0,0,0,139,69,192,29,0,0,0,0,0,
+    0,128,91,69,184,189,139,32,249,222,222,94,217,221,221,157,132,219,219,122,72,8,30,0,0,0,88,12,2,238,0,0,0,0,0,0,0,76,
+    21,193,246,195,195,195,50,139,232,210,254,249,243,231,201,51,0,0,0,192,125,30,23,0,0,0,0,0,0,0,152,226,248,248,120,166,
+    238,237,251,251,251,229,219,183,111,194,237,0,0,0,192,131,9,184,3,0,0,0,0,0,0,48,213,193,193,65,169,245,238,221,187,
+    242,241,227,199,2,0,0,0,208,134,128,59,0,0,0,0,0,0,0,255,56,57,57,169,238,222,190,179,179,83,222,191,127,95,0,0,0,0,
+    218,18,112,7,0,0,0,0,0,0,224,31,199,199,199,165,198,218,218,154,206,237,0,0,0,64,53,1,119,0,0,0,0,0,0,0,254,81,27,112,
+    143,206,237,17,114,7,0,0,0,168,33,224,14,0,0,0,0,0,0,192,95,206,206,206,202,213,213,85,105,43,130,237,187,187,187,5,
+    0,0,0,160,150,128,59,0,0,0,0,0,0,0,127,57,61,61,45,53,162,123,59,0,0,0,192,44,4,220,1,0,0,0,0,0,0,248,75,109,192,125,
+    123,123,187,0,0,0,0,204,66,192,29,0,0,0,0,0,0,128,191,156,159,159,151,182,118,118,118,202,202,202,74,1,0,0,0,152,133,
+    128,59,0,0,0,0,0,0,0,127,92,93,93,77,30,109,69,192,29,0,0,0,96,86,2,238,0,0,0,0,0,0,0,252,113,113,113,81,106,172,175,
+    175,23,0,0,0,128,89,9,184,3,0,0,0,0,0,0,240,199,249,249,121,105,107,101,101,165,108,108,108,20,0,0,0,128,89,61,41,0,
+    0,64,106,151,151,151,147,77,197,184,22,250,199,143,31,127,125,47,54,14,215,214,214,254,60,175,174,174,22,128,190,69,
+    125,138,90,21,53,170,185,198,254,230,85,246,81,167,154,90,21,162,171,95,252,25,160,75,215,199,77,55,107,209,245,113,
+    147,26,4,100,19,245,234,215,175,95,183,214,176,208,212,48,117,12,232,195,205,26,244,16,194,237,192,208,204,9,129,69,
+    114,95,77,107,234,154,154,6,192,162,18,112,7,96,20,94,191,126,93,78,79,79,255,252,185,153,176,221,167,9,80,93,255,58,
+    158,175,47,96,1,100,19,11,84,7,7,7,147,186,215,44,92,61,84,211,41,43,30,59,59,59,101,115,115,179,0,116,41,106,210,201,
+    201,201,164,62,53,143,154,224,67,104,106,214,214,214,214,228,161,102,1,109,157,157,157,77,198,76,53,227,166,166,254,
+    236,237,237,153,27,2,189,107,198,84,77,13,187,121,152,249,33,154,177,84,204,253,226,217,88,10,232,82,109,93,2,232,211,
+    172,115,194,102,44,181,189,189,253,224,223,139,250,24,161,211,135,138,166,52,215,247,43,1,110,19,181,229,240,240,176,
+    170,166,69,157,185,94,211,140,203,0,88,4,2,238,0,140,66,44,22,213,44,168,63,68,76,244,98,194,215,4,171,4,27,128,161,
+    68,157,251,240,225,195,100,241,170,86,44,118,53,11,250,159,62,125,154,44,96,197,98,86,4,183,132,29,128,90,215,23,214,
+    175,31,58,156,213,245,154,21,154,154,213,118,99,17,88,46,205,97,192,24,235,212,30,176,9,205,33,157,120,157,38,232,190,
+    187,187,91,0,230,37,106,214,209,209,81,57,62,62,238,100,76,117,115,44,213,172,111,189,123,247,78,136,10,152,89,205,122,
+    188,218,3,244,161,235,57,97,172,121,69,253,106,230,132,247,213,178,230,189,31,234,253,251,247,147,241,25,192,109,226,
+    176,78,212,138,89,230,137,77,158,34,230,155,33,106,154,185,33,0,99,247,184,0,192,8,204,43,220,30,98,241,42,38,122,251,
+    251,251,147,176,251,179,103,207,38,29,227,163,139,22,64,95,98,81,252,197,139,23,51,133,219,167,137,5,254,120,205,8,57,
+    188,124,249,114,178,72,6,240,80,81,51,162,118,196,34,248,172,11,236,15,209,212,172,8,184,63,127,254,124,18,0,155,231,
+    56,16,24,151,168,17,113,24,48,234,67,212,164,89,130,12,55,69,125,139,141,191,152,11,170,59,64,215,174,215,175,88,127,
+    154,215,152,42,234,87,140,165,226,125,212,51,96,8,58,133,2,243,52,207,57,97,140,155,226,53,99,29,44,214,163,238,251,
+    89,128,46,68,29,123,251,246,237,100,15,175,235,121,162,185,33,0,139,64,192,29,128,81,232,115,210,117,51,88,101,210,7,
+    204,91,44,202,71,200,161,203,5,249,105,98,113,44,22,201,212,53,224,62,77,176,125,30,11,235,15,21,117,42,194,166,15,217,
+    88,4,22,95,212,165,56,12,216,117,136,225,166,152,11,70,221,137,131,208,0,93,136,195,204,243,8,97,221,167,9,51,68,88,
+    162,207,247,5,22,71,77,237,16,112,7,230,165,175,57,97,179,30,21,99,168,219,24,91,1,93,136,122,19,117,173,205,141,16,
+    53,172,117,1,48,102,2,238,0,164,55,228,66,145,206,87,192,188,69,184,61,22,229,251,212,44,102,9,140,2,55,197,88,103,232,
+    96,251,77,205,198,98,140,199,140,197,96,57,197,120,41,234,82,95,53,160,169,133,54,254,128,89,52,181,164,143,195,204,
+    119,137,176,68,132,38,140,163,128,182,4,220,129,44,250,158,19,134,24,67,197,88,110,26,1,119,96,86,205,124,177,207,181,
+    174,152,23,198,1,108,0,24,19,1,119,0,210,187,184,184,40,25,52,65,247,88,72,3,232,66,115,237,233,80,239,29,129,81,53,
+    13,104,196,226,118,44,114,103,9,182,223,20,117,203,88,12,150,79,28,52,30,98,188,20,129,133,62,55,26,129,197,210,116,
+    24,205,116,96,48,198,81,194,12,0,192,216,12,53,39,12,49,150,139,247,191,201,60,17,152,85,172,113,15,81,75,226,0,182,
+    121,33,0,99,34,224,14,0,45,197,66,154,14,162,64,23,166,45,142,247,45,106,218,93,215,173,2,203,33,234,192,208,221,69,
+    31,74,221,130,229,17,99,165,56,104,60,148,168,137,25,198,107,192,184,68,88,32,58,140,102,28,87,197,120,207,97,65,0,96,
+    44,134,158,19,134,120,255,155,97,80,29,220,129,89,68,93,25,178,182,197,188,240,248,248,184,0,192,24,8,184,3,144,94,198,
+    107,225,93,89,15,204,42,234,72,150,110,126,113,221,170,176,40,44,167,166,67,113,212,129,49,137,207,43,116,10,139,45,
+    198,38,67,7,25,66,140,215,142,142,142,10,192,67,68,120,60,194,2,153,197,97,65,29,251,0,128,236,178,204,9,67,140,159,
+    154,80,187,230,87,192,172,50,172,51,197,218,186,122,6,192,24,8,184,3,144,94,214,78,8,49,233,139,235,166,133,29,128,26,
+    217,2,5,17,22,213,201,15,150,75,19,110,207,114,216,166,173,216,228,116,56,7,22,83,140,147,50,29,188,137,48,3,192,125,
+    162,3,222,88,234,69,132,240,199,58,6,4,0,22,95,182,57,97,172,161,53,235,249,186,183,3,179,200,210,252,202,173,133,0,
+    140,133,128,59,0,233,101,63,61,188,183,183,103,83,16,104,45,99,221,136,48,134,122,6,203,35,22,176,199,126,27,77,108,
+    118,234,64,10,139,37,230,127,217,2,162,153,110,222,1,114,138,58,49,182,112,192,171,87,175,116,236,3,0,210,201,56,39,
+    12,77,55,249,95,191,126,21,128,90,39,39,39,37,139,88,235,178,222,5,64,118,79,10,0,36,55,134,205,182,216,20,252,246,237,
+    91,89,91,91,43,0,247,137,206,8,109,67,165,81,95,86,86,86,38,143,70,212,199,174,107,100,132,50,162,158,93,127,31,96,241,
+    196,141,13,209,101,116,17,196,166,231,246,246,182,113,24,44,136,184,153,161,235,142,120,205,24,234,122,157,104,59,142,
+    138,13,200,173,173,173,2,112,83,115,43,206,216,186,121,54,29,251,190,126,253,90,0,0,178,200,58,39,140,159,141,53,253,
+    239,223,191,23,128,90,109,2,229,93,212,174,251,68,205,141,61,65,0,200,74,192,29,128,244,154,137,91,44,104,101,221,44,
+    140,207,213,132,220,1,238,243,144,197,167,8,80,237,236,236,148,205,205,205,63,225,246,219,196,130,216,197,197,197,164,
+    147,241,172,11,91,241,251,209,13,249,221,187,119,5,88,76,209,113,106,30,157,176,162,86,109,108,108,76,158,227,241,244,
+    233,211,63,223,187,188,188,252,115,184,39,30,93,142,233,132,179,96,113,68,125,234,234,240,77,51,150,186,239,0,76,212,
+    164,179,179,179,201,251,222,181,201,168,163,21,112,155,56,56,216,85,192,32,198,82,81,191,214,215,215,255,140,169,26,
+    205,186,88,204,253,162,38,69,253,154,245,125,227,117,142,142,142,202,238,238,110,1,0,24,90,230,57,97,136,159,27,219,
+    161,70,32,151,187,230,112,177,15,24,55,199,199,190,96,212,176,219,246,5,163,14,69,189,138,102,12,205,237,18,181,162,
+    6,198,107,105,234,0,64,86,143,126,255,167,0,192,72,221,156,4,78,11,193,55,63,19,215,6,54,193,170,235,207,93,138,112,
+    233,155,55,111,10,176,28,158,63,127,222,58,80,16,161,210,88,148,218,223,223,255,231,123,241,247,81,67,226,123,181,29,
+    212,99,49,107,214,128,69,188,119,116,162,209,197,29,22,79,212,134,232,48,218,85,8,43,22,190,35,16,21,27,134,109,106,
+    70,19,166,138,205,195,174,198,99,17,112,183,16,15,227,86,51,182,186,41,234,64,28,212,171,169,7,241,222,209,185,106,90,
+    160,34,106,92,252,125,140,211,218,222,196,19,227,63,135,7,97,49,69,221,136,218,53,139,89,230,129,81,151,226,128,242,
+    44,135,112,34,240,229,22,47,96,154,154,177,89,172,75,57,52,3,212,202,60,39,12,177,254,21,218,134,240,205,9,97,177,196,
+    30,92,219,6,50,113,152,57,114,4,211,106,211,44,115,194,168,91,209,252,101,150,57,97,124,38,205,99,0,200,74,192,29,128,
+    165,214,116,17,141,19,206,93,116,133,16,10,133,229,210,197,130,123,35,22,183,190,124,249,114,103,55,153,54,98,33,62,
+    22,203,106,89,116,135,197,20,139,221,179,118,117,9,209,73,38,106,196,172,53,43,106,104,124,158,8,102,205,18,116,143,
+    177,87,212,80,1,119,24,175,168,5,81,163,106,69,29,136,186,52,237,16,97,91,49,134,138,177,84,87,140,171,96,113,197,193,
+    193,89,130,4,81,179,162,62,204,186,142,52,235,65,103,117,10,152,70,192,29,232,147,57,33,48,22,53,1,247,219,196,193,153,
+    207,159,63,207,60,39,140,207,19,159,171,214,207,159,63,229,27,0,72,233,113,1,128,37,22,129,210,8,104,69,32,42,130,233,
+    49,129,156,37,168,21,193,172,8,104,1,180,17,27,127,209,49,175,171,112,123,248,248,241,227,76,139,230,177,136,239,186,
+    85,88,44,77,152,124,22,81,167,162,155,203,172,99,166,235,175,23,139,239,81,3,99,76,86,35,198,115,241,251,194,237,48,
+    110,113,171,67,173,216,128,139,218,212,69,144,33,196,235,232,102,12,220,231,236,236,172,58,220,222,140,169,98,222,214,
+    69,173,137,113,84,188,94,140,139,106,204,114,56,26,0,160,11,230,132,192,178,137,61,188,200,40,116,81,107,98,141,125,
+    150,26,24,205,0,1,32,163,39,5,0,152,136,205,197,216,16,140,199,44,167,156,99,83,48,174,17,179,240,5,60,68,132,219,187,
+    232,166,60,77,212,178,95,191,126,85,133,21,34,220,30,155,10,81,207,128,197,48,75,23,172,16,245,42,234,201,60,198,56,
+    49,14,139,208,252,234,234,106,171,49,88,44,218,71,48,12,24,183,56,128,51,75,7,228,89,66,157,183,105,110,215,137,238,
+    204,0,211,212,118,236,107,194,237,93,30,112,190,254,186,81,183,226,182,194,54,98,254,23,117,216,129,65,24,175,89,110,
+    113,184,77,77,227,131,88,227,154,101,92,215,198,246,246,246,164,235,41,48,126,230,132,192,178,105,242,8,93,138,192,124,
+    212,210,182,243,193,16,191,227,22,30,0,50,18,112,7,128,41,98,66,25,19,203,88,184,106,187,49,32,20,10,60,84,4,16,230,
+    21,110,111,68,240,51,22,166,106,54,8,142,143,143,213,50,88,16,181,117,160,17,139,227,93,47,184,79,19,239,17,27,136,17,
+    198,191,43,76,17,33,251,8,196,11,51,192,98,152,165,75,84,140,117,186,14,50,52,34,232,25,7,105,116,54,6,110,170,13,97,
+    205,43,220,222,104,186,151,190,120,241,162,245,122,86,132,99,5,220,97,188,162,38,245,21,44,191,75,159,159,33,106,169,
+    57,33,44,6,115,66,96,153,196,24,102,30,77,91,98,62,24,175,91,115,48,39,195,56,18,0,166,121,92,0,128,169,154,77,199,154,
+    46,165,17,10,5,184,79,212,152,62,68,8,180,70,44,104,213,116,235,2,242,57,56,56,40,181,162,115,75,31,225,246,70,4,20,
+    238,170,143,177,105,25,215,68,11,50,192,226,168,61,240,23,245,160,171,43,232,111,51,207,176,4,48,94,181,183,254,69,77,
+    153,87,184,189,17,235,88,209,109,180,173,56,16,105,254,7,0,12,193,156,16,88,38,177,214,62,175,155,224,227,96,78,205,
+    193,229,154,174,239,0,208,7,1,119,0,184,67,108,58,214,4,67,109,10,2,247,137,91,34,230,29,108,104,196,251,196,251,213,
+    152,165,123,14,144,67,116,239,172,221,40,140,250,49,68,151,170,216,56,156,54,6,139,77,203,8,183,247,85,63,129,249,139,
+    26,85,187,137,86,19,224,172,49,143,174,90,192,184,213,116,183,139,57,89,95,7,244,98,44,213,246,128,98,172,99,9,53,0,
+    0,125,51,39,4,150,73,172,107,71,67,153,121,170,189,153,235,242,242,178,0,64,54,2,238,0,112,143,216,124,108,59,17,180,
+    41,8,220,231,221,187,119,165,79,111,222,188,41,53,92,75,8,227,55,203,255,227,218,219,108,186,16,33,176,166,11,87,124,
+    134,8,188,219,80,132,197,83,91,163,98,158,214,215,97,151,218,238,87,192,98,58,59,59,155,4,177,218,136,122,53,196,28,
+    176,237,56,206,1,103,0,160,111,230,132,192,50,233,227,166,212,237,237,237,82,67,182,1,128,140,4,220,1,224,1,106,54,33,
+    47,46,46,10,192,52,209,77,175,239,238,195,241,158,53,139,240,2,238,48,126,71,71,71,165,70,159,55,77,220,38,198,96,177,
+    97,25,93,219,107,111,162,0,114,139,160,104,141,218,195,123,181,250,234,186,12,228,119,124,124,92,218,138,14,125,125,
+    143,171,34,220,222,118,252,100,254,7,0,244,205,156,16,88,38,181,225,243,54,98,63,176,134,219,233,1,200,72,192,29,0,30,
+    32,38,130,109,187,94,57,229,12,220,102,168,144,102,205,34,124,116,38,180,168,5,227,86,27,84,234,187,203,232,52,49,254,
+    138,235,166,135,14,218,3,243,83,51,111,138,154,208,119,247,188,121,95,31,13,140,71,77,221,26,106,14,216,54,60,17,255,
+    54,243,63,0,160,79,230,132,192,178,136,186,213,215,109,169,53,235,233,230,130,0,100,36,224,14,0,15,16,147,205,182,167,
+    157,117,189,2,110,179,190,190,94,134,176,185,185,89,106,68,200,29,24,167,218,46,88,25,186,183,3,203,161,38,204,48,196,
+    213,240,49,39,116,37,61,16,218,174,247,196,65,227,161,198,85,53,1,10,243,63,0,160,79,230,132,192,178,232,243,38,136,
+    154,32,189,128,59,0,25,9,184,3,192,3,181,221,140,52,9,4,110,51,212,66,120,205,109,20,225,226,226,162,0,227,84,123,224,
+    206,181,203,64,31,106,111,189,26,170,70,213,94,241,12,44,142,154,195,131,67,143,171,218,214,46,243,63,0,160,47,230,132,
+    192,50,233,179,249,85,95,157,226,1,96,222,4,220,1,224,129,4,220,129,46,12,189,8,238,90,66,88,46,53,27,133,177,248,189,
+    189,189,93,0,230,237,242,242,178,212,168,189,149,102,86,67,221,194,3,228,81,51,182,26,170,102,53,218,206,65,117,112,
+    7,0,250,98,78,8,44,19,135,100,0,160,61,1,119,0,152,163,218,197,57,96,113,13,117,53,125,163,102,1,77,192,29,198,171,38,
+    160,100,161,29,232,75,77,80,52,198,82,67,117,161,114,29,61,208,118,108,21,227,170,161,231,128,109,131,88,2,238,0,64,
+    95,204,9,129,101,162,171,58,0,180,39,224,14,0,0,61,26,58,220,80,179,128,38,224,0,227,85,179,81,104,179,14,232,75,205,
+    33,186,33,199,82,54,34,129,182,115,163,161,231,127,225,249,243,231,173,126,222,1,103,0,160,47,230,132,192,178,200,48,
+    55,4,128,49,122,82,0,96,1,197,162,88,116,79,143,141,199,248,186,217,128,188,109,35,50,22,165,174,63,154,14,16,174,27,
+    4,186,54,244,34,184,69,120,88,30,53,225,246,160,131,59,208,151,154,58,53,100,141,106,230,139,194,159,176,188,106,58,
+    184,15,237,233,211,167,173,126,94,141,131,113,250,250,245,107,233,90,28,144,105,91,247,14,15,15,203,238,238,110,1,120,
+    8,115,66,96,89,8,184,3,64,29,1,119,0,70,47,22,146,46,46,46,202,233,233,233,100,49,44,30,93,118,27,142,9,103,60,44,88,
+    1,0,99,242,235,215,175,82,99,117,117,181,0,100,149,225,54,28,115,67,88,94,109,255,255,103,8,49,180,61,228,172,198,1,
+    0,153,153,19,2,0,192,242,16,112,7,96,148,98,241,232,232,232,168,28,31,31,79,2,237,243,92,76,138,176,124,151,129,121,
+    0,128,62,212,142,143,116,147,1,250,82,51,207,202,16,102,0,150,87,219,186,85,123,163,78,151,218,142,9,5,182,0,128,190,
+    152,19,2,0,0,119,17,112,7,96,84,206,206,206,38,161,246,184,234,212,134,27,48,70,130,163,64,95,126,254,252,89,106,216,
+    168,3,50,123,250,244,105,25,146,26,9,180,241,233,211,167,2,0,64,119,204,9,1,0,96,121,8,184,3,48,10,209,197,225,237,219,
+    183,147,112,59,0,0,247,187,188,188,44,109,57,132,3,244,201,77,89,192,152,168,89,0,0,221,50,190,2,0,0,238,242,184,0,64,
+    114,7,7,7,229,197,139,23,194,237,0,0,0,75,238,249,243,231,5,0,0,128,229,100,78,8,0,0,203,67,7,119,0,210,138,206,13,175,
+    95,191,46,167,167,167,5,128,110,212,116,197,113,237,42,0,0,0,0,0,0,0,0,125,17,112,7,32,165,8,96,190,124,249,210,245,
+    132,0,29,19,112,7,0,0,224,54,230,127,0,0,0,0,64,6,143,11,0,36,35,220,14,48,63,87,87,87,165,173,181,181,181,2,44,135,
+    154,26,1,0,192,226,16,112,7,0,0,0,0,50,16,112,7,32,21,225,118,128,249,58,63,63,47,109,173,174,174,22,96,124,106,194,
+    73,2,238,0,0,211,9,126,3,0,0,0,0,244,71,192,29,128,84,62,124,248,32,220,14,48,39,53,225,246,32,200,1,227,244,244,233,
+    211,82,227,242,242,178,0,244,161,102,140,241,243,231,207,2,48,132,101,153,23,153,255,1,0,125,49,39,4,0,0,238,242,164,
+    0,64,18,135,135,135,147,71,23,54,54,54,254,60,162,243,240,218,218,218,100,161,172,121,76,19,29,75,155,174,165,55,191,
+    142,160,215,241,241,113,57,61,61,45,0,99,85,27,90,141,90,10,140,207,179,103,207,74,141,56,12,227,230,6,160,15,49,55,
+    107,123,115,132,155,38,128,33,213,212,173,177,17,112,7,0,250,98,78,8,0,0,220,69,192,29,128,52,162,123,251,44,182,182,
+    182,202,206,206,78,217,221,221,173,218,140,187,43,252,30,98,209,76,192,29,24,179,56,168,211,86,212,86,96,156,106,67,
+    234,110,211,1,50,27,250,150,9,53,18,150,91,219,16,86,252,252,216,14,12,111,110,110,22,0,128,172,204,9,1,0,96,121,8,184,
+    3,144,66,116,110,175,93,20,138,141,194,143,31,63,10,97,2,220,163,230,144,142,238,237,48,94,113,131,77,141,232,224,14,
+    208,135,168,83,109,231,129,67,119,235,19,102,128,229,22,243,163,182,117,224,235,215,175,5,0,128,127,153,19,2,0,0,119,
+    121,92,0,32,129,163,163,163,82,99,127,127,191,124,251,246,77,184,29,224,30,17,88,173,89,124,87,95,97,188,238,187,157,
+    230,54,53,183,61,0,212,168,57,136,51,228,33,156,161,131,20,192,240,218,214,173,168,27,67,119,25,5,0,200,202,156,16,0,
+    0,184,139,128,59,0,131,139,192,101,77,87,225,119,239,222,77,58,183,3,112,191,131,131,131,82,99,125,125,189,0,227,85,
+    179,81,24,155,117,53,99,51,128,182,106,14,225,12,25,102,184,184,184,40,192,114,171,153,31,197,173,133,0,0,252,203,156,
+    16,0,0,184,139,128,59,0,131,171,89,16,138,176,214,251,247,239,11,0,15,83,19,86,221,216,216,168,10,199,2,121,212,222,
+    194,112,118,118,86,0,230,173,102,156,49,228,117,240,223,191,127,47,192,114,139,57,82,91,14,14,2,0,76,103,78,8,0,0,220,
+    69,192,29,128,193,213,108,244,125,254,252,185,244,205,213,131,192,88,69,199,192,154,133,255,189,189,189,2,140,91,237,
+    45,12,159,62,125,50,246,1,230,110,108,183,76,56,252,3,68,221,106,219,105,52,106,150,144,59,0,192,191,204,9,1,0,128,187,
+    8,184,3,48,184,182,215,9,198,130,87,109,55,210,89,12,121,237,33,192,44,62,124,248,80,106,108,111,111,23,96,220,106,199,
+    76,177,89,120,114,114,82,0,230,169,246,16,206,80,161,2,1,85,32,194,237,53,93,220,107,231,100,0,0,139,204,156,16,0,0,
+    184,139,128,59,0,131,107,219,85,184,102,35,177,11,2,238,192,24,69,144,162,166,123,123,132,98,107,58,232,0,185,196,255,
+    227,218,255,203,239,223,191,215,197,29,152,171,154,78,200,97,136,80,65,204,7,107,198,84,192,226,169,57,64,168,139,59,
+    0,192,191,204,9,1,0,128,187,8,184,3,48,184,49,4,220,163,27,132,128,23,48,54,81,95,35,160,90,99,111,111,175,0,139,97,
+    103,103,167,212,136,26,162,219,40,48,111,53,243,187,33,130,162,7,7,7,5,32,212,222,116,245,250,245,107,107,75,0,0,55,
+    152,19,2,0,0,183,17,112,7,128,7,248,244,233,83,1,24,147,8,78,188,124,249,178,212,136,206,57,187,187,187,5,88,12,181,
+    33,172,16,99,32,221,70,129,121,170,61,132,115,116,116,84,250,164,22,2,141,8,97,213,116,113,119,120,16,0,224,95,230,132,
+    0,0,192,109,4,220,1,24,157,190,187,93,197,181,131,199,199,199,5,96,76,162,59,96,237,149,169,181,93,223,129,156,34,128,
+    85,19,194,106,204,82,79,0,238,179,190,190,94,106,28,30,30,246,86,155,250,124,47,96,28,106,199,86,113,120,80,247,79,0,
+    128,255,103,78,8,0,0,220,70,192,29,128,209,233,59,224,254,234,213,171,2,48,38,17,70,173,61,152,163,123,59,44,166,218,
+    110,88,33,54,240,226,70,8,27,121,192,60,68,72,116,101,101,165,212,136,49,207,188,233,184,12,76,243,230,205,155,234,218,
+    181,191,191,47,228,14,0,240,127,204,9,1,0,128,219,8,184,3,48,184,8,83,182,209,103,55,245,183,111,223,10,115,1,163,17,
+    7,128,98,81,63,58,202,212,210,189,29,22,83,28,92,169,221,44,12,77,200,61,110,182,1,232,218,222,222,94,169,17,87,196,
+    207,59,36,26,65,6,115,66,224,166,24,87,69,80,189,86,252,174,160,20,0,192,255,50,39,4,0,0,166,17,112,7,96,112,109,195,
+    86,17,224,140,69,171,121,139,69,171,184,58,26,96,12,154,240,233,44,225,246,216,72,208,189,29,22,211,172,33,172,16,117,
+    230,197,139,23,194,88,64,231,182,183,183,75,173,56,156,55,175,195,55,81,239,102,25,91,1,139,109,150,46,238,33,234,151,
+    91,114,0,0,204,9,1,0,128,233,4,220,1,24,220,198,198,70,105,43,58,171,207,75,4,232,227,245,167,117,49,142,77,71,221,141,
+    129,108,98,161,61,66,167,179,44,228,199,109,26,239,222,189,43,192,226,138,16,86,219,155,115,166,137,177,208,243,231,
+    207,203,209,209,81,1,232,66,92,73,95,51,47,12,49,127,139,128,104,215,135,160,99,124,101,238,7,220,165,139,3,132,81,187,
+    98,92,165,51,40,0,176,204,204,9,1,0,128,105,4,220,1,24,92,205,162,85,132,56,95,191,126,93,186,118,118,118,54,9,137,222,
+    214,185,125,117,117,181,0,100,16,11,247,209,61,38,194,16,177,208,30,127,158,197,199,143,31,59,9,190,2,121,69,8,235,243,
+    231,207,165,11,17,192,138,91,31,154,160,123,159,129,172,168,119,2,96,176,120,118,118,118,74,173,38,208,208,197,13,19,
+    241,90,49,215,20,100,0,30,162,203,3,132,81,199,162,254,244,61,174,2,0,200,192,156,16,0,0,184,73,192,29,128,193,213,94,
+    61,24,193,206,87,175,94,117,178,241,23,193,246,88,252,138,46,17,183,189,94,124,47,180,9,185,71,120,63,2,243,241,218,
+    209,21,62,22,215,78,78,78,38,239,103,19,17,168,17,245,35,234,73,132,74,187,10,63,68,231,246,89,54,16,128,241,136,241,
+    204,172,157,70,175,187,30,116,111,54,18,103,29,231,196,239,94,94,94,78,94,39,194,243,241,154,81,239,98,76,21,239,243,
+    236,217,179,185,222,230,3,12,35,66,162,113,16,103,22,179,220,48,17,181,39,234,77,252,254,180,43,232,227,179,253,254,
+    253,123,82,243,0,26,93,31,32,108,14,49,199,184,167,139,113,85,163,25,95,69,125,60,56,56,152,140,173,154,113,149,245,
+    41,0,32,131,177,204,9,155,189,66,0,0,96,254,158,20,0,24,88,116,186,138,71,77,72,243,248,248,120,210,205,61,22,148,34,
+    160,217,166,107,86,108,236,197,239,199,227,33,87,23,214,116,154,143,5,177,248,124,225,182,247,136,215,141,133,177,248,
+    252,22,198,96,241,69,173,139,250,19,158,62,125,58,117,209,62,106,199,175,95,191,254,212,144,248,157,120,142,58,210,117,
+    248,32,106,143,110,52,176,92,226,255,125,140,127,186,238,14,26,53,234,250,120,39,234,91,140,205,226,185,121,220,212,
+    124,134,230,57,106,220,67,234,92,51,190,2,22,71,51,39,154,245,0,75,115,240,38,198,55,49,191,138,71,212,162,245,245,245,
+    191,234,80,140,199,162,222,68,221,106,230,149,119,213,159,102,62,56,107,224,2,88,60,205,154,84,23,29,67,27,81,147,174,
+    143,119,154,181,163,230,249,161,99,171,166,182,221,53,238,139,239,213,172,121,1,0,116,105,44,115,66,0,0,160,63,2,238,
+    0,164,208,44,54,213,104,58,92,197,35,22,152,98,161,170,121,190,249,115,205,166,94,19,24,109,99,119,119,183,204,67,179,
+    97,169,19,32,44,135,168,117,89,2,229,81,215,132,219,97,249,196,102,222,215,175,95,39,29,215,187,14,185,95,119,253,160,
+    95,215,230,249,185,129,225,196,13,19,209,105,175,139,218,113,125,158,216,133,38,204,208,230,80,53,176,60,98,94,21,117,
+    167,166,91,232,67,220,215,60,97,22,23,23,23,2,91,0,64,10,99,152,19,2,0,0,253,17,112,7,32,133,184,122,240,211,167,79,
+    51,119,38,110,58,92,69,183,133,46,69,135,135,102,241,42,174,39,4,24,59,157,219,97,185,69,64,243,203,151,47,147,144,123,
+    215,55,67,244,37,58,109,173,174,174,22,96,177,124,254,252,185,188,120,241,162,100,179,189,189,61,121,142,27,120,0,166,
+    137,117,173,8,139,143,237,166,25,7,7,1,128,76,178,207,9,1,0,128,254,60,46,0,144,64,115,245,96,86,153,63,27,64,91,194,
+    237,64,136,195,123,209,201,253,250,245,204,99,242,243,231,207,2,44,158,168,77,31,63,126,44,153,196,161,160,56,244,28,
+    28,120,6,110,211,220,146,51,182,238,158,2,238,0,64,38,217,231,132,0,0,64,127,4,220,1,72,35,174,30,204,184,64,180,183,
+    183,247,215,231,210,177,15,24,171,38,112,33,220,14,52,98,211,240,219,183,111,147,141,186,177,137,14,169,192,98,138,185,
+    225,238,238,110,201,226,250,216,201,205,17,192,93,98,206,21,99,171,168,99,99,49,182,142,243,0,192,226,203,60,39,4,0,
+    0,250,35,224,14,64,42,113,245,96,166,128,85,124,150,155,157,34,198,218,229,20,88,110,113,80,39,130,22,58,205,0,55,197,
+    120,39,14,191,140,173,62,232,54,10,139,237,240,240,48,69,160,33,106,228,245,207,49,198,3,65,64,255,98,45,105,44,183,
+    1,26,83,1,0,25,101,157,19,2,0,0,253,17,112,7,32,149,38,96,149,33,52,208,124,22,129,118,96,204,162,150,125,249,242,37,
+    77,109,5,114,106,198,61,17,196,26,203,216,71,24,11,22,95,4,26,134,236,130,220,212,198,105,127,15,112,159,232,244,249,
+    253,251,247,244,53,227,234,234,106,242,0,0,200,38,235,156,16,0,0,232,135,128,59,0,233,100,8,185,223,245,25,4,222,129,
+    49,136,90,21,65,213,232,218,190,179,179,83,0,30,34,130,88,81,55,246,246,246,74,118,2,238,176,28,134,234,130,28,99,169,
+    56,36,104,78,8,204,34,106,72,132,220,163,150,101,14,186,27,87,1,0,89,101,156,19,2,0,0,253,16,112,7,32,165,38,96,62,68,
+    184,42,186,65,68,176,235,182,69,43,97,6,32,179,141,141,141,201,130,127,132,40,34,168,170,102,1,109,197,24,232,243,231,
+    207,147,58,146,57,232,46,136,5,203,163,239,46,200,241,62,49,39,140,113,213,109,223,7,104,35,214,154,154,219,114,50,214,
+    144,139,139,139,2,0,144,85,182,57,97,205,235,1,0,0,237,9,184,3,144,86,19,174,234,171,155,251,214,214,214,228,189,162,
+    27,132,64,40,48,38,81,179,154,192,68,44,188,11,182,3,93,184,25,116,207,182,25,39,224,14,203,165,233,130,28,117,105,158,
+    245,232,190,3,207,193,56,11,168,17,117,165,9,103,69,45,139,117,168,44,140,171,0,128,236,178,204,9,175,174,174,10,0,0,
+    208,143,39,5,0,146,139,13,191,88,180,58,61,61,45,71,71,71,229,248,248,184,179,5,164,8,38,68,96,107,123,123,187,213,198,
+    98,44,108,217,252,3,134,18,181,43,186,199,108,110,110,78,106,87,166,96,4,176,120,154,160,123,136,241,216,201,201,201,
+    228,249,252,252,188,12,33,62,79,212,192,120,142,49,161,160,41,44,151,152,191,197,227,240,240,112,82,143,98,126,56,171,
+    102,94,248,230,205,155,7,5,37,116,223,3,102,213,212,178,88,91,106,214,187,98,108,213,119,96,234,250,184,10,0,96,12,134,
+    158,19,214,140,215,86,87,87,11,0,0,208,222,163,223,255,41,0,48,50,177,249,119,118,118,54,121,142,205,192,135,134,205,
+    99,97,42,130,160,177,121,183,190,190,94,29,10,125,251,246,237,159,64,213,245,80,85,124,253,244,233,211,127,222,243,174,
+    63,223,124,13,96,92,154,16,66,212,161,203,203,203,63,95,199,115,243,168,61,16,211,212,135,38,112,16,117,171,249,90,221,
+    0,134,22,245,45,106,224,197,197,197,100,76,214,252,121,150,96,86,83,247,226,209,212,186,120,142,141,64,245,15,152,38,
+    106,78,51,63,140,26,244,144,58,212,212,150,152,15,198,97,231,168,47,109,106,75,19,70,109,230,118,77,88,225,122,13,107,
+    94,207,124,15,104,35,106,88,212,179,152,67,54,245,108,150,67,133,215,199,83,198,85,0,192,34,234,123,78,248,232,209,163,
+    210,86,220,188,170,73,13,0,0,180,39,224,14,192,194,184,30,40,189,174,9,29,232,70,5,12,233,122,125,186,43,240,174,102,
+    1,139,160,169,115,15,169,119,65,0,20,232,218,180,131,208,198,89,192,88,93,63,64,61,45,176,117,115,44,165,206,1,0,203,
+    110,30,115,194,8,207,191,120,241,162,180,21,159,67,23,119,0,0,104,79,192,29,0,0,0,0,0,0,0,0,110,113,114,114,82,118,118,
+    118,74,91,34,57,0,0,80,231,113,1,0,0,0,0,0,0,0,0,166,58,61,61,45,109,109,108,108,20,0,0,160,142,128,59,0,0,0,0,0,0,0,
+    0,220,226,252,252,188,180,181,182,182,86,0,0,128,58,2,238,0,0,0,0,0,0,0,0,48,197,143,31,63,116,112,7,0,128,158,9,184,
+    3,0,0,0,0,0,0,0,192,20,53,225,246,176,185,185,89,0,0,128,58,143,126,255,167,0,0,0,0,0,0,0,0,0,127,121,254,252,249,164,
+    139,123,91,63,127,254,44,43,43,43,5,0,0,104,79,7,119,0,0,0,0,0,0,0,0,184,225,240,240,176,42,220,190,181,181,37,220,14,
+    0,0,51,16,112,7,0,0,0,0,0,0,0,128,27,62,124,248,80,106,236,236,236,20,0,0,160,158,128,59,0,0,0,0,0,0,0,0,92,19,225,246,
+    154,238,237,97,123,123,187,0,0,0,245,30,253,254,79,1,0,0,0,0,0,0,0,0,202,209,209,81,217,219,219,43,53,54,54,54,202,183,
+    111,223,10,0,0,80,79,7,119,0,0,0,0,0,0,0,0,40,179,133,219,195,254,254,126,1,0,0,102,163,131,59,0,0,0,0,0,0,0,0,75,239,
+    195,135,15,229,253,251,247,165,214,218,218,90,249,254,253,123,1,0,0,102,243,164,0,0,0,0,0,0,0,0,192,146,58,59,59,155,
+    4,219,79,79,79,203,44,118,119,119,11,0,0,48,59,29,220,1,0,0,0,0,0,0,0,88,42,87,87,87,229,228,228,164,28,30,30,206,28,
+    108,15,186,183,3,0,64,119,116,112,7,0,0,0,0,0,0,0,96,97,69,152,253,215,175,95,229,252,252,124,242,136,64,123,60,199,
+    223,119,37,58,192,3,0,0,221,16,112,7,0,0,0,0,0,0,0,96,48,17,52,191,184,184,152,60,223,12,157,255,248,241,227,159,159,
+    189,235,103,110,126,127,218,207,119,109,111,111,175,236,238,238,22,0,0,160,27,143,126,255,167,0,0,0,0,0,0,0,0,192,0,
+    206,206,206,202,214,214,86,25,163,181,181,181,242,245,235,215,201,51,0,0,208,141,199,5,0,0,0,0,0,0,0,0,6,178,186,186,
+    90,198,104,101,101,69,184,29,0,0,230,64,192,29,0,0,0,0,0,0,0,0,90,16,110,7,0,128,249,17,112,7,0,0,0,0,0,0,0,96,48,17,
+    22,31,147,8,181,71,184,125,99,99,163,0,0,0,221,123,244,251,63,5,0,0,0,0,0,0,0,0,6,242,232,209,163,50,6,17,106,255,242,
+    229,139,206,237,0,0,48,71,58,184,3,0,0,0,0,0,0,0,192,61,246,247,247,203,183,111,223,132,219,1,0,96,206,4,220,1,0,0,0,
+    0,0,0,0,24,84,230,208,248,214,214,214,36,216,254,241,227,199,2,0,0,204,159,128,59,0,0,0,0,0,0,0,0,220,16,193,246,175,
+    95,191,78,30,27,27,27,5,0,0,232,199,147,2,0,0,0,0,0,0,0,0,3,90,89,89,41,25,196,231,120,243,230,77,217,217,217,17,106,
+    7,0,128,129,8,184,3,0,0,0,0,0,0,0,48,168,161,2,238,241,190,17,100,223,220,220,156,116,108,143,7,0,0,48,44,1,119,0,0,
+    0,0,0,0,0,0,6,53,239,128,123,188,126,19,102,95,91,91,43,235,235,235,147,175,117,105,7,0,128,124,4,220,1,0,0,0,0,0,0,
+    0,24,84,132,206,227,209,4,209,175,255,253,205,159,187,110,117,117,245,214,239,55,95,223,252,29,0,0,32,183,71,191,255,
+    83,0,0,0,0,0,0,0,0,0,0,0,96,96,143,11,0,0,0,0,0,0,0,0,0,0,0,36,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,
+    0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,
+    2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,
+    0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,0,0,0,0,0,164,32,224,14,0,0,0,0,0,0,0,0,0,0,64,10,2,238,0,0,0,0,0,0,252,79,187,
+    118,44,0,0,0,0,48,200,223,122,26,59,138,35,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,
+    128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,
+    0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,
+    5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,
+    0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,
+    193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,
+    0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,
+    29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,
+    0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,
+    0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,
+    0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,
+    0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,
+    128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,
+    0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,
+    5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,
+    0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,
+    193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,
+    0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,5,193,29,0,0,0,0,0,0,0,0,0,0,128,133,
+    0,46,152,159,3,137,2,241,238,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+inline const unsigned char texture_draw[12230] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,5,220,0,0,3,132,8,6,0,0,0,187,56,243,196,0,0,0,9,112,72,89,115,0,0,
+    11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,
+    0,47,91,73,68,65,84,120,1,236,221,225,89,83,233,186,199,225,229,190,252,206,88,129,99,5,104,5,72,5,98,5,98,5,74,5,104,
+    5,74,5,98,5,58,21,8,21,140,84,192,236,10,144,10,56,231,225,156,53,59,59,3,73,222,149,127,194,34,220,247,117,113,161,
+    78,32,201,202,202,124,248,173,55,207,251,168,235,186,171,14,0,0,0,0,0,88,202,191,58,0,0,0,0,0,96,105,130,59,0,0,0,0,
+    0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,
+    0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,240,184,107,116,117,117,213,1,0,0,0,0,192,166,123,
+    244,232,81,211,237,173,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,
+    119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,
+    119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,
+    119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,
+    119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,167,
+    3,0,0,0,0,96,121,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,
+    8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,
+    64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,
+    0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,
+    3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,
+    130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,
+    16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,
+    0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,
+    0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,
+    224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,
+    4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,
+    0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,
+    0,0,0,0,0,4,8,238,0,0,0,0,0,16,240,184,3,0,0,96,99,253,252,249,179,59,59,59,107,250,153,237,237,237,238,249,243,231,
+    29,0,0,109,4,119,0,96,163,29,28,28,92,199,166,85,250,253,247,223,187,223,126,251,237,239,175,138,84,245,189,130,21,192,
+    93,251,227,143,63,186,15,31,62,180,252,200,245,237,5,119,0,128,118,130,59,0,176,209,42,182,159,156,156,116,119,165,130,
+    85,125,189,124,249,242,250,187,8,15,0,0,176,185,4,119,0,128,21,170,224,95,95,199,199,199,215,127,175,213,240,21,223,
+    247,247,247,187,157,157,157,14,0,0,128,205,97,211,84,0,128,53,250,235,175,191,174,227,123,69,247,103,207,158,117,111,
+    223,190,189,254,55,0,0,0,238,63,193,29,0,224,142,244,241,93,120,7,0,0,216,12,130,59,0,192,8,8,239,0,0,0,247,159,224,
+    14,0,48,34,21,222,119,119,119,187,175,95,191,118,0,119,165,246,155,0,0,160,157,224,14,0,48,50,181,194,189,54,85,61,56,
+    56,232,126,253,250,213,1,0,0,112,63,8,238,0,0,35,245,249,243,231,238,197,139,23,70,204,0,0,0,220,19,130,59,0,192,136,
+    85,108,175,17,51,162,59,48,212,111,191,253,214,1,0,176,30,130,59,0,192,200,85,108,175,149,238,63,127,254,236,0,90,109,
+    109,109,117,0,0,172,135,224,14,0,112,15,212,44,247,215,175,95,91,233,14,0,0,48,98,143,59,0,0,254,246,242,229,203,238,
+    203,151,47,11,223,190,15,224,103,103,103,215,127,174,85,232,245,181,138,205,78,251,241,50,127,254,249,167,17,17,0,0,
+    0,35,36,184,3,0,76,249,253,247,223,155,111,91,161,126,82,69,247,211,211,211,238,251,247,239,221,201,201,73,151,82,209,
+    189,86,186,255,248,241,163,3,0,0,96,92,140,148,1,0,88,129,231,207,159,119,239,222,189,187,14,227,231,231,231,221,254,
+    254,126,151,82,1,255,232,232,168,3,0,0,96,92,4,119,0,128,21,171,85,240,53,166,38,25,222,223,191,127,111,158,59,0,0,192,
+    200,8,238,0,0,107,50,25,222,91,198,214,220,230,237,219,183,29,0,0,0,227,33,184,3,0,172,89,197,246,218,248,116,111,111,
+    175,91,70,141,150,249,250,245,107,7,144,102,99,102,0,128,97,4,119,0,128,59,80,49,235,219,183,111,221,225,225,97,183,
+    140,15,31,62,116,0,105,91,91,91,29,0,0,237,4,119,0,128,59,84,193,188,230,177,15,85,115,220,173,114,7,0,0,24,7,193,29,
+    0,224,142,125,250,244,169,123,249,242,101,55,212,231,207,159,59,0,0,0,238,222,227,14,0,128,59,87,227,101,94,188,120,
+    113,189,98,189,213,207,159,63,175,231,185,47,19,237,199,238,223,255,254,247,245,243,252,245,235,215,63,142,81,205,196,
+    175,17,61,245,125,123,123,187,3,0,0,184,43,130,59,0,192,8,84,48,254,242,229,75,183,187,187,219,13,241,241,227,199,165,
+    130,251,233,233,105,183,42,59,59,59,93,171,10,235,53,42,167,46,36,212,87,253,125,81,117,28,234,235,205,155,55,215,17,
+    126,157,234,162,192,235,215,175,255,235,223,22,121,12,245,250,247,155,84,246,127,238,47,34,212,247,186,144,112,95,54,
+    177,108,61,151,158,62,125,58,232,117,58,59,59,107,58,47,134,222,79,25,242,254,184,79,175,25,0,0,57,130,59,0,192,72,84,
+    36,222,223,223,239,142,143,143,187,86,253,234,239,161,129,111,149,171,227,107,69,122,197,206,69,212,115,56,58,58,186,
+    30,147,211,18,83,39,245,145,190,230,227,215,243,170,239,67,162,255,16,151,151,151,255,88,129,63,228,83,11,55,169,215,
+    246,249,243,231,215,95,245,188,234,57,141,45,232,214,107,214,122,46,213,107,253,238,221,187,174,85,237,125,80,175,115,
+    203,237,107,124,83,171,33,207,169,92,93,93,117,0,0,60,60,102,184,3,0,140,72,5,193,33,17,181,95,17,62,70,23,23,23,11,
+    221,238,251,247,239,221,179,103,207,174,3,249,208,216,62,173,31,181,243,246,237,219,88,248,158,229,252,252,188,91,149,
+    58,38,245,124,42,80,239,237,237,117,79,158,60,185,30,67,84,23,40,214,241,220,22,49,185,82,127,81,67,95,235,186,200,212,
+    98,232,49,26,242,115,235,254,100,5,0,0,227,33,184,3,0,140,72,197,202,90,137,59,68,5,235,49,170,209,31,243,212,72,156,
+    26,197,146,10,237,211,234,83,3,53,174,103,213,97,186,102,205,175,83,69,231,58,95,234,66,69,61,191,49,92,116,105,141,
+    205,67,94,147,58,79,90,207,149,161,175,125,125,106,161,149,224,14,0,240,112,9,238,0,0,35,51,100,188,70,233,199,202,140,
+    205,188,208,89,177,189,86,181,175,227,113,12,221,152,118,81,119,121,252,107,245,123,141,36,170,248,126,151,225,189,53,
+    54,15,57,102,139,92,196,153,54,244,117,31,242,169,133,26,251,3,0,192,195,36,184,3,0,140,76,173,114,31,50,51,186,194,
+    101,235,152,141,117,152,21,58,107,28,202,58,98,123,175,142,81,173,4,95,85,24,31,195,241,175,227,221,135,247,187,24,53,
+    211,58,82,102,232,10,247,33,63,51,228,19,8,67,126,198,10,119,0,128,135,75,112,7,0,24,161,195,195,195,110,136,63,254,
+    248,163,27,155,219,34,116,133,214,117,198,246,201,251,173,153,238,155,174,158,103,69,247,250,4,193,58,173,99,133,251,
+    208,11,27,139,238,39,48,105,200,227,19,220,1,0,30,46,193,29,0,96,132,106,133,251,144,205,83,199,184,194,253,182,96,89,
+    33,248,174,70,176,212,188,251,26,193,146,54,198,227,95,23,53,14,14,14,186,117,121,250,244,105,211,237,135,172,112,31,
+    186,114,127,93,163,104,90,143,1,0,0,155,67,112,7,0,24,169,189,189,189,174,213,125,25,41,83,255,86,27,153,222,165,85,
+    172,252,30,227,12,253,242,249,243,231,235,249,245,235,120,124,181,170,190,213,186,54,64,93,215,248,154,177,205,112,127,
+    242,228,73,215,106,200,235,8,0,128,224,14,0,48,90,59,59,59,93,171,161,115,170,87,109,250,49,173,123,204,201,77,106,133,
+    123,114,149,251,93,204,75,111,81,23,99,94,191,126,221,173,218,144,213,221,151,151,151,77,183,31,122,97,105,29,171,233,
+    199,56,78,102,200,167,101,0,0,24,70,112,7,0,24,169,33,27,167,150,85,140,74,89,214,116,32,109,121,140,21,11,43,98,214,
+    241,168,175,90,61,156,10,136,201,153,247,99,188,208,49,173,142,251,170,199,203,12,9,206,231,231,231,11,223,182,46,42,
+    13,93,169,63,36,212,111,66,112,7,0,96,125,30,119,0,0,140,82,133,187,10,203,235,24,183,177,191,191,223,114,243,235,25,
+    232,45,143,107,242,49,157,158,158,206,125,140,21,214,107,164,206,171,87,175,110,13,152,21,79,143,142,142,150,26,77,83,
+    63,251,233,211,167,46,225,234,234,234,239,199,58,230,213,238,53,94,166,62,61,49,100,100,209,162,234,56,180,28,131,150,
+    139,21,203,28,219,214,159,221,132,113,50,0,0,172,151,224,14,0,48,98,21,158,43,110,183,24,18,36,191,124,249,210,116,251,
+    186,143,150,85,234,147,143,105,214,207,213,243,61,60,60,92,104,117,127,133,205,122,220,117,251,221,221,221,193,243,185,
+    235,241,12,253,52,193,164,250,29,183,173,212,190,105,85,246,244,227,157,188,77,5,232,250,115,93,84,232,191,39,213,42,
+    247,161,27,243,46,98,149,35,76,150,249,36,65,127,140,23,125,124,67,206,41,43,220,1,0,30,54,193,29,0,96,196,134,196,187,
+    49,110,156,58,25,155,111,11,238,21,206,63,124,248,208,181,170,99,244,227,199,143,193,155,130,158,157,157,69,130,251,
+    44,21,120,167,35,111,203,107,219,71,247,26,129,83,23,96,150,93,65,95,63,95,159,14,168,99,190,10,245,220,90,206,195,150,
+    231,147,120,238,139,174,66,111,157,45,95,4,119,0,128,135,205,12,119,0,128,17,219,222,222,238,90,13,157,111,189,74,147,
+    241,245,166,16,91,43,213,135,196,246,94,69,206,247,239,223,119,67,140,241,2,197,180,138,245,117,81,160,198,223,212,42,
+    250,186,192,208,58,6,104,90,141,150,89,213,185,210,26,157,147,193,125,222,121,84,23,88,22,213,50,91,190,55,100,211,88,
+    0,0,54,135,224,14,0,48,98,67,230,65,143,113,126,120,255,152,110,26,173,82,17,121,217,120,92,222,189,123,55,104,148,201,
+    24,55,153,157,167,226,123,93,164,168,32,60,116,69,117,189,14,181,202,125,21,90,31,83,75,248,159,117,129,164,222,47,117,
+    30,204,178,170,217,242,61,43,220,1,0,30,54,193,29,0,96,196,134,206,194,94,102,206,245,42,244,161,125,58,118,214,170,
+    244,161,43,211,167,213,177,26,18,238,199,188,193,233,60,21,119,43,186,15,29,13,83,171,220,87,97,107,107,171,233,246,
+    169,21,238,253,70,195,179,222,55,45,247,213,250,9,128,121,247,13,0,192,230,19,220,1,0,70,108,147,86,203,214,252,241,
+    211,211,211,191,255,94,207,45,61,67,124,232,44,246,177,93,160,104,85,99,84,134,92,184,232,55,141,77,107,253,100,70,75,
+    216,158,23,220,39,191,223,100,85,179,229,203,144,79,164,0,0,176,89,4,119,0,128,145,27,178,98,118,200,236,233,85,171,
+    213,231,147,81,184,34,113,122,53,240,144,153,247,101,140,199,171,85,141,230,25,18,124,39,47,130,164,180,190,174,139,
+    6,247,121,177,188,15,237,179,142,67,75,220,111,93,225,110,156,12,0,0,130,59,0,192,200,109,226,136,138,10,147,111,222,
+    188,233,210,250,145,34,173,238,251,10,247,94,69,247,86,171,88,225,62,100,134,251,34,113,251,242,242,114,230,127,239,
+    47,184,204,186,255,90,181,190,104,72,111,93,225,46,184,3,0,32,184,3,0,108,160,177,7,228,90,221,190,42,15,57,122,214,
+    72,157,214,177,58,45,35,86,90,180,190,14,243,98,122,153,247,88,251,149,237,79,159,62,157,121,187,69,67,250,67,30,41,
+    51,239,24,2,0,112,51,193,29,0,96,228,54,45,32,215,10,244,87,175,94,117,171,50,100,133,123,235,232,144,49,107,13,238,
+    245,220,87,113,129,166,245,117,184,184,184,152,123,155,89,1,124,114,195,210,121,225,123,145,231,59,228,156,16,169,1,
+    0,16,220,1,0,88,171,189,189,189,149,142,201,25,114,129,98,147,130,251,206,206,78,215,106,12,27,167,46,18,193,103,173,
+    112,159,124,221,231,157,3,139,172,92,111,93,221,190,200,253,2,0,176,249,4,119,0,0,214,170,130,59,171,51,150,11,14,171,
+    216,56,117,214,109,38,159,119,221,247,172,227,176,200,24,157,69,70,220,76,154,92,97,15,0,192,195,245,184,3,0,128,53,
+    26,178,2,187,69,109,198,218,122,31,155,52,123,123,44,193,189,245,113,44,178,162,124,86,40,159,126,13,103,197,239,69,
+    158,239,249,249,121,215,98,147,206,33,0,0,134,19,220,1,0,88,155,154,47,190,234,85,192,173,51,204,25,54,62,101,158,173,
+    173,173,166,219,207,139,224,243,30,227,116,240,174,191,223,22,232,23,89,225,222,58,215,222,56,25,0,0,138,145,50,0,0,
+    172,141,85,192,15,71,235,107,61,47,184,207,11,224,211,129,127,214,253,47,114,129,161,117,213,191,224,14,0,64,177,194,
+    29,0,96,228,134,172,62,126,250,244,105,55,70,130,251,63,85,72,174,215,184,190,42,242,78,126,221,164,15,187,245,189,159,
+    27,190,189,189,61,186,249,225,173,143,103,222,121,62,111,85,250,244,185,53,47,128,215,113,159,245,62,105,125,223,57,
+    183,1,0,40,130,59,0,192,200,173,98,190,246,93,25,235,133,128,117,169,200,123,114,114,114,253,85,1,185,143,236,9,253,
+    70,161,99,89,105,157,158,225,62,235,191,223,180,97,105,93,132,152,165,142,255,172,243,177,245,117,105,29,161,179,78,
+    15,253,125,7,0,176,78,130,59,0,192,200,13,9,178,99,91,237,220,123,136,171,128,79,79,79,187,239,223,191,95,127,173,98,
+    86,122,175,206,147,138,200,139,204,39,95,151,138,238,139,62,231,101,102,184,223,116,94,205,123,15,44,19,248,23,125,12,
+    0,0,60,60,130,59,0,192,136,13,13,180,79,158,60,233,198,230,166,85,200,155,170,226,241,215,175,95,175,35,123,173,102,
+    127,168,214,21,220,111,58,175,250,21,255,183,253,92,50,184,63,164,115,27,0,128,217,4,119,0,128,17,155,183,81,228,109,
+    198,56,66,226,161,108,42,121,124,124,220,29,28,28,108,212,40,160,161,90,95,243,89,115,213,91,87,184,247,255,62,36,184,
+    183,190,118,86,183,3,0,208,251,87,7,0,192,104,109,210,56,153,77,95,1,92,1,119,119,119,183,123,251,246,173,216,254,255,
+    90,95,243,139,139,139,27,255,125,214,38,178,229,182,224,61,43,248,207,26,189,211,250,201,146,77,59,183,173,214,7,0,24,
+    78,112,7,0,24,177,33,227,72,198,186,218,118,147,35,222,209,209,81,247,226,197,139,7,61,62,230,38,67,86,184,223,228,236,
+    236,108,230,207,221,182,42,126,214,253,207,138,234,151,151,151,93,139,77,91,225,46,184,3,0,12,39,184,3,0,140,216,144,
+    13,48,173,112,95,175,143,31,63,118,239,223,191,183,170,253,6,173,193,253,182,99,120,126,126,222,13,185,159,121,247,127,
+    91,224,159,119,127,211,140,148,1,0,160,39,184,3,0,140,216,144,224,110,133,251,250,84,108,255,240,225,67,199,205,90,247,
+    18,184,45,184,207,218,203,160,162,250,109,231,214,246,246,118,55,203,109,239,175,214,189,19,182,182,182,58,0,0,40,130,
+    59,0,192,72,85,12,28,178,106,90,112,95,15,177,125,190,214,21,238,183,141,121,153,117,225,105,214,125,204,187,255,219,
+    222,95,54,77,5,0,96,40,193,29,0,96,164,78,79,79,187,33,90,87,21,211,174,194,176,216,62,95,93,100,105,185,208,50,36,128,
+    207,139,221,67,54,78,109,217,52,181,245,57,2,0,176,217,30,119,0,0,140,210,247,239,223,187,86,21,254,172,182,93,189,221,
+    221,221,46,161,94,175,151,47,95,94,71,225,26,127,82,223,251,64,188,232,134,159,211,127,174,113,40,99,186,24,80,207,113,
+    209,21,227,233,21,238,165,222,15,183,253,222,219,254,189,101,133,251,125,120,191,213,107,208,114,78,184,128,0,0,48,156,
+    224,14,0,48,66,21,2,79,78,78,186,86,98,251,234,29,31,31,55,173,128,158,86,49,115,127,127,191,123,245,234,213,117,108,
+    31,98,50,50,223,20,156,199,20,220,235,241,45,122,188,110,186,93,197,239,89,1,124,222,156,246,69,47,92,44,242,239,55,
+    185,15,113,186,30,227,225,225,97,7,0,192,234,9,238,0,0,35,84,243,193,135,216,219,219,235,88,173,161,175,77,169,232,249,
+    254,253,251,7,181,130,184,117,142,251,180,179,179,179,153,255,125,222,177,156,21,228,19,193,221,69,46,0,0,38,9,238,0,
+    0,35,52,100,117,123,153,183,218,151,229,212,92,253,33,171,219,43,58,127,251,246,237,65,198,217,150,224,126,219,10,247,
+    89,230,29,211,39,79,158,220,250,223,234,119,215,8,158,201,125,15,108,152,10,0,192,50,108,154,10,0,48,50,67,71,150,84,
+    216,28,58,162,132,197,212,107,211,170,94,151,31,63,126,60,216,48,219,186,137,111,5,240,73,179,230,183,47,114,76,231,
+    93,132,186,184,184,248,175,191,183,190,247,182,182,182,58,0,0,232,9,238,0,0,35,82,177,111,232,200,18,177,125,245,102,
+    197,223,219,212,60,245,101,199,170,220,103,179,86,152,47,98,86,0,95,100,52,79,29,251,89,183,155,30,89,115,121,121,217,
+    181,176,194,29,0,128,73,130,59,0,192,136,28,29,29,13,222,144,243,205,155,55,29,171,83,163,70,90,131,123,93,4,89,247,
+    235,210,58,18,101,213,90,199,28,157,159,159,255,215,223,103,189,31,22,141,221,45,27,167,78,223,255,44,21,242,31,210,
+    60,126,0,0,230,19,220,1,0,70,162,230,131,127,254,252,185,27,194,56,153,213,155,183,121,231,77,246,247,247,187,117,27,
+    242,56,87,169,53,72,183,140,148,89,244,147,3,179,194,252,116,112,159,190,255,161,191,23,0,128,135,73,112,7,0,24,129,
+    138,126,203,196,217,26,91,194,106,181,172,124,238,221,197,38,182,67,198,222,172,82,235,42,240,201,21,250,245,231,89,
+    43,246,23,61,190,179,238,127,250,120,181,124,66,192,234,118,0,0,166,9,238,0,0,119,172,2,223,238,238,238,224,81,50,181,
+    202,119,103,103,167,99,181,90,86,62,247,238,98,5,244,247,239,223,187,177,25,26,220,231,189,39,158,61,123,214,45,98,86,
+    152,159,190,143,150,247,161,21,238,0,0,76,19,220,1,0,238,208,178,177,189,212,40,153,135,188,41,39,255,81,171,181,79,
+    78,78,186,177,105,9,211,147,239,133,121,23,57,158,62,125,218,45,123,255,211,171,232,91,86,184,11,238,0,0,76,123,220,
+    1,0,112,39,42,44,46,27,219,43,180,31,30,30,118,140,83,197,219,117,142,29,249,248,241,99,55,70,171,88,225,222,18,187,
+    231,93,144,170,251,233,127,95,203,251,113,107,107,171,187,175,234,98,70,255,92,235,245,185,139,241,71,0,0,155,200,10,
+    119,0,128,59,80,27,164,190,120,241,98,169,216,94,222,188,121,99,117,251,136,93,94,94,118,235,114,124,124,60,202,113,
+    50,165,229,28,157,124,79,204,122,127,180,252,206,121,115,228,39,55,154,221,228,145,50,245,220,14,14,14,186,39,79,158,
+    252,189,209,114,125,213,243,168,241,60,111,223,190,93,250,255,73,0,0,15,157,224,14,0,176,70,21,179,94,191,126,125,29,
+    185,90,70,87,220,164,130,153,205,82,215,103,209,241,37,147,214,21,192,251,144,58,86,45,199,110,242,125,49,107,3,216,
+    214,216,61,43,208,247,145,185,117,195,212,251,180,105,234,209,209,209,245,69,190,207,159,63,223,248,60,235,24,212,69,
+    155,10,239,99,253,164,4,0,192,125,32,184,3,0,172,65,197,172,138,88,21,188,82,17,246,199,143,31,29,235,83,171,130,91,
+    173,35,184,247,163,137,150,189,128,179,74,45,199,110,21,43,220,203,172,64,223,223,207,166,174,110,175,255,247,188,127,
+    255,126,225,115,164,46,228,137,238,0,0,195,8,238,0,0,43,82,113,171,86,149,86,12,173,85,163,21,177,82,81,180,230,182,
+    27,37,179,94,67,102,92,215,6,166,171,140,238,53,154,232,166,125,0,246,247,247,187,171,171,171,110,44,90,143,93,255,62,
+    153,21,192,91,63,113,48,235,253,210,175,164,111,25,1,116,95,86,183,87,56,31,242,73,152,250,153,250,255,23,0,0,109,108,
+    154,10,0,16,80,27,16,86,180,171,64,88,223,43,180,174,106,22,242,222,222,158,81,50,119,160,130,109,69,214,214,139,38,
+    53,23,187,126,54,185,34,186,30,67,133,212,26,15,114,147,177,93,140,105,141,211,21,190,231,189,127,90,143,231,172,64,
+    223,191,166,231,231,231,221,162,238,195,10,247,58,134,203,252,191,162,86,197,191,122,245,202,197,61,0,128,6,130,59,0,
+    192,132,10,229,181,26,125,81,235,222,96,176,194,215,151,47,95,58,238,70,93,236,168,57,215,45,42,230,214,42,244,138,227,
+    181,201,237,50,250,79,77,220,54,135,187,183,179,179,115,253,189,206,151,69,206,209,122,78,117,238,247,23,21,42,38,79,
+    126,31,178,186,127,82,63,239,124,209,139,21,21,190,31,61,122,52,247,247,181,152,55,82,166,30,91,93,56,91,212,125,136,
+    208,137,177,48,117,190,125,250,244,169,3,0,96,49,130,59,0,192,148,117,71,244,69,85,224,171,185,237,169,81,22,125,184,
+    29,98,200,104,156,186,175,214,88,61,169,54,154,189,235,139,13,21,178,135,60,135,58,94,53,230,165,126,182,190,183,132,
+    247,250,217,179,179,179,235,209,52,245,243,139,28,251,33,171,175,235,188,239,207,253,155,198,224,244,1,126,232,69,159,
+    250,185,89,155,160,78,170,240,61,235,121,14,121,126,243,2,121,31,221,23,53,100,19,221,117,171,139,40,203,170,115,78,
+    112,7,0,88,156,224,14,0,112,15,244,177,61,185,170,182,226,226,58,47,46,212,253,45,51,195,126,12,23,66,106,133,251,193,
+    193,193,224,231,81,1,180,190,106,84,71,69,227,62,96,79,94,68,233,143,83,63,158,168,53,4,215,99,92,197,124,241,122,12,
+    253,42,248,33,90,130,123,93,148,152,101,200,243,171,159,153,181,226,191,54,52,110,49,246,145,50,253,185,179,172,126,
+    229,255,125,184,192,0,0,48,6,130,59,0,192,200,213,202,238,111,223,190,221,155,77,26,55,89,189,6,21,203,151,157,161,223,
+    199,235,196,10,228,105,239,222,189,251,251,207,139,142,148,89,135,228,249,59,52,118,167,142,199,144,145,54,235,214,178,
+    1,236,60,53,226,71,112,7,0,88,204,191,58,0,0,70,171,226,110,114,140,12,203,171,160,61,214,249,221,117,113,166,190,198,
+    40,121,204,150,9,238,9,54,17,5,0,224,54,130,59,0,192,8,245,35,100,204,78,30,159,186,248,49,214,141,107,167,31,215,152,
+    46,212,36,87,72,111,109,109,117,67,164,198,192,220,135,224,158,60,222,46,248,1,0,44,78,112,7,0,24,153,195,195,195,238,
+    207,63,255,28,237,74,101,254,111,37,121,189,78,99,82,23,103,166,67,240,152,66,233,179,103,207,186,148,187,94,225,62,
+    246,249,237,101,122,111,128,101,126,207,125,120,190,0,0,99,33,184,3,0,140,68,109,20,89,179,146,107,62,184,21,165,227,
+    87,175,211,88,162,123,61,142,26,63,52,102,169,21,215,203,204,79,223,222,222,238,18,238,203,72,153,121,155,207,46,194,
+    133,63,0,128,54,130,59,0,192,29,170,112,88,177,244,226,226,226,122,28,136,217,208,247,203,24,162,123,221,255,109,155,
+    184,142,233,194,205,24,86,151,167,30,195,125,217,64,180,246,27,88,246,28,24,219,39,57,0,0,198,78,112,7,0,88,179,10,96,
+    181,242,180,102,180,91,209,126,255,213,235,119,23,23,75,250,57,255,183,197,246,50,182,243,42,113,140,150,253,29,137,
+    199,112,95,70,172,212,115,93,38,152,215,207,186,8,8,0,208,230,113,7,0,192,74,85,244,172,64,183,179,179,115,61,158,193,
+    136,134,205,83,23,80,234,117,61,62,62,238,62,126,252,216,173,82,157,79,181,114,185,70,200,220,183,11,53,169,153,226,
+    203,168,247,226,95,127,253,213,13,181,204,72,155,187,80,231,201,175,95,191,154,207,203,89,159,156,0,0,224,118,130,59,
+    0,192,18,38,227,91,133,192,126,163,194,250,94,99,39,42,238,89,33,250,48,212,235,92,129,178,226,251,201,201,73,119,116,
+    116,212,253,252,249,179,75,169,160,191,183,183,215,189,121,243,102,225,224,59,182,209,39,117,140,150,61,38,203,174,46,
+    31,195,10,249,117,235,195,249,162,209,189,54,224,29,251,158,0,0,0,99,245,232,127,191,174,90,126,224,234,170,233,230,
+    0,0,240,96,213,74,234,138,239,167,167,167,215,161,185,254,94,171,141,231,233,63,21,81,95,181,209,103,133,246,33,171,
+    170,235,190,191,126,253,122,253,231,233,80,60,29,227,167,87,110,223,180,146,219,197,163,251,173,206,191,138,238,117,
+    94,76,175,242,239,71,93,213,167,39,188,206,0,0,255,241,232,209,163,182,219,119,130,59,0,0,172,77,5,247,250,186,41,120,
+    78,126,193,42,213,5,160,254,226,79,255,233,28,0,0,254,73,112,7,0,0,0,0,128,128,214,224,254,175,14,0,0,0,0,0,88,154,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,252,79,187,118,80,3,0,12,195,48,112,227,15,122,43,135,250,121,39,133,132,21,32,32,184,3,0,0,0,0,64,64,112,
+    7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,
+    1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,
+    119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,
+    1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,
+    64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,
+    16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,
+    0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,
+    0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,
+    0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,
+    0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,
+    130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,
+    128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,
+    32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,238,236,29,0,0,
+    0,0,0,96,197,195,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,
+    0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,124,217,
+    245,105,111,227,91,90,34,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+inline const unsigned char texture_piece_black[4054] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,44,0,0,1,44,8,6,0,0,0,121,125,142,117,0,0,0,9,112,72,89,115,0,0,
+    11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,
+    0,15,107,73,68,65,84,120,1,237,221,61,151,28,197,21,198,241,103,215,9,142,180,202,156,209,250,4,136,140,140,38,35,67,
+    100,118,196,56,35,3,50,136,180,68,224,8,17,153,76,75,230,12,41,179,35,90,25,142,144,50,178,41,62,129,86,153,28,225,190,
+    219,221,171,222,217,158,153,126,239,170,234,255,239,156,171,217,93,141,124,142,197,204,163,91,213,119,170,79,4,220,150,
+    228,117,214,240,120,167,124,172,126,86,169,126,118,200,101,89,187,95,187,188,94,149,223,187,218,239,185,178,128,107,
+    39,194,90,37,121,165,42,130,230,157,242,241,190,110,6,145,15,92,173,126,207,235,121,249,245,115,97,117,8,172,248,37,
+    122,19,68,22,76,169,252,11,165,190,170,240,122,145,87,86,126,127,41,68,139,192,138,75,213,37,89,189,47,63,59,166,169,
+    57,21,193,245,172,124,204,132,104,16,88,97,171,2,234,129,222,116,79,184,45,83,209,133,61,17,93,88,208,8,172,240,88,64,
+    165,121,125,84,126,125,108,179,27,183,101,121,61,213,155,101,36,128,145,88,32,165,121,61,202,235,101,94,127,80,163,214,
+    54,175,199,162,59,5,122,171,66,202,222,72,132,212,124,245,178,252,59,127,32,0,71,165,34,164,124,11,175,84,0,174,165,
+    98,185,231,123,109,85,132,87,34,96,133,108,201,247,121,94,63,43,172,55,46,37,253,154,215,70,92,236,192,10,164,162,155,
+    138,165,170,37,99,34,32,50,169,232,166,98,174,159,197,70,61,2,87,45,251,108,9,17,202,27,143,26,86,91,21,203,69,32,24,
+    22,84,15,197,178,111,205,181,85,17,92,137,0,79,17,84,212,110,109,85,188,38,18,1,158,32,168,168,99,181,85,241,26,225,
+    202,34,22,67,80,81,93,107,43,246,184,176,0,187,34,100,47,190,16,222,36,148,127,181,21,193,133,25,164,98,60,129,26,175,
+    182,98,127,11,19,176,229,223,133,194,122,51,80,225,212,99,17,92,24,201,67,177,79,69,77,95,246,26,123,40,160,167,84,12,
+    125,82,243,215,86,116,91,232,192,150,127,223,41,172,23,57,21,95,217,107,48,17,112,64,42,174,254,81,254,212,86,92,77,
+    68,3,186,42,202,231,122,44,186,45,148,82,209,85,81,254,215,86,156,126,186,106,116,85,84,136,245,80,43,182,214,219,124,
+    37,121,253,164,226,54,89,64,104,92,94,31,148,143,171,114,170,245,169,206,168,34,172,16,170,68,197,107,248,115,173,204,
+    159,180,30,182,4,252,38,175,243,188,222,18,16,54,123,13,127,168,226,117,253,223,188,94,107,5,214,178,36,76,84,124,6,
+    48,17,16,31,167,149,44,17,215,176,36,180,147,21,172,125,78,4,196,41,81,241,26,143,254,92,249,216,151,132,118,69,229,
+    7,177,4,68,252,236,53,254,215,242,235,103,138,84,172,129,101,235,250,127,106,133,155,146,88,189,84,69,199,101,161,21,
+    221,190,86,140,123,88,137,24,89,0,156,34,220,215,138,45,176,18,177,185,14,84,156,34,11,173,152,54,221,83,177,185,14,
+    212,37,42,222,19,169,34,17,203,30,214,39,121,61,17,155,235,192,46,123,79,108,242,122,149,215,47,10,92,12,129,101,87,
+    2,31,9,192,33,31,150,143,65,95,65,12,61,176,44,172,206,5,160,141,180,124,12,54,180,66,14,44,194,10,232,46,45,31,131,
+    12,173,80,3,139,176,2,250,75,203,199,224,66,43,196,192,122,44,6,66,129,161,82,21,3,214,255,81,64,66,11,44,59,112,239,
+    83,1,24,195,123,42,70,31,158,42,16,33,5,150,45,3,191,20,128,49,85,159,8,9,98,121,24,74,96,177,103,5,76,39,45,31,189,
+    15,173,16,2,139,176,2,166,151,150,143,94,135,150,239,129,69,88,1,243,73,203,71,111,67,203,231,192,178,43,129,223,10,
+    192,156,82,21,31,150,126,33,15,249,122,90,67,170,226,212,5,0,203,176,83,30,50,121,198,199,192,74,84,124,194,252,76,0,
+    150,114,153,215,187,242,236,104,26,223,142,151,73,84,116,86,132,21,176,44,123,15,122,119,182,156,79,29,150,253,5,113,
+    158,21,224,151,231,42,150,135,151,242,128,79,155,238,118,179,136,84,0,124,242,151,178,188,152,134,247,37,176,108,124,
+    129,207,7,2,126,242,102,26,222,135,37,161,221,75,237,39,1,240,221,199,42,78,246,93,204,210,129,149,136,43,130,64,40,
+    22,191,114,184,100,96,177,201,14,132,199,169,8,173,69,54,225,151,220,195,250,70,111,206,153,6,16,6,107,52,236,198,22,
+    139,156,163,181,84,96,217,6,251,185,0,132,200,206,209,90,228,46,60,75,44,9,19,177,111,5,132,110,145,253,172,37,2,107,
+    43,246,173,128,24,204,62,84,58,247,146,208,230,173,30,8,64,12,108,160,116,214,253,172,57,59,172,84,156,192,0,196,104,
+    182,147,29,230,10,172,68,30,126,144,18,192,40,156,102,26,117,152,107,73,104,183,146,79,5,32,70,179,141,58,204,209,97,
+    109,84,220,75,16,64,220,38,95,26,78,29,88,137,88,10,2,107,225,52,241,210,112,234,37,161,93,21,100,154,29,88,135,201,
+    151,134,83,118,88,137,138,153,43,0,235,50,217,210,112,202,192,98,64,20,88,39,27,40,125,87,19,152,106,73,200,128,40,176,
+    94,54,80,106,205,80,166,145,77,209,97,37,226,179,130,192,218,217,198,251,61,141,188,1,63,197,93,115,206,69,88,1,107,
+    103,25,240,157,70,54,118,135,149,136,141,118,0,111,140,186,1,63,118,135,197,103,5,1,212,61,212,136,198,12,172,141,184,
+    42,8,224,166,84,35,94,128,27,115,73,200,24,3,128,38,78,35,77,192,143,213,97,109,68,88,1,104,150,104,164,251,142,142,
+    209,97,113,247,27,0,199,140,50,230,48,70,135,245,153,8,43,0,135,89,99,51,184,203,26,218,97,37,226,52,6,0,237,12,238,
+    178,134,118,88,159,136,176,2,208,206,224,46,107,72,135,149,136,238,10,64,55,131,186,172,33,29,86,42,194,10,64,55,131,
+    186,172,33,29,22,115,87,0,250,232,221,101,245,237,176,54,34,172,0,244,99,93,214,70,61,244,237,176,232,174,0,12,209,235,
+    144,191,62,29,150,125,46,40,17,0,244,119,95,61,110,253,215,39,176,62,19,0,12,215,249,36,135,174,75,194,68,156,119,5,
+    96,60,157,206,203,234,218,97,157,11,0,198,211,233,232,153,46,29,150,237,236,111,197,241,199,0,198,211,105,196,161,75,
+    135,101,73,72,88,1,24,83,167,17,135,46,129,197,102,59,128,41,124,212,246,137,109,151,132,137,216,108,7,48,157,86,155,
+    239,109,59,172,115,1,192,116,90,109,190,183,237,176,152,108,7,48,37,219,116,191,123,236,73,109,58,172,84,132,21,128,
+    105,217,230,123,122,236,73,109,2,107,35,0,152,222,39,199,158,208,102,73,248,82,140,51,0,152,222,209,153,172,99,29,22,
+    179,87,0,230,98,89,115,255,208,19,218,4,22,0,204,229,224,178,240,216,146,144,229,32,128,57,29,92,22,30,234,176,82,17,
+    86,0,230,117,112,89,120,40,176,54,2,128,249,237,221,138,58,180,36,100,88,20,192,18,246,14,145,238,235,176,172,37,75,
+    4,0,243,219,187,44,220,23,88,169,0,96,57,105,211,15,247,5,86,235,227,30,0,96,2,141,25,212,180,135,101,237,216,75,1,192,
+    114,26,199,27,154,58,172,131,147,166,0,48,131,198,125,172,166,192,98,186,29,128,15,110,101,81,83,96,189,35,0,88,222,
+    173,44,106,218,195,250,67,0,224,7,155,199,186,222,199,218,237,176,82,1,128,63,110,236,99,157,30,250,77,0,88,216,193,
+    192,74,5,0,254,72,235,223,236,6,22,27,238,0,124,114,35,147,234,155,238,12,140,2,240,209,245,198,123,189,195,98,255,10,
+    128,143,210,234,139,211,166,31,2,128,71,146,234,11,58,44,0,190,187,222,199,170,7,214,219,2,0,255,164,213,23,245,77,119,
+    38,220,1,248,234,42,171,170,14,139,229,32,0,159,37,246,203,105,253,27,0,240,84,106,191,208,97,1,8,193,213,45,7,233,176,
+    0,132,224,234,74,97,21,88,92,33,4,224,179,171,219,126,85,129,117,79,0,224,175,171,14,171,26,107,96,164,1,128,239,78,
+    172,195,74,4,0,254,75,8,44,0,161,56,179,192,58,19,0,248,47,33,176,0,132,226,140,37,33,128,80,208,97,1,8,6,123,88,0,130,
+    113,199,2,139,41,119,0,33,184,123,42,0,8,3,75,66,0,193,120,219,2,235,174,0,32,0,44,9,1,4,195,2,235,142,0,192,127,103,
+    118,90,3,39,53,0,8,2,75,66,0,193,32,176,0,4,131,192,2,16,12,2,11,64,48,8,44,0,193,32,176,0,4,131,192,2,16,12,11,172,
+    75,1,128,255,46,45,176,94,9,0,252,119,201,146,16,64,48,8,44,0,161,184,234,176,182,2,0,255,189,98,15,11,64,48,184,74,
+    8,32,20,91,2,11,64,40,94,17,88,0,66,113,181,233,238,4,0,254,115,116,88,0,66,65,135,5,32,24,151,116,88,0,66,225,78,202,
+    47,184,17,5,0,223,157,84,31,205,249,93,0,224,47,103,191,84,129,245,92,0,224,175,171,166,170,10,44,246,177,0,248,236,
+    234,51,207,116,88,0,66,64,135,5,32,24,87,77,85,21,88,153,0,192,95,206,126,57,169,253,128,209,6,0,190,186,202,170,250,
+    137,163,140,54,0,240,209,245,30,123,61,176,50,1,128,127,174,155,169,122,96,113,165,16,128,143,26,59,44,39,0,240,79,86,
+    125,81,223,116,63,203,235,165,0,192,47,119,85,142,94,213,59,44,251,1,27,239,0,124,226,84,155,19,221,189,47,33,251,88,
+    0,124,242,162,254,205,110,96,101,2,0,127,100,245,111,232,176,0,248,236,70,38,157,236,252,38,27,239,0,124,114,35,163,
+    118,59,44,219,220,202,4,0,203,123,182,251,131,211,134,39,189,16,0,44,239,214,22,85,83,96,61,17,0,44,239,86,22,157,52,
+    60,201,246,177,182,229,35,0,44,229,122,96,180,210,212,97,217,19,184,90,8,96,73,182,127,117,235,96,209,211,61,79,126,
+    42,0,88,78,227,214,212,190,192,202,4,0,203,201,154,126,120,114,224,15,216,60,22,251,88,0,230,230,242,186,215,244,27,
+    167,7,254,208,143,2,128,249,101,251,126,227,80,96,49,222,0,96,9,123,155,165,67,75,66,198,27,0,204,205,174,12,222,221,
+    247,155,167,71,254,32,87,11,1,204,233,224,202,238,80,96,153,11,1,192,124,14,54,73,135,150,132,134,101,33,128,185,28,
+    92,14,154,99,29,22,203,66,0,115,57,122,161,239,88,96,153,11,1,192,244,142,142,82,29,91,18,86,24,34,5,48,37,167,61,195,
+    162,117,109,58,44,195,16,41,128,41,101,109,158,212,182,195,74,243,250,89,0,48,13,235,174,220,177,39,181,237,176,50,241,
+    129,104,0,211,176,227,172,92,155,39,182,13,44,195,213,66,0,83,248,190,237,19,219,46,9,13,51,89,0,198,102,163,83,247,
+    212,112,88,95,147,46,29,150,253,15,178,249,14,96,76,54,123,213,42,172,76,151,14,203,164,98,243,29,192,120,90,109,182,
+    87,186,116,88,38,19,155,239,0,198,97,231,182,187,46,127,160,107,96,153,175,5,0,195,61,82,71,93,151,132,21,219,124,79,
+    4,0,253,56,181,152,108,223,245,39,245,99,65,247,161,0,160,159,47,212,227,118,130,125,59,44,70,28,0,244,229,212,163,187,
+    50,125,59,172,215,121,253,89,197,85,67,0,232,162,87,119,101,250,118,88,134,46,11,64,87,46,175,15,212,241,234,96,165,
+    207,85,194,138,13,123,181,30,169,7,0,21,195,231,78,61,13,233,176,12,93,22,128,182,156,6,116,87,102,72,135,101,232,178,
+    0,180,53,168,187,50,67,59,44,67,151,5,224,24,151,215,187,234,240,185,193,38,125,175,18,214,113,197,16,192,49,118,101,
+    240,23,13,52,70,135,101,172,187,250,85,76,191,3,184,205,169,231,220,213,174,161,123,88,21,107,243,190,16,0,220,54,218,
+    231,143,199,234,176,42,118,244,76,42,0,40,56,141,212,93,153,177,58,172,10,39,57,0,168,251,64,35,26,59,176,50,113,42,
+    41,128,194,133,6,142,49,236,26,123,73,104,24,115,0,96,251,218,54,198,224,52,162,177,59,44,195,48,41,0,203,0,167,145,
+    77,209,97,85,108,204,225,190,0,172,141,211,136,27,237,117,83,116,88,21,198,28,128,117,26,117,163,189,110,140,73,247,
+    125,92,94,119,243,122,79,0,214,194,150,130,255,210,68,166,92,18,26,38,224,129,245,112,26,120,26,195,49,83,46,9,141,109,
+    192,255,93,0,214,192,230,48,157,38,52,229,146,176,226,196,210,16,136,221,133,102,24,28,159,122,73,88,97,105,8,196,203,
+    105,226,165,96,101,234,37,97,133,165,33,16,47,123,111,59,205,96,142,37,97,197,137,165,33,16,27,91,6,94,104,38,115,45,
+    9,43,182,52,180,19,29,24,40,5,194,231,52,209,128,232,62,115,7,150,73,84,236,103,241,89,67,32,92,147,124,86,240,152,57,
+    151,132,21,251,63,250,63,113,171,123,32,100,95,229,245,111,205,108,137,192,50,118,182,51,251,89,64,152,108,154,253,92,
+    11,88,98,73,88,97,212,1,8,143,211,8,119,191,233,107,201,192,50,137,216,207,2,66,177,200,190,85,221,92,115,88,251,56,
+    49,159,5,132,98,182,121,171,125,150,218,195,170,251,77,69,167,151,10,128,175,108,222,234,7,45,204,135,192,50,153,138,
+    121,14,230,179,0,255,92,200,147,243,237,150,222,195,170,99,168,20,240,143,211,130,155,236,187,150,222,195,170,179,191,
+    144,143,181,240,26,25,192,53,167,226,67,205,94,132,149,241,169,195,170,36,226,202,33,176,180,197,175,8,54,241,169,195,
+    170,56,21,157,22,128,229,120,185,218,241,49,176,76,38,198,29,128,165,216,6,123,38,15,249,114,149,176,201,115,49,238,
+    0,204,205,198,23,190,149,167,124,14,44,147,137,208,2,230,98,97,117,46,143,249,30,88,38,19,161,5,76,205,251,176,50,33,
+    4,150,201,68,104,1,83,9,34,172,76,40,129,101,50,49,13,15,140,205,142,138,249,82,129,8,41,176,204,19,113,142,22,48,150,
+    31,243,250,84,1,9,45,176,140,157,114,200,242,16,24,198,150,129,159,43,48,33,6,150,201,68,104,1,125,5,179,103,181,43,
+    212,192,50,153,8,45,160,171,96,195,202,132,28,88,38,19,161,5,180,21,116,88,153,208,3,203,100,121,189,18,119,225,1,14,
+    177,143,186,61,82,224,124,60,173,161,175,52,175,159,196,41,15,64,93,117,108,83,166,8,196,20,88,38,81,113,8,96,34,0,78,
+    197,121,86,78,145,240,245,180,134,190,156,34,251,15,4,244,100,135,7,68,247,94,136,45,176,140,83,113,240,216,143,2,214,
+    201,94,251,81,254,195,29,195,166,123,147,215,42,166,226,185,130,136,181,169,6,66,95,11,65,122,144,215,203,188,254,160,
+    168,136,203,94,227,246,90,143,90,108,155,238,251,36,98,51,30,241,114,90,201,222,109,140,123,88,77,156,138,125,173,239,
+    5,196,197,94,211,222,221,44,98,42,177,238,97,53,177,53,189,125,112,218,134,76,237,180,135,183,4,132,203,230,171,190,
+    82,49,185,190,154,253,170,181,44,9,119,37,98,137,136,112,217,200,194,42,239,225,185,150,37,225,46,167,226,48,192,175,
+    5,132,197,150,128,204,26,174,88,154,215,86,97,93,17,162,214,87,91,49,162,179,170,61,172,125,92,94,79,85,156,100,202,
+    241,203,240,145,117,85,127,203,235,55,1,53,27,209,109,81,254,212,86,116,85,55,208,97,221,100,155,153,214,109,217,197,
+    8,206,141,199,146,232,170,208,73,34,186,45,106,254,250,85,116,85,123,209,97,237,103,115,46,246,175,156,117,91,182,183,
+    197,220,22,166,100,175,183,127,168,232,170,156,128,1,146,188,46,20,214,191,212,84,56,245,88,28,60,137,9,36,98,153,72,
+    141,87,153,88,254,97,6,27,17,92,84,255,218,106,5,39,43,192,63,27,17,92,84,251,178,35,96,206,197,242,15,11,178,23,223,
+    185,8,46,106,127,17,84,240,78,34,130,139,186,89,4,21,188,151,136,165,34,65,69,80,33,64,27,17,92,107,42,27,250,180,243,
+    212,9,42,4,205,174,8,101,10,235,205,71,181,175,76,140,39,32,66,137,138,1,84,110,138,17,126,217,127,67,187,245,123,42,
+    32,114,182,100,216,168,248,176,117,72,111,82,170,232,166,88,246,97,181,18,21,93,215,86,97,189,113,215,84,116,83,64,131,
+    84,44,25,125,10,169,11,17,82,64,43,182,81,127,33,194,107,169,144,98,201,7,244,148,138,101,227,148,33,85,45,247,8,41,
+    207,173,245,54,95,33,179,179,185,82,21,29,216,251,66,87,118,238,212,139,188,158,168,216,64,127,46,4,131,192,10,155,117,
+    4,22,96,15,202,71,2,172,217,51,21,193,244,164,124,188,20,130,68,96,197,39,213,155,46,236,29,173,239,102,177,191,171,
+    8,165,172,124,36,160,34,66,96,197,175,234,194,210,242,49,81,17,100,49,176,112,202,84,132,146,43,191,38,156,34,70,96,
+    173,87,21,94,213,99,85,111,203,47,85,199,116,89,123,204,196,185,231,171,68,96,161,73,82,214,89,89,187,95,171,246,189,
+    185,163,227,87,216,44,104,94,213,190,119,229,207,234,229,26,30,129,107,255,7,115,194,138,255,111,190,47,238,0,0,0,0,
+    73,69,78,68,174,66,96,130,
+};
+
+inline const unsigned char texture_piece_white[6955] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,44,0,0,1,44,8,6,0,0,0,121,125,142,117,0,0,0,9,112,72,89,115,0,0,
+    11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,
+    0,26,192,73,68,65,84,120,1,237,221,63,144,21,215,149,199,241,3,74,216,72,168,156,144,209,160,196,25,88,10,204,38,158,
+    182,18,169,28,152,193,137,119,203,85,98,80,232,192,8,7,246,174,3,49,40,240,122,29,72,194,137,45,87,217,12,4,222,221,
+    196,128,147,93,37,210,35,90,43,144,4,153,9,228,105,178,117,224,210,144,161,192,229,237,223,235,105,120,51,243,102,230,
+    253,185,231,246,189,221,223,79,213,213,27,254,8,9,152,247,155,115,79,159,190,125,196,128,189,138,122,29,159,242,250,
+    252,246,107,251,125,173,246,251,14,178,181,189,118,127,92,213,235,241,246,183,171,137,31,171,182,23,240,212,17,195,80,
+    21,245,42,173,9,154,51,219,175,103,109,103,16,165,160,154,88,143,234,117,127,251,227,251,134,193,33,176,250,175,176,
+    103,65,164,96,42,45,189,80,90,84,27,94,15,234,53,218,254,246,150,161,183,8,172,126,105,171,36,173,21,75,179,98,242,86,
+    89,19,92,247,182,95,71,134,222,32,176,242,214,6,212,170,61,171,158,176,215,200,154,42,236,142,81,133,101,141,192,202,
+    143,2,170,172,215,249,237,143,15,107,118,99,175,81,189,238,218,179,109,36,128,64,20,72,101,189,222,171,215,23,245,250,
+    59,43,232,218,172,215,13,163,58,5,22,214,134,148,222,72,132,84,188,245,197,246,159,249,170,1,56,84,105,132,84,106,225,
+    85,26,128,167,74,99,187,151,250,218,180,38,188,10,3,6,72,91,190,55,235,245,145,229,245,198,101,153,125,86,175,53,227,
+    98,7,6,160,52,170,169,190,172,118,203,88,24,208,51,165,81,77,245,121,125,100,52,234,145,185,118,219,167,45,68,46,111,
+    60,214,114,107,211,154,237,34,144,13,5,213,85,99,219,55,228,181,105,77,112,21,6,36,138,160,98,237,94,155,214,124,78,
+    20,6,36,130,160,98,29,182,54,173,249,28,225,202,34,58,67,80,177,230,93,155,70,143,11,29,208,21,33,125,242,229,240,38,
+    97,165,183,54,141,224,66,4,165,49,158,192,10,183,54,141,254,214,92,56,94,102,54,218,254,105,224,243,162,13,196,201,147,
+    39,237,248,241,227,86,20,197,248,85,223,214,18,125,223,228,235,238,143,167,169,170,106,207,199,91,91,91,246,232,209,
+    163,29,175,90,15,30,60,24,191,14,200,70,189,174,25,103,216,31,138,192,58,220,85,107,230,169,122,215,48,109,131,232,236,
+    217,179,118,230,204,153,167,31,235,251,181,186,118,255,254,253,113,184,41,204,244,170,32,235,113,152,233,55,165,47,138,
+    215,12,251,34,176,246,87,214,235,93,107,14,201,203,158,2,104,101,101,101,28,76,90,10,166,195,170,162,84,41,188,20,102,
+    10,175,123,247,238,245,45,196,170,122,125,211,168,182,166,34,176,246,106,175,254,189,105,25,83,181,116,254,252,249,113,
+    56,149,101,153,109,56,205,170,173,198,238,222,189,251,180,18,203,156,170,173,235,70,112,237,64,96,237,84,90,166,55,180,
+    170,130,82,64,125,227,27,223,176,213,213,213,36,182,116,93,82,120,169,250,26,141,70,227,87,109,43,51,84,89,179,69,220,
+    48,140,17,88,141,44,171,42,109,241,218,165,42,10,251,83,5,166,224,186,121,243,102,142,213,215,134,209,148,31,35,176,
+    50,171,170,20,78,170,164,46,94,188,56,248,42,106,81,109,245,165,240,210,107,38,170,122,93,178,129,63,182,108,200,129,
+    149,77,85,213,86,81,151,47,95,38,164,2,107,195,235,250,245,235,185,84,94,235,54,224,43,137,67,13,172,162,94,183,45,225,
+    43,128,10,166,215,95,127,125,92,77,177,221,139,67,219,70,5,87,6,61,175,202,6,122,37,113,136,129,165,138,74,149,85,146,
+    165,74,91,73,233,149,106,170,59,218,46,38,190,101,212,28,135,42,173,247,108,64,134,20,88,201,110,1,169,166,210,165,45,
+    227,181,107,215,236,214,173,91,150,168,118,216,116,16,183,6,12,37,176,10,107,238,1,44,44,33,10,170,31,252,224,7,244,
+    166,50,208,206,120,105,203,152,224,118,177,178,129,108,17,135,16,88,58,89,65,87,1,147,73,4,13,113,42,168,184,210,151,
+    39,109,21,85,117,37,22,92,170,176,116,21,241,142,245,88,223,3,75,91,192,117,75,132,130,234,173,183,222,26,7,21,242,151,
+    104,112,173,91,143,175,34,246,53,176,84,182,232,62,192,53,75,0,65,213,111,9,6,215,70,189,174,88,15,251,90,125,12,172,
+    194,18,25,89,160,71,53,44,137,5,87,101,61,236,107,245,45,176,10,75,160,185,78,80,13,151,154,243,10,174,183,223,126,219,
+    18,80,89,207,66,171,79,129,85,90,83,89,117,154,16,154,159,186,113,227,198,211,195,238,48,76,9,141,67,104,91,120,193,
+    122,114,75,79,95,2,75,205,161,13,235,144,250,84,191,249,205,111,152,163,194,14,26,133,184,114,229,74,10,219,68,245,180,
+    178,31,50,125,206,242,167,43,129,157,253,69,104,203,247,163,31,253,200,126,251,219,223,218,87,191,250,85,3,38,233,115,
+    66,173,1,233,120,106,254,181,237,215,108,238,246,158,38,247,10,171,211,177,5,182,127,152,135,182,137,111,188,241,70,
+    215,193,181,110,25,143,61,228,92,97,117,22,86,170,170,126,250,211,159,218,47,127,249,75,154,234,152,153,62,87,218,97,
+    225,143,63,254,216,158,60,121,98,29,40,183,95,179,172,180,114,173,176,58,11,43,170,42,132,144,64,181,181,110,25,86,90,
+    57,86,88,186,205,38,250,13,204,84,85,8,169,173,182,164,163,208,42,173,185,162,254,129,101,36,183,10,75,211,235,209,195,
+    74,87,0,127,255,251,223,143,31,232,0,132,166,106,235,149,87,94,233,234,74,226,134,53,247,32,102,33,167,10,75,219,192,
+    127,177,200,52,0,250,187,223,253,174,247,79,157,65,119,218,106,75,61,45,245,182,34,107,239,8,201,162,167,149,75,96,69,
+    239,89,181,91,192,171,87,175,218,177,99,199,12,240,164,207,177,215,94,123,173,171,134,124,185,253,154,124,104,229,176,
+    37,140,30,86,170,166,62,252,240,67,26,235,232,68,135,91,196,117,75,188,17,159,122,133,21,61,172,116,21,80,97,117,226,
+    196,9,3,186,208,62,99,82,129,245,240,225,67,139,168,220,126,77,182,210,74,57,176,212,92,255,153,69,164,35,96,52,178,
+    192,22,16,93,83,104,125,247,187,223,29,127,28,249,42,98,105,205,205,210,73,62,66,40,213,192,42,235,245,31,22,145,110,
+    173,105,111,161,0,82,161,123,83,21,94,31,124,16,117,250,64,167,244,42,37,43,75,76,138,61,172,162,94,159,89,164,83,23,
+    244,201,160,45,32,35,11,72,153,158,153,120,225,194,133,152,125,45,157,242,240,53,75,44,180,82,11,172,194,34,158,103,
+    69,115,29,57,233,160,25,95,89,98,231,105,29,181,116,168,162,138,22,86,170,168,8,43,228,164,131,47,176,133,37,112,198,
+    220,164,148,2,75,71,196,20,22,1,97,133,92,41,180,62,253,244,211,152,45,12,13,150,190,107,137,72,37,176,52,190,16,229,
+    9,13,122,96,169,194,138,251,1,145,43,125,238,42,180,244,185,28,201,154,53,239,209,206,165,112,149,80,87,36,126,101,17,
+    232,47,152,177,5,244,197,234,234,234,184,175,165,134,124,4,165,53,163,14,127,178,14,117,29,88,69,189,254,187,94,238,
+    9,210,134,21,208,39,145,67,75,167,150,254,151,117,248,248,176,46,3,75,123,178,255,173,151,251,72,57,97,133,62,139,24,
+    90,42,44,180,35,186,89,175,78,78,31,236,50,176,254,205,158,157,51,237,134,176,194,16,68,12,45,21,26,10,174,78,206,209,
+    234,42,176,116,219,205,186,57,35,172,48,36,17,67,235,92,189,30,215,235,143,22,89,23,131,163,133,69,152,100,215,101,95,
+    93,73,1,134,100,107,107,107,60,92,26,33,180,58,153,132,239,98,172,65,195,161,174,97,213,14,216,1,67,19,241,86,51,189,
+    135,163,15,149,198,14,44,205,114,20,230,168,13,43,230,172,48,84,250,220,215,145,222,17,6,163,53,84,26,117,62,43,230,
+    150,176,180,166,186,114,195,189,129,192,51,234,103,189,252,242,203,227,109,162,51,221,111,56,178,8,98,5,86,97,17,238,
+    19,140,124,203,2,144,60,245,178,94,122,233,37,115,86,89,211,207,114,79,198,88,91,194,117,115,14,171,119,222,121,135,
+    176,2,118,209,123,66,103,189,57,43,44,210,214,48,198,88,195,154,57,255,102,116,82,232,143,127,252,99,3,176,215,217,179,
+    205,131,113,156,79,46,213,168,131,251,161,127,222,91,194,194,156,183,130,58,251,90,13,70,0,7,211,184,131,115,104,85,
+    230,188,53,244,222,18,234,204,225,194,156,168,201,254,238,187,201,156,124,1,36,45,194,149,195,194,156,119,83,158,21,
+    86,81,175,77,115,210,30,177,193,21,65,96,118,145,174,28,186,93,53,244,236,97,185,78,179,235,33,167,175,190,250,170,1,
+    152,157,190,208,235,120,37,231,135,90,168,105,246,190,57,240,10,44,149,133,171,230,68,143,143,215,19,153,1,204,239,220,
+    185,115,227,10,75,79,152,118,162,19,88,180,123,27,89,96,30,91,194,194,28,171,43,245,173,62,249,228,19,38,217,129,37,
+    40,176,52,159,229,248,64,11,237,57,79,89,224,6,188,71,211,125,221,28,183,130,220,118,3,44,79,239,161,219,183,111,123,
+    190,151,244,11,7,191,34,22,122,75,88,212,203,237,60,23,205,91,105,140,1,192,242,78,156,56,225,221,207,82,47,43,232,108,
+    86,232,45,161,174,10,22,230,96,101,101,133,19,24,0,7,206,243,89,35,107,174,26,6,17,50,176,214,204,169,186,98,132,1,240,
+    19,97,212,225,66,189,238,88,0,33,183,132,110,103,227,48,194,0,248,137,48,234,160,219,118,130,156,3,31,170,194,90,51,
+    167,234,138,173,32,16,135,243,214,240,154,5,56,22,61,68,96,169,170,210,24,67,97,14,254,252,231,63,179,21,4,34,112,222,
+    26,6,25,115,8,177,37,212,49,9,46,67,162,92,21,4,226,209,214,240,201,147,39,94,85,150,158,180,243,165,45,57,76,186,108,
+    133,85,152,211,105,12,26,16,253,252,243,207,13,64,60,206,3,165,75,87,89,203,14,142,94,52,167,173,160,14,228,3,16,151,
+    170,44,199,71,227,169,125,244,166,45,97,153,192,42,172,105,182,7,119,241,226,69,182,130,64,71,116,161,75,203,137,142,
+    156,90,120,154,96,153,45,225,154,57,93,25,164,209,14,116,203,185,1,191,240,21,195,101,154,238,46,115,87,52,218,129,238,
+    57,55,224,219,227,103,230,158,203,90,116,75,184,102,78,141,246,181,181,53,3,208,189,203,151,47,123,221,28,173,95,116,
+    205,22,176,104,133,229,82,93,169,209,238,184,119,6,48,7,77,191,59,86,89,58,51,107,238,67,254,22,233,97,105,230,234,182,
+    5,198,24,3,144,30,231,49,135,185,143,82,94,100,75,120,217,28,168,119,5,32,45,218,18,58,158,238,59,247,47,60,111,133,
+    85,152,195,131,37,168,174,128,180,157,62,125,58,137,42,107,222,10,107,221,28,80,93,1,105,115,172,178,230,186,173,111,
+    158,10,75,77,246,77,11,220,108,167,186,2,242,224,84,101,205,117,187,206,60,21,150,146,208,101,238,10,64,250,52,230,224,
+    96,174,17,135,121,42,44,29,33,115,214,2,162,186,2,242,161,43,134,47,190,248,162,199,244,251,200,102,60,70,121,214,10,
+    171,176,192,97,37,122,190,32,128,60,232,138,161,211,123,182,220,94,135,154,181,194,218,176,230,100,134,160,184,103,16,
+    200,139,99,149,117,221,102,56,201,97,214,10,43,248,248,185,78,100,32,172,128,188,168,202,122,253,245,215,205,193,76,
+    5,209,44,129,85,154,195,125,131,60,106,30,200,211,234,170,203,1,195,106,190,151,135,253,164,89,2,107,205,2,211,253,130,
+    84,87,64,158,28,207,203,58,180,202,154,37,176,130,159,245,162,237,32,128,124,57,141,56,28,58,58,117,88,211,61,248,141,
+    206,140,50,0,249,115,108,190,31,120,171,206,97,21,86,240,205,42,199,199,0,249,235,170,249,126,88,96,5,223,14,50,123,
+    5,244,131,83,243,253,192,109,225,65,129,85,90,224,91,113,206,156,57,99,103,207,6,159,63,5,208,1,167,230,187,50,103,223,
+    144,56,40,176,214,44,48,167,70,29,128,142,56,181,120,246,45,221,14,106,186,235,100,134,194,2,98,178,29,232,23,53,221,
+    191,242,149,175,88,96,234,228,191,48,237,7,246,171,176,84,146,21,22,16,179,87,64,255,168,249,30,115,91,184,95,96,149,
+    22,24,179,87,64,63,57,61,150,175,156,246,157,251,109,9,63,178,192,161,197,118,16,232,39,167,109,225,200,166,28,57,51,
+    173,194,154,233,158,158,121,232,234,32,97,5,244,147,211,182,80,91,194,61,83,10,71,247,249,137,65,177,29,4,250,45,86,
+    31,107,90,96,49,221,14,96,46,101,89,154,131,61,89,52,173,135,21,180,127,197,189,131,192,48,168,143,21,248,222,194,145,
+    237,234,99,77,171,176,74,11,136,234,10,24,134,111,127,251,219,22,88,105,187,250,88,71,167,252,132,160,8,44,96,24,156,
+    222,235,59,250,88,71,15,250,193,16,156,246,182,0,18,227,116,51,244,129,129,85,90,64,140,51,0,195,161,241,6,135,247,123,
+    57,249,141,221,129,117,198,2,226,100,6,96,88,28,166,222,119,100,210,100,96,169,185,85,88,64,78,35,251,0,18,165,93,85,
+    96,133,77,52,222,39,3,43,120,57,196,118,16,24,22,167,158,117,217,126,112,116,218,119,134,160,253,44,91,66,96,88,52,119,
+    169,247,126,232,95,182,253,192,173,194,114,40,13,1,100,192,97,188,225,105,152,76,6,86,208,253,27,243,87,192,48,121,94,
+    41,116,171,176,216,14,2,195,228,208,199,42,218,15,218,192,10,158,46,4,22,48,76,78,237,160,66,255,56,58,249,141,80,156,
+    6,200,0,100,192,169,241,94,234,31,46,21,22,13,119,96,216,28,10,150,113,2,186,84,88,4,22,48,108,14,25,48,254,5,219,192,
+    10,26,135,42,9,1,12,151,67,15,123,252,216,175,54,176,78,89,64,4,22,48,108,14,25,224,87,97,209,112,7,134,205,233,158,
+    194,241,17,201,250,96,211,2,250,219,223,254,102,0,134,203,233,209,95,167,84,97,21,22,144,195,229,76,0,153,113,26,109,
+    58,174,192,10,154,48,92,33,4,32,30,55,65,7,15,44,42,44,0,226,208,120,63,206,150,16,128,139,231,159,127,222,2,11,95,97,
+    113,133,16,128,120,85,88,108,9,1,4,231,80,188,60,175,192,98,202,29,64,14,94,56,106,129,57,236,91,1,100,232,212,169,160,
+    55,208,72,248,45,33,0,56,57,169,192,122,193,2,114,72,85,0,25,242,184,0,23,124,75,8,0,94,20,88,52,157,0,228,224,184,110,
+    126,254,187,5,196,141,207,0,90,207,61,247,156,133,196,150,16,64,54,8,44,0,217,32,176,0,100,131,192,2,144,13,2,11,64,
+    54,8,44,0,217,32,176,0,100,67,129,181,101,1,61,122,244,200,0,160,170,42,11,108,75,129,245,216,0,32,125,91,108,9,1,100,
+    35,120,96,109,110,6,125,196,33,128,76,57,180,135,198,21,22,9,3,32,7,143,131,247,176,104,186,3,16,61,253,57,180,224,87,
+    9,1,64,28,174,18,110,6,15,44,135,255,73,0,25,114,168,176,30,51,135,5,192,133,215,28,86,101,1,121,236,91,1,228,231,241,
+    227,224,35,158,21,91,66,0,46,28,138,151,240,21,150,67,170,2,200,208,131,7,15,44,176,45,157,233,94,88,224,89,172,191,
+    254,245,175,60,178,30,24,184,208,231,185,215,78,5,175,176,132,42,11,24,182,251,247,239,155,131,170,189,53,39,232,165,
+    61,167,255,89,0,153,112,152,22,168,244,143,54,176,130,38,12,141,119,96,216,28,50,96,156,128,109,96,5,109,231,59,52,219,
+    0,100,196,99,202,93,255,112,169,176,216,18,2,195,230,80,180,248,85,88,76,187,3,195,230,16,88,227,42,168,13,172,145,5,
+    164,129,49,66,11,24,38,109,7,29,134,70,43,253,227,232,228,55,66,98,91,8,12,147,83,15,123,71,133,37,65,75,162,209,104,
+    100,0,134,199,161,88,121,250,11,78,6,214,200,2,98,75,8,12,211,189,123,247,44,176,167,97,50,25,88,65,99,209,225,127,26,
+    64,6,188,26,238,50,25,88,149,5,68,227,29,24,30,109,7,29,26,238,163,246,3,183,45,225,248,23,164,143,5,12,138,83,145,50,
+    181,194,82,44,114,79,33,128,133,221,185,115,199,2,171,108,98,78,116,247,115,9,131,38,204,31,254,240,7,3,48,28,14,253,
+    171,29,191,224,238,192,26,89,64,78,3,100,0,18,164,247,187,67,96,141,38,191,225,90,97,201,221,187,119,13,64,255,57,77,
+    6,236,200,36,247,192,98,188,1,24,6,167,139,108,163,201,111,28,153,242,19,62,170,87,105,129,232,168,100,29,153,12,160,
+    223,78,159,62,29,250,42,161,170,157,114,242,59,142,78,249,73,65,55,161,234,97,81,101,1,253,166,137,0,135,145,134,61,
+    59,190,105,129,21,252,186,36,243,88,64,191,57,21,37,123,178,104,90,96,41,213,130,94,218,163,194,2,250,237,230,205,155,
+    230,96,79,133,117,100,159,159,24,180,143,37,60,250,11,232,39,141,51,188,248,226,139,22,216,158,254,149,28,221,231,39,
+    7,159,69,112,74,96,0,29,139,181,29,148,253,2,107,100,129,49,143,5,244,147,83,49,50,154,246,157,71,14,248,23,190,168,
+    87,208,61,28,219,66,160,95,156,182,131,85,189,78,77,251,129,163,7,252,75,193,99,243,250,245,235,6,160,63,156,182,131,
+    163,253,126,224,160,192,10,62,222,192,213,66,160,95,156,138,144,125,139,165,131,182,132,218,187,109,90,224,109,225,135,
+    31,126,104,43,43,43,6,32,111,26,22,125,249,229,151,45,48,141,84,189,176,223,15,30,61,228,95,12,222,41,119,56,47,7,64,
+    7,156,170,171,3,3,226,160,10,75,74,107,102,178,130,81,211,253,243,207,63,167,249,14,100,206,225,222,65,185,96,7,132,
+    214,65,21,150,4,159,122,231,222,66,32,127,26,101,112,8,43,101,205,129,21,214,97,129,229,178,45,228,106,33,144,55,167,
+    217,171,67,251,69,135,109,9,165,180,192,219,66,161,249,14,228,201,105,246,74,190,105,135,12,173,31,86,97,217,246,47,
+    16,252,156,99,154,239,64,158,174,93,187,102,14,42,155,225,14,155,89,42,44,121,175,94,151,45,32,154,239,64,126,28,171,
+    171,141,122,93,58,236,39,205,82,97,73,240,114,72,205,119,122,89,64,94,28,239,9,158,169,108,155,181,194,146,224,71,206,
+    80,101,1,121,113,26,101,208,52,194,215,102,249,137,179,86,88,18,60,90,85,101,113,236,12,144,7,167,81,6,153,121,171,53,
+    79,133,229,114,171,78,81,20,227,42,11,64,218,156,170,43,93,208,59,101,51,94,216,155,167,194,210,47,24,188,28,82,19,143,
+    42,11,72,155,99,117,165,254,248,204,83,8,243,84,88,82,154,195,76,22,85,22,144,54,167,234,74,84,93,85,179,254,228,121,
+    42,44,25,153,195,105,164,84,89,64,186,28,171,43,221,163,87,205,243,47,204,91,97,73,105,78,85,214,39,159,124,194,21,67,
+    32,49,142,213,213,129,55,58,79,51,111,133,37,35,155,51,21,103,161,42,139,185,44,32,45,142,213,85,101,11,204,119,46,82,
+    97,201,155,245,122,215,2,99,46,11,72,135,138,136,87,94,121,197,43,176,52,213,190,97,115,90,164,194,178,237,255,80,240,
+    251,11,153,126,7,210,113,235,214,45,207,234,106,195,22,176,104,133,37,235,245,186,106,129,169,186,250,244,211,79,237,
+    228,201,147,6,160,27,142,247,12,202,66,213,149,44,90,97,137,110,136,118,169,178,46,93,58,244,30,72,0,142,156,78,100,
+    144,202,150,152,52,88,38,176,20,86,46,251,55,157,72,202,169,164,64,55,116,131,179,182,131,78,52,191,84,217,130,150,217,
+    18,138,203,237,58,194,152,3,208,13,199,49,134,202,154,67,250,42,91,208,115,182,156,39,245,250,7,11,124,138,131,104,107,
+    120,236,216,49,43,203,210,0,196,241,246,219,111,123,30,33,163,29,217,82,71,85,45,91,97,137,91,149,69,3,30,136,199,185,
+    209,94,89,115,132,204,82,125,239,101,122,88,45,183,94,22,13,120,32,158,55,222,120,195,28,169,139,191,244,69,186,101,
+    183,132,45,29,192,245,79,230,80,101,105,47,173,74,235,220,185,115,6,192,135,230,31,127,253,235,95,155,147,202,102,56,
+    254,120,22,33,182,132,173,213,122,221,54,7,108,13,1,63,218,10,234,145,243,218,209,56,89,120,238,106,183,16,91,194,150,
+    154,105,35,115,192,214,16,240,163,173,160,99,88,85,22,40,172,36,212,150,176,165,107,161,107,230,128,173,33,16,158,174,
+    10,58,31,237,180,116,163,125,82,200,45,97,107,163,94,23,205,129,2,75,15,96,61,115,230,140,1,88,142,243,85,65,217,176,
+    64,189,171,150,71,96,185,141,57,8,3,165,192,242,180,5,124,233,165,151,188,6,68,199,255,9,107,170,171,202,2,10,189,37,
+    20,183,97,82,209,31,244,151,95,126,105,175,190,250,170,1,88,204,79,126,242,19,251,224,131,15,204,209,191,155,195,243,
+    76,61,2,75,70,214,92,53,60,97,14,62,254,248,99,250,89,192,130,52,194,160,222,149,163,202,154,211,68,131,243,216,18,182,
+    74,115,56,74,185,197,168,3,48,191,8,35,12,50,215,131,37,230,17,114,172,97,183,145,57,77,192,139,254,192,117,26,162,243,
+    31,60,208,27,237,9,162,206,239,25,189,231,43,115,226,25,88,178,110,142,255,243,250,11,248,206,119,190,99,0,14,247,195,
+    31,254,208,179,201,46,149,53,231,228,185,241,234,97,181,212,128,127,96,78,179,89,162,191,128,35,71,142,216,202,202,138,
+    1,152,78,61,171,247,223,127,223,156,93,49,167,225,241,150,119,96,73,85,175,23,234,229,214,33,215,97,127,167,78,157,98,
+    62,11,152,66,77,118,93,21,116,182,97,205,13,206,174,60,155,238,147,52,52,245,89,189,10,115,164,38,60,161,5,60,243,224,
+    193,131,241,188,149,179,202,150,60,152,111,86,222,61,172,150,186,124,238,55,3,58,62,146,8,200,142,122,188,23,46,184,
+    76,23,236,166,247,118,101,17,196,10,44,25,153,227,85,67,105,175,28,18,90,24,58,231,103,10,78,210,54,112,100,145,196,
+    218,18,182,180,53,212,108,214,89,115,164,109,161,238,57,228,246,29,12,81,132,219,110,90,149,53,51,87,209,196,14,44,41,
+    172,233,103,185,166,9,161,133,161,82,88,169,119,229,204,229,94,193,195,196,184,74,184,155,126,163,95,214,235,53,115,
+    244,151,191,252,101,188,206,159,63,111,192,80,232,108,43,231,123,4,91,255,90,175,255,177,200,186,8,44,249,163,57,143,
+    58,136,190,202,168,44,38,180,48,4,10,43,231,179,173,90,234,69,175,91,7,186,10,44,81,104,185,156,3,63,137,208,194,16,
+    68,12,171,170,94,255,108,205,80,120,116,93,6,150,126,195,122,0,218,90,189,142,153,35,66,11,125,22,49,172,212,206,249,
+    199,122,253,159,117,164,203,192,18,253,1,60,180,166,210,114,69,104,161,143,34,134,149,168,178,250,163,117,168,235,192,
+    146,63,89,115,181,178,52,103,132,22,250,66,163,11,223,255,254,247,99,134,149,230,173,126,101,29,235,98,172,97,63,27,
+    230,116,22,252,110,140,60,32,103,237,128,116,132,209,133,214,134,69,184,83,101,22,41,5,86,148,161,210,150,206,134,87,
+    104,113,0,32,114,210,30,169,20,49,172,42,11,252,228,155,101,164,20,88,82,88,19,90,133,69,64,104,33,39,17,111,183,121,
+    250,159,180,72,55,53,207,42,230,189,132,179,168,172,249,3,138,146,230,237,39,64,196,175,86,192,66,244,57,170,163,141,
+    35,134,149,222,131,73,133,149,164,22,88,82,153,211,1,246,83,255,99,117,104,233,86,6,157,25,4,164,232,214,173,91,227,
+    207,209,200,199,129,235,61,88,89,98,82,184,74,56,77,101,205,83,164,87,45,18,221,206,192,201,165,72,141,78,10,189,114,
+    229,138,69,166,255,224,127,90,130,82,13,44,185,111,145,198,29,90,58,185,84,165,183,30,31,198,21,68,116,73,213,212,183,
+    190,245,173,152,99,11,45,141,47,252,204,18,149,90,211,125,154,245,122,93,181,136,104,198,163,75,29,52,215,91,10,171,
+    117,75,88,202,21,86,107,100,145,43,45,125,117,211,87,182,99,199,142,241,176,86,68,165,94,234,247,190,247,189,241,73,
+    35,145,37,31,86,146,67,96,201,200,34,135,214,147,39,79,198,125,173,199,143,31,219,215,191,254,245,113,120,1,94,244,69,
+    82,15,138,80,207,74,159,123,145,101,17,86,146,195,150,112,210,134,69,154,134,159,196,22,17,158,212,55,213,217,235,29,
+    29,237,173,203,227,111,90,38,82,28,107,56,200,154,57,159,11,63,141,122,10,167,79,159,30,127,245,3,66,210,22,176,195,
+    231,16,168,163,159,77,88,73,110,21,86,107,221,34,55,226,91,26,123,184,113,227,6,213,22,150,162,47,130,58,105,65,87,166,
+    59,146,205,54,112,82,46,61,172,221,70,22,185,167,213,210,87,66,26,242,88,70,219,88,127,248,240,161,117,36,203,176,146,
+    92,43,172,214,186,117,84,105,9,213,22,230,145,64,85,37,217,134,149,228,90,97,181,70,214,81,165,37,170,182,244,213,146,
+    9,121,28,68,87,0,127,254,243,159,143,195,170,195,170,74,178,14,43,201,189,194,106,169,113,248,174,117,72,87,18,223,121,
+    231,29,14,7,196,14,170,166,46,93,186,148,194,195,125,117,158,213,134,101,174,47,129,37,101,189,110,155,243,67,45,14,
+    115,241,226,69,187,122,245,42,219,196,129,75,100,251,39,186,99,90,55,50,143,172,7,250,20,88,82,88,196,243,180,14,162,
+    208,82,120,17,92,195,162,237,223,47,126,241,139,113,171,32,242,233,10,211,84,150,224,17,49,203,232,91,96,73,97,137,132,
+    150,182,137,111,189,245,214,56,184,208,111,137,5,149,232,240,128,36,143,136,89,70,31,3,75,180,45,124,207,58,152,138,
+    159,134,224,234,55,141,185,92,187,118,45,133,62,85,171,29,8,77,34,57,67,202,253,42,225,126,116,51,214,29,235,240,10,
+    226,36,125,197,189,123,247,238,248,32,54,29,91,115,246,108,148,99,235,225,76,65,165,243,213,245,247,170,123,78,19,161,
+    43,129,10,171,78,30,116,234,173,175,21,214,36,29,2,120,195,58,110,198,79,162,226,202,87,123,146,135,182,126,9,85,84,
+    162,106,74,87,2,239,88,143,13,33,176,164,176,68,250,90,147,20,92,151,47,95,30,143,66,208,156,79,91,130,61,170,73,149,
+    245,172,185,190,159,161,4,150,168,194,90,175,215,101,75,16,227,16,105,210,88,194,157,59,119,198,219,190,4,131,74,116,
+    24,192,186,245,176,95,53,205,144,2,171,165,253,189,110,231,73,242,12,100,77,204,43,188,216,46,118,71,193,164,160,82,
+    53,149,192,28,213,126,20,80,234,87,189,103,3,50,196,192,146,194,18,220,34,78,210,118,81,225,165,45,163,158,84,13,127,
+    25,84,83,173,94,142,44,204,98,168,129,213,90,183,14,111,158,158,149,2,75,193,85,150,37,91,198,192,218,222,212,104,52,
+    74,185,154,154,52,168,45,224,110,67,15,44,41,173,185,138,88,88,6,218,45,35,225,181,184,246,74,159,70,77,50,9,41,169,
+    172,185,10,56,178,1,35,176,26,133,53,95,181,178,106,28,169,242,106,195,139,109,227,193,20,76,90,25,85,82,147,6,93,85,
+    77,34,176,118,90,179,102,139,88,88,102,218,158,151,22,213,215,179,97,93,133,147,94,19,239,73,237,167,50,170,170,29,8,
+    172,189,10,107,174,36,38,57,254,48,43,85,92,154,168,215,140,151,194,172,239,21,152,134,56,85,61,221,191,127,127,28,80,
+    137,13,117,46,130,170,106,10,2,107,127,133,37,126,37,113,30,186,37,72,161,165,10,76,65,166,149,107,21,166,48,82,48,41,
+    160,244,177,170,168,76,43,168,105,116,5,80,143,138,31,25,246,32,176,14,183,110,77,181,213,187,103,215,183,33,166,165,
+    42,172,93,41,84,99,10,32,221,159,167,96,210,217,82,122,20,150,62,86,64,245,40,156,38,233,55,213,86,85,216,7,129,53,155,
+    194,50,108,202,47,163,13,51,189,106,169,26,211,171,2,77,175,162,143,91,135,85,107,147,91,52,5,208,238,215,54,136,244,
+    177,94,123,176,165,155,199,134,53,85,21,219,63,4,85,212,107,179,94,127,103,177,2,172,145,37,112,154,8,250,111,205,8,
+    46,214,226,107,211,154,83,68,128,168,214,140,224,98,205,190,190,176,166,181,208,187,126,40,242,209,158,2,177,105,121,
+    189,121,88,241,22,65,133,228,20,70,112,177,118,46,130,10,201,43,140,173,34,65,69,80,33,67,107,70,112,13,105,125,102,
+    205,93,18,4,21,178,166,43,66,35,203,235,205,199,154,125,141,140,241,4,244,80,97,205,144,160,182,12,57,189,33,89,123,
+    151,254,14,117,218,103,105,64,207,105,203,176,102,205,125,99,57,189,73,89,77,53,197,182,15,131,85,88,83,117,109,90,94,
+    111,220,33,45,170,41,96,138,210,216,50,166,20,82,27,70,72,1,51,81,163,126,195,8,175,174,66,138,45,31,176,160,210,216,
+    54,122,134,84,187,221,35,164,18,199,241,50,249,57,107,205,155,75,21,216,138,97,94,58,194,229,129,53,143,116,31,89,115,
+    225,3,153,32,176,242,166,138,64,1,182,186,253,74,128,77,167,167,78,40,152,238,108,191,114,238,84,166,8,172,254,41,237,
+    89,21,166,163,67,11,27,22,157,252,167,80,26,109,191,18,80,61,66,96,245,95,91,133,149,219,175,133,53,65,214,7,10,167,
+    145,53,161,84,109,127,76,56,245,24,129,53,92,109,120,181,175,237,58,105,105,105,43,166,173,137,215,145,13,240,49,237,
+    32,176,48,93,177,189,142,111,175,221,31,219,196,183,229,121,59,252,10,155,130,230,241,196,183,171,237,239,155,92,213,
+    148,87,224,169,255,7,239,251,69,121,56,191,38,186,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+inline const unsigned char texture_queen_black[5167] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,44,0,0,1,44,8,6,0,0,0,121,125,142,117,0,0,0,9,112,72,89,115,0,0,
+    11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,
+    0,19,196,73,68,65,84,120,1,237,221,59,144,20,87,150,198,241,15,180,134,214,162,241,228,41,65,142,188,70,178,228,41,133,
+    28,133,12,169,133,53,235,64,35,107,214,209,203,89,141,3,141,156,153,117,120,200,209,172,3,45,12,197,56,10,53,178,22,
+    67,80,120,131,33,212,120,227,16,149,120,35,131,160,241,24,131,232,201,83,89,9,213,69,61,179,242,117,110,254,127,17,135,
+    106,160,81,180,154,170,143,115,110,222,186,121,72,192,203,162,180,214,38,60,30,25,62,230,191,150,203,127,109,150,189,
+    97,141,127,156,164,245,100,248,243,100,228,247,146,97,1,207,29,18,186,42,74,43,86,22,52,235,195,199,19,58,24,68,109,
+    144,140,212,195,180,118,135,31,239,10,157,67,96,133,47,210,139,32,178,96,138,213,190,80,42,42,15,175,251,105,245,134,
+    63,223,19,130,69,96,133,37,239,146,172,222,85,59,59,166,170,37,202,130,235,206,240,177,39,4,131,192,242,45,15,168,13,
+    189,232,158,240,178,158,178,46,108,71,116,97,174,17,88,254,88,64,197,105,125,60,252,120,222,98,55,94,214,75,235,134,
+    94,140,145,0,74,98,129,20,167,117,57,173,199,105,237,83,165,86,63,173,107,162,59,5,10,203,67,202,94,72,132,84,125,245,
+    120,248,61,223,16,128,185,98,17,82,109,11,175,88,0,158,139,197,184,215,246,234,43,11,175,72,64,7,217,200,247,69,90,183,
+    229,235,133,75,73,191,165,181,41,46,118,160,3,98,209,77,133,82,249,200,24,9,8,76,44,186,169,144,235,182,88,168,135,115,
+    249,216,103,35,132,151,23,30,181,90,245,149,141,139,128,27,22,84,231,197,216,215,229,234,43,11,174,72,64,75,17,84,212,
+    120,245,149,61,39,34,1,45,65,80,81,243,170,175,236,57,194,149,69,52,134,160,162,150,173,190,88,227,66,3,236,138,144,
+    61,249,60,188,72,168,246,85,95,4,23,106,16,139,237,9,84,121,213,23,235,91,168,128,141,127,219,242,245,98,160,252,212,
+    53,17,92,40,201,121,177,78,69,85,95,246,28,59,47,160,160,88,108,250,164,234,175,190,232,182,176,4,27,255,46,201,215,
+    147,156,10,175,236,57,24,9,152,33,22,87,255,168,246,84,95,92,77,196,4,116,85,84,155,235,154,232,182,48,20,139,174,138,
+    106,127,245,197,233,167,157,70,87,69,121,172,243,234,176,174,222,230,43,74,235,39,101,183,201,2,188,73,210,122,111,248,
+    216,41,135,213,61,249,25,85,132,21,188,138,148,61,135,191,80,199,188,162,238,176,17,240,207,105,109,165,245,170,0,223,
+    236,57,252,129,178,231,245,221,180,158,170,3,186,50,18,70,202,222,3,24,9,8,79,162,142,140,136,93,24,9,237,100,5,107,
+    159,35,1,97,138,148,61,199,131,63,87,62,244,145,208,174,168,252,85,140,128,8,159,61,199,255,48,252,248,142,2,21,106,
+    96,217,92,255,157,58,184,40,137,206,139,149,117,92,22,90,193,173,107,133,184,134,21,137,45,11,64,162,0,215,181,66,11,
+    172,72,44,174,3,185,68,129,133,86,72,139,238,177,88,92,7,70,69,202,94,19,177,2,17,202,26,214,153,180,118,196,226,58,
+    48,206,94,19,155,105,61,73,235,239,114,46,132,192,178,43,129,151,5,96,150,15,134,143,174,175,32,122,15,44,11,171,45,
+    1,88,68,60,124,116,27,90,158,3,139,176,2,150,23,15,31,93,134,150,215,192,34,172,128,226,226,225,163,187,208,242,24,88,
+    215,196,134,80,96,85,177,178,13,214,55,229,136,183,192,178,3,247,254,40,0,101,120,71,217,214,135,27,114,194,83,96,217,
+    24,248,181,0,148,41,127,71,136,139,241,208,75,96,177,102,5,84,39,30,62,182,62,180,60,4,22,97,5,84,47,30,62,182,58,180,
+    218,30,88,132,21,80,159,120,248,216,218,208,106,115,96,217,149,192,191,8,64,157,98,101,111,150,190,175,22,106,235,105,
+    13,177,178,83,23,0,52,195,78,121,232,169,101,218,24,88,145,178,119,152,175,9,64,83,246,210,122,75,45,59,154,166,109,
+    199,203,68,202,58,43,194,10,104,150,189,6,91,119,182,92,155,58,44,251,6,113,158,21,208,46,187,202,198,195,61,181,64,
+    155,22,221,237,102,17,177,0,180,201,107,195,106,197,110,248,182,4,150,109,95,224,253,129,64,59,181,102,55,124,27,70,
+    66,187,151,218,79,2,208,118,159,40,59,217,183,49,77,7,86,36,174,8,2,94,52,126,229,176,201,192,98,145,29,240,39,81,22,
+    90,141,44,194,55,185,134,245,103,189,56,103,26,128,15,214,104,216,141,45,26,57,71,171,169,192,178,5,246,45,1,240,200,
+    206,209,106,228,46,60,77,140,132,145,88,183,2,188,107,100,61,171,137,192,234,139,117,43,32,4,181,111,42,173,123,36,180,
+    253,86,27,2,16,2,219,80,90,235,122,86,157,29,86,44,78,96,0,66,84,219,201,14,117,5,86,164,22,190,145,18,64,41,18,213,
+    180,213,161,174,145,208,110,37,31,11,64,136,106,219,234,80,71,135,181,169,236,94,130,0,194,86,249,104,88,117,96,69,98,
+    20,4,186,34,81,197,163,97,213,35,161,93,21,100,55,59,208,13,149,143,134,85,118,88,145,178,61,87,0,186,165,178,209,176,
+    202,192,98,131,40,208,77,182,161,244,45,85,160,170,145,144,13,162,64,119,217,134,82,107,134,122,42,89,21,29,86,36,222,
+    43,8,116,157,45,188,31,83,201,11,240,85,220,53,103,75,132,21,208,117,150,1,151,84,178,178,59,172,72,44,180,3,120,161,
+    212,5,248,178,59,44,222,43,8,96,212,121,149,168,204,192,218,20,87,5,1,28,20,171,196,11,112,101,142,132,108,99,0,48,73,
+    162,146,118,192,151,213,97,109,138,176,2,48,89,164,146,238,59,90,70,135,197,221,111,0,204,83,202,54,135,50,58,172,207,
+    69,88,1,152,205,26,155,149,187,172,85,59,172,72,156,198,0,96,49,43,119,89,171,118,88,103,68,88,1,88,204,202,93,214,42,
+    29,86,36,186,43,0,203,89,169,203,90,165,195,138,69,88,1,88,206,74,93,214,42,29,22,251,174,0,20,81,184,203,42,218,97,
+    109,138,176,2,80,140,117,89,155,42,160,104,135,69,119,5,96,21,133,14,249,43,210,97,217,251,130,34,1,64,113,39,84,224,
+    214,127,69,2,235,115,1,192,234,150,62,201,97,217,145,48,18,231,93,1,40,207,82,231,101,45,219,97,109,9,0,202,179,212,
+    209,51,203,116,88,182,178,223,23,199,31,3,40,207,82,91,28,150,233,176,44,9,9,43,0,101,90,106,139,195,50,129,197,98,59,
+    128,42,124,188,232,39,46,58,18,70,98,177,29,64,117,22,90,124,95,180,195,218,18,0,84,103,161,197,247,69,59,44,118,182,
+    3,168,146,45,186,31,157,247,73,139,116,88,177,8,43,0,213,178,197,247,120,222,39,45,18,88,155,2,128,234,157,153,247,9,
+    139,140,132,143,197,118,6,0,213,155,187,39,107,94,135,197,222,43,0,117,177,172,57,49,235,19,22,9,44,0,168,203,204,177,
+    112,222,72,200,56,8,160,78,51,199,194,89,29,86,44,194,10,64,189,102,142,133,179,2,107,83,0,80,191,169,75,81,179,70,66,
+    54,139,98,41,175,191,254,186,214,214,214,6,21,69,209,243,95,79,146,100,240,184,183,183,167,135,15,31,14,30,129,25,166,
+    110,34,253,143,41,127,192,90,178,72,192,4,22,72,239,190,251,238,160,44,164,78,156,56,113,32,160,230,177,192,218,221,
+    221,213,253,251,247,7,143,119,238,220,25,4,25,48,148,143,133,187,139,254,1,187,111,216,62,69,229,149,6,211,254,185,115,
+    231,246,127,249,229,151,253,103,207,158,149,94,15,30,60,216,191,122,245,234,126,26,130,174,190,47,84,101,181,212,189,
+    11,111,75,141,126,177,84,11,42,237,164,246,63,251,236,179,202,66,106,94,120,89,72,122,250,126,81,165,214,109,45,104,
+    77,106,252,139,165,26,44,11,42,235,166,30,61,122,84,107,80,77,42,186,174,206,214,194,91,170,98,169,241,47,150,106,160,
+    218,20,84,147,130,139,142,171,115,21,107,1,151,213,252,23,74,213,92,54,250,181,49,168,8,174,78,151,101,209,92,183,213,
+    252,23,74,213,84,233,213,189,253,186,215,168,86,45,91,227,58,125,250,180,171,239,51,85,168,110,107,204,43,122,217,182,
+    208,9,105,87,165,31,126,248,65,111,190,249,166,60,177,109,21,27,27,27,131,199,187,119,239,234,233,211,167,66,144,162,
+    180,174,164,245,252,47,120,124,227,104,172,37,86,231,225,215,197,139,23,245,249,231,254,239,43,98,155,82,79,158,60,201,
+    62,174,112,29,56,235,125,252,173,57,39,132,160,217,6,207,123,247,238,5,17,86,198,254,127,110,221,186,165,245,245,117,
+    33,72,7,50,105,60,176,98,33,88,161,190,184,243,16,78,215,181,132,224,196,163,63,25,15,44,254,153,10,84,30,86,246,86,
+    154,80,93,187,118,141,208,10,207,129,76,26,93,195,178,77,90,143,133,224,116,33,172,70,157,61,123,86,215,175,95,23,130,
+    97,111,132,30,188,99,126,52,176,98,177,224,30,28,187,146,102,227,82,87,194,42,247,246,219,111,15,222,92,141,32,124,146,
+    214,142,125,48,58,18,198,66,112,126,252,241,199,206,133,149,233,82,71,217,1,81,254,193,104,96,113,133,48,48,231,206,
+    157,83,28,199,234,34,235,44,45,180,236,17,238,61,95,199,26,221,56,250,63,105,189,38,4,225,227,143,63,214,119,223,125,
+    167,46,179,176,122,245,213,87,117,243,230,77,193,53,251,87,199,54,144,30,88,195,218,23,130,208,181,69,246,121,78,157,
+    58,165,27,55,110,8,174,13,178,42,31,9,25,7,3,98,163,32,97,245,194,213,171,87,25,13,253,139,236,135,195,163,63,129,127,
+    54,10,158,57,115,70,120,193,194,202,66,28,174,197,246,3,29,86,96,46,93,186,36,188,204,222,138,100,103,208,195,173,65,
+    139,76,135,21,16,235,172,24,5,167,59,127,254,188,224,214,224,74,97,30,88,60,203,3,192,11,114,182,252,78,63,112,105,112,
+    219,175,60,176,142,9,174,209,93,45,134,80,119,107,208,97,229,219,26,216,210,224,220,175,191,254,58,184,63,32,230,59,
+    126,252,56,231,103,249,116,200,58,172,72,112,205,142,139,33,172,22,199,85,84,183,34,2,43,0,161,28,198,87,23,190,95,110,
+    173,89,96,177,163,206,185,174,190,95,176,40,219,151,197,226,187,75,17,129,229,156,189,240,88,108,95,158,109,176,133,
+    59,107,140,132,206,241,194,43,134,239,155,75,116,88,222,49,218,20,99,111,16,167,51,117,135,53,44,207,108,45,134,171,
+    131,197,17,246,238,28,177,192,226,159,25,167,184,181,213,106,8,123,119,142,30,22,220,34,176,86,67,96,185,195,72,232,
+    153,173,195,160,56,2,223,157,215,45,176,142,10,46,241,130,91,141,173,1,114,176,159,47,140,132,142,241,98,91,221,145,
+    35,71,4,63,44,176,248,27,115,234,232,81,154,227,85,49,86,187,194,26,150,103,236,35,66,199,172,49,18,162,211,8,125,95,
+    8,44,0,110,16,88,232,180,39,79,158,8,126,16,88,142,237,237,237,9,171,225,123,232,11,129,229,24,221,1,186,134,192,114,
+    236,241,227,199,194,106,146,36,17,252,32,176,28,187,127,255,190,176,26,110,70,225,139,5,22,67,188,83,172,191,172,102,
+    119,119,87,112,101,207,2,139,133,16,167,232,176,86,195,26,160,59,123,140,132,142,209,33,172,166,215,235,9,190,16,88,
+    142,89,135,197,88,88,220,157,59,119,4,87,6,29,86,95,112,139,177,176,56,190,119,238,60,97,13,203,185,157,157,29,97,121,
+    214,93,209,157,250,195,85,66,231,126,254,249,103,97,121,4,189,75,125,2,203,57,219,248,200,90,204,242,110,220,184,33,
+    184,243,132,192,10,0,87,187,150,99,87,87,217,48,234,210,96,209,61,17,92,251,246,219,111,133,197,93,185,114,69,112,41,
+    161,195,10,128,45,30,51,226,44,198,70,104,214,253,220,162,195,10,5,93,195,98,184,58,232,218,222,161,244,135,72,236,197,
+    10,194,173,91,183,184,253,250,28,199,143,31,103,253,202,175,99,116,88,1,185,112,225,130,48,157,117,161,132,149,107,73,
+    254,214,28,254,22,3,96,227,14,107,89,147,217,218,21,99,179,107,137,253,144,7,22,239,162,13,196,87,95,125,197,26,205,
+    4,214,125,210,93,185,54,248,203,203,3,139,103,120,32,172,147,248,230,155,111,132,23,172,243,188,126,253,186,224,218,
+    96,157,157,14,43,64,54,250,176,251,61,99,221,230,217,179,103,5,247,232,176,66,246,233,167,159,50,26,166,172,219,100,
+    20,12,194,160,169,202,3,171,39,4,197,70,195,83,167,78,169,203,172,211,100,161,61,24,137,253,240,202,240,39,246,79,241,
+    150,16,20,235,44,14,29,58,212,201,189,89,118,214,85,215,3,59,48,255,109,63,188,50,242,11,54,232,175,9,65,177,181,172,
+    181,181,53,189,243,206,59,234,10,235,46,63,252,240,67,206,108,15,135,141,131,255,103,31,140,6,214,137,97,33,48,55,111,
+    222,212,177,99,199,180,190,190,174,208,89,88,157,60,121,146,117,171,176,220,77,235,111,246,193,232,153,238,92,41,12,
+    152,93,41,11,253,210,62,97,21,172,231,217,52,218,97,189,150,214,31,132,96,217,46,248,80,215,180,8,171,160,217,123,206,
+    18,251,96,52,176,254,153,214,215,66,208,108,77,43,180,208,178,255,167,247,223,127,95,191,255,254,187,16,164,47,211,122,
+    106,31,140,142,132,118,165,144,127,158,58,192,222,166,98,87,208,66,232,70,108,219,130,117,86,236,57,11,86,162,145,125,
+    162,227,247,37,100,29,171,35,108,60,180,23,186,215,29,241,22,80,246,245,219,123,39,17,180,3,247,98,27,15,172,158,208,
+    25,249,186,143,183,55,76,91,216,190,241,198,27,188,253,168,27,122,179,126,51,78,107,159,234,94,69,81,180,127,245,234,
+    213,253,103,207,158,181,182,238,221,187,183,159,174,189,185,250,190,82,43,87,172,25,214,90,244,133,82,13,148,5,215,173,
+    91,183,90,21,84,15,30,60,216,63,125,250,180,171,239,35,85,90,205,117,91,205,127,145,84,195,181,190,190,222,120,199,101,
+    193,73,80,117,186,122,90,192,101,53,255,133,82,45,41,235,184,206,156,57,51,24,199,234,8,169,71,143,30,237,95,188,120,
+    145,209,143,178,178,44,58,224,144,94,22,43,235,178,128,3,210,240,210,71,31,125,164,141,141,141,193,219,124,236,61,138,
+    101,176,55,42,219,205,96,109,49,157,133,116,140,120,79,99,93,214,164,192,178,103,97,95,188,17,26,115,88,104,89,136,217,
+    38,84,123,180,0,179,199,35,71,142,188,20,102,249,158,47,187,235,178,93,157,180,178,160,178,98,15,21,166,56,170,177,179,
+    250,14,77,249,68,235,176,98,1,64,51,172,213,142,199,127,241,240,148,79,230,214,43,0,154,180,51,233,23,167,5,86,79,0,
+    208,156,222,164,95,60,52,227,15,60,22,235,88,0,234,151,164,117,108,210,111,28,158,241,135,190,23,0,212,175,55,237,55,
+    102,5,214,142,0,160,126,83,155,165,89,35,33,219,27,0,212,205,182,49,28,157,246,155,135,231,252,65,174,22,2,168,211,204,
+    201,110,86,96,153,109,1,64,125,102,54,73,179,70,66,195,88,8,160,46,51,199,65,51,175,195,98,44,4,80,151,185,23,250,230,
+    5,150,217,22,0,84,111,238,86,170,121,35,97,142,77,164,0,170,148,104,202,102,209,81,139,116,88,134,77,164,0,170,212,91,
+    228,147,22,237,176,98,113,70,22,128,234,88,119,149,204,251,164,69,59,172,158,120,67,52,128,106,216,237,5,147,69,62,113,
+    209,192,50,92,45,4,80,133,43,139,126,226,162,35,161,97,79,22,128,178,217,214,169,99,26,59,89,116,154,101,58,44,251,15,
+    178,248,14,160,76,182,247,106,225,51,178,151,233,176,76,44,22,223,1,148,103,161,197,246,220,50,29,150,233,137,197,119,
+    0,229,176,115,219,147,101,254,192,178,129,101,46,8,0,86,119,121,201,207,95,122,36,204,217,226,123,36,0,40,38,209,2,59,
+    219,199,189,162,98,44,232,62,16,0,20,243,165,178,253,87,75,41,218,97,177,197,1,64,81,137,10,116,87,166,104,135,245,52,
+    173,255,20,55,91,5,176,188,66,221,149,41,218,97,25,186,44,0,203,74,210,122,79,75,94,29,204,21,185,74,152,179,205,94,
+    11,111,169,7,0,101,155,207,19,21,180,74,135,101,232,178,0,44,42,209,10,221,149,89,165,195,50,116,89,0,22,181,82,119,
+    101,86,237,176,12,93,22,128,121,146,180,222,210,18,239,27,156,164,232,85,194,81,92,49,4,48,143,93,25,252,187,86,84,70,
+    135,101,172,187,250,77,236,126,7,240,178,68,5,247,93,141,91,117,13,43,103,109,222,151,2,128,151,149,246,254,227,178,
+    58,172,156,29,61,19,11,0,50,137,74,234,174,76,89,29,86,142,147,28,0,140,122,79,37,42,59,176,122,226,84,82,0,153,109,
+    173,184,141,97,92,217,35,161,97,155,3,0,91,215,182,109,12,137,74,84,118,135,101,216,76,10,192,50,32,81,201,170,232,176,
+    114,182,205,225,132,0,116,77,162,18,23,218,71,85,209,97,229,216,230,0,116,83,169,11,237,163,202,216,233,62,77,146,214,
+    209,180,222,17,128,174,176,81,240,111,170,72,149,35,161,97,7,60,208,29,137,86,60,141,97,158,42,71,66,99,11,240,103,5,
+    160,11,108,31,102,162,10,85,57,18,230,18,49,26,2,161,219,86,13,27,199,171,30,9,115,140,134,64,184,18,85,60,10,230,170,
+    30,9,115,140,134,64,184,236,181,157,168,6,117,140,132,185,68,140,134,64,104,108,12,220,86,77,234,26,9,115,54,26,218,
+    137,14,108,40,5,252,75,84,209,6,209,105,234,14,44,19,41,91,207,226,189,134,128,95,149,188,87,112,158,58,71,194,156,253,
+    143,254,75,220,234,30,240,236,79,105,253,191,106,214,68,96,25,59,219,153,245,44,192,39,219,205,190,165,6,52,49,18,230,
+    216,234,0,248,147,168,132,187,223,20,213,100,96,153,72,172,103,1,94,52,178,110,53,170,174,125,88,211,36,98,127,22,224,
+    69,109,251,173,166,105,106,13,107,212,63,148,117,122,177,0,180,149,237,183,250,171,26,214,134,192,50,61,101,251,57,216,
+    159,5,180,207,182,90,114,190,93,211,107,88,163,216,84,10,180,79,162,6,23,217,199,53,189,134,53,202,190,33,159,168,225,
+    25,25,192,115,137,178,55,53,183,34,172,76,155,58,172,92,36,174,28,2,77,107,252,138,224,36,109,234,176,114,137,178,78,
+    11,64,115,90,57,237,180,49,176,76,79,108,119,0,154,98,11,236,61,181,80,91,174,18,78,178,43,182,59,0,117,179,237,11,127,
+    81,75,181,57,176,76,79,132,22,80,23,11,171,45,181,88,219,3,203,244,68,104,1,85,107,125,88,25,15,129,101,122,34,180,128,
+    170,184,8,43,227,37,176,76,79,236,134,7,202,102,71,197,124,45,39,60,5,150,217,17,231,104,1,101,249,62,173,63,202,17,
+    111,129,101,236,148,67,198,67,96,53,54,6,126,33,103,60,6,150,233,137,208,2,138,114,179,102,53,206,107,96,153,158,8,45,
+    96,89,110,195,202,120,14,44,211,19,161,5,44,202,117,88,25,239,129,101,122,105,61,17,119,225,1,102,177,183,186,93,150,
+    115,109,60,173,161,168,56,173,159,196,41,15,192,168,252,216,166,158,2,16,82,96,153,72,217,33,128,145,0,36,202,206,179,
+    74,20,136,182,158,214,80,84,162,192,254,130,128,130,236,240,128,224,94,11,161,5,150,73,148,29,60,246,189,128,110,178,
+    231,126,144,255,112,135,176,232,62,201,83,101,187,226,185,130,136,174,201,55,132,62,21,92,218,72,235,113,90,251,20,21,
+    112,217,115,220,158,235,65,11,109,209,125,154,72,44,198,35,92,137,58,178,118,27,226,26,214,36,137,178,117,173,43,2,194,
+    98,207,233,214,221,44,162,42,161,174,97,77,98,51,189,189,113,218,54,153,218,105,15,175,10,240,203,246,87,253,73,217,
+    206,245,206,172,87,117,101,36,28,23,137,17,17,126,217,150,133,78,222,195,179,43,35,225,184,68,217,97,128,23,4,248,98,
+    35,32,123,13,59,44,78,171,47,95,87,132,168,238,85,95,108,209,233,212,26,214,52,73,90,55,148,157,100,202,241,203,104,
+    35,235,170,254,43,173,127,8,24,177,41,186,45,170,61,213,23,93,213,1,116,88,7,217,98,166,117,91,118,49,130,115,227,209,
+    36,186,42,44,37,18,221,22,85,127,253,38,186,170,169,232,176,166,179,125,46,246,175,156,117,91,182,182,197,190,45,84,
+    201,158,111,255,171,172,171,74,4,172,32,74,107,91,190,254,165,166,252,212,53,113,240,36,42,16,137,49,145,42,175,122,
+    98,252,67,13,54,69,112,81,197,171,175,14,156,172,128,246,217,20,193,69,45,94,118,4,204,150,24,255,208,32,123,242,109,
+    137,224,162,166,23,65,133,214,137,68,112,81,7,139,160,66,235,69,98,84,36,168,8,42,56,180,41,130,171,75,101,155,62,237,
+    60,117,130,10,174,217,21,161,158,124,189,248,168,197,171,39,182,39,32,64,145,178,13,168,220,20,195,127,217,223,161,221,
+    250,61,22,16,56,27,25,54,149,189,217,218,211,139,148,202,186,41,198,62,116,86,164,172,235,234,203,215,11,183,75,69,55,
+    5,76,16,139,145,177,77,33,181,45,66,10,88,136,45,212,111,139,240,106,42,164,24,249,128,130,98,49,54,86,25,82,249,184,
+    71,72,181,92,87,111,243,229,153,157,205,21,43,235,192,222,21,150,101,231,78,221,79,107,71,217,2,250,174,224,6,129,229,
+    155,117,4,22,96,27,195,71,2,108,178,59,202,130,105,103,248,184,39,184,68,96,133,39,214,139,46,108,93,221,187,89,236,
+    67,101,161,212,27,62,18,80,1,33,176,194,151,119,97,241,240,49,82,22,100,33,176,112,234,41,11,165,100,248,49,225,20,48,
+    2,171,187,242,240,202,31,243,122,93,237,146,119,76,123,35,143,61,113,238,121,39,17,88,152,36,26,214,218,176,198,63,214,
+    200,207,205,17,205,191,194,102,65,243,100,228,231,201,240,215,70,43,153,240,8,60,247,111,232,162,145,6,174,101,183,53,
+    0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+inline const unsigned char texture_queen_white[7895] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,44,0,0,1,44,8,6,0,0,0,121,125,142,117,0,0,0,9,112,72,89,115,0,0,
+    11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,
+    0,30,108,73,68,65,84,120,1,237,221,63,116,85,199,157,7,240,47,56,5,91,25,159,52,116,190,224,38,29,10,20,97,155,232,134,
+    198,62,41,130,112,147,221,147,115,144,160,76,97,129,139,100,55,5,146,40,178,217,20,96,220,36,206,57,49,130,194,187,219,
+    24,201,205,174,11,227,235,106,237,194,88,116,161,176,117,221,173,11,31,139,14,87,217,251,125,247,13,60,73,79,122,255,
+    230,55,119,230,222,239,231,156,241,19,127,140,13,232,125,245,155,153,223,204,61,2,145,253,178,106,28,31,242,250,98,255,
+    213,125,159,227,190,239,48,59,253,177,247,227,178,26,79,250,223,46,7,126,172,236,15,145,103,142,64,186,42,171,70,142,
+    58,104,78,247,95,231,176,59,136,98,80,14,140,175,171,177,213,255,120,11,210,57,10,172,246,203,240,60,136,24,76,57,226,
+    11,165,105,185,240,122,84,141,162,255,237,29,72,107,41,176,218,197,85,73,28,243,136,179,98,178,86,162,14,174,79,250,
+    175,5,164,53,20,88,105,115,1,181,128,231,213,147,236,87,160,174,194,54,160,42,44,105,10,172,244,48,160,242,106,92,232,
+    127,60,106,177,91,246,43,170,177,137,231,211,72,17,241,132,129,148,87,227,173,106,124,87,141,191,107,120,29,219,213,
+    184,3,85,167,34,83,115,33,197,55,146,66,42,220,248,174,255,103,190,0,17,25,41,135,66,42,182,240,202,33,34,207,228,208,
+    116,47,246,177,141,58,188,50,136,116,16,167,124,87,171,241,49,210,122,227,106,0,95,84,99,9,218,236,144,14,200,161,106,
+    170,45,195,77,25,51,136,180,76,14,85,83,109,30,31,67,11,245,146,56,55,237,227,20,34,149,55,158,198,108,99,27,245,116,
+    81,36,25,12,170,21,104,218,215,229,177,141,58,184,50,136,68,74,65,165,177,119,108,163,254,156,200,32,18,9,5,149,198,
+    168,177,141,250,115,68,59,139,210,24,5,149,198,164,99,27,90,227,146,6,112,71,136,159,124,41,188,73,52,226,27,219,80,
+    112,73,0,57,212,158,160,225,111,108,67,235,91,19,209,245,50,227,225,244,143,13,159,139,232,136,151,95,126,25,199,143,
+    31,71,150,101,189,87,126,155,131,248,125,131,175,123,63,30,166,44,203,125,31,239,236,236,224,235,175,191,222,245,202,
+    241,232,209,163,222,107,135,172,87,99,13,186,195,126,36,5,214,104,43,168,251,169,90,183,96,234,130,104,110,110,14,167,
+    79,159,126,246,49,191,159,163,105,91,91,91,189,112,99,152,241,149,65,214,226,48,227,111,138,95,20,215,32,7,82,96,29,
+    44,175,198,45,212,151,228,37,143,1,52,63,63,223,11,38,14,6,211,168,170,40,86,12,47,134,25,195,235,147,79,62,105,91,136,
+    149,213,248,25,84,109,13,165,192,218,207,237,254,93,69,194,88,45,93,184,112,161,23,78,121,158,39,27,78,227,114,213,216,
+    230,230,230,179,74,44,113,172,182,110,67,193,181,139,2,107,183,28,137,30,104,101,5,197,128,250,233,79,127,138,133,133,
+    133,40,166,116,77,98,120,177,250,42,138,162,247,202,105,101,130,74,212,83,196,117,72,143,2,171,150,100,85,197,41,158,
+    27,172,162,228,96,172,192,24,92,119,239,222,77,177,250,90,135,22,229,123,20,88,137,85,85,12,39,86,82,139,139,139,157,
+    175,162,166,229,170,47,134,23,95,19,81,86,227,50,58,254,216,178,46,7,86,50,85,149,171,162,150,151,151,21,82,158,185,
+    240,186,125,251,118,42,149,215,42,58,188,147,216,213,192,202,170,113,31,17,239,0,50,152,46,93,186,212,171,166,52,221,
+    11,131,211,70,6,87,2,107,94,37,58,186,147,216,197,192,98,69,197,202,42,202,82,197,85,82,124,85,53,213,28,78,23,35,159,
+    50,178,143,131,149,214,91,232,144,46,5,86,180,83,64,85,83,241,226,148,113,109,109,13,247,238,221,67,164,92,179,105,39,
+    142,6,116,37,176,50,212,103,0,51,68,132,65,245,198,27,111,104,109,42,1,174,199,139,83,198,8,167,139,37,58,50,69,236,
+    66,96,241,102,5,238,2,70,147,8,108,226,100,80,105,167,47,77,156,42,178,234,138,44,184,88,97,113,23,113,3,45,214,246,
+    192,226,20,112,21,145,96,80,93,191,126,189,23,84,146,190,72,131,107,21,45,222,69,108,107,96,177,108,225,57,192,37,68,
+    64,65,213,110,17,6,215,122,53,174,161,133,235,90,109,12,172,12,145,180,44,104,141,170,91,34,11,174,18,45,92,215,106,
+    91,96,101,136,96,113,93,65,213,93,92,156,103,112,221,184,113,3,17,40,209,178,208,106,83,96,229,168,43,171,70,19,130,
+    253,83,119,238,220,121,118,217,157,116,83,68,237,16,156,22,94,68,75,142,244,180,37,176,184,56,180,142,6,113,157,234,
+    175,127,253,171,250,168,100,23,182,66,92,187,118,45,134,105,34,215,180,146,111,50,125,1,233,227,78,96,99,127,17,156,
+    242,253,230,55,191,193,187,239,190,139,31,253,232,71,16,25,196,207,9,46,13,80,195,93,243,175,245,95,147,57,237,61,76,
+    234,21,86,163,109,11,154,254,201,36,56,77,188,114,229,74,211,193,181,138,132,219,30,82,174,176,26,11,43,86,85,191,255,
+    253,239,241,167,63,253,73,139,234,50,54,126,174,184,102,225,207,62,251,12,79,159,62,69,3,242,254,107,146,149,86,170,
+    21,86,99,97,165,170,74,124,136,160,218,90,69,130,149,86,138,21,22,143,217,4,63,192,172,170,74,124,114,213,22,53,20,90,
+    57,234,29,245,15,145,144,212,42,44,118,175,7,15,43,238,0,190,255,254,251,189,7,58,136,248,198,106,235,252,249,243,77,
+    237,36,174,163,62,131,152,132,148,42,44,78,3,255,5,129,177,1,244,189,247,222,107,253,83,103,164,57,174,218,226,154,22,
+    215,182,2,115,39,66,146,88,211,74,37,176,130,175,89,185,41,224,202,202,10,142,29,59,6,17,75,252,28,123,237,181,215,154,
+    90,144,207,251,175,209,135,86,10,83,194,224,97,197,106,234,193,131,7,90,88,151,70,52,56,69,92,69,228,11,241,177,87,88,
+    193,195,138,187,128,12,171,19,39,78,64,164,9,238,25,147,12,172,199,143,31,35,160,188,255,26,109,165,21,115,96,113,113,
+    253,15,8,136,87,192,176,101,65,83,64,105,26,67,235,151,191,252,101,239,227,192,187,136,57,234,195,210,81,62,66,40,214,
+    192,202,171,241,31,8,136,71,107,220,17,10,145,88,240,108,42,195,235,195,15,131,118,31,240,150,94,166,100,137,200,196,
+    184,134,149,85,227,11,4,186,117,129,159,12,156,2,170,101,65,98,198,103,38,94,188,120,49,228,186,22,111,121,248,49,34,
+    11,173,216,2,43,67,192,251,172,180,184,46,41,105,96,49,190,68,100,247,105,29,69,60,88,81,5,11,43,86,84,10,43,73,73,3,
+    95,96,51,68,112,199,220,160,152,2,139,87,196,100,8,64,97,37,169,98,104,61,124,248,48,228,18,6,27,75,111,33,18,177,4,
+    22,219,23,130,60,161,129,15,44,101,88,233,60,160,164,138,159,187,12,45,126,46,7,178,132,250,61,218,184,24,118,9,185,
+    35,241,103,4,192,191,96,181,45,72,91,44,44,44,244,214,181,184,32,31,64,142,186,213,225,111,104,80,211,129,149,85,227,
+    191,171,97,158,32,46,172,68,218,36,112,104,241,214,210,255,66,131,143,15,107,50,176,56,39,251,223,106,152,183,148,43,
+    172,164,205,2,134,22,11,11,206,136,238,86,163,145,219,7,155,12,172,127,195,243,123,166,205,40,172,164,11,2,134,22,11,
+    13,6,87,35,247,104,53,21,88,60,118,179,10,99,10,43,233,146,128,161,117,174,26,79,170,241,41,2,107,162,113,52,67,128,
+    78,118,110,251,114,39,69,164,75,118,118,118,122,205,165,1,66,171,145,78,248,38,218,26,216,28,106,26,86,174,193,78,164,
+    107,2,30,53,227,123,56,120,83,105,232,192,98,47,71,6,67,46,172,212,103,37,93,197,207,125,94,233,29,160,49,154,77,165,
+    65,251,179,66,78,9,115,212,213,149,25,157,13,20,121,142,235,89,103,207,158,237,77,19,141,241,188,97,129,0,66,5,86,134,
+    0,231,4,3,31,89,16,137,30,215,178,206,156,57,3,99,37,234,245,44,243,100,12,53,37,92,133,113,88,221,188,121,83,97,37,
+    178,7,223,19,188,235,205,88,134,64,83,195,16,109,13,75,48,254,205,240,166,208,223,254,246,183,16,145,253,230,230,234,
+    7,227,24,223,92,202,86,7,243,75,255,172,167,132,25,140,167,130,188,251,154,11,140,34,114,56,182,59,24,135,86,9,227,169,
+    161,245,148,144,119,14,103,48,194,69,246,91,183,162,185,249,66,36,106,1,118,14,51,24,207,166,44,43,172,172,26,219,48,
+    226,174,216,208,142,160,200,248,2,237,28,154,237,26,90,174,97,153,118,179,243,33,167,175,190,250,42,68,100,124,252,66,
+    207,235,149,140,31,106,193,69,179,119,96,192,42,176,88,22,46,192,8,31,31,207,39,50,139,200,228,206,157,59,215,171,176,
+    248,132,105,35,188,129,133,179,183,2,158,89,76,9,51,24,86,87,92,183,250,252,243,207,213,201,46,50,3,6,22,251,179,12,
+    31,104,193,57,231,73,120,94,128,183,88,116,95,133,225,84,80,199,110,68,102,199,247,208,253,251,247,45,223,75,252,133,
+    189,239,136,249,158,18,102,213,48,187,207,133,253,86,108,99,16,145,217,157,56,113,194,122,61,139,107,89,94,123,179,124,
+    79,9,185,43,152,193,192,252,252,188,110,96,16,49,96,220,159,85,160,222,53,244,194,103,96,45,193,168,186,82,11,131,136,
+    157,0,173,14,23,171,177,1,15,124,78,9,205,238,198,81,11,131,136,157,0,173,14,60,182,227,229,30,120,95,21,214,18,140,
+    170,43,77,5,69,194,48,158,26,174,193,195,181,232,62,2,139,85,21,219,24,50,24,248,234,171,175,52,21,20,9,192,120,106,
+    232,165,205,193,199,148,144,215,36,152,52,137,106,87,80,36,28,78,13,159,62,125,106,85,101,241,73,59,223,99,198,102,210,
+    89,43,172,12,70,183,49,176,65,244,203,47,191,132,136,132,99,220,80,58,115,149,53,107,227,232,34,140,166,130,188,144,
+    79,68,194,98,149,101,248,104,60,46,31,93,197,12,102,9,172,12,245,98,187,119,139,139,139,154,10,138,52,132,27,93,28,70,
+    120,229,212,212,221,4,179,76,9,151,96,180,51,168,133,118,145,102,25,47,192,79,189,99,56,203,162,187,73,223,149,22,218,
+    69,154,103,188,0,239,174,159,153,184,47,107,218,41,225,18,140,22,218,151,150,150,32,34,205,91,94,94,182,58,28,205,95,
+    116,9,83,152,182,194,50,169,174,184,208,110,56,119,22,145,9,176,251,221,176,202,226,157,89,19,95,242,55,205,26,22,123,
+    174,238,195,51,181,49,136,196,199,184,205,97,226,171,148,167,153,18,46,195,0,215,174,68,36,46,156,18,26,222,238,59,241,
+    47,60,105,133,149,193,224,193,18,170,174,68,226,118,234,212,169,40,170,172,73,43,172,85,24,80,117,37,18,55,195,42,107,
+    162,99,125,147,84,88,92,100,223,134,231,197,118,85,87,34,105,48,170,178,38,58,174,51,73,133,197,36,52,233,187,18,145,
+    248,177,205,193,192,68,45,14,147,84,88,188,66,102,14,30,169,186,18,73,7,119,12,95,121,229,21,139,238,247,2,99,94,163,
+    60,110,133,149,193,115,88,17,159,47,40,34,105,224,142,161,209,123,54,239,143,145,198,173,176,214,81,223,204,224,149,
+    206,12,138,164,197,176,202,186,141,49,110,114,24,183,194,242,222,126,206,27,25,20,86,34,105,97,149,117,233,210,37,24,
+    24,171,32,26,39,176,114,24,156,27,212,163,230,69,210,180,176,96,114,193,48,23,223,243,81,63,105,156,192,90,130,103,60,
+    47,168,234,74,36,77,134,247,101,141,172,178,198,9,44,239,119,189,112,58,40,34,233,50,106,113,24,217,58,53,106,209,221,
+    251,65,103,181,50,136,164,207,112,241,253,208,163,58,163,42,44,239,147,85,93,31,35,146,190,166,22,223,71,5,150,247,233,
+    160,122,175,68,218,193,104,241,253,208,105,225,97,129,149,195,243,81,156,211,167,79,99,110,206,123,255,169,136,52,192,
+    104,241,157,153,115,96,72,252,224,224,127,207,255,238,160,209,66,157,68,130,7,99,185,166,193,193,135,24,56,92,183,36,
+    78,35,184,59,108,116,237,174,52,128,129,101,112,35,41,171,172,98,216,15,28,182,232,206,155,25,50,120,164,206,246,118,
+    96,32,241,147,180,40,138,94,72,109,109,109,77,116,138,159,129,197,106,219,85,220,28,252,88,210,195,207,133,31,254,240,
+    135,240,140,43,249,47,13,251,129,131,2,139,37,217,23,240,136,73,252,224,193,3,72,154,24,80,28,27,27,27,120,244,232,17,
+    124,99,21,198,207,17,62,49,73,79,77,74,203,249,243,231,45,170,172,31,87,99,107,239,119,30,52,37,204,225,153,122,175,
+    210,195,175,158,111,191,253,54,214,215,215,173,110,155,124,134,83,72,142,187,119,239,246,42,48,134,22,63,103,180,171,
+    28,63,254,93,25,4,86,142,33,129,117,80,133,245,49,60,135,150,166,131,233,224,39,31,67,234,222,189,123,104,26,167,138,
+    92,251,212,23,188,120,25,77,11,11,12,185,114,102,88,96,113,69,244,59,120,196,79,186,135,15,31,66,226,198,10,231,202,
+    149,43,86,143,117,154,9,167,140,188,236,81,193,21,39,131,105,225,208,155,72,135,181,53,120,239,59,208,39,89,220,248,
+    21,242,205,55,223,236,117,46,199,24,86,228,194,212,240,145,83,50,131,80,237,13,195,2,75,221,237,29,194,128,98,8,220,
+    190,125,27,41,224,130,63,239,22,191,113,227,6,36,30,121,158,195,192,190,44,26,54,37,244,186,126,165,179,131,113,98,85,
+    197,55,125,42,65,53,12,63,183,184,243,172,181,209,56,112,29,203,243,217,194,2,123,214,177,134,85,88,57,60,82,117,21,
+    31,78,175,82,170,170,14,210,150,223,71,91,252,226,23,191,128,103,57,246,156,182,57,58,228,39,120,165,192,138,11,167,
+    128,103,207,158,109,205,58,144,91,127,211,20,177,121,70,239,245,93,235,88,71,15,251,65,31,140,230,182,50,5,86,34,220,
+    205,49,184,18,164,113,107,107,107,189,69,121,105,142,209,97,232,67,3,43,135,71,108,103,208,250,66,28,88,129,176,18,105,
+    51,54,157,190,254,250,235,173,12,228,20,184,179,162,158,229,131,223,216,27,88,94,15,116,233,102,134,56,48,172,88,129,
+    116,193,230,230,102,47,180,164,25,6,199,170,118,101,210,96,96,113,113,43,131,71,58,19,214,60,118,171,119,37,172,28,174,
+    211,105,122,216,12,131,67,236,25,6,22,222,7,3,203,123,57,164,233,96,179,216,179,116,249,242,101,116,17,167,135,90,136,
+    15,207,104,205,58,119,31,28,29,246,157,62,112,62,171,41,97,115,184,229,127,241,226,69,116,25,43,203,24,206,67,118,9,
+    123,227,12,238,59,203,220,7,102,21,150,238,55,106,22,215,113,116,132,5,184,118,237,154,254,28,2,51,104,111,120,22,38,
+    131,129,229,117,254,166,254,171,230,112,42,100,113,103,85,138,184,99,200,74,83,59,135,225,88,238,20,154,85,88,154,14,
+    54,131,83,193,174,45,178,143,194,240,86,55,124,56,6,235,88,153,251,192,157,37,244,126,195,168,238,191,106,6,15,6,107,
+    10,52,28,175,56,210,82,133,61,126,209,228,205,31,158,241,170,153,210,85,88,25,60,50,106,32,147,17,184,51,166,176,58,
+    24,215,179,196,158,209,194,123,206,127,184,192,210,130,123,226,52,21,28,205,221,75,47,246,12,10,150,94,2,154,84,88,10,
+    172,240,184,125,175,234,106,52,85,89,97,24,100,64,239,23,116,129,229,53,14,221,115,232,36,12,86,87,188,131,93,70,227,
+    2,188,170,44,123,6,155,110,189,199,126,185,192,58,9,143,20,88,97,241,13,168,234,106,124,154,58,219,51,200,0,187,10,75,
+    11,238,97,233,13,56,25,173,101,217,51,58,83,216,11,172,12,158,169,7,43,28,85,87,211,225,3,97,197,142,193,46,33,101,222,
+    3,203,232,127,84,14,160,181,171,233,112,147,66,221,239,118,140,90,155,142,51,176,188,38,140,118,8,195,250,224,131,15,
+    32,147,99,88,233,248,146,45,139,67,208,222,3,75,21,86,56,188,172,78,85,194,244,216,104,43,118,12,22,222,143,107,74,152,
+    48,173,195,204,134,129,47,118,94,124,241,69,120,230,191,194,210,14,97,56,154,210,204,134,213,169,54,44,236,88,85,88,
+    154,18,38,72,107,48,126,20,69,1,177,97,80,188,188,200,192,82,151,123,130,20,86,126,168,31,43,41,47,29,133,103,6,243,
+    86,25,98,107,107,11,50,59,253,57,218,57,121,210,235,1,26,242,63,37,148,48,120,126,80,102,167,53,172,164,188,204,192,
+    122,9,30,25,164,170,12,161,41,161,31,92,11,84,107,136,13,139,13,56,239,83,66,9,67,111,50,127,158,60,121,2,73,3,3,75,
+    139,78,9,82,96,249,179,189,189,13,73,194,113,245,97,37,74,107,47,18,59,171,62,44,145,78,83,248,167,67,129,37,34,201,
+    80,96,73,231,233,116,70,58,20,88,137,210,155,204,31,53,59,167,67,129,149,40,189,201,164,139,20,88,137,82,133,229,143,
+    154,157,211,161,192,74,148,14,153,251,163,86,156,116,48,176,188,118,32,106,139,56,12,189,201,252,80,240,219,49,56,239,
+    186,195,192,210,185,132,4,233,238,124,63,20,252,73,217,209,148,48,81,122,148,154,31,10,254,180,120,15,44,157,203,10,
+    131,129,165,133,247,217,229,121,14,177,97,176,60,212,171,176,148,48,137,82,117,48,59,85,170,73,121,226,125,13,75,139,
+    238,225,204,207,207,67,166,199,192,215,26,150,29,139,27,69,188,239,18,74,56,154,206,204,70,129,111,203,96,151,112,219,
+    123,96,233,234,222,112,248,134,211,58,214,244,46,92,184,0,177,99,80,97,61,81,31,86,226,222,120,227,13,200,228,216,127,
+    165,10,213,150,85,31,86,9,143,116,19,102,88,170,18,166,163,160,183,103,112,245,116,169,41,97,226,184,203,165,181,152,
+    201,45,44,44,64,108,25,20,47,254,43,44,93,232,31,222,202,202,10,100,124,139,139,139,218,29,12,192,224,201,78,59,71,170,
+    127,100,240,220,139,245,237,183,223,106,49,56,176,243,231,207,235,41,198,99,250,234,171,175,20,88,1,188,240,194,11,240,
+    236,164,247,10,139,84,101,133,167,42,107,60,170,174,194,48,122,162,118,233,142,230,120,221,218,211,227,191,195,227,58,
+    150,214,178,70,83,176,135,97,208,45,80,242,31,46,176,188,38,140,22,222,155,161,55,227,225,184,51,168,234,42,12,131,12,
+    232,37,160,11,44,175,203,249,122,140,122,51,88,97,105,187,126,56,246,93,93,189,122,21,18,134,69,151,59,255,97,82,97,
+    105,74,216,28,86,89,170,34,246,187,126,253,186,254,92,2,50,40,90,236,42,44,117,187,55,135,187,179,119,238,220,129,60,
+    199,170,147,139,237,18,142,65,96,245,170,32,23,88,5,60,98,195,152,66,171,57,154,26,62,199,169,160,214,246,194,226,116,
+    208,160,105,180,228,63,142,14,126,195,39,77,11,155,117,235,214,173,206,239,26,178,218,124,240,224,129,122,2,3,51,90,
+    195,222,85,97,145,215,146,168,40,10,72,179,222,127,255,253,78,175,219,188,251,238,187,90,183,106,128,65,177,242,236,
+    23,28,12,172,2,30,105,74,216,60,87,97,116,241,77,123,243,230,77,29,12,111,136,193,137,139,103,97,50,24,88,94,99,81,199,
+    68,226,192,53,156,174,133,22,119,4,151,151,151,33,205,176,90,112,167,193,192,42,225,145,22,222,227,209,165,208,98,88,
+    105,145,189,57,156,14,26,44,184,23,238,3,179,41,97,239,23,212,58,86,52,186,16,90,92,179,82,88,53,203,168,72,25,90,97,
+    49,22,117,166,176,197,92,104,181,109,247,144,191,175,135,15,31,170,215,42,2,27,27,27,240,172,196,64,159,232,222,231,
+    18,122,77,152,15,62,248,0,18,23,23,90,156,58,181,1,195,151,191,31,61,242,44,14,6,235,87,187,126,193,189,129,85,192,35,
+    163,6,50,241,128,83,167,212,219,30,216,28,219,213,93,208,24,241,253,110,16,88,197,224,55,76,43,44,218,220,220,132,196,
+    137,219,254,124,195,95,186,116,9,41,97,53,245,209,71,31,245,154,99,37,30,70,157,1,187,50,201,60,176,212,222,16,55,78,
+    17,121,246,240,243,207,63,143,190,82,97,95,25,251,171,184,94,165,39,222,196,199,104,147,173,24,252,198,222,192,218,129,
+    231,105,161,42,172,52,240,97,22,188,58,56,198,238,112,6,21,215,220,190,252,242,75,245,87,69,204,160,56,217,247,11,30,
+    29,242,147,188,78,66,185,134,165,42,43,29,220,105,115,193,213,244,110,226,96,80,113,205,77,103,2,227,197,142,0,131,150,
+    134,125,51,190,97,129,229,125,95,82,253,88,233,97,112,113,125,139,97,17,242,166,78,134,18,255,219,92,163,226,195,76,
+    20,84,105,48,42,74,246,101,209,145,33,63,137,159,29,219,253,87,47,220,214,179,164,141,95,69,249,137,201,105,190,207,
+    79,80,134,33,55,0,56,56,53,85,64,165,231,204,153,51,22,59,132,47,97,207,93,125,71,14,248,137,31,87,35,135,71,122,244,
+    87,251,176,114,230,52,192,77,7,56,253,231,214,54,159,154,180,183,157,197,85,104,46,144,184,211,199,161,128,74,31,255,
+    206,95,121,229,21,120,198,175,136,249,222,239,252,193,1,63,121,19,158,3,235,238,221,187,90,48,109,25,183,83,167,14,243,
+    110,11,53,29,164,163,7,252,228,2,158,105,183,80,164,157,88,140,24,40,134,125,231,145,67,254,133,239,224,113,29,139,52,
+    45,20,105,23,163,233,96,89,141,147,195,126,224,232,33,255,146,247,216,188,125,251,54,68,164,61,140,166,131,197,65,63,
+    112,88,96,121,111,111,80,63,150,72,187,24,21,33,7,22,75,135,77,9,189,183,55,80,27,175,55,17,233,34,238,14,159,61,123,
+    22,158,113,123,249,165,131,126,240,232,136,127,209,251,74,185,193,125,57,34,210,0,163,234,234,208,128,56,172,194,162,
+    28,117,79,150,55,92,116,103,247,180,22,223,69,210,118,234,212,41,139,227,56,23,113,72,104,29,86,97,17,207,242,120,189,
+    208,74,103,11,69,210,199,86,6,131,176,98,214,28,90,97,141,10,44,147,105,161,118,11,69,210,102,212,123,53,114,189,104,
+    212,148,144,114,120,158,22,146,22,223,69,210,100,212,123,69,63,195,136,166,245,81,21,22,250,191,128,247,123,142,181,
+    248,46,146,166,181,181,53,24,40,49,198,9,155,113,42,44,122,171,26,94,15,2,106,241,93,36,61,134,213,213,122,53,46,143,
+    250,73,227,84,88,228,189,28,226,226,187,214,178,68,210,98,120,38,120,172,178,109,220,10,139,188,95,57,163,42,75,36,45,
+    70,173,12,236,70,248,241,56,63,113,220,10,139,188,71,43,171,44,163,221,6,17,241,204,168,149,129,198,158,106,77,82,97,
+    153,28,213,225,83,91,88,101,137,72,220,140,170,43,110,232,157,196,152,27,123,147,84,88,252,5,189,151,67,92,196,83,149,
+    37,18,55,195,234,138,235,227,99,119,33,76,82,97,81,14,131,158,44,85,89,34,113,51,170,174,136,213,85,57,238,79,158,164,
+    194,162,2,6,183,145,170,202,18,137,151,97,117,197,51,122,229,36,255,194,164,21,22,229,48,170,178,248,244,97,237,24,138,
+    196,197,176,186,58,244,160,243,48,147,86,88,84,96,194,84,28,7,171,44,245,101,137,196,197,176,186,42,49,69,127,231,52,
+    21,22,93,173,198,45,120,166,190,44,145,120,176,136,56,127,254,188,85,96,177,171,125,29,19,154,166,194,66,255,63,228,
+    253,124,161,186,223,69,226,113,239,222,61,203,234,106,29,83,152,182,194,162,213,106,172,192,51,86,87,15,31,62,12,246,
+    104,116,17,217,207,240,204,32,77,85,93,209,180,21,22,241,64,180,73,149,117,249,242,200,51,144,34,98,200,232,70,6,42,
+    49,67,167,193,44,129,197,176,50,153,191,241,70,82,221,74,42,210,12,30,112,230,116,208,8,251,151,74,76,105,150,41,33,
+    153,28,215,33,181,57,136,52,195,176,141,161,68,125,73,95,137,41,189,128,217,60,173,198,63,192,243,45,14,196,169,225,
+    177,99,199,144,231,57,68,36,140,27,55,110,88,94,33,195,25,217,76,87,85,205,90,97,145,89,149,165,5,120,145,112,140,23,
+    218,75,212,87,200,204,180,238,61,203,26,150,99,182,150,165,5,120,145,112,174,92,185,2,67,92,197,159,121,147,110,214,
+    41,161,195,11,184,254,9,6,85,22,231,210,172,180,206,157,59,7,17,177,193,254,199,191,252,229,47,48,82,98,140,235,143,
+    199,225,99,74,232,44,84,227,62,12,104,106,40,98,135,83,65,62,114,158,51,26,35,83,247,93,237,229,99,74,232,112,49,173,
+    128,1,77,13,69,236,112,42,104,24,86,37,60,133,21,249,154,18,58,220,11,93,130,1,77,13,69,252,227,174,160,241,213,78,51,
+    47,180,15,242,57,37,116,214,171,177,8,3,12,44,62,128,245,244,233,211,16,145,217,24,239,10,210,58,60,173,93,57,22,129,
+    101,214,230,64,106,40,21,153,29,167,128,103,206,156,177,106,16,237,253,39,80,87,87,37,60,242,61,37,36,179,102,82,226,
+    31,244,247,223,127,143,87,95,125,21,34,50,157,223,253,238,119,248,240,195,15,97,232,223,97,240,60,83,139,192,162,2,245,
+    174,225,9,24,248,236,179,207,180,158,37,50,37,182,48,112,237,202,80,137,250,54,81,239,44,166,132,78,14,131,171,148,29,
+    181,58,136,76,46,64,11,3,77,244,96,137,73,248,108,107,216,171,128,81,7,60,241,15,156,183,33,26,255,193,139,180,134,187,
+    65,212,248,61,195,247,124,9,35,150,129,69,171,48,252,159,231,95,192,235,175,191,14,17,25,237,205,55,223,180,92,100,167,
+    18,245,61,121,102,172,214,176,28,46,192,63,130,81,111,22,241,47,224,200,145,35,152,159,159,135,136,12,199,53,171,119,
+    222,121,7,198,174,193,168,121,220,177,14,44,42,171,241,82,53,204,86,200,121,217,223,201,147,39,213,159,37,50,4,23,217,
+    185,43,104,108,29,245,1,103,83,150,139,238,131,216,52,245,69,53,50,24,226,34,188,66,75,228,185,71,143,30,245,250,173,
+    140,149,152,241,98,190,113,89,175,97,57,92,229,51,63,12,104,248,72,34,145,228,112,141,247,226,69,147,238,130,189,248,
+    222,46,17,64,168,192,162,2,134,187,134,228,118,14,21,90,210,117,198,207,20,28,196,105,96,129,64,66,77,9,29,78,13,217,
+    155,53,7,67,156,22,242,204,161,142,239,72,23,5,56,118,227,148,168,123,174,130,9,29,88,148,161,94,207,50,77,19,133,150,
+    116,21,195,138,107,87,198,76,206,10,142,18,98,151,112,47,254,70,191,175,198,107,48,244,205,55,223,244,198,133,11,23,
+    32,210,21,188,219,202,248,140,160,243,175,213,248,31,4,214,68,96,209,167,48,110,117,32,126,149,97,89,172,208,146,46,
+    96,88,25,223,109,229,112,45,122,21,13,104,42,176,136,161,101,114,15,252,32,133,150,116,65,192,176,42,171,241,207,168,
+    155,194,131,107,50,176,248,27,230,3,208,150,170,113,12,134,20,90,210,102,1,195,138,203,57,255,88,141,255,67,67,154,12,
+    44,226,31,192,99,212,149,150,41,133,150,180,81,192,176,34,86,86,159,162,65,77,7,22,253,13,245,110,101,14,99,10,45,105,
+    11,182,46,252,250,215,191,14,25,86,236,183,250,51,26,214,68,91,195,65,214,97,116,23,252,94,106,121,144,148,185,6,233,
+    0,173,11,206,58,2,156,84,25,71,76,129,21,164,169,212,225,221,240,12,45,93,0,40,41,113,87,42,5,12,171,18,158,159,124,
+    51,139,152,2,139,50,212,161,149,33,0,133,150,164,36,224,113,155,103,255,73,4,58,212,60,174,144,103,9,199,81,162,254,
+    3,10,146,230,238,19,32,224,87,43,145,169,240,115,148,87,27,7,12,43,190,7,163,10,43,138,45,176,168,132,209,5,246,67,255,
+    99,85,104,241,40,3,239,12,18,137,209,189,123,247,122,159,163,129,175,3,231,123,176,68,100,98,216,37,28,166,68,253,20,
+    233,5,4,194,227,12,186,185,84,98,195,155,66,175,93,187,134,192,248,31,252,79,68,40,214,192,162,45,4,106,119,112,120,
+    115,41,75,111,62,62,76,59,136,210,36,86,83,63,255,249,207,67,182,45,56,108,95,248,3,34,21,219,162,251,48,171,213,88,
+    65,64,90,140,151,38,53,176,184,238,48,172,86,17,177,152,43,44,167,64,224,74,139,95,221,248,149,237,216,177,99,122,88,
+    171,4,197,181,212,95,253,234,87,189,155,70,2,139,62,172,40,133,192,162,2,129,67,235,233,211,167,189,117,173,39,79,158,
+    224,39,63,249,73,47,188,68,172,240,139,36,31,20,193,53,43,126,238,5,150,68,88,81,10,83,194,65,235,8,212,13,63,72,83,
+    68,177,196,117,83,222,189,222,208,213,222,220,30,191,138,68,196,216,214,112,152,37,24,223,11,63,12,215,20,78,157,58,
+    213,251,234,39,226,19,167,128,13,62,135,128,43,250,201,132,21,165,86,97,57,171,8,188,16,239,176,237,225,206,157,59,170,
+    182,100,38,252,34,200,155,22,184,51,221,144,100,166,129,131,82,89,195,218,171,64,224,53,45,135,95,9,181,32,47,179,112,
+    11,235,143,31,63,70,67,146,12,43,74,181,194,114,86,209,80,165,69,170,182,100,18,17,84,85,148,108,88,81,170,21,150,83,
+    160,161,74,139,88,109,241,171,165,58,228,229,48,220,1,252,227,31,255,216,11,171,6,171,42,74,58,172,40,245,10,203,225,
+    194,225,45,52,136,59,137,55,111,222,212,229,128,178,11,171,169,203,151,47,199,240,112,95,222,103,181,142,196,181,37,
+    176,40,175,198,125,24,63,212,98,148,197,197,69,172,172,172,104,154,216,113,145,76,255,136,39,166,121,144,185,64,11,180,
+    41,176,40,67,192,251,180,14,195,208,98,120,41,184,186,133,211,191,183,223,126,187,183,84,16,248,118,133,97,74,68,120,
+    69,204,44,218,22,88,148,33,146,208,226,52,241,250,245,235,189,224,146,118,139,44,168,136,151,7,68,121,69,204,44,218,
+    24,88,196,105,225,91,104,160,43,126,24,5,87,187,177,205,101,109,109,45,134,117,42,199,53,132,70,145,156,62,165,190,75,
+    120,16,30,198,218,64,131,59,136,131,248,21,119,115,115,179,119,17,27,175,173,153,155,11,114,109,189,24,99,80,241,126,
+    117,254,189,242,204,105,36,184,19,200,176,106,228,65,167,214,218,90,97,13,226,37,128,119,208,240,98,252,32,85,92,233,
+    114,55,121,112,234,23,81,69,69,172,166,184,19,184,129,22,235,66,96,81,134,72,214,181,6,49,184,150,151,151,123,173,16,
+    90,156,143,91,132,107,84,131,74,180,108,113,253,32,93,9,44,98,133,181,90,141,101,68,72,237,16,113,98,91,194,198,198,
+    70,111,218,23,97,80,17,47,3,88,69,11,215,171,134,233,82,96,57,156,223,243,56,79,148,119,32,179,99,158,225,165,233,98,
+    115,24,76,12,42,86,83,17,244,81,29,132,1,197,245,170,183,208,33,93,12,44,202,16,225,20,113,16,167,139,12,47,78,25,249,
+    164,106,177,151,64,53,229,180,178,101,97,28,93,13,44,103,21,13,30,158,30,23,3,139,193,149,231,185,166,140,158,185,181,
+    169,162,40,98,174,166,6,117,106,10,184,87,215,3,139,114,212,187,136,25,18,224,166,140,10,175,233,185,157,62,182,154,
+    36,18,82,84,162,222,5,44,208,97,10,172,90,134,250,171,86,82,11,71,172,188,92,120,105,218,120,56,6,19,71,66,149,212,160,
+    78,87,85,131,20,88,187,45,161,158,34,102,72,140,91,243,226,80,245,245,188,89,151,225,196,215,200,215,164,14,82,66,85,
+    213,46,10,172,253,50,212,59,137,81,182,63,140,139,21,23,59,234,217,227,197,48,107,123,5,198,38,78,86,79,91,91,91,189,
+    128,138,172,169,115,26,170,170,134,80,96,29,44,67,228,59,137,147,224,145,32,134,22,43,48,6,25,71,170,85,24,195,136,193,
+    196,128,226,199,172,162,18,173,160,134,225,14,32,31,21,95,64,246,81,96,141,182,138,186,218,106,221,179,235,93,136,113,
+    176,10,115,35,134,106,140,1,196,243,121,12,38,222,45,197,71,97,241,99,6,84,139,194,105,16,127,83,174,170,146,3,40,176,
+    198,147,33,193,69,249,89,184,48,227,43,7,171,49,190,50,208,248,74,252,216,25,85,173,13,78,209,24,64,123,95,93,16,241,
+    99,190,182,96,74,55,137,117,212,85,149,166,127,226,85,86,141,237,106,252,93,67,195,195,40,16,193,109,34,210,126,75,80,
+    112,105,76,63,182,81,223,34,34,18,212,18,20,92,26,227,143,239,80,47,45,180,110,61,84,210,225,110,129,216,70,90,111,30,
+    141,112,67,65,37,209,201,160,224,210,216,61,20,84,18,189,12,154,42,42,168,20,84,146,160,37,40,184,186,52,190,64,125,
+    74,66,65,37,73,227,142,80,129,180,222,124,26,227,143,2,106,79,144,22,202,80,55,9,114,202,144,210,27,82,99,255,224,223,
+    33,111,251,204,33,210,114,156,50,44,161,62,55,150,210,155,84,163,174,166,52,237,147,206,202,80,87,93,219,72,235,141,
+    219,165,161,106,74,100,136,28,154,50,198,20,82,235,80,72,137,140,133,11,245,235,80,120,53,21,82,154,242,137,76,41,135,
+    166,141,150,33,229,166,123,10,169,200,233,122,153,244,204,161,126,115,177,2,155,135,76,138,87,184,60,66,253,72,247,2,
+    245,198,135,36,66,129,149,54,86,4,12,176,133,254,171,2,108,56,62,117,130,193,180,209,127,213,189,83,137,82,96,181,79,
+    142,231,85,24,175,14,205,208,45,188,249,143,161,84,244,95,21,80,45,162,192,106,63,87,133,229,253,215,12,117,144,181,
+    1,195,169,64,29,74,101,255,99,133,83,139,41,176,186,203,133,151,123,117,227,101,196,197,85,76,59,3,175,5,58,248,152,
+    118,81,96,201,112,89,127,28,239,143,189,31,99,224,219,244,34,70,239,176,49,104,158,12,124,187,236,127,223,224,40,135,
+    188,138,60,243,255,152,7,114,169,66,59,217,220,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+inline const unsigned char texture_replay[34397] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,3,212,0,0,3,216,8,4,0,0,0,145,31,121,116,0,0,0,4,103,65,77,65,0,0,
+    177,143,11,252,97,5,0,0,0,32,99,72,82,77,0,0,122,38,0,0,128,132,0,0,250,0,0,0,128,232,0,0,117,48,0,0,234,96,0,0,58,152,
+    0,0,23,112,156,186,81,60,0,0,0,2,98,75,71,68,0,255,135,143,204,191,0,0,0,9,112,72,89,115,0,0,0,96,0,0,0,96,0,240,107,
+    66,207,0,0,0,7,116,73,77,69,7,229,3,27,9,8,35,47,138,74,42,0,0,128,0,73,68,65,84,120,218,237,221,119,156,21,69,186,198,
+    241,95,207,144,51,130,130,8,42,24,64,65,84,16,69,130,18,5,3,24,49,99,22,179,168,107,222,117,13,235,174,152,115,194,156,
+    17,204,9,37,171,128,10,130,40,130,152,0,69,17,4,73,146,195,188,247,15,145,75,102,102,186,186,171,251,244,243,245,115,
+    239,238,170,188,85,61,83,167,159,83,213,213,221,129,33,34,201,176,200,126,99,38,179,152,199,18,22,176,144,21,24,243,
+    214,252,211,133,172,216,224,79,148,164,194,154,255,94,134,178,0,228,81,25,168,72,9,202,80,118,245,255,170,68,62,101,
+    40,75,62,149,200,167,82,224,251,72,69,164,240,2,5,181,136,31,203,236,23,126,225,103,126,102,26,211,248,137,105,44,136,
+    173,237,114,148,166,42,165,41,71,37,74,83,145,242,148,166,10,101,40,75,101,202,80,137,202,84,161,50,149,168,68,25,133,
+    186,136,71,11,173,66,160,160,22,137,133,217,12,126,102,26,191,48,149,95,152,198,52,102,144,134,79,95,41,42,81,137,170,
+    84,90,253,87,101,170,81,157,106,84,163,58,91,83,89,49,46,18,161,183,173,15,47,4,37,124,119,67,36,55,45,176,159,249,137,
+    105,107,102,203,191,178,220,119,151,138,101,57,179,153,189,201,127,90,210,170,173,14,238,173,169,78,13,118,160,54,181,
+    217,70,241,45,226,64,111,59,159,150,128,130,90,196,137,37,54,149,41,252,255,255,253,225,187,67,177,88,193,12,102,108,
+    240,119,203,88,29,106,83,135,237,169,205,206,52,164,166,130,91,164,200,238,181,75,49,230,163,107,212,34,197,182,194,
+    38,51,145,111,153,196,119,76,217,72,92,201,223,170,178,59,187,179,59,13,217,141,218,10,109,145,66,248,159,253,19,128,
+    29,152,170,107,212,34,69,177,192,38,49,137,111,248,150,111,248,113,35,187,176,101,75,42,211,128,70,52,162,9,123,105,
+    247,185,200,38,252,203,254,187,250,191,109,197,31,10,106,145,45,41,176,201,140,227,75,190,228,43,126,242,221,153,28,
+    146,199,206,52,89,253,87,85,69,182,200,106,102,151,115,215,154,255,85,145,5,10,106,145,141,91,100,227,249,146,113,124,
+    197,87,44,244,221,153,156,87,111,77,100,111,173,200,150,76,51,187,148,123,215,250,223,101,88,162,160,22,89,219,10,251,
+    146,207,24,197,104,190,165,192,119,103,50,105,39,154,211,156,230,236,73,73,69,182,100,142,89,79,238,95,231,239,228,179,
+    82,65,45,2,48,221,198,48,130,225,140,101,137,239,174,8,0,37,105,76,75,154,114,0,59,42,176,37,35,54,140,105,128,85,218,
+    245,45,89,182,208,62,97,4,159,49,138,57,190,187,34,155,180,3,251,211,156,230,52,209,28,91,114,154,217,5,60,188,145,191,
+    191,84,65,45,89,244,187,125,198,8,134,51,58,165,15,33,201,166,114,236,77,43,90,114,160,118,139,75,14,50,187,136,7,55,
+    250,79,22,42,168,37,75,166,219,8,134,51,130,177,169,120,120,167,108,92,9,246,164,37,173,104,207,86,10,108,201,17,102,
+    23,242,208,38,254,217,92,5,181,100,193,79,54,152,193,12,99,186,239,142,136,67,249,236,73,107,14,164,149,118,138,75,202,
+    21,216,57,60,190,201,127,58,83,65,45,185,108,182,13,101,48,131,249,193,119,71,36,66,1,187,209,142,246,180,161,138,2,
+    91,82,168,192,206,230,201,205,252,243,95,20,212,146,139,22,219,72,6,49,136,47,116,139,85,134,228,179,23,29,104,73,27,
+    42,42,176,37,53,10,236,76,158,222,236,191,49,85,65,45,185,229,43,235,79,127,62,209,38,177,12,43,67,11,218,211,158,125,
+    200,87,96,75,194,173,178,51,121,102,11,255,206,119,10,106,201,13,11,109,32,253,233,207,47,190,59,34,137,81,153,54,180,
+    231,32,234,43,174,37,161,86,217,233,60,183,197,127,107,130,130,90,210,238,27,123,143,254,124,172,57,180,108,66,93,58,
+    115,48,237,40,175,192,150,68,89,101,167,242,66,33,254,189,113,10,106,73,171,101,54,132,119,232,207,20,223,29,145,84,
+    40,77,107,14,166,51,187,43,174,37,17,86,89,119,94,42,212,191,57,86,65,45,233,179,216,6,211,143,183,152,239,187,35,146,
+    66,53,233,72,23,14,162,178,2,91,60,90,101,167,241,124,33,255,221,207,21,212,146,38,51,236,45,94,103,40,203,124,119,68,
+    82,174,20,173,56,140,195,169,167,184,22,15,86,218,73,244,45,244,191,253,153,130,90,210,97,138,189,197,59,12,99,165,239,
+    142,72,78,217,157,46,28,70,75,2,5,182,196,166,176,215,166,255,246,137,130,90,146,238,27,235,75,63,38,248,238,134,228,
+    176,58,116,229,8,14,212,75,63,36,6,133,191,54,253,183,225,10,106,73,174,169,246,38,253,24,225,187,27,146,17,229,105,
+    75,55,14,215,213,107,137,80,225,110,200,90,215,199,10,106,73,162,41,246,50,125,249,194,119,55,36,131,74,211,137,19,232,
+    162,155,185,36,2,197,137,105,24,166,160,150,100,153,102,175,209,143,145,122,187,149,120,85,134,14,116,227,24,202,41,
+    174,197,153,2,59,99,139,79,33,219,152,33,10,106,73,138,185,214,151,231,20,209,146,32,85,56,138,227,105,167,71,145,138,
+    3,5,118,22,79,21,235,79,14,84,80,139,127,203,173,63,207,241,142,110,186,146,68,170,193,49,156,76,115,133,181,132,80,
+    96,61,120,162,152,127,246,3,5,181,248,53,193,158,227,41,126,247,221,13,145,45,104,192,105,156,70,13,197,181,20,131,217,
+    5,60,92,236,63,221,95,65,45,190,76,179,23,121,138,111,125,119,67,164,208,242,105,75,15,142,208,109,92,82,36,102,23,242,
+    80,136,63,255,174,130,90,226,183,196,94,225,113,62,214,213,104,73,165,26,116,231,116,61,51,92,10,41,220,108,26,224,45,
+    5,181,196,107,172,61,193,139,204,243,221,141,196,41,75,37,42,82,153,42,84,162,4,101,41,67,30,149,129,242,148,162,4,21,
+    129,138,148,88,235,223,47,73,133,141,214,153,11,192,42,22,0,176,156,69,0,44,97,41,0,11,88,197,124,10,152,139,49,143,
+    85,44,96,37,127,174,249,183,164,40,154,115,58,39,80,81,113,45,155,101,118,17,15,134,172,241,134,130,90,226,50,223,94,
+    224,9,198,250,238,134,119,37,168,201,246,108,71,109,182,167,58,91,83,147,234,84,167,180,231,19,254,82,91,194,18,150,
+    50,151,63,87,255,53,143,249,171,255,219,2,230,241,39,11,248,147,133,190,127,120,9,83,145,147,57,143,61,20,214,178,9,
+    102,61,185,63,116,149,215,20,212,18,61,179,143,121,130,126,44,241,221,17,47,202,80,143,122,212,163,46,219,177,29,59,
+    80,51,197,55,251,44,179,217,204,102,22,179,152,205,31,204,102,54,191,51,155,217,252,145,233,183,129,183,226,60,142,246,
+    254,85,75,146,232,18,187,215,65,149,126,10,106,137,214,108,123,138,199,249,206,119,55,98,181,21,245,217,137,122,212,
+    99,39,234,81,43,19,39,240,57,54,157,159,153,206,47,252,194,79,252,200,207,172,242,221,165,88,109,195,25,156,195,142,
+    153,248,93,75,97,93,102,119,59,169,243,178,130,90,162,51,218,30,228,229,213,87,71,115,91,62,59,208,128,221,168,79,125,
+    118,99,107,157,174,89,97,83,249,145,111,152,192,87,76,204,200,53,240,60,14,230,60,14,38,79,191,127,1,46,183,59,29,85,
+    122,73,65,45,81,88,106,47,243,32,163,125,119,35,98,219,179,7,123,176,39,187,83,95,11,159,155,97,54,133,241,76,96,60,
+    19,152,196,10,223,221,137,88,93,46,228,44,42,105,60,100,220,149,118,187,179,90,47,40,168,197,181,169,246,8,79,48,219,
+    119,55,34,82,158,61,104,76,99,246,160,49,85,116,50,46,178,21,246,237,234,200,30,207,228,156,189,65,175,34,103,114,49,
+    117,53,62,50,235,26,235,229,176,218,179,10,106,113,199,108,48,189,121,157,149,190,59,226,92,121,246,162,41,77,105,74,
+    131,20,111,5,75,154,5,246,21,99,24,195,24,38,250,238,74,4,242,56,132,158,116,208,104,201,160,235,236,102,167,245,158,
+    86,80,139,27,139,236,25,238,205,177,77,99,101,105,194,62,52,165,41,245,21,207,145,250,205,62,103,52,163,25,205,31,190,
+    187,226,88,51,46,229,24,61,201,44,83,92,199,52,60,169,160,150,240,126,179,251,121,148,57,190,187,225,204,246,180,96,
+    127,154,179,183,78,176,177,155,98,163,248,156,209,140,229,79,223,93,113,166,54,23,210,131,170,26,75,153,112,131,221,
+    232,188,230,227,10,106,9,231,75,187,139,62,57,113,23,109,105,246,161,57,45,104,158,145,27,170,146,109,149,125,201,71,
+    124,196,112,102,249,238,138,19,21,233,193,101,26,89,57,239,38,187,62,130,170,143,42,168,165,184,204,6,115,47,239,166,
+    126,67,80,57,246,166,21,29,104,73,89,157,70,19,104,178,13,103,4,3,153,226,187,35,161,149,226,56,254,73,125,141,178,156,
+    117,187,93,25,73,221,135,21,212,82,28,75,236,57,238,225,27,223,221,8,165,2,173,104,205,129,52,163,148,78,157,41,48,213,
+    62,226,99,62,78,249,251,214,242,233,198,213,236,169,17,151,131,110,177,107,35,170,252,160,130,90,138,106,190,61,196,
+    61,41,126,131,116,41,246,167,35,237,217,135,18,58,93,166,208,12,27,206,48,6,240,189,239,142,20,91,192,193,92,67,43,141,
+    190,156,114,135,93,17,89,237,251,20,212,82,20,179,236,94,30,96,190,239,110,20,75,64,35,58,208,145,3,40,175,83,100,14,
+    152,98,31,48,128,33,41,29,141,208,138,107,56,152,64,99,49,39,220,107,151,68,88,253,30,5,181,20,214,52,187,147,199,88,
+    236,187,27,197,80,131,78,116,164,3,53,117,82,204,57,43,237,83,6,48,128,207,83,249,108,241,166,220,192,97,26,149,169,
+    247,144,93,24,233,94,157,187,20,212,82,24,147,237,94,122,167,238,169,221,121,236,77,7,14,163,133,158,190,156,243,22,
+    218,80,222,225,3,126,242,221,145,34,107,204,191,56,70,51,235,20,123,210,206,166,32,210,22,238,80,80,203,150,124,105,
+    183,240,74,202,230,43,91,113,16,135,208,89,175,199,200,156,137,54,128,119,249,48,101,79,20,223,143,235,57,88,99,53,149,
+    158,178,179,34,142,105,184,85,65,45,155,243,165,93,207,91,169,186,1,107,103,142,164,43,251,235,73,98,153,54,215,222,
+    227,77,222,79,213,67,83,154,115,35,7,105,212,166,204,115,118,90,228,49,13,183,40,168,101,83,38,90,47,94,136,97,16,186,
+    178,59,221,232,66,83,157,234,100,181,149,246,41,253,120,149,95,125,119,164,208,246,231,26,186,104,4,167,198,43,118,66,
+    44,111,54,248,175,130,90,54,102,146,221,196,203,41,9,233,146,180,225,8,186,82,91,39,56,217,136,2,27,197,155,188,153,
+    154,187,254,91,115,11,45,53,150,83,32,174,152,134,155,20,212,178,190,31,236,38,94,76,197,53,233,82,116,228,88,186,234,
+    117,147,82,8,223,217,27,188,201,167,169,248,250,217,149,255,209,80,163,58,209,222,176,99,99,219,9,113,131,130,90,214,
+    54,213,254,195,179,41,120,77,101,73,58,112,44,135,235,69,7,82,68,191,89,63,94,226,179,196,239,187,200,167,59,55,178,
+    189,198,119,66,189,99,71,199,248,134,131,127,43,168,229,111,51,236,38,30,79,252,110,217,146,180,227,88,142,96,43,157,
+    194,164,216,166,88,31,250,240,149,239,110,108,65,25,206,231,90,170,105,164,39,206,251,118,4,203,98,108,239,95,10,106,
+    1,88,104,119,112,39,11,125,119,99,179,2,90,114,50,199,232,196,37,142,76,180,151,232,195,15,190,187,177,89,149,185,146,
+    158,122,150,94,162,12,178,174,44,137,181,197,107,20,212,178,210,30,231,70,102,248,238,198,102,53,224,100,78,98,71,157,
+    174,196,185,209,214,135,190,252,226,187,27,155,177,45,255,230,76,189,27,61,33,134,217,161,177,63,159,241,42,5,117,214,
+    13,178,75,249,218,119,39,54,163,26,71,211,93,47,48,144,72,21,216,72,250,241,50,51,125,119,100,147,118,229,102,186,233,
+    83,224,221,72,235,228,97,229,241,74,5,117,150,141,176,43,25,233,187,19,155,84,134,163,232,78,71,61,186,68,98,178,194,
+    222,229,73,250,39,118,51,101,39,238,212,94,112,175,62,177,78,94,30,162,243,15,5,117,86,125,107,87,243,134,239,78,108,
+    82,51,78,231,4,221,118,37,30,252,102,207,241,20,147,124,119,99,163,74,208,131,27,169,174,207,133,23,163,236,32,79,239,
+    106,187,68,65,157,69,139,236,118,122,197,186,107,177,240,170,210,141,115,217,91,167,34,241,106,140,245,230,165,68,62,
+    130,180,2,255,224,26,74,235,19,18,179,113,214,158,57,158,218,238,169,160,206,154,2,123,154,107,19,121,45,174,4,7,115,
+    58,135,105,211,140,36,196,34,235,199,147,12,79,224,61,215,59,115,59,71,232,115,18,163,47,173,157,183,152,134,11,21,212,
+    217,242,137,93,204,231,190,59,177,17,219,113,22,103,179,157,78,61,146,56,223,219,83,60,155,192,231,133,183,229,110,246,
+    212,39,38,22,95,91,91,102,123,108,255,60,5,117,118,76,183,171,121,62,113,179,131,60,58,114,46,135,81,66,167,28,73,172,
+    85,246,62,143,240,94,194,30,63,154,207,249,220,164,157,28,145,251,198,218,122,94,131,60,71,65,157,13,43,236,33,254,205,
+    2,223,221,88,79,85,186,211,147,122,58,209,72,42,252,106,143,241,160,215,153,213,134,170,113,29,23,145,167,207,80,100,
+    190,183,54,76,247,220,135,30,10,234,44,120,203,46,227,71,223,157,88,79,75,46,228,40,74,233,4,35,169,178,196,94,226,65,
+    198,250,238,198,58,90,242,160,22,193,35,242,131,181,73,192,101,143,51,21,212,185,238,59,187,148,247,124,119,98,29,165,
+    56,156,75,217,95,39,22,73,173,49,214,155,231,98,126,140,228,230,228,113,18,119,235,225,186,206,253,108,7,50,213,119,
+    39,128,51,20,212,185,108,161,93,207,253,137,122,205,70,45,206,163,7,219,232,132,34,169,55,211,30,227,145,4,204,182,254,
+    86,147,219,56,153,64,159,45,103,146,18,211,112,186,130,58,119,189,107,23,240,147,239,78,172,165,41,23,115,130,110,190,
+    146,28,82,96,239,114,31,131,19,179,69,179,53,15,208,88,159,48,39,126,177,54,137,185,96,120,26,121,190,187,32,81,152,
+    110,221,236,176,196,196,116,9,142,103,20,159,7,167,4,138,105,201,37,121,65,151,96,96,240,21,167,83,202,119,87,0,248,
+    152,166,92,105,139,147,242,189,33,197,166,91,187,196,196,52,152,102,212,185,167,192,30,225,90,79,143,186,219,80,5,206,
+    224,82,189,247,74,114,220,116,187,151,71,19,242,169,171,199,195,28,164,79,92,8,51,173,77,162,30,34,123,138,130,58,215,
+    140,183,115,248,196,119,39,86,219,134,243,184,72,91,92,36,35,254,180,39,185,147,105,190,187,1,64,55,30,208,94,144,98,
+    154,101,237,18,246,70,193,238,10,234,92,178,196,110,229,22,150,251,238,6,0,59,115,33,61,40,171,83,133,100,202,10,123,
+    137,219,19,113,154,175,74,47,206,214,230,178,34,155,103,29,24,227,187,19,235,57,89,65,157,59,62,176,243,153,236,187,
+    19,0,52,231,26,14,211,67,24,36,163,204,222,227,118,62,244,221,13,160,29,143,178,179,62,135,69,48,207,218,39,236,46,121,
+    128,147,180,153,44,55,204,180,83,172,115,34,98,186,37,111,241,73,208,53,80,76,75,86,5,193,161,193,176,96,44,221,41,225,
+    185,39,67,216,131,27,108,185,102,99,133,180,192,58,37,48,166,181,153,44,71,60,105,151,51,215,119,39,8,232,194,53,52,
+    87,64,139,172,246,163,221,206,83,222,47,70,237,193,19,52,211,231,114,139,254,180,206,140,244,221,137,141,58,65,51,234,
+    180,155,97,135,219,153,222,99,58,143,195,24,205,155,129,98,90,228,255,237,20,60,18,252,192,197,148,241,218,139,241,180,
+    224,106,91,166,57,217,102,45,182,174,9,141,105,48,5,117,186,61,99,187,241,150,231,62,148,224,116,190,229,237,160,169,
+    66,90,100,3,117,130,123,131,239,56,143,210,30,251,176,146,91,105,202,231,138,234,77,90,98,93,24,22,81,237,178,148,11,
+    89,65,65,157,98,51,237,72,59,141,121,94,251,144,71,55,38,240,100,160,13,43,34,155,86,39,120,40,248,222,243,204,122,2,
+    251,107,94,189,9,203,173,27,67,34,170,93,138,126,108,29,178,134,130,58,181,250,89,67,222,240,218,131,60,186,49,145,190,
+    193,174,10,105,145,45,250,107,102,237,51,172,255,154,87,143,86,84,175,103,185,29,195,187,17,213,46,197,43,28,26,250,
+    12,169,160,78,165,223,237,104,59,150,63,60,246,224,175,153,116,223,160,190,66,90,164,208,252,135,245,4,93,175,94,207,
+    10,59,150,183,35,170,93,146,126,116,113,112,142,84,80,167,80,95,107,200,107,30,219,207,227,56,198,211,55,104,160,144,
+    22,41,178,58,193,189,193,247,92,224,237,154,245,74,110,101,31,198,40,170,1,88,105,39,240,102,68,181,75,242,50,93,157,
+    156,37,11,20,212,233,50,203,142,181,227,152,237,177,7,7,51,134,62,193,238,10,105,145,98,171,29,60,16,252,192,89,222,
+    238,179,254,154,230,252,219,86,102,62,172,87,89,119,94,141,168,118,9,94,224,72,71,231,73,205,168,83,229,93,219,139,126,
+    30,219,223,143,33,188,23,236,165,144,22,9,173,118,240,88,240,53,221,240,243,113,90,201,127,104,193,183,153,142,234,2,
+    59,157,62,17,213,206,231,105,186,57,252,213,42,168,83,226,79,59,213,14,99,186,183,246,27,241,22,159,6,109,21,210,34,
+    206,212,15,250,6,31,211,210,83,235,163,105,202,163,153,141,234,2,59,155,231,34,170,157,207,211,156,228,240,92,169,165,
+    239,148,24,109,77,121,214,91,235,219,243,40,227,156,108,138,16,145,117,181,12,134,7,3,105,236,165,237,69,156,75,103,
+    155,158,193,176,54,187,136,39,35,170,29,240,16,39,59,62,91,42,168,19,175,192,110,177,150,124,239,169,245,106,220,203,
+    247,244,8,242,21,211,34,17,233,16,140,229,49,182,243,210,246,7,236,205,219,25,139,106,179,139,121,40,162,218,1,189,233,
+    225,248,108,169,25,117,226,205,176,67,184,150,21,94,218,46,73,15,38,113,113,80,74,33,45,18,169,252,224,172,224,59,122,
+    81,197,67,219,191,211,149,83,108,97,134,194,250,26,30,136,168,114,192,3,156,21,193,249,82,65,157,104,111,88,35,62,240,
+    212,246,97,124,195,163,65,117,133,180,72,44,202,5,87,5,63,114,149,151,187,172,159,163,49,35,50,18,213,255,180,91,35,
+    170,28,112,31,231,71,112,198,212,174,239,4,91,108,231,218,145,158,30,107,178,63,35,121,59,216,73,33,45,18,171,173,130,
+    94,193,36,78,240,176,23,124,10,109,184,217,86,229,124,88,255,219,254,23,89,237,187,184,48,146,95,156,150,190,19,107,
+    130,53,231,81,47,45,215,225,25,70,176,191,66,90,196,139,29,130,23,131,79,217,47,246,118,87,114,29,29,248,53,167,163,
+    250,38,251,79,100,181,255,199,37,145,157,53,21,212,9,100,214,219,154,49,222,67,203,229,184,158,239,56,37,8,20,211,34,
+    30,237,27,140,228,25,182,137,189,221,97,236,197,59,57,27,213,119,217,245,145,213,190,153,107,34,59,107,106,233,59,129,
+    102,89,23,206,97,73,236,237,6,116,227,27,110,8,202,40,164,69,188,203,11,78,9,190,229,42,74,197,220,238,108,186,210,211,
+    150,231,96,88,223,99,255,136,172,246,77,252,51,194,243,166,130,58,113,134,90,227,200,222,228,178,57,251,48,156,190,193,
+    246,10,105,145,196,168,18,244,10,198,210,62,230,86,141,251,104,197,143,57,22,213,15,216,101,145,213,190,142,235,34,61,
+    115,234,26,117,162,152,221,107,157,152,17,123,187,213,184,135,79,105,161,144,22,73,156,134,193,160,224,45,234,197,220,
+    234,104,246,230,133,28,138,234,39,237,98,162,58,156,127,112,83,228,231,78,5,117,98,204,177,46,92,18,251,29,211,37,185,
+    140,31,233,169,7,154,136,36,86,151,224,107,110,162,92,172,109,254,201,201,156,101,139,115,34,172,159,180,179,35,139,
+    233,203,185,35,242,115,167,102,212,137,49,218,154,122,88,242,110,205,88,238,12,42,43,164,69,18,173,108,112,93,48,137,
+    227,98,110,245,9,154,49,62,245,81,253,156,157,77,65,68,181,47,225,246,24,206,158,186,70,157,16,207,218,129,76,141,185,
+    205,173,184,135,97,52,82,72,139,164,66,157,160,79,240,33,13,98,109,115,34,251,242,120,170,163,250,21,59,35,178,152,62,
+    155,187,98,58,10,5,181,119,75,236,76,59,53,230,93,222,1,221,249,150,158,65,158,98,90,36,69,14,8,190,224,122,74,199,216,
+    226,82,206,230,148,212,46,129,191,102,39,176,50,162,218,103,242,40,241,220,200,170,25,181,119,223,218,190,145,189,197,
+    101,83,246,100,4,207,234,225,160,34,41,84,38,184,33,24,79,187,88,219,124,142,86,76,78,97,84,247,183,19,35,139,233,211,
+    233,29,83,76,43,168,189,123,209,246,225,235,88,91,172,196,221,124,174,231,142,137,164,216,46,193,64,30,137,245,5,30,
+    95,176,79,234,30,132,242,174,29,193,178,136,106,159,198,227,196,183,30,169,205,100,30,45,179,158,118,18,11,99,109,243,
+    16,198,115,73,80,66,49,45,146,106,121,193,57,193,36,186,199,216,226,92,186,210,211,86,166,38,172,7,218,49,44,143,168,
+    246,177,60,22,99,76,131,174,81,123,243,179,181,230,190,88,91,172,193,203,188,171,71,154,136,228,136,26,193,179,193,187,
+    236,24,91,123,198,125,116,226,247,84,68,245,16,59,156,165,17,213,62,158,23,137,119,178,163,25,181,39,35,108,63,70,199,
+    218,98,55,190,230,88,133,180,72,78,57,36,152,200,245,49,62,102,116,8,77,82,240,58,204,17,118,120,100,219,115,143,226,
+    57,226,127,234,132,130,218,131,222,214,46,214,231,143,237,196,32,250,106,243,152,72,14,42,27,220,16,124,74,179,216,218,
+    251,149,182,220,147,232,168,30,105,157,35,187,164,120,36,125,98,158,77,131,102,212,30,172,180,171,237,156,200,174,157,
+    108,168,4,23,51,142,246,10,105,145,156,181,119,240,41,247,196,118,211,214,10,46,229,196,196,222,176,53,214,14,139,44,
+    166,59,243,18,37,189,156,75,21,212,177,154,109,29,184,53,198,246,26,241,9,247,6,21,20,211,34,57,45,47,232,25,124,78,
+    211,216,218,123,137,3,152,150,192,168,30,99,237,153,27,81,237,67,120,131,210,94,206,165,154,81,199,234,43,219,151,15,
+    99,107,173,4,87,241,57,251,40,164,69,50,161,81,240,41,189,98,187,94,61,134,38,12,73,88,84,127,101,157,152,23,81,237,
+    142,188,234,41,166,65,51,234,24,189,99,173,153,18,91,107,187,51,130,94,129,191,129,37,34,113,43,17,92,21,124,206,222,
+    49,181,54,155,78,220,154,160,168,158,100,157,248,35,162,218,173,121,157,50,222,206,166,122,224,73,76,204,110,181,195,
+    89,16,83,107,121,244,96,52,251,42,164,69,50,103,143,224,51,122,81,50,150,182,86,114,53,221,109,73,34,194,250,187,8,183,
+    232,182,226,61,202,123,60,159,42,168,99,177,208,142,225,234,200,30,12,191,190,157,24,202,163,65,57,197,180,72,38,149,
+    12,174,10,134,199,246,242,142,231,105,197,207,222,163,250,7,107,203,111,17,213,110,193,123,248,221,231,163,160,142,193,
+    143,182,63,175,197,212,86,192,165,140,231,0,133,180,72,166,237,27,140,229,210,152,78,239,99,105,206,39,94,163,122,178,
+    181,101,122,68,181,91,240,62,21,61,159,81,181,153,44,114,195,108,191,216,158,230,93,155,129,220,21,148,85,76,139,100,
+    94,217,224,174,96,24,59,197,210,214,111,180,245,248,50,204,159,172,29,191,68,84,123,63,250,123,143,105,205,168,35,247,
+    124,132,219,27,214,119,60,95,233,126,105,17,89,163,117,240,37,61,98,105,105,25,103,115,153,173,242,16,214,211,172,29,
+    63,69,84,123,31,222,167,82,2,206,169,10,234,72,221,107,167,196,244,104,147,202,60,202,75,65,213,4,12,41,17,73,142,242,
+    193,163,193,107,108,21,75,91,119,115,40,243,99,142,234,153,214,137,201,17,213,222,147,247,169,146,136,115,170,130,58,
+    50,43,237,28,187,132,120,70,109,59,198,211,35,17,3,74,68,146,230,200,96,28,7,196,210,210,7,180,98,106,140,81,253,187,
+    181,227,155,136,106,55,102,16,213,18,114,86,85,80,71,228,79,235,66,239,88,90,42,77,47,6,82,39,33,3,74,68,146,167,78,
+    48,132,235,201,143,161,165,175,105,198,71,49,69,245,44,107,207,196,136,106,215,231,3,146,243,118,4,5,117,36,126,181,
+    214,188,31,75,75,245,249,148,171,130,120,223,140,42,34,105,147,31,220,16,12,167,110,12,45,205,230,32,158,141,33,170,
+    231,217,193,145,109,211,221,149,161,212,76,208,89,85,65,29,129,47,173,57,95,198,210,82,119,62,103,175,4,13,39,17,73,
+    174,230,193,23,28,23,67,59,203,56,149,158,86,16,105,88,207,183,142,140,137,168,246,46,12,101,219,68,157,87,21,212,206,
+    189,111,173,35,187,85,96,109,21,121,158,103,245,186,13,17,41,180,202,65,159,224,25,202,197,208,210,125,28,75,116,239,
+    215,90,96,7,241,121,68,181,119,102,40,181,18,118,94,85,80,59,214,219,186,240,103,12,237,236,195,88,78,74,216,96,18,145,
+    228,59,37,248,156,198,49,180,243,42,45,35,122,191,214,34,235,194,168,136,122,189,61,3,217,46,113,103,86,5,181,67,102,
+    55,216,57,172,140,188,157,128,139,25,193,206,137,27,76,34,146,6,187,5,159,113,113,12,237,140,163,57,227,156,71,245,98,
+    59,140,143,34,234,113,29,134,177,99,2,207,172,10,106,103,150,216,81,220,24,67,59,91,243,30,247,6,165,18,56,152,68,36,
+    29,202,4,247,6,125,169,24,121,59,211,105,195,96,167,81,189,196,186,48,44,162,222,214,97,24,117,19,121,102,85,80,59,50,
+    223,58,241,70,12,237,52,99,52,157,19,57,148,68,36,77,186,5,159,211,40,242,86,230,211,153,199,156,69,245,114,235,198,
+    144,136,122,90,131,1,212,75,232,185,85,65,237,196,76,107,203,199,145,183,18,112,49,195,217,33,161,67,73,68,210,101,215,
+    224,147,24,118,129,175,228,28,110,112,18,213,203,237,104,222,141,168,151,53,24,66,131,196,158,91,21,212,14,76,181,214,
+    124,17,121,43,149,120,89,75,222,34,226,80,133,160,79,240,104,228,239,174,54,110,228,116,91,17,50,172,87,216,177,188,
+    19,81,15,183,97,48,187,39,248,220,170,160,14,109,162,181,230,251,200,91,217,139,49,116,75,240,64,18,145,116,234,17,12,
+    102,219,200,91,121,154,67,88,16,34,170,87,217,41,188,25,81,223,182,102,48,13,19,125,118,85,80,135,52,202,14,136,225,
+    174,233,238,218,229,45,34,17,105,29,140,163,109,228,173,12,162,21,191,20,51,170,87,217,41,244,137,168,95,85,120,159,
+    70,9,63,187,42,168,67,121,207,218,70,254,18,203,178,60,205,179,65,185,132,15,36,17,73,175,109,130,15,98,184,97,107,60,
+    45,153,80,140,168,46,176,211,121,49,162,62,85,101,8,77,18,127,118,85,80,135,240,130,29,193,226,136,219,216,129,225,156,
+    154,248,97,36,34,233,86,50,184,55,120,129,242,17,183,242,51,173,24,86,196,168,46,176,179,120,46,162,254,84,97,0,123,
+    167,224,252,170,160,46,182,7,237,20,86,68,220,198,1,124,150,130,111,123,34,146,11,78,12,62,103,247,136,219,152,71,39,
+    94,44,66,84,155,93,196,83,17,245,165,18,239,179,79,42,206,175,10,234,98,250,183,93,72,65,196,109,92,198,96,106,164,98,
+    24,137,72,46,104,16,140,164,75,196,109,44,231,100,110,47,100,84,155,93,204,67,17,245,163,34,253,217,47,37,231,87,5,117,
+    49,20,216,5,246,159,136,219,40,199,11,220,25,148,72,201,48,18,145,220,80,57,120,131,171,137,246,196,99,92,201,69,182,
+    170,16,97,253,15,30,136,168,15,229,121,151,22,169,57,191,42,168,139,108,165,117,143,236,59,222,223,118,100,4,39,166,
+    102,16,137,72,238,200,11,110,9,158,167,76,196,173,60,64,55,150,108,33,170,175,178,187,35,106,189,28,239,208,58,69,103,
+    88,5,117,17,173,176,19,35,219,127,248,183,246,122,203,180,136,120,116,98,240,33,181,34,110,227,117,58,240,199,102,162,
+    250,58,187,45,162,150,203,242,22,109,82,117,134,85,80,23,201,114,59,142,126,17,183,209,131,254,84,75,213,32,18,145,92,
+    179,111,48,154,125,35,110,99,36,251,241,253,38,162,250,38,187,57,162,86,75,209,143,246,41,59,195,42,168,139,96,169,29,
+    197,235,145,182,80,130,7,121,52,40,153,178,65,36,34,185,167,86,48,140,19,35,110,227,71,90,51,102,35,81,221,203,174,143,
+    168,197,210,188,206,161,169,59,195,42,168,11,109,177,29,30,217,3,225,255,82,149,254,156,159,186,33,36,34,185,169,108,
+    240,66,112,79,196,17,49,147,3,121,119,189,168,190,199,174,137,168,181,146,244,229,144,84,158,99,21,212,133,178,200,14,
+    99,64,164,45,212,231,51,58,164,114,8,137,72,174,234,25,188,22,241,99,80,22,113,4,79,172,21,213,247,219,101,17,181,84,
+    146,151,233,154,202,115,172,102,212,133,178,200,186,48,52,210,22,58,242,9,187,164,114,8,137,72,46,59,60,24,74,141,72,
+    91,88,201,89,92,109,102,0,79,88,79,156,189,190,122,29,249,60,195,145,169,61,199,42,168,183,104,190,117,136,56,166,47,
+    226,61,170,166,118,8,137,72,46,107,22,124,66,131,136,219,184,149,179,88,105,79,218,217,145,197,244,243,156,144,226,115,
+    108,16,205,143,37,119,204,177,78,124,30,97,253,124,238,226,226,20,15,32,17,201,125,115,236,112,134,71,220,70,19,198,
+    69,244,188,199,124,158,230,100,143,103,217,29,237,167,80,127,126,91,205,168,55,111,110,196,49,93,134,23,21,211,34,146,
+    112,91,5,131,56,33,226,54,198,70,20,211,1,15,121,141,105,23,71,160,160,222,140,223,237,192,72,99,186,26,131,56,54,213,
+    3,72,68,178,161,116,240,2,81,221,52,21,165,128,135,232,145,242,179,172,54,147,109,198,44,107,199,248,8,235,239,198,104,
+    90,166,124,0,137,72,86,4,193,13,193,253,228,251,238,70,209,250,204,67,156,155,3,103,89,5,245,38,204,183,131,153,16,97,
+    253,22,124,68,221,28,24,64,34,146,29,23,6,175,82,206,119,39,10,45,224,190,156,136,105,5,245,38,44,176,131,24,19,97,253,
+    110,12,166,122,78,12,32,17,201,146,195,131,97,17,223,174,229,78,47,46,204,137,179,172,150,190,55,106,145,29,202,168,
+    8,235,95,197,203,148,201,137,1,36,34,89,211,44,24,193,206,190,59,81,8,183,115,101,206,156,101,21,212,27,88,98,93,35,
+    188,17,33,224,54,122,5,65,206,12,32,17,201,154,157,130,225,52,241,221,137,45,184,153,203,115,232,44,171,160,94,207,114,
+    235,198,144,200,170,151,226,121,174,200,161,225,35,34,89,84,35,248,144,131,124,119,98,51,110,226,159,57,116,158,213,
+    210,247,122,86,217,201,17,190,122,163,60,111,114,98,14,13,31,17,201,170,10,193,219,28,235,187,19,155,240,111,174,203,
+    177,243,172,130,122,45,171,172,123,132,239,155,222,138,129,116,206,177,225,35,34,89,85,42,120,145,115,125,119,98,35,
+    254,193,141,57,119,158,85,80,175,97,118,46,47,69,86,125,71,70,178,127,206,13,31,17,201,174,252,224,225,160,151,239,78,
+    172,231,82,238,200,185,243,172,150,190,215,48,59,151,199,35,171,222,152,145,212,207,185,225,35,34,89,119,85,240,64,130,
+    98,228,82,238,202,201,243,108,114,126,194,158,93,73,239,200,106,239,195,16,182,205,201,225,35,34,89,119,65,240,10,101,
+    124,119,2,128,179,185,211,119,23,34,162,160,6,224,95,118,71,100,181,219,48,132,106,138,105,17,201,81,71,6,111,81,193,
+    119,39,56,151,71,201,205,27,95,181,244,13,192,67,246,223,200,106,31,194,123,84,204,201,193,35,34,242,151,142,193,80,
+    182,241,218,131,51,120,48,71,99,26,52,163,6,250,216,69,145,213,62,150,55,40,155,179,131,71,68,228,47,251,4,31,81,199,
+    91,235,167,241,24,121,57,124,166,205,124,80,15,177,211,34,122,11,42,156,204,11,148,204,225,193,35,34,242,183,250,193,
+    112,118,241,210,242,177,60,158,211,49,157,249,160,254,220,14,103,89,68,181,207,231,25,74,228,244,224,17,17,249,127,219,
+    7,31,211,56,246,86,143,225,5,242,115,250,76,155,241,107,212,223,217,33,44,140,168,246,85,60,24,228,246,119,60,17,145,
+    117,213,8,134,176,79,172,45,118,227,165,12,76,136,50,28,212,211,173,19,179,34,170,125,57,189,114,126,232,136,136,172,
+    175,90,48,148,118,177,181,118,36,47,100,32,166,51,28,212,243,237,80,166,70,84,251,10,110,207,192,208,17,17,217,80,133,
+    224,109,58,199,210,210,193,188,148,137,93,64,153,93,250,94,98,93,24,23,81,237,43,184,45,3,67,71,68,100,227,202,5,111,
+    114,76,228,173,116,226,53,74,103,228,92,155,201,160,94,101,39,243,113,68,181,21,211,34,146,117,165,130,62,156,30,105,
+    11,29,121,131,50,153,57,215,102,48,168,205,206,225,181,136,106,95,169,152,22,17,33,63,120,130,158,145,85,239,192,155,
+    25,138,233,76,46,125,255,147,39,34,170,252,47,110,205,204,208,17,17,217,156,32,184,155,43,35,169,220,134,55,51,246,32,
+    169,204,5,245,147,118,75,68,149,175,228,63,153,26,58,34,34,155,19,4,183,70,240,26,204,150,188,77,185,140,157,107,51,
+    22,212,195,236,188,136,42,95,165,217,180,136,200,122,174,10,110,115,90,111,127,250,83,33,99,231,218,140,45,125,127,99,
+    71,178,60,146,202,87,233,190,105,17,145,141,184,34,120,216,89,208,52,225,221,76,190,228,40,67,65,61,219,186,50,47,146,
+    202,138,105,17,145,77,57,55,120,196,73,212,236,205,64,170,102,242,92,155,153,160,94,98,93,248,33,146,202,87,43,166,69,
+    68,54,227,236,224,41,242,67,214,216,155,193,108,149,201,115,109,102,150,190,205,206,226,211,72,42,159,199,45,153,28,
+    58,34,34,133,119,74,240,18,37,67,252,249,198,153,157,77,67,102,102,212,215,242,98,36,117,79,226,1,223,135,38,34,146,
+    2,221,130,215,41,83,204,63,219,128,15,168,150,217,152,206,72,80,63,101,238,111,17,0,232,194,83,57,254,22,84,17,17,87,
+    14,13,94,167,108,49,254,92,125,134,80,51,211,103,218,12,4,245,71,118,110,36,117,219,210,55,19,15,132,23,17,113,163,115,
+    240,62,21,139,248,103,118,97,8,219,102,250,76,155,129,107,212,147,236,136,72,110,201,218,55,83,143,176,19,17,113,225,
+    128,160,63,149,139,240,239,239,204,80,106,101,254,76,155,227,65,61,219,186,48,55,130,186,141,120,47,147,119,243,137,
+    136,132,211,50,24,66,181,66,254,187,59,48,144,237,116,166,205,237,160,94,102,135,71,114,75,86,189,140,111,108,16,17,
+    41,190,38,193,96,182,46,196,191,183,35,31,178,163,206,180,185,190,244,125,33,35,35,168,90,139,129,90,138,17,17,41,182,
+    61,131,143,216,110,11,255,78,29,6,179,131,206,180,64,78,207,168,31,176,199,35,168,90,141,1,212,211,224,17,17,9,161,65,
+    240,49,117,55,243,207,107,51,84,103,218,53,114,54,168,71,216,63,34,168,90,145,254,52,212,224,17,17,9,169,110,48,140,
+    157,55,241,207,106,48,128,157,116,166,93,45,103,151,190,167,217,81,17,236,245,46,197,27,52,211,224,17,17,113,96,251,
+    96,40,245,55,242,247,107,48,140,221,116,166,93,75,78,6,245,82,59,154,223,157,87,13,120,140,118,26,60,34,34,142,212,14,
+    62,100,143,245,254,222,214,12,162,129,206,180,235,200,201,160,62,159,209,17,84,253,47,167,104,240,136,136,56,84,35,248,
+    144,125,215,250,223,85,121,159,70,58,211,174,39,7,131,250,46,123,42,130,170,103,113,141,6,143,136,136,99,85,131,15,216,
+    127,245,127,175,194,64,154,232,76,187,158,28,188,70,61,216,174,138,160,234,193,60,236,251,192,68,68,114,82,149,96,32,
+    237,128,202,12,160,169,98,122,35,114,44,168,167,216,113,172,116,94,181,41,125,41,161,225,35,34,18,137,242,193,91,28,
+    197,0,109,214,221,40,35,48,223,125,112,104,137,181,98,172,243,170,59,242,73,198,223,220,34,34,34,197,181,163,253,20,
+    234,207,151,207,165,25,181,217,233,17,196,116,101,222,82,76,139,136,136,55,57,20,212,183,243,178,243,154,165,121,155,
+    61,20,211,34,34,226,73,14,109,38,251,212,254,229,188,102,192,227,180,86,76,139,136,136,71,57,18,212,179,236,24,86,56,
+    175,122,27,39,43,166,69,68,196,171,156,8,234,2,59,153,95,157,87,61,159,203,21,211,34,34,226,85,142,44,125,255,143,1,
+    206,107,118,224,94,223,135,37,34,34,146,11,183,103,125,104,237,89,229,184,102,93,70,81,93,243,105,17,17,9,41,236,237,
+    89,101,211,63,163,254,221,78,116,30,211,21,121,75,49,45,34,34,137,144,242,160,46,176,147,153,238,184,102,30,47,232,161,
+    240,34,34,146,8,169,191,70,125,35,3,157,215,252,31,93,20,211,34,34,146,16,169,190,70,61,212,58,58,95,246,238,198,203,
+    4,10,106,17,17,113,34,236,53,234,50,105,158,81,207,180,147,156,199,116,19,158,86,76,139,136,72,130,164,54,168,11,236,
+    36,126,115,92,179,38,111,82,78,49,45,34,34,137,145,226,107,212,255,102,176,227,138,101,120,157,218,138,105,17,17,73,
+    148,148,6,245,199,214,203,121,205,7,104,174,152,22,17,145,132,73,101,80,207,183,238,206,175,78,95,206,153,138,105,17,
+    17,73,152,148,46,125,159,71,184,61,116,27,58,8,247,51,116,17,17,145,240,82,24,212,207,219,75,142,43,214,225,121,242,
+    53,159,22,17,145,4,74,93,80,255,98,23,59,174,88,146,151,216,90,49,45,34,34,9,148,186,165,239,2,235,206,92,199,53,239,
+    160,165,98,90,68,68,18,42,101,65,221,139,97,142,43,30,203,197,138,105,17,17,73,172,84,61,66,116,172,237,207,114,167,
+    21,119,225,115,42,41,168,69,68,36,34,97,31,33,90,34,77,51,234,197,118,146,227,152,46,75,95,197,180,136,136,36,90,9,223,
+    29,40,188,127,48,201,113,197,71,217,75,49,45,169,176,220,22,49,151,69,44,98,33,243,88,196,66,22,50,15,99,30,127,173,
+    137,45,88,253,100,129,133,172,0,96,49,203,200,163,242,234,63,93,146,10,171,255,91,25,202,2,80,142,114,84,162,34,101,
+    169,64,101,202,81,142,42,127,253,61,125,34,68,18,198,210,19,212,111,219,163,142,43,246,160,187,78,74,146,40,43,109,38,
+    211,152,193,111,204,230,15,102,51,155,89,204,99,46,139,28,175,37,109,134,85,164,10,213,168,198,214,84,163,26,213,169,
+    77,77,106,83,131,82,250,180,136,120,146,146,107,212,51,173,49,191,59,173,216,132,17,148,209,169,71,188,90,110,63,49,
+    153,31,153,204,100,126,102,58,51,41,240,221,165,77,218,134,218,212,93,253,215,206,212,211,147,7,68,10,41,236,53,234,
+    252,180,4,117,87,123,219,105,189,170,124,78,61,157,104,196,139,159,108,28,95,243,21,95,243,29,43,125,119,166,152,202,
+    176,27,13,105,196,158,236,71,85,125,146,68,54,35,124,80,167,98,233,251,57,199,49,29,240,132,98,90,98,182,208,198,49,
+    134,17,124,196,76,223,93,113,96,41,95,240,197,234,255,190,173,181,162,37,77,217,71,107,84,34,145,72,193,140,122,166,
+    53,228,15,167,21,175,224,54,157,80,36,22,171,236,107,62,227,83,70,241,77,130,151,181,221,40,67,19,246,101,63,154,179,
+    163,62,95,34,107,132,157,81,231,165,33,168,143,182,215,156,214,107,202,72,109,140,145,136,173,176,209,12,101,24,159,
+    176,200,119,87,60,168,67,27,218,208,70,235,86,34,100,34,168,251,218,113,78,235,149,231,115,26,232,244,33,17,89,101,227,
+    24,206,8,6,48,223,119,87,18,96,91,90,209,129,150,52,212,39,78,50,44,231,131,122,182,53,116,188,219,251,49,206,210,73,
+    67,156,51,251,130,33,12,227,35,254,244,221,149,4,218,129,54,116,164,19,213,245,217,147,12,10,27,212,65,210,131,250,4,
+    235,227,180,222,145,188,166,83,133,56,181,200,134,240,14,239,241,139,239,142,36,94,30,123,211,129,195,104,65,158,62,
+    133,146,33,57,30,212,111,91,87,167,245,182,227,75,170,233,20,33,142,76,182,65,188,205,128,248,30,70,146,35,170,211,150,
+    195,232,162,219,186,36,35,114,58,168,231,90,67,126,115,88,47,143,65,180,213,169,65,66,91,102,131,121,151,247,152,234,
+    187,35,169,86,130,22,116,229,104,237,16,151,156,23,54,168,19,125,123,214,169,246,172,211,122,87,115,139,78,9,18,202,
+    50,27,64,63,222,210,70,49,135,118,167,27,39,80,95,159,77,201,89,57,28,212,253,237,16,167,245,116,83,150,132,177,212,
+    6,42,162,35,180,59,221,56,142,221,244,9,149,28,148,179,65,189,192,26,49,205,97,189,10,140,101,23,157,4,164,24,150,88,
+    127,250,241,174,118,115,199,160,49,199,112,2,59,235,147,42,57,37,103,131,186,135,61,230,180,222,19,156,161,15,191,20,
+    81,129,125,200,51,188,202,66,223,29,201,148,128,22,156,202,177,84,214,39,86,114,68,142,6,245,72,107,133,203,126,29,197,
+    171,250,208,75,145,252,108,47,209,155,201,190,187,145,89,165,233,200,41,28,73,9,125,114,37,245,114,50,168,87,89,179,
+    53,143,251,119,161,54,95,233,70,16,41,180,121,246,50,207,50,210,119,55,4,168,197,73,156,170,231,154,73,202,229,100,80,
+    63,98,231,57,172,22,240,30,157,245,65,151,66,40,176,15,120,154,183,88,234,187,35,178,142,102,156,203,9,148,213,167,88,
+    82,42,7,131,122,142,213,103,182,195,122,103,241,152,62,224,178,69,243,236,25,238,211,82,119,98,85,230,56,122,178,187,
+    62,203,146,66,57,24,212,231,218,163,14,171,109,199,215,84,209,135,91,54,107,140,245,230,57,150,248,238,134,108,65,64,
+    123,122,232,186,181,164,78,206,5,245,23,214,140,85,14,235,245,215,178,183,108,198,82,235,203,61,78,119,68,72,212,106,
+    209,157,11,169,173,207,181,164,70,142,5,181,89,75,62,113,88,239,76,30,215,199,89,54,225,59,123,128,103,245,0,147,84,
+    42,205,137,92,174,133,112,73,137,28,11,234,167,237,116,135,213,180,236,45,155,50,198,238,229,69,167,107,55,18,183,128,
+    67,233,73,7,125,194,37,241,114,42,168,255,180,250,14,95,194,161,221,222,178,49,5,246,46,183,50,194,119,55,196,145,166,
+    92,204,73,228,235,147,46,9,22,62,168,243,124,31,194,255,187,217,233,187,178,206,84,76,203,122,150,90,111,219,157,174,
+    138,233,28,50,134,83,105,196,19,182,44,57,51,14,17,231,18,51,163,254,201,26,56,188,127,181,14,227,245,8,66,89,203,28,
+    123,152,251,153,233,187,27,18,145,109,185,156,243,116,175,181,36,82,14,205,168,255,233,48,166,3,122,43,166,101,141,63,
+    236,6,171,199,191,20,211,57,236,55,254,193,14,220,106,75,146,50,243,16,113,40,33,51,234,113,214,148,2,103,213,206,166,
+    183,98,90,0,152,99,247,113,143,246,118,103,70,109,46,231,28,202,232,243,47,9,146,51,155,201,58,218,32,103,181,180,219,
+    91,254,242,167,61,68,47,230,249,238,134,196,108,123,46,227,92,74,235,28,32,9,145,35,75,223,239,57,140,105,232,173,152,
+    22,230,217,13,86,135,171,21,211,25,244,51,151,208,144,103,109,85,50,102,33,34,161,37,96,70,189,202,246,226,107,103,213,
+    142,161,159,98,58,227,254,180,187,185,91,17,157,121,13,185,67,247,126,72,2,228,196,210,247,19,118,150,179,90,149,152,
+    200,118,250,104,102,216,74,123,140,27,115,120,219,88,89,170,80,133,170,84,89,253,159,21,169,76,30,21,41,65,57,74,83,
+    154,114,27,252,137,197,44,99,33,43,88,192,42,230,81,192,60,230,51,135,185,252,193,92,230,228,252,213,251,131,184,131,
+    61,116,70,16,175,114,32,168,23,217,174,76,119,86,237,94,46,214,135,50,195,222,180,171,153,228,187,19,206,148,160,54,
+    219,83,155,26,108,71,13,182,163,38,181,156,223,205,176,202,230,48,147,95,152,193,47,204,96,26,51,248,149,25,57,245,204,
+    182,124,206,224,38,106,234,188,32,222,228,64,80,255,199,254,237,172,86,83,62,211,51,138,50,107,148,93,206,199,190,59,
+    17,82,69,234,83,151,122,212,163,46,245,216,158,146,94,70,243,114,155,202,100,126,92,243,87,250,223,207,93,129,171,184,
+    140,114,58,55,136,23,169,15,234,153,182,11,127,58,170,149,207,167,236,163,143,98,38,77,182,107,233,139,239,47,157,197,
+    83,145,221,104,180,250,255,118,72,228,248,157,102,223,48,158,137,124,205,68,22,250,238,76,177,213,230,191,156,76,94,
+    34,127,194,146,219,82,31,212,23,217,3,238,106,113,159,62,132,25,52,207,110,226,65,150,251,238,70,17,213,96,31,154,210,
+    148,61,19,26,206,27,103,54,149,9,76,96,44,99,248,209,119,103,138,161,57,15,179,87,138,126,222,146,27,234,218,212,144,
+    21,188,6,245,84,171,239,236,4,91,139,111,168,164,143,96,198,152,61,203,149,252,238,187,27,133,182,21,251,209,148,125,
+    104,154,3,239,83,158,99,159,51,134,207,249,156,159,125,119,165,8,74,112,33,55,234,76,33,177,74,121,80,159,110,79,59,
+    171,213,151,110,250,240,101,204,151,118,65,74,94,176,81,135,3,104,73,107,26,18,228,224,40,253,221,62,227,99,134,243,
+    57,43,124,119,165,80,106,113,23,199,229,224,239,65,146,42,213,65,61,201,26,57,219,93,122,48,239,233,131,151,41,243,237,
+    223,60,196,74,223,221,216,130,93,104,71,43,90,167,106,121,187,248,22,219,40,62,98,56,159,164,224,74,246,65,60,192,46,
+    153,248,173,136,127,169,14,234,99,173,159,163,74,229,248,154,186,250,208,101,134,217,243,92,201,12,223,221,216,140,170,
+    180,167,35,7,177,99,38,71,229,74,27,203,32,6,48,50,209,51,236,50,92,201,53,122,42,184,196,160,158,77,9,89,193,91,80,
+    143,181,125,156,237,210,253,31,215,232,227,150,25,227,237,66,62,242,221,137,77,200,167,5,29,57,136,125,116,155,32,176,
+    208,134,49,128,1,124,235,187,35,155,180,51,143,209,70,191,41,137,88,138,131,250,16,235,239,168,82,67,198,82,74,31,182,
+    76,88,102,255,225,182,68,206,211,202,211,137,174,28,70,53,141,196,13,252,108,3,120,135,129,44,246,221,145,141,8,56,159,
+    94,84,208,111,77,34,148,218,160,30,110,173,157,213,250,128,131,244,49,203,132,79,237,76,38,250,238,196,6,170,115,48,
+    93,56,88,39,251,45,88,98,35,120,155,126,252,230,187,35,27,216,145,199,232,160,223,158,68,38,181,65,125,128,185,122,134,
+    212,145,188,166,143,88,6,44,182,127,113,95,194,30,109,89,147,110,28,199,254,122,136,70,17,172,178,145,188,146,184,184,
+    14,56,151,91,169,168,223,163,68,98,39,155,28,178,130,151,160,238,111,135,56,170,84,138,175,181,119,51,3,134,219,89,137,
+    186,210,89,133,46,116,227,96,74,104,236,21,75,129,141,164,31,125,18,117,7,252,14,60,174,121,181,68,34,149,65,109,214,
+    140,49,142,106,93,205,45,250,104,229,184,5,118,21,143,38,230,241,160,229,233,202,241,116,214,174,8,7,86,216,64,158,231,
+    245,196,60,75,60,160,7,183,107,94,45,206,165,50,168,95,177,110,142,42,109,203,183,250,88,229,184,1,118,118,98,158,124,
+    213,156,51,56,94,35,206,177,121,214,135,167,249,204,119,55,86,171,203,11,236,175,223,176,56,181,179,133,125,224,110,
+    236,65,93,96,123,56,219,16,244,20,167,233,35,149,195,150,218,213,220,151,136,185,244,54,156,204,153,236,174,209,22,153,
+    137,246,52,207,37,226,222,248,18,252,155,107,117,123,157,56,148,194,160,238,99,39,56,170,212,140,79,181,141,39,135,141,
+    183,147,24,239,187,19,228,209,153,51,57,76,75,221,49,88,110,111,240,48,31,38,224,171,89,107,158,103,123,253,198,197,
+    145,212,5,117,129,237,201,215,78,42,5,124,68,43,125,148,114,148,217,99,92,234,253,190,219,202,156,202,37,122,230,93,
+    204,190,179,39,121,156,63,60,247,162,18,15,113,146,126,243,226,68,234,130,218,221,124,250,36,158,215,199,40,71,205,176,
+    211,248,192,115,31,246,228,66,78,164,156,198,152,23,139,236,69,238,101,130,231,94,156,193,189,186,59,94,28,216,197,126,
+    8,89,33,214,160,118,55,159,46,203,36,45,77,229,168,15,236,116,175,119,217,230,115,48,61,105,159,147,239,185,74,151,225,
+    118,43,239,122,93,8,215,214,50,113,33,124,80,231,197,217,221,190,142,98,26,174,81,76,231,164,165,118,158,117,246,24,
+    211,21,184,132,41,188,29,116,8,20,211,254,181,10,222,14,190,230,108,202,122,235,193,20,218,112,175,255,75,230,146,121,
+    49,206,168,221,237,247,222,129,111,40,171,19,105,206,249,209,186,241,133,183,214,183,230,34,46,96,43,141,171,196,153,
+    101,247,241,0,243,188,181,127,28,143,107,9,92,66,216,213,190,15,89,33,198,25,117,63,103,183,101,221,166,152,206,65,111,
+    218,62,222,98,186,46,15,48,149,235,2,197,116,18,109,29,252,39,248,137,91,169,233,169,253,151,217,151,111,52,175,22,143,
+    98,155,81,23,88,99,71,155,67,246,229,83,93,63,204,49,43,237,90,238,240,116,53,114,119,254,201,177,122,24,104,10,44,181,
+    167,184,157,176,175,55,40,158,10,60,193,177,26,35,82,44,41,154,81,247,115,182,135,179,151,98,58,199,252,102,237,185,
+    221,75,76,215,231,5,198,115,98,160,152,78,131,50,193,121,193,119,60,69,61,15,109,47,228,56,46,177,21,154,87,75,49,132,
+    63,189,196,52,163,46,176,189,28,61,188,162,19,239,235,164,154,83,62,178,227,189,108,31,219,145,107,56,67,51,233,20,90,
+    97,47,241,31,194,238,163,45,142,102,244,99,7,141,24,41,162,212,204,168,95,113,20,211,1,255,139,167,195,18,11,179,94,
+    214,206,67,76,215,227,41,190,167,135,102,210,169,84,50,56,37,152,192,35,108,31,123,203,163,217,143,97,154,85,75,17,133,
+    63,205,196,18,212,5,118,147,163,74,199,210,68,167,214,156,177,216,142,227,154,216,223,49,93,131,135,153,196,105,10,233,
+    84,43,21,156,19,124,207,189,108,29,115,187,51,57,136,71,20,213,18,179,88,130,250,85,71,215,167,75,242,159,56,186,43,
+    177,248,197,90,211,47,230,54,203,241,47,190,231,220,160,164,66,58,7,148,10,46,14,126,228,58,202,199,218,234,10,206,227,
+    34,91,169,176,150,66,75,201,140,186,151,163,58,103,177,139,78,176,57,226,11,107,193,216,88,91,204,163,27,19,249,79,160,
+    215,84,230,146,138,193,77,193,84,174,162,116,172,173,62,64,123,102,41,170,165,144,194,15,149,24,130,250,93,115,115,66,
+    46,199,117,209,119,86,98,241,162,181,96,90,172,45,118,102,28,125,3,109,4,202,69,213,131,94,193,120,142,138,181,205,143,
+    104,201,183,138,106,41,148,84,204,168,93,109,255,234,201,182,58,205,230,128,2,251,167,157,204,210,24,91,220,149,247,
+    233,31,236,161,209,147,195,118,9,94,13,134,176,87,140,45,126,79,115,6,40,170,165,16,82,16,212,195,108,164,147,58,85,
+    185,34,234,174,74,12,22,217,49,252,47,198,123,166,203,113,61,95,209,73,33,157,1,109,131,49,60,19,227,243,203,230,113,
+    8,183,42,170,101,139,82,176,244,237,106,62,125,13,85,117,178,77,189,95,172,37,175,199,216,222,241,124,199,13,65,105,
+    141,156,140,200,11,78,9,190,229,10,74,197,212,222,42,174,166,135,54,150,201,22,36,254,129,39,163,109,95,39,117,106,241,
+    189,222,13,156,122,19,237,96,126,142,173,181,250,220,199,65,26,51,153,244,131,93,24,227,27,205,59,240,42,149,52,210,
+    100,147,118,179,73,33,43,68,60,163,118,53,159,190,81,49,157,122,31,91,171,216,98,186,60,119,241,181,98,58,179,118,14,
+    222,15,250,80,43,166,214,6,209,142,25,154,85,203,38,37,124,70,253,141,53,162,192,65,157,122,124,171,71,61,166,220,27,
+    118,34,75,98,106,235,64,30,211,141,124,194,34,187,157,91,88,30,75,91,59,210,159,6,26,115,178,81,9,159,81,255,215,73,
+    76,195,181,138,233,148,123,208,142,142,41,166,171,241,12,195,2,197,180,64,249,224,134,96,52,205,99,105,107,42,173,24,
+    169,89,181,108,84,162,119,125,79,182,151,157,212,217,158,238,209,117,82,34,103,118,131,93,232,232,43,219,150,116,99,
+    34,167,40,164,101,141,198,193,8,30,165,98,12,45,253,65,59,250,42,170,37,18,17,6,245,173,172,116,82,231,90,74,233,212,
+    155,90,43,236,116,110,140,165,165,58,188,77,223,96,27,141,21,89,71,94,208,35,248,138,131,98,104,105,25,39,242,128,162,
+    90,54,144,224,107,212,191,218,78,44,115,80,167,14,63,40,168,83,107,177,29,205,251,177,180,212,157,251,168,162,113,34,
+    155,244,172,93,198,31,49,180,115,37,189,8,52,18,101,45,13,109,98,200,10,145,205,168,239,116,18,211,112,149,98,58,181,
+    22,218,161,177,196,116,117,94,225,217,64,49,45,155,115,74,48,129,174,49,180,115,27,103,178,74,243,106,113,42,162,25,
+    245,92,219,158,133,14,234,108,203,143,148,213,9,56,149,230,219,33,184,121,42,221,230,117,226,9,182,211,24,145,66,233,
+    103,231,48,55,242,86,14,167,15,101,52,38,101,181,196,206,168,31,118,18,211,112,181,98,58,165,230,90,167,24,98,186,28,
+    247,208,95,49,45,133,214,45,24,71,251,200,91,121,147,67,89,168,89,181,56,19,201,140,122,153,213,229,55,7,117,106,50,
+    89,65,157,74,191,91,71,190,138,188,149,253,121,158,122,26,31,82,68,102,15,112,53,139,35,110,165,53,111,83,89,163,83,
+    128,70,54,33,100,133,72,102,212,207,59,137,105,184,66,49,157,74,51,172,125,228,49,29,112,49,195,20,211,82,12,65,112,
+    81,48,38,242,55,109,125,76,59,189,179,90,28,137,32,168,205,238,114,82,167,58,61,98,254,97,136,11,63,91,107,190,142,184,
+    141,234,188,195,189,129,182,25,74,113,53,8,62,225,98,7,183,205,108,206,88,14,224,23,69,181,56,16,65,80,191,75,216,11,
+    231,127,185,130,10,58,17,167,206,100,59,128,31,34,110,227,64,190,228,16,141,13,9,165,76,112,111,240,58,213,34,109,99,
+    18,7,240,163,162,58,243,18,249,100,178,59,156,84,169,206,249,238,187,38,17,251,217,218,241,83,164,45,228,113,29,131,
+    169,165,152,22,7,14,15,190,228,192,72,91,152,66,107,38,40,170,37,36,231,65,61,202,62,116,82,167,167,230,211,169,51,221,
+    218,71,28,211,219,48,144,155,130,124,141,12,113,100,187,96,16,87,70,186,4,254,27,109,249,82,81,157,105,9,156,81,223,
+    238,164,74,57,206,115,221,49,137,216,44,235,24,241,162,119,19,70,209,78,33,45,78,149,8,110,13,222,164,106,132,45,204,
+    162,13,159,41,170,51,44,252,47,223,113,80,79,177,215,157,212,57,131,106,58,33,167,202,60,235,236,104,111,194,166,116,
+    103,56,59,104,84,72,4,186,4,163,104,28,97,253,121,116,226,19,69,117,102,37,110,70,125,39,171,28,84,201,231,18,183,221,
+    146,136,205,183,142,140,141,176,126,41,30,230,217,64,55,235,73,84,118,14,62,137,244,45,125,243,233,204,112,69,117,70,
+    37,44,168,231,216,211,78,234,28,201,78,58,37,167,200,98,235,202,231,17,214,175,197,48,206,213,136,144,72,149,11,158,
+    13,238,33,63,178,250,11,232,196,32,69,117,38,37,108,233,251,33,22,57,169,115,153,203,78,73,196,150,216,161,124,20,97,
+    253,150,124,206,254,138,105,137,65,207,224,45,42,69,86,125,49,135,51,64,81,157,65,137,154,81,175,176,135,157,212,105,
+    161,211,114,138,172,176,163,24,22,97,253,147,25,204,182,26,15,18,147,67,130,79,216,41,178,234,139,57,156,119,21,213,
+    82,100,14,131,250,21,166,59,169,115,185,167,31,133,20,157,217,25,17,190,200,50,224,70,158,165,180,98,90,98,180,123,48,
+    138,182,145,85,95,202,81,188,161,168,206,152,68,205,168,239,115,82,165,94,44,239,140,21,55,174,228,249,200,106,151,230,
+    89,254,29,4,138,105,137,217,86,193,251,156,28,89,245,229,28,195,243,138,234,76,73,208,53,234,49,246,169,147,58,151,163,
+    199,89,164,197,131,230,230,41,116,27,83,141,1,156,172,145,32,94,148,10,158,229,250,200,170,175,226,52,158,81,84,103,
+    72,130,102,212,247,56,169,178,21,167,184,234,144,68,172,143,93,28,89,237,93,24,201,1,138,105,241,38,8,110,8,30,167,68,
+    68,213,87,113,6,79,42,170,165,208,28,5,245,76,235,231,164,206,5,148,215,233,57,21,6,218,169,20,68,84,251,64,70,177,171,
+    198,129,120,118,102,208,151,178,17,213,46,224,108,122,43,170,51,34,49,51,234,71,88,230,160,74,105,189,136,35,37,190,
+    178,110,44,143,168,118,87,250,83,69,49,45,9,112,100,48,148,234,17,213,46,224,92,238,85,84,75,161,56,9,234,21,214,219,
+    73,103,186,83,83,39,232,20,248,209,14,98,126,68,181,207,230,53,244,4,50,73,138,253,130,143,216,33,162,218,198,165,220,
+    169,168,150,66,112,18,212,174,110,204,186,200,235,143,66,10,103,142,29,204,204,136,106,255,147,71,181,153,80,18,101,
+    183,96,100,100,207,1,55,46,231,22,69,117,206,75,200,210,183,155,27,179,90,211,88,167,232,196,91,97,221,248,62,146,202,
+    1,119,112,179,110,199,146,196,169,21,140,224,160,200,170,95,203,213,138,234,28,151,136,219,179,92,221,152,165,23,91,
+    166,193,69,12,137,164,110,41,94,228,31,10,105,73,164,10,193,219,156,16,89,245,91,185,82,81,157,211,18,49,163,190,223,
+    201,161,212,224,104,39,117,36,74,119,218,163,145,212,45,195,235,28,175,152,150,196,42,21,60,31,225,59,253,110,231,31,
+    102,10,235,156,149,128,160,158,239,232,198,172,179,40,165,19,117,194,245,183,171,34,169,91,142,183,56,68,191,125,73,
+    180,188,224,238,224,30,215,239,5,94,227,46,206,163,64,81,157,163,18,176,244,253,2,139,29,28,72,62,103,185,248,121,72,
+    132,38,218,9,78,222,54,190,190,114,188,69,71,197,180,164,64,207,160,47,101,34,170,253,40,231,40,170,101,19,66,7,245,
+    19,78,186,113,24,59,234,84,157,104,179,173,75,36,183,100,149,231,29,218,235,119,47,41,113,116,240,46,149,35,170,253,
+    56,221,89,169,168,206,65,222,151,190,199,218,88,39,7,162,141,100,201,182,212,186,48,57,130,186,85,24,68,91,197,180,164,
+    72,187,224,213,200,106,191,72,15,223,135,39,17,8,127,138,11,249,48,219,199,157,28,198,206,116,116,82,71,162,114,46,110,
+    118,246,175,107,43,62,96,31,197,180,164,202,28,187,34,178,218,165,181,165,86,54,42,212,140,122,137,189,228,164,19,231,
+    146,167,211,117,130,61,108,207,68,80,181,18,239,43,166,37,101,230,89,39,190,136,168,118,41,250,114,168,62,17,178,17,
+    161,130,186,47,243,28,116,161,44,167,249,254,41,200,102,140,178,75,35,168,90,142,183,105,166,147,146,164,202,60,235,
+    200,231,17,213,46,69,63,186,234,19,33,27,21,42,168,221,108,36,59,158,106,26,158,137,245,135,29,231,228,133,43,235,42,
+    203,59,122,141,165,164,140,98,90,124,9,17,212,223,217,112,39,93,208,70,178,228,42,176,19,153,234,188,106,41,250,105,
+    11,153,164,140,98,90,252,9,177,153,236,113,7,183,113,67,83,45,128,38,216,63,25,224,188,102,73,94,214,149,56,73,153,57,
+    214,33,178,107,211,165,121,85,159,136,156,230,241,246,172,2,123,209,201,33,156,225,238,167,33,142,189,101,183,58,175,
+    153,207,211,28,161,147,146,164,138,182,144,137,95,197,158,81,127,200,175,14,154,47,19,225,163,238,37,156,239,236,20,
+    39,107,38,107,11,120,140,19,117,82,146,84,209,108,90,194,241,56,163,118,115,99,86,87,170,106,144,38,210,82,235,22,193,
+    147,200,110,231,116,253,190,37,85,20,211,226,95,49,131,122,185,189,230,164,249,211,124,31,191,108,194,21,124,229,188,
+    230,249,122,145,165,164,140,22,189,37,9,138,25,212,239,243,135,131,198,107,69,248,58,118,9,163,191,61,232,188,230,177,
+    142,94,136,42,18,23,237,244,150,100,40,102,80,187,89,248,62,133,124,13,212,4,250,53,130,171,211,7,240,140,158,63,39,
+    169,162,152,150,164,40,86,80,47,178,183,157,52,126,138,239,163,151,141,40,176,83,153,237,184,102,67,222,160,140,78,75,
+    146,34,138,105,113,197,211,102,178,55,88,228,160,243,205,217,77,67,53,129,122,49,216,113,197,237,120,79,155,6,37,85,
+    20,211,146,36,197,10,106,55,11,223,167,249,62,118,217,136,209,118,131,227,138,149,120,151,237,117,90,146,20,81,76,75,
+    178,20,227,62,234,63,108,160,131,134,203,112,156,239,99,151,13,204,183,227,88,225,180,98,73,94,103,79,157,150,36,69,
+    116,67,150,184,229,101,233,251,21,150,59,232,250,17,84,209,112,77,156,11,153,226,184,226,61,180,211,239,89,82,68,49,
+    45,201,83,140,160,126,217,73,195,167,249,62,114,217,192,27,246,188,227,138,231,113,190,78,75,146,34,138,105,113,47,252,
+    47,61,40,234,109,56,127,88,77,86,134,110,118,59,126,210,173,89,9,243,135,53,98,134,211,138,173,25,68,41,253,150,37,53,
+    116,109,90,162,208,220,62,11,89,161,200,215,168,223,118,16,211,208,93,49,157,56,23,57,142,233,157,120,93,49,45,41,162,
+    217,180,68,195,195,53,234,215,157,116,92,175,226,72,154,55,205,205,94,254,191,85,228,13,170,233,196,36,169,161,135,133,
+    74,114,21,49,168,23,219,32,7,141,214,167,177,6,109,162,204,182,115,156,214,203,227,5,26,233,119,44,169,161,69,111,73,
+    178,34,46,125,191,207,98,7,141,234,198,172,164,185,144,153,78,235,253,143,46,58,49,73,106,104,209,91,162,20,251,210,
+    183,155,133,111,5,117,178,188,105,110,118,242,255,237,48,174,244,125,72,34,133,166,69,111,73,186,34,205,168,87,216,187,
+    14,154,108,196,238,26,184,9,50,203,122,56,173,87,151,103,9,244,27,150,148,208,108,90,162,22,243,140,122,24,115,29,116,
+    250,248,168,126,26,82,44,151,243,187,195,106,165,233,167,231,122,75,106,104,54,45,209,11,255,46,194,34,5,245,27,78,58,
+    125,108,36,63,10,41,158,143,237,57,167,245,238,165,169,78,77,146,18,218,66,38,113,136,117,70,109,246,150,131,46,55,97,
+    23,13,222,196,88,110,231,58,125,243,244,241,156,163,223,174,164,132,98,90,210,162,8,65,61,138,95,28,52,168,141,100,73,
+    114,59,19,29,86,171,79,111,223,7,36,82,72,138,105,73,143,34,108,38,115,49,159,14,232,230,251,136,101,141,201,246,95,
+    135,213,42,240,26,21,117,114,146,84,208,22,50,137,79,172,75,223,253,29,116,184,25,117,53,128,19,227,66,150,56,172,118,
+    175,118,243,75,74,40,166,37,93,10,29,212,51,108,156,131,230,180,240,157,28,253,204,197,87,175,191,29,193,25,58,57,73,
+    42,104,167,183,164,77,161,131,250,125,7,155,142,2,142,246,125,188,178,218,159,118,169,195,106,181,120,220,247,1,137,
+    20,138,174,77,75,250,20,250,26,245,251,14,26,219,159,29,52,136,19,226,6,126,117,86,43,224,105,189,128,67,82,65,139,222,
+    18,191,216,174,81,175,178,129,14,186,123,68,164,63,12,41,188,31,237,65,135,213,122,210,81,167,39,73,1,45,122,75,58,21,
+    50,168,63,99,142,131,198,186,248,62,90,89,237,31,44,115,86,107,119,254,231,251,112,68,10,65,139,222,146,86,133,12,106,
+    23,219,142,118,162,129,6,114,34,12,179,55,157,213,42,205,139,148,213,239,85,18,79,49,45,190,132,31,26,133,188,70,237,
+    226,10,117,215,104,127,22,82,72,5,118,153,195,106,255,99,79,157,160,36,241,116,109,90,210,172,80,51,234,89,54,214,65,
+    83,135,251,62,86,1,224,105,135,39,172,253,232,233,251,112,68,182,72,215,166,37,221,10,21,212,253,41,8,221,208,86,180,
+    244,125,172,2,44,180,235,156,213,42,197,19,228,235,20,37,9,167,69,111,73,187,66,5,181,139,133,239,131,41,161,225,156,
+    0,183,50,221,89,173,127,209,80,191,83,73,56,197,180,248,22,203,53,234,2,39,183,102,29,22,253,79,67,182,104,154,221,229,
+    172,214,30,92,229,251,112,68,182,64,215,166,197,191,88,238,163,254,146,217,161,155,41,201,193,113,252,60,100,11,254,
+    205,98,71,149,242,121,156,82,58,73,73,162,41,166,37,55,20,34,168,135,56,104,230,64,42,107,72,123,247,157,61,239,172,
+    214,37,236,171,223,168,36,154,182,144,73,174,40,68,80,15,117,208,140,30,117,146,4,215,177,210,81,165,29,185,193,247,
+    193,136,108,150,174,77,75,238,216,226,53,234,149,246,177,131,102,116,133,218,191,47,237,21,103,181,30,163,130,78,83,
+    146,96,90,244,150,228,136,225,26,245,88,22,132,110,164,17,245,52,172,189,187,206,193,77,118,127,57,142,14,250,125,74,
+    130,105,209,91,146,36,252,155,39,183,56,163,214,194,119,110,248,204,222,118,84,169,60,183,251,62,24,145,205,208,108,
+    90,146,37,134,25,181,139,173,100,157,227,248,89,200,102,253,203,89,165,127,82,71,39,42,73,44,205,166,37,247,108,33,168,
+    87,216,136,208,77,148,103,63,223,71,153,121,31,219,32,71,149,118,194,229,147,194,69,220,210,22,50,201,69,91,8,234,81,
+    44,10,221,68,27,74,107,112,123,230,110,62,125,175,126,155,146,88,138,105,73,162,200,159,76,230,226,10,117,135,120,126,
+    22,178,73,3,237,35,71,149,186,104,225,79,18,75,215,166,37,87,109,97,70,237,226,10,117,71,223,199,152,121,189,28,213,
+    41,205,157,190,15,69,100,19,116,109,90,114,215,102,103,212,75,237,211,208,13,212,98,119,223,199,152,113,163,205,197,
+    215,45,128,43,216,69,39,43,73,36,205,166,37,185,34,222,245,61,138,37,161,27,104,79,160,33,238,149,171,249,116,13,189,
+    132,67,18,74,49,45,185,109,179,65,29,126,199,55,28,228,251,8,51,238,91,123,195,81,165,235,244,52,50,73,36,45,122,75,
+    174,219,108,80,143,12,93,62,160,189,239,35,204,184,91,29,61,143,172,30,103,251,62,20,145,141,208,78,111,201,125,155,
+    9,106,115,112,133,186,17,219,106,152,123,244,139,189,224,168,210,45,122,169,165,36,144,98,90,146,47,210,107,212,223,
+    58,120,15,181,110,205,242,235,78,150,59,169,179,15,221,124,31,138,200,6,20,211,146,13,155,9,106,23,87,168,117,107,150,
+    79,115,236,113,71,149,122,105,75,160,36,142,98,90,178,98,51,183,103,125,18,186,120,41,14,240,125,124,153,246,32,11,157,
+    212,233,68,123,157,178,36,97,180,211,91,210,34,210,165,239,240,91,201,90,80,94,131,221,155,21,246,136,147,58,121,206,
+    110,240,18,113,69,49,45,89,178,201,160,158,99,147,66,23,111,235,251,232,50,237,53,166,59,169,115,20,123,233,164,37,137,
+    162,152,150,52,137,112,70,61,210,193,203,174,91,199,251,211,144,117,220,231,164,74,224,240,133,30,34,46,232,190,105,
+    73,151,240,89,186,153,160,14,171,4,205,226,253,105,200,90,190,176,240,191,65,128,195,217,83,167,45,73,16,109,33,147,
+    180,137,116,70,29,86,19,61,201,202,35,55,243,105,184,214,247,129,136,172,69,49,45,89,180,137,160,94,97,163,67,151,110,
+    229,251,216,50,108,182,245,113,82,231,80,154,233,196,37,137,161,152,150,108,218,68,80,143,103,113,232,210,45,125,31,
+    91,134,245,102,169,147,58,215,248,62,16,145,53,20,211,146,85,155,8,234,49,14,74,183,240,125,108,153,181,210,209,141,
+    89,157,104,169,83,151,36,132,98,90,210,42,252,208,218,196,3,79,198,134,46,188,11,53,53,240,61,121,139,105,78,234,104,
+    191,183,36,133,110,200,146,244,138,108,51,89,248,25,181,174,80,251,243,152,147,42,7,208,74,39,47,73,4,197,180,100,219,
+    70,131,122,185,125,21,186,176,130,218,151,95,109,160,147,58,255,240,125,32,34,128,238,155,22,217,104,80,143,103,89,232,
+    194,218,74,230,203,83,172,114,80,101,103,14,243,125,32,34,232,218,180,200,38,130,58,252,194,119,117,118,245,125,100,
+    25,101,246,140,147,58,61,201,211,9,76,188,83,76,139,68,22,212,173,245,90,68,79,62,228,7,7,85,170,112,154,239,3,17,81,
+    76,139,0,155,8,234,240,31,13,45,124,251,242,148,147,42,61,244,84,57,241,78,49,45,185,33,146,219,179,150,219,132,208,
+    101,21,212,126,44,176,87,29,84,41,193,5,190,15,68,50,79,59,189,37,87,68,114,123,214,87,161,183,146,149,100,47,47,63,
+    14,233,195,34,7,85,142,97,123,157,196,196,43,237,244,150,220,17,254,237,89,27,153,81,135,127,216,201,238,148,209,199,
+    192,139,167,157,84,185,196,247,97,72,198,105,54,45,185,36,146,25,117,248,173,100,77,125,252,44,132,111,237,19,7,85,154,
+    176,159,78,99,226,145,98,90,100,93,27,9,234,240,31,145,125,124,31,85,70,189,228,164,74,15,223,135,33,153,166,69,111,
+    145,245,109,16,212,5,54,49,116,81,205,168,253,232,231,160,70,121,78,240,125,24,146,97,218,233,45,178,161,13,130,122,
+    114,232,237,72,37,105,236,251,168,50,105,156,131,175,88,112,28,149,116,42,19,79,20,211,146,139,34,184,70,61,62,116,201,
+    134,218,74,230,197,203,78,170,156,237,251,48,36,179,20,211,34,27,23,65,80,107,225,219,15,23,11,223,123,208,92,39,51,
+    241,66,49,45,178,41,10,234,28,241,153,253,232,160,138,230,211,226,135,98,90,114,87,34,151,190,21,212,62,184,88,248,46,
+    203,73,190,15,67,50,73,49,45,178,57,235,61,240,100,169,133,125,165,131,182,146,249,80,96,46,22,190,143,98,43,157,208,
+    36,118,186,111,90,114,155,243,25,245,196,208,239,50,214,86,50,31,62,230,23,7,85,186,251,62,12,201,32,221,55,45,185,206,
+    249,35,68,195,47,124,55,241,245,179,200,180,215,28,212,216,154,246,190,15,67,50,71,179,105,201,125,206,103,212,225,131,
+    90,79,37,243,225,109,7,53,142,165,132,78,106,18,43,205,166,69,10,99,189,25,245,215,161,11,238,233,251,136,50,104,188,
+    77,113,80,229,120,223,135,33,25,163,217,180,100,131,243,25,245,87,161,11,238,238,235,103,145,97,111,58,168,177,189,222,
+    33,46,177,210,108,90,164,176,214,153,81,207,181,223,66,150,219,142,42,250,120,196,238,29,7,53,78,32,208,111,78,98,163,
+    217,180,72,225,173,51,163,254,46,116,185,134,190,143,39,131,102,218,104,7,85,78,244,125,24,146,33,154,77,139,20,197,
+    58,65,253,109,232,114,10,234,248,189,69,65,232,26,187,209,88,167,54,137,137,30,111,34,82,52,235,44,125,127,31,186,220,
+    110,190,143,39,131,220,44,124,139,196,67,139,222,146,53,142,55,147,105,70,157,62,75,108,144,131,42,71,250,62,12,201,
+    8,45,122,139,20,157,227,160,214,140,58,110,3,89,28,186,198,142,52,210,233,77,98,160,69,111,145,226,88,107,233,219,66,
+    63,231,187,22,85,245,65,137,217,123,14,106,28,225,251,32,36,19,162,92,244,134,229,28,238,226,89,141,34,9,180,214,140,
+    122,90,232,185,153,22,190,227,55,208,65,141,35,124,31,132,100,64,148,139,222,34,185,109,173,160,214,205,89,233,51,213,
+    38,135,174,177,149,30,117,34,145,139,114,209,91,36,215,173,21,212,225,175,80,235,169,100,113,27,224,160,198,161,122,
+    198,183,68,76,49,45,18,134,211,25,181,130,58,110,46,118,124,31,238,251,32,36,199,41,166,69,194,113,26,212,218,243,29,
+    175,2,27,26,186,70,105,14,242,125,24,146,211,20,211,34,97,173,181,235,59,108,80,111,203,86,90,66,141,213,23,204,14,93,
+    163,45,21,245,91,147,200,68,187,211,91,36,27,214,204,168,151,219,79,33,75,237,226,251,88,50,199,197,194,119,71,223,7,
+    33,57,76,49,45,226,194,154,160,254,153,85,33,75,237,228,251,88,50,199,197,173,89,237,125,31,132,228,44,221,144,37,226,
+    198,154,160,158,18,186,84,61,223,199,146,49,75,109,100,232,26,219,208,216,247,97,72,142,210,181,105,17,87,214,92,163,
+    14,187,240,173,160,142,219,112,150,132,174,209,78,111,161,150,72,104,209,91,196,29,205,168,83,235,99,7,53,58,248,62,
+    8,201,73,90,244,22,113,105,77,80,79,13,93,74,65,29,175,17,14,106,180,243,125,16,146,131,180,232,45,226,150,179,25,117,
+    5,182,209,34,106,140,86,218,168,208,53,118,166,174,126,103,226,152,98,90,196,53,103,51,106,205,167,227,245,37,127,134,
+    174,161,29,223,226,154,98,90,196,189,213,155,201,150,218,140,144,133,20,212,241,10,191,227,91,65,45,174,105,11,153,72,
+    20,86,207,168,167,134,126,145,171,130,58,94,195,29,212,208,91,179,196,37,109,33,19,137,198,154,160,14,75,65,29,175,240,
+    51,234,186,212,210,21,106,113,70,139,222,34,81,89,29,212,186,57,43,93,166,218,47,161,107,236,239,251,32,36,135,40,166,
+    69,162,179,58,168,245,184,147,116,113,113,107,150,130,90,92,81,76,139,68,105,245,102,178,169,33,203,228,177,163,239,
+    35,201,20,23,91,201,20,212,226,134,182,144,137,68,107,245,140,250,215,144,101,106,81,90,215,59,99,244,105,232,10,229,
+    216,211,247,65,72,78,80,76,139,68,109,117,80,79,15,89,166,182,239,227,200,148,229,246,117,232,26,251,82,66,95,173,36,
+    52,237,244,22,137,222,234,160,254,45,100,153,90,190,143,35,83,198,179,60,116,141,22,190,15,66,114,128,174,77,139,196,
+    33,15,96,142,133,125,15,211,182,190,143,35,83,198,58,168,161,43,212,18,150,98,90,36,30,37,32,252,124,90,65,29,175,113,
+    14,106,236,227,251,32,36,229,116,109,90,36,46,121,16,126,43,153,150,190,227,53,62,116,133,109,168,169,43,212,18,130,
+    174,77,139,196,39,15,194,111,37,83,80,199,235,219,208,21,246,242,125,8,146,106,90,244,22,137,147,163,160,214,210,119,
+    124,230,217,239,161,107,232,214,44,41,62,197,180,72,188,242,192,197,53,106,205,168,227,51,201,65,13,5,181,20,151,98,
+    90,36,110,78,54,147,149,162,154,239,227,200,144,239,28,212,104,236,251,32,36,165,180,133,76,36,126,78,150,190,183,37,
+    208,214,164,216,76,14,93,161,52,13,124,31,132,164,146,182,144,137,248,224,100,70,93,211,247,81,100,74,248,247,102,237,
+    78,73,125,177,146,98,120,152,186,212,245,221,9,145,204,41,1,102,122,46,89,154,76,11,93,65,87,168,165,120,174,209,23,
+    60,17,15,242,96,1,203,66,22,209,158,239,56,133,15,106,93,161,22,17,73,143,60,152,21,186,136,102,212,113,10,31,212,187,
+    249,62,4,17,17,41,180,60,152,19,186,136,174,81,199,103,129,45,12,93,99,87,223,7,33,34,34,133,230,100,70,173,155,179,
+    226,19,254,183,85,154,29,124,31,132,136,136,20,90,30,252,17,186,72,85,223,71,145,33,179,67,87,216,133,124,109,9,18,17,
+    73,141,60,23,167,254,173,124,31,69,134,132,255,109,213,247,125,8,34,34,82,4,78,174,81,87,241,125,20,25,18,126,253,99,
+    39,223,135,32,34,34,69,224,100,70,173,165,239,248,132,255,109,213,241,125,8,34,34,82,4,14,130,186,20,21,116,205,51,54,
+    243,66,87,208,86,50,17,145,52,113,16,212,154,79,199,233,207,208,21,52,163,22,17,73,19,7,187,190,21,212,113,90,16,186,
+    194,246,190,15,65,68,68,138,64,65,157,50,97,31,119,82,158,173,116,161,66,68,36,69,20,212,41,19,118,233,91,207,101,23,
+    17,73,151,188,197,182,60,100,9,221,69,29,167,176,75,223,53,124,31,128,136,136,20,73,94,248,205,73,85,124,31,67,166,132,
+    93,250,222,198,247,1,136,136,72,145,56,8,106,205,168,227,180,36,228,159,215,140,90,68,36,93,242,194,191,139,73,215,168,
+    227,20,246,221,225,10,106,17,145,116,113,48,163,174,236,251,24,50,37,108,80,111,237,251,0,68,68,164,72,28,4,117,57,223,
+    199,144,41,75,67,254,121,189,146,84,68,36,93,28,4,117,25,223,199,144,41,97,103,212,90,255,16,17,73,23,7,65,93,214,247,
+    49,100,74,216,160,174,226,251,0,68,68,164,72,28,108,38,83,80,199,103,185,21,132,172,160,25,181,136,72,186,104,233,59,
+    85,86,132,174,80,201,247,33,136,136,72,145,104,233,59,85,194,206,167,117,51,157,136,72,218,56,88,250,214,140,58,62,97,
+    131,58,208,30,125,17,145,148,201,11,255,218,68,157,250,227,179,42,228,159,47,69,160,119,103,137,136,164,74,94,216,71,
+    82,106,233,59,78,97,103,212,165,124,31,128,136,136,20,81,94,216,119,103,41,168,227,20,54,168,75,251,62,0,17,17,41,162,
+    208,65,29,232,228,31,35,5,181,136,72,214,132,14,234,210,186,234,25,35,45,125,139,136,100,77,94,216,39,93,105,225,59,
+    78,97,55,147,105,70,45,34,146,54,161,103,212,10,234,56,105,70,45,34,146,53,161,131,90,167,254,56,89,200,63,175,25,181,
+    136,72,218,132,14,234,60,223,71,144,41,225,239,163,22,17,145,116,9,125,141,90,226,164,93,223,34,34,89,227,224,246,44,
+    137,143,130,90,68,36,107,20,212,169,162,165,111,17,145,172,113,240,100,50,137,79,216,205,100,249,190,15,64,68,68,138,
+    72,51,234,84,9,187,244,29,118,70,46,34,34,113,203,11,255,134,99,137,79,216,160,93,233,251,0,68,68,164,136,242,194,206,
+    136,53,163,142,83,216,175,85,10,106,17,145,180,81,80,103,138,130,90,68,36,109,66,7,181,196,41,236,227,101,20,212,34,
+    34,105,163,25,117,170,132,13,234,21,190,15,64,68,68,138,72,51,234,84,209,140,90,68,36,107,52,163,78,21,5,181,136,72,
+    214,40,168,83,37,236,3,75,20,212,34,34,105,147,23,118,142,166,251,176,227,164,107,212,34,34,89,19,250,45,149,122,251,
+    86,156,194,254,186,244,100,50,17,145,180,9,189,244,189,212,247,17,100,138,102,212,34,34,89,19,122,233,91,65,29,167,176,
+    215,168,21,212,34,34,105,163,160,78,149,176,191,173,133,190,15,64,68,68,138,40,175,116,200,2,75,177,176,239,94,148,66,
+    11,27,212,127,234,183,37,34,146,50,121,101,66,22,48,244,70,235,248,132,223,76,182,200,247,33,136,136,72,145,228,149,
+    13,93,66,139,223,241,9,189,73,159,5,190,15,65,68,68,138,36,244,140,90,65,29,39,5,181,136,72,214,104,70,157,42,225,131,
+    122,190,239,67,16,17,145,34,209,140,58,85,52,163,22,17,201,26,205,168,83,37,236,125,212,10,106,17,145,180,81,80,167,
+    138,150,190,69,68,178,198,193,210,183,158,246,29,159,82,161,43,104,70,45,34,146,46,154,81,167,74,201,32,236,156,90,65,
+    45,34,146,46,14,130,122,177,239,99,200,148,176,43,32,90,250,22,17,73,23,7,75,223,243,124,31,67,166,132,125,228,171,102,
+    212,34,34,233,146,87,41,116,137,121,190,143,33,83,194,6,245,108,223,7,32,34,34,69,146,87,37,116,137,121,190,143,33,83,
+    194,6,245,111,190,15,64,68,68,138,36,175,106,232,18,243,124,31,67,166,40,168,69,68,178,197,65,80,207,245,125,12,153,
+    18,118,243,223,76,189,232,82,68,36,85,52,163,78,153,10,33,255,252,50,230,248,62,4,17,17,41,2,5,117,202,84,12,93,65,139,
+    223,34,34,105,226,96,51,153,150,190,227,20,126,151,190,130,90,68,36,77,242,170,16,132,44,49,207,247,49,100,138,102,212,
+    34,34,217,146,87,34,8,123,213,83,51,234,56,41,168,69,68,178,37,15,194,94,165,94,200,10,237,35,142,141,130,90,68,36,91,
+    28,4,181,158,31,29,167,42,161,43,40,168,69,68,210,196,73,80,207,243,125,20,25,178,117,232,10,211,125,31,130,136,136,
+    20,65,30,84,15,93,100,158,239,163,200,144,240,191,173,25,190,15,65,68,68,138,32,15,106,134,46,162,71,104,196,39,124,
+    80,79,163,64,123,10,68,68,82,35,15,106,132,46,162,57,90,124,194,7,245,50,45,126,139,136,164,136,147,160,214,246,164,
+    248,132,15,106,248,209,247,65,136,136,72,161,57,89,250,86,80,199,167,98,16,254,6,173,201,190,15,66,68,68,10,77,75,223,
+    169,83,39,116,133,41,190,15,65,68,68,10,77,75,223,169,19,62,168,53,163,22,17,73,143,60,168,25,250,105,223,10,234,56,
+    133,15,234,239,124,31,130,136,136,20,90,30,148,14,42,135,44,162,160,142,83,248,160,158,132,233,6,45,17,145,148,200,131,
+    240,139,223,11,89,168,19,127,108,234,134,174,240,39,191,250,62,8,17,17,41,164,60,208,190,239,116,169,239,160,198,36,
+    223,7,33,34,34,133,228,100,70,173,160,142,147,139,160,254,198,247,65,136,136,72,33,105,70,157,58,149,131,240,191,175,
+    137,190,15,66,68,68,10,41,15,160,118,232,50,10,234,56,133,159,83,143,247,125,8,34,34,82,72,121,224,98,31,177,30,121,
+    18,167,70,161,43,124,169,23,115,136,136,164,132,163,160,214,140,58,78,77,66,87,88,200,15,190,15,66,68,68,10,197,209,
+    210,183,222,199,20,167,240,65,13,95,248,62,8,17,17,41,148,60,128,90,228,135,44,51,213,247,113,100,74,67,202,132,174,
+    49,206,247,65,136,136,72,161,228,1,148,12,194,222,160,245,51,171,116,205,51,54,37,131,134,161,107,140,245,125,16,34,
+    34,82,40,121,127,253,71,216,171,212,203,245,172,171,88,53,15,93,225,83,125,181,18,17,73,5,71,65,173,87,39,198,171,101,
+    232,10,11,116,47,181,136,72,42,172,14,234,240,219,201,20,212,113,58,192,65,141,145,190,15,66,68,68,10,65,51,234,84,218,
+    46,216,62,116,141,79,124,31,132,136,136,20,130,179,160,158,236,251,72,50,38,252,226,247,8,223,135,32,34,34,133,160,25,
+    117,74,133,15,234,31,248,73,219,201,68,68,18,111,117,80,239,24,186,144,130,58,94,173,28,212,24,224,251,32,68,68,100,
+    139,86,7,117,13,202,135,44,244,27,75,52,63,139,209,30,84,14,93,99,160,239,131,16,17,145,45,90,29,212,65,80,55,100,33,
+    227,39,223,199,146,41,121,65,248,123,169,7,233,94,106,17,145,196,203,251,251,191,212,11,93,74,219,201,226,117,96,232,
+    10,115,25,237,251,32,68,68,100,11,28,6,181,174,82,199,171,189,131,26,186,74,45,34,146,116,10,234,212,106,74,213,208,
+    53,116,149,90,68,36,233,214,4,245,78,161,75,105,233,59,94,249,65,155,208,53,62,101,190,174,82,139,136,36,218,154,160,
+    14,187,153,12,38,249,62,150,204,9,191,248,189,146,161,190,15,66,68,68,54,107,173,160,206,11,83,7,248,158,101,154,157,
+    197,170,131,131,26,186,74,45,34,146,108,107,210,185,76,80,43,100,169,149,252,224,251,104,50,166,126,16,254,137,114,253,
+    49,125,189,18,17,73,176,181,166,209,225,183,147,233,197,137,113,11,63,167,158,202,88,223,7,33,34,34,155,161,160,78,53,
+    23,183,104,189,230,251,32,68,68,100,51,214,10,234,93,67,23,83,80,199,173,99,232,157,5,10,106,17,145,100,91,235,60,223,
+    32,116,177,111,124,31,77,230,108,19,236,27,186,198,36,38,234,42,181,136,72,98,57,13,234,111,89,169,83,126,204,14,117,
+    80,227,85,223,7,33,34,34,155,180,86,80,239,76,201,144,197,150,243,163,239,227,201,156,195,28,212,208,226,183,136,72,
+    114,173,21,212,37,3,109,39,75,159,189,130,29,66,215,24,199,143,90,9,17,17,73,168,117,246,34,133,95,252,86,80,199,239,
+    96,7,53,94,247,125,16,34,34,178,9,142,131,90,219,201,226,231,98,241,91,87,169,69,68,146,202,113,80,79,240,125,60,25,
+    212,142,114,161,107,124,198,47,90,252,22,17,73,164,117,130,186,126,232,114,147,88,165,19,126,204,202,6,225,31,123,98,
+    188,232,251,48,68,68,100,163,214,9,234,221,66,151,91,170,183,82,123,112,184,131,26,207,248,62,8,17,17,217,168,117,130,
+    186,74,80,51,116,193,47,124,31,81,6,29,69,169,208,53,38,242,185,214,66,68,68,18,104,189,39,80,134,159,83,143,241,125,
+    68,25,84,53,104,227,160,138,230,212,34,34,73,180,94,80,239,17,186,160,222,197,228,67,55,7,53,94,212,251,196,69,68,18,
+    200,121,80,143,209,251,141,61,56,146,18,161,107,204,225,61,223,135,33,34,34,27,88,47,168,27,135,46,56,135,159,124,31,
+    83,6,85,11,218,58,168,162,197,111,17,145,228,217,96,70,157,31,186,164,174,82,251,224,98,241,251,93,102,106,53,68,68,
+    36,97,214,11,234,178,193,78,161,75,234,42,181,15,46,22,191,87,210,199,247,97,136,136,200,122,242,214,255,27,225,23,191,
+    53,163,246,161,122,208,198,65,21,45,126,139,136,36,141,130,58,103,156,224,160,198,23,140,210,226,183,136,72,162,68,16,
+    212,179,249,89,39,123,15,142,113,240,204,111,120,208,247,97,136,136,200,58,34,8,106,205,169,253,168,20,184,120,148,232,
+    203,218,80,38,34,146,40,27,4,245,142,84,10,93,84,219,201,252,232,238,160,198,50,158,240,125,24,34,34,178,150,13,130,
+    58,8,92,60,244,68,124,232,72,248,103,181,195,67,172,208,156,90,68,36,49,242,54,252,91,123,133,46,170,25,181,31,37,130,
+    19,29,84,249,149,183,125,31,136,136,136,172,177,145,160,110,22,186,232,76,126,209,156,204,11,23,139,223,240,128,239,
+    195,16,17,145,53,54,18,212,251,56,40,59,210,247,113,101,212,94,129,139,205,128,67,25,175,47,90,34,34,9,177,145,160,110,
+    64,133,208,101,71,248,62,174,204,58,197,73,149,135,125,31,134,136,136,172,182,145,160,206,15,154,132,46,59,220,247,113,
+    101,214,41,148,114,80,229,57,230,107,78,45,34,146,8,121,27,251,155,225,23,191,191,228,79,157,232,189,216,58,56,210,65,
+    149,133,60,226,251,64,68,68,4,216,68,80,135,223,78,182,138,79,125,31,89,102,157,227,164,202,221,44,209,87,45,17,145,
+    4,136,104,70,173,171,212,254,180,13,118,115,80,101,38,79,249,62,16,17,17,97,19,65,189,19,213,66,23,86,80,251,115,166,
+    147,42,183,234,193,39,34,34,9,176,209,160,14,28,108,39,251,132,149,58,205,123,114,26,101,28,84,249,153,151,125,31,136,
+    136,136,108,60,168,93,44,126,47,226,75,223,199,150,89,213,130,163,156,212,249,31,5,250,178,37,34,226,217,38,130,58,252,
+    118,50,221,162,229,147,155,13,101,223,232,97,162,34,34,222,109,34,168,91,56,40,173,171,212,254,28,16,52,114,82,231,22,
+    223,7,34,34,146,121,155,8,234,26,193,206,161,75,127,236,251,216,50,173,167,147,42,159,49,68,139,223,34,34,94,229,109,
+    234,31,180,12,93,122,6,147,117,146,247,230,36,182,118,82,231,127,190,15,68,68,36,227,34,12,106,45,126,251,84,54,56,215,
+    73,157,193,12,214,215,45,17,17,143,34,13,106,109,39,243,233,60,39,79,253,134,107,49,69,181,136,136,55,155,12,234,221,
+    28,60,244,100,136,239,163,203,180,109,131,227,156,212,25,197,155,190,15,69,68,36,195,54,25,212,65,176,127,232,226,63,
+    48,69,115,49,143,46,113,84,231,106,61,188,70,68,196,155,188,77,255,35,23,139,223,131,124,31,95,166,53,9,14,112,82,231,
+    91,94,240,125,40,34,34,153,21,113,80,15,240,125,124,25,119,137,163,58,55,176,76,115,106,17,17,47,130,77,159,127,151,
+    89,101,150,133,44,95,149,89,228,7,190,15,50,187,204,246,96,130,147,74,247,113,145,126,143,34,34,30,108,102,70,93,218,
+    193,171,57,230,50,214,247,17,102,90,16,92,233,168,210,127,89,168,57,181,136,136,7,121,155,251,135,109,28,52,160,171,
+    212,126,157,72,93,39,117,102,114,143,239,67,17,17,201,164,205,6,117,91,7,13,12,244,125,132,25,87,34,184,220,81,165,219,
+    248,77,115,106,17,145,216,5,155,59,247,46,182,173,66,95,165,46,197,28,202,235,234,166,71,203,172,30,211,157,84,58,141,
+    167,244,155,20,17,137,217,102,103,212,229,130,230,161,27,88,174,151,115,120,86,58,112,243,130,14,120,134,79,53,167,22,
+    17,137,89,222,230,255,177,139,197,111,93,165,246,237,2,170,59,169,99,92,72,129,162,90,68,36,86,91,8,234,118,14,154,208,
+    85,106,223,202,7,23,56,170,52,134,103,124,31,140,136,72,198,4,155,159,32,45,183,173,88,20,182,9,126,101,91,93,219,244,
+    106,190,213,99,142,147,74,219,240,29,149,245,219,20,17,137,205,22,102,212,165,130,240,207,39,51,189,156,195,187,202,
+    193,165,142,42,253,206,127,124,31,140,136,72,166,228,109,233,95,208,226,119,110,184,132,173,29,85,186,159,111,117,157,
+    90,68,36,54,91,12,106,23,219,201,250,179,74,167,118,207,42,56,123,70,217,114,46,244,125,48,34,34,25,18,108,41,65,87,
+    89,117,230,133,110,102,56,45,117,93,211,179,37,182,179,163,251,169,225,85,142,210,239,83,68,36,22,91,156,81,231,7,46,
+    22,191,223,242,125,156,66,217,224,90,103,181,46,96,174,214,72,68,68,98,177,197,160,134,131,29,52,163,160,78,130,30,142,
+    158,251,13,51,184,202,247,193,136,136,100,68,33,130,186,51,225,87,57,39,241,157,102,96,222,149,12,254,229,172,214,227,
+    12,213,111,84,68,36,6,133,8,234,218,65,67,7,13,189,233,251,72,5,56,149,61,28,85,50,206,100,145,162,90,68,36,114,133,
+    8,106,45,126,231,142,252,224,86,103,181,166,112,147,239,195,17,17,201,128,45,238,250,6,24,106,225,55,148,229,49,157,
+    26,218,41,156,0,157,108,128,163,74,37,248,148,166,250,157,138,136,68,170,80,51,234,86,84,14,221,80,1,253,125,31,171,
+    0,112,59,249,142,42,173,228,12,86,104,249,91,68,36,82,133,10,234,146,129,139,199,158,104,241,59,25,26,7,167,58,171,245,
+    21,119,250,62,28,17,145,28,87,168,165,111,232,109,231,132,110,170,60,179,40,171,133,210,4,152,110,187,134,126,213,202,
+    223,202,48,154,70,250,173,138,136,68,166,80,51,106,55,219,201,22,49,216,247,209,10,0,181,130,203,157,213,90,202,241,
+    44,213,242,183,136,72,100,10,25,212,117,156,220,162,165,197,239,164,184,130,90,206,106,77,192,221,221,217,34,34,178,
+    190,66,6,53,116,113,208,216,91,20,104,238,149,8,229,131,219,28,86,187,155,193,250,189,138,136,68,164,208,65,125,184,
+    131,198,102,50,218,247,241,202,106,39,114,160,179,90,5,156,198,28,69,181,136,72,36,10,29,212,251,81,219,65,115,253,124,
+    31,175,172,22,4,15,82,210,89,181,95,56,219,247,1,137,136,228,168,66,7,117,16,28,230,160,185,151,180,248,157,24,13,3,
+    151,239,149,126,141,103,244,155,21,17,137,64,33,111,207,2,120,223,92,236,253,254,136,214,186,153,39,33,254,180,6,206,
+    222,80,13,21,24,203,46,250,221,138,136,56,86,232,25,53,180,115,240,124,50,232,227,251,136,101,141,138,78,183,148,45,
+    228,52,86,106,86,45,34,226,88,17,130,186,84,224,98,70,221,79,39,243,4,57,41,104,227,176,218,72,254,233,251,128,68,68,
+    114,78,17,130,26,142,112,208,224,44,134,248,62,102,89,203,253,14,183,148,193,237,188,161,175,97,34,34,78,21,41,168,15,
+    165,140,131,38,181,248,157,36,141,130,171,28,86,51,78,97,146,162,90,68,196,161,34,108,38,3,56,196,194,191,3,171,18,51,
+    41,163,77,71,137,177,204,154,48,209,97,189,61,248,148,114,250,253,138,136,56,82,164,25,181,155,199,158,44,224,3,223,
+    71,45,107,41,29,60,90,212,97,176,89,227,57,223,247,33,137,136,228,144,34,158,161,143,162,132,131,70,95,246,125,212,178,
+    142,86,193,185,78,235,61,67,111,45,127,139,136,56,82,196,165,111,232,104,131,66,55,90,142,153,84,208,226,104,130,252,
+    105,13,153,230,176,94,105,134,179,143,126,195,34,34,14,20,121,205,243,56,7,141,46,230,29,223,199,45,235,168,24,60,234,
+    180,222,50,142,102,182,102,213,34,34,14,20,57,168,143,116,114,59,143,22,191,147,230,224,224,4,167,245,126,230,68,221,
+    49,47,34,226,64,145,131,186,90,208,193,65,179,253,153,167,147,120,194,220,71,77,167,245,6,226,246,202,183,136,72,54,
+    21,99,187,175,139,197,239,101,188,238,251,200,101,61,213,131,199,28,87,124,130,251,245,117,76,68,36,164,34,111,38,131,
+    5,86,131,165,161,27,110,205,71,218,108,148,56,61,204,109,88,231,243,6,135,233,247,44,34,18,66,49,130,26,14,183,183,28,
+    52,253,13,13,116,10,79,152,69,182,55,223,59,173,88,145,17,236,161,223,179,136,72,177,21,235,73,23,46,22,191,225,89,223,
+    199,46,27,40,31,60,77,190,211,138,127,210,149,223,181,0,46,34,82,108,197,154,81,47,178,26,44,10,221,116,77,166,81,66,
+    115,173,196,185,202,92,190,252,18,160,37,131,41,173,223,180,136,72,177,20,107,70,93,222,201,11,47,103,240,190,239,163,
+    151,141,184,137,198,142,43,142,160,135,239,131,18,17,73,173,98,62,228,249,100,39,141,63,233,251,232,101,35,74,7,207,
+    57,121,75,218,218,158,229,6,45,127,139,136,20,75,177,150,190,97,133,109,199,172,208,141,151,96,26,53,181,36,154,64,15,
+    217,5,206,107,222,205,37,250,93,139,136,20,89,49,103,212,37,131,227,29,52,190,146,23,125,31,191,108,212,249,142,159,
+    83,6,112,25,207,104,86,45,34,82,100,197,156,81,195,104,219,215,65,243,13,248,70,179,172,68,154,103,77,152,226,184,102,
+    73,222,228,96,253,190,69,68,138,164,216,47,34,110,22,52,114,208,252,36,62,211,44,43,145,170,4,47,83,202,113,205,21,28,
+    195,8,253,190,69,68,138,164,216,65,13,39,57,233,128,54,148,37,85,179,224,102,231,53,23,115,56,19,21,213,34,34,69,80,
+    236,165,111,248,213,118,96,85,232,14,84,226,55,202,105,57,52,145,204,142,192,197,51,232,214,181,29,195,217,81,191,113,
+    17,145,66,10,49,163,222,46,104,231,160,3,11,120,197,247,207,64,54,33,8,30,167,182,243,170,191,114,176,222,85,45,34,82,
+    104,33,130,26,186,59,233,130,22,191,147,107,235,224,21,74,59,175,58,137,246,138,106,17,145,66,10,177,244,13,139,108,
+    91,254,116,208,137,241,52,210,82,104,98,245,182,115,34,168,186,39,131,168,174,223,186,136,200,22,133,154,81,151,15,142,
+    118,210,137,71,124,255,20,100,51,122,4,103,70,80,245,75,58,242,135,102,213,34,34,91,20,106,70,13,35,172,149,131,78,84,
+    224,23,42,107,118,149,88,203,236,0,70,69,80,87,179,106,17,145,45,11,53,163,134,150,193,238,14,58,177,80,175,188,76,180,
+    210,193,43,108,19,65,93,205,170,37,141,22,218,23,26,181,18,171,144,65,13,103,57,233,198,253,20,104,232,39,88,157,160,
+    15,37,34,168,59,142,246,138,106,73,149,95,237,64,90,51,76,163,86,98,20,58,168,79,113,242,166,165,239,25,228,251,39,33,
+    155,213,54,112,253,150,234,191,124,201,65,204,209,73,79,82,226,19,107,202,88,22,209,85,207,216,147,24,133,14,234,106,
+    193,81,78,58,242,128,239,159,132,108,193,165,129,155,213,147,245,141,165,61,51,117,210,147,20,120,193,218,49,19,128,
+    63,57,88,81,45,177,9,185,153,12,96,152,181,117,208,145,60,190,167,158,54,22,37,218,10,59,152,193,145,84,174,203,0,118,
+    214,111,95,18,204,236,70,110,98,237,243,101,121,222,229,64,141,90,137,65,232,25,53,28,200,174,14,58,82,160,155,180,18,
+    175,100,208,215,201,239,122,67,83,104,205,151,154,159,72,98,45,181,147,185,145,117,135,232,34,14,229,67,141,90,137,129,
+    131,160,14,28,221,103,251,56,139,52,232,19,110,171,160,63,213,35,169,60,131,182,90,74,148,132,154,110,7,240,226,70,254,
+    190,162,90,226,225,32,168,225,12,39,143,153,156,203,75,158,127,24,178,101,245,130,215,156,191,254,242,47,115,57,136,
+    254,58,233,73,226,140,179,230,140,222,196,63,83,84,75,28,156,4,117,245,160,171,147,206,104,67,89,26,180,14,162,186,72,
+    177,152,35,232,163,147,158,36,202,43,214,146,105,155,249,231,139,56,148,143,52,106,37,82,78,130,26,122,56,169,242,37,
+    195,53,224,83,224,244,224,170,136,42,47,231,36,30,212,24,144,132,48,251,143,29,203,226,45,252,91,139,232,194,39,26,181,
+    18,33,71,65,221,158,6,78,234,104,78,157,14,183,112,74,68,149,11,184,144,235,204,116,218,19,239,150,218,73,252,155,194,
+    12,197,5,116,230,83,141,89,137,140,163,160,14,130,11,156,212,121,141,105,26,238,41,16,4,143,211,57,178,234,55,115,2,
+    75,52,14,196,171,25,214,166,8,187,102,22,208,73,81,45,145,113,20,212,112,42,149,28,84,89,193,221,30,127,24,82,120,37,
+    131,87,216,55,178,234,47,211,150,25,58,237,137,55,95,216,190,124,86,164,63,177,128,206,124,166,49,43,145,112,22,212,
+    21,131,83,157,212,233,173,103,63,167,68,249,224,93,71,23,60,54,230,51,246,65,175,62,16,63,250,88,171,205,110,32,219,
+    184,249,28,164,89,181,68,194,89,80,195,69,78,138,45,226,97,111,63,12,41,154,234,193,0,106,71,86,253,87,14,224,109,157,
+    246,36,102,171,236,106,59,113,139,27,200,54,78,215,170,37,26,14,30,33,250,255,14,178,129,14,170,108,195,84,202,234,193,
+    124,41,49,206,14,100,65,100,213,243,185,139,139,53,22,36,54,115,236,4,6,132,170,80,153,1,236,171,49,43,78,57,156,81,
+    195,133,78,170,252,206,83,94,126,20,82,28,123,5,253,169,16,89,245,85,244,164,135,173,208,28,69,98,241,173,181,12,25,
+    211,127,45,128,235,90,181,184,229,116,70,189,202,118,97,138,131,58,245,248,142,124,125,39,77,141,65,214,133,165,17,214,
+    111,199,75,108,163,241,32,17,123,205,78,101,161,147,74,85,24,64,51,141,88,113,198,233,140,58,63,56,207,73,157,201,244,
+    243,242,195,144,226,233,16,188,225,228,33,178,155,50,132,38,140,212,28,69,34,100,118,171,117,115,20,211,48,143,142,154,
+    85,139,67,78,103,212,48,199,234,20,115,27,198,186,246,102,172,190,143,166,202,43,118,2,43,35,172,95,138,59,185,80,99,
+    66,34,49,219,78,161,191,227,154,154,85,139,59,78,103,212,176,85,112,146,147,58,95,48,64,223,71,83,229,152,224,41,215,
+    131,105,29,203,185,136,147,76,239,87,19,247,134,219,222,206,99,26,230,113,16,163,53,94,197,9,199,51,106,248,214,118,
+    167,192,65,157,246,12,210,183,209,148,121,202,206,44,212,3,23,139,175,1,175,178,187,198,133,56,99,118,31,87,176,34,162,
+    234,218,1,46,110,56,159,4,213,15,14,113,82,103,48,159,235,219,104,202,156,30,220,71,180,103,165,73,236,207,107,26,23,
+    226,200,108,59,148,75,34,139,105,152,79,103,157,199,196,129,8,86,43,255,225,168,206,109,177,254,32,196,133,11,131,135,
+    35,93,0,135,5,28,195,229,182,92,39,63,9,45,154,37,239,117,205,229,32,198,104,180,74,72,206,151,190,1,246,179,81,14,170,
+    228,243,13,187,104,217,40,117,94,180,83,35,221,86,6,208,136,23,217,67,99,67,138,45,218,37,239,117,85,225,3,45,128,75,
+    40,145,76,127,46,113,82,101,149,230,212,169,116,98,240,20,249,17,183,241,53,205,121,68,243,20,41,166,223,236,224,72,
+    151,188,215,53,143,206,154,85,75,40,145,204,168,87,218,206,252,228,160,78,73,38,81,79,223,68,83,168,159,157,20,195,105,
+    176,19,79,83,83,227,67,138,232,85,59,151,217,49,183,169,155,181,36,140,72,102,212,37,130,139,157,212,89,193,127,99,253,
+    97,136,43,221,130,215,34,125,4,202,95,62,96,79,222,213,76,69,138,96,190,157,99,199,196,30,211,186,89,75,194,137,100,
+    70,13,11,108,123,230,59,168,83,130,73,236,164,239,161,169,244,142,117,139,244,193,162,127,9,232,201,45,148,209,24,145,
+    66,24,100,103,20,227,245,149,174,108,197,64,154,104,164,74,49,68,180,69,183,82,112,182,147,58,43,249,79,140,63,12,113,
+    233,176,224,3,42,71,222,138,113,15,251,49,78,115,21,217,130,37,214,211,14,242,24,211,48,135,142,122,199,186,20,75,68,
+    51,106,248,213,234,58,185,74,153,207,4,234,235,91,104,74,77,176,78,252,26,67,59,37,248,7,55,104,94,45,155,52,218,78,
+    97,146,239,78,0,85,24,200,62,26,167,82,68,145,221,244,186,93,112,188,147,58,171,184,57,182,31,134,184,214,48,248,136,
+    157,99,104,103,37,183,178,55,35,52,91,145,141,88,106,255,178,22,137,136,233,191,118,128,107,253,71,138,42,178,25,53,
+    124,99,141,156,60,76,52,159,241,236,166,239,160,169,53,211,14,97,108,44,45,5,156,205,29,84,212,88,145,181,12,183,30,
+    124,227,187,19,235,208,172,90,138,42,194,199,72,237,22,116,117,82,103,149,174,83,167,90,141,224,67,58,198,210,146,209,
+    155,61,248,64,243,21,89,109,158,245,180,3,19,22,211,127,189,4,83,15,22,149,162,136,112,70,13,163,109,95,39,117,242,24,
+    175,87,49,164,218,50,59,137,87,99,107,237,84,238,166,170,198,75,230,245,181,158,204,240,221,137,77,168,198,32,246,210,
+    24,149,66,138,244,193,204,205,2,55,51,169,2,110,140,229,135,33,81,41,29,244,229,138,216,90,123,134,221,120,198,76,115,
+    150,12,155,102,93,236,184,196,198,52,252,65,7,190,212,8,149,66,138,116,70,13,195,172,173,147,58,121,140,211,179,157,
+    83,239,49,187,32,182,199,54,194,254,220,79,83,141,153,12,90,101,15,242,47,254,244,221,141,45,170,206,32,246,212,8,149,
+    66,136,246,85,71,180,9,90,58,169,83,192,77,49,252,48,36,90,103,7,253,169,18,91,107,159,176,47,167,216,239,154,181,100,
+    204,48,107,66,207,20,196,52,204,166,173,158,1,46,133,18,113,80,195,213,142,234,188,170,133,162,28,208,62,24,197,46,177,
+    181,86,192,115,52,224,94,91,169,145,147,17,211,236,20,107,203,87,190,187,81,104,115,233,168,168,150,66,136,120,233,27,
+    160,169,185,185,57,231,80,222,209,50,81,14,248,195,142,228,227,88,91,220,147,251,105,173,177,147,227,22,219,109,220,
+    26,195,67,107,93,171,202,64,93,162,145,45,136,124,70,13,87,58,170,243,46,67,245,221,51,7,84,11,62,224,132,88,91,252,
+    146,3,57,209,166,106,244,228,44,179,231,109,87,110,76,97,76,195,92,14,102,188,198,166,108,86,12,51,234,85,182,59,223,
+    57,169,212,148,209,4,250,238,153,19,238,176,171,89,21,107,139,165,57,151,127,178,181,198,79,206,25,101,151,240,137,239,
+    78,132,178,53,131,181,89,86,54,35,134,25,117,126,224,234,58,245,24,94,138,190,187,18,139,203,131,247,169,22,107,139,
+    203,184,151,157,185,201,22,106,246,146,67,190,177,99,172,121,202,99,26,102,209,94,179,106,217,140,24,102,212,46,231,
+    212,59,242,141,94,189,144,51,166,217,81,124,30,123,171,213,185,156,75,40,173,81,148,122,211,236,102,158,100,165,239,
+    110,56,162,89,181,108,90,12,51,106,200,15,174,113,84,105,42,15,196,209,97,137,69,157,96,24,110,94,221,82,20,179,185,
+    154,134,188,100,5,154,193,164,216,44,187,196,118,161,183,135,152,174,26,213,17,209,158,175,53,38,101,163,98,153,81,195,
+    74,219,157,239,157,84,170,202,15,108,165,239,157,57,195,236,14,174,137,249,106,245,95,246,230,122,186,106,207,67,10,
+    45,176,59,184,155,133,30,90,174,202,99,236,75,27,38,71,84,127,27,6,211,72,35,82,54,16,203,140,26,74,4,255,114,84,105,
+    46,255,141,167,203,18,139,32,184,34,24,200,182,30,90,254,130,35,216,147,151,108,149,102,49,41,242,167,221,102,245,248,
+    143,151,152,110,205,56,142,14,234,4,195,168,23,81,11,191,107,86,45,27,21,211,140,26,86,89,67,190,117,82,169,20,19,217,
+    73,223,58,115,202,44,59,133,247,61,181,93,151,158,156,163,157,15,41,48,219,30,224,126,230,120,105,59,159,203,249,15,
+    37,87,143,146,105,214,150,31,35,106,73,215,170,101,67,177,5,53,60,103,167,56,170,116,2,47,106,32,231,24,179,251,184,
+    34,198,39,129,175,107,123,46,227,108,202,105,84,37,214,76,123,152,187,89,224,169,245,237,121,126,189,71,230,68,27,213,
+    67,180,0,46,235,136,49,168,221,205,169,3,70,233,197,235,57,232,67,59,145,233,222,90,175,201,101,156,75,69,141,171,196,
+    249,222,110,229,57,150,123,107,191,27,189,169,178,193,184,152,102,209,93,171,174,193,16,189,216,87,214,18,99,80,195,
+    11,118,178,163,74,109,24,170,97,156,131,126,183,238,12,240,216,126,101,206,224,2,93,88,73,144,177,118,27,175,120,217,
+    108,248,151,242,220,203,153,155,24,15,138,106,137,75,172,65,189,202,26,49,201,81,173,183,57,76,195,56,7,21,216,109,92,
+    239,113,246,4,121,28,202,197,180,215,126,112,207,86,216,107,60,192,112,175,125,216,155,23,105,176,153,113,160,168,150,
+    120,196,26,212,208,199,92,61,229,121,119,190,164,132,134,113,78,26,107,221,153,232,185,15,187,115,49,39,83,94,35,204,
+    139,153,214,155,71,60,94,6,1,8,232,73,175,45,62,24,39,218,168,30,202,110,26,129,66,236,65,109,182,15,110,222,165,5,119,
+    115,137,6,113,142,90,106,55,112,59,5,158,123,81,137,211,184,132,186,26,101,177,26,99,189,121,142,37,158,123,177,53,79,
+    113,104,161,126,243,81,110,43,219,134,33,52,212,248,147,184,131,26,222,183,131,29,85,170,204,183,212,208,32,206,89,3,
+    236,116,207,115,42,128,124,14,226,116,186,234,145,163,49,88,108,253,120,144,209,190,187,1,28,196,51,212,44,244,111,60,
+    202,89,117,77,134,104,86,45,241,7,53,180,181,97,142,42,157,202,211,26,194,57,236,15,59,151,87,124,119,2,128,173,56,137,
+    211,217,91,163,45,34,102,195,121,154,126,252,233,187,35,64,89,254,203,37,69,220,161,16,109,84,15,221,236,117,114,201,
+    2,15,65,253,169,181,192,77,171,1,35,216,95,67,56,167,61,107,151,48,215,119,39,86,219,147,51,56,145,234,26,113,78,253,
+    100,207,242,76,100,139,199,69,213,156,167,138,21,139,138,106,137,146,135,160,134,35,237,13,71,149,154,48,138,124,13,
+    225,156,246,155,93,192,235,190,59,177,70,41,186,114,26,7,173,121,70,149,20,223,34,123,141,167,25,230,125,47,194,223,
+    74,115,3,87,20,251,124,18,101,84,111,203,16,69,117,166,121,9,234,137,214,216,217,157,145,15,115,174,6,112,206,235,107,
+    23,241,187,239,78,172,101,43,14,167,27,237,41,165,177,87,44,75,172,63,175,242,118,34,150,186,255,214,132,103,66,62,15,
+    76,81,45,81,241,18,212,112,186,61,237,168,210,86,124,171,197,200,12,152,103,87,209,219,119,39,214,83,133,46,116,163,
+    147,226,186,8,150,216,32,250,241,70,162,34,26,74,240,15,110,114,240,123,140,114,7,184,238,171,206,50,79,65,253,147,213,
+    103,153,163,90,231,242,176,134,111,38,188,107,231,242,139,239,78,108,160,42,135,211,141,14,138,235,45,88,96,111,243,
+    42,239,123,191,241,106,67,45,120,152,198,142,126,123,81,206,170,107,49,132,250,26,101,153,228,41,168,225,82,187,199,
+    81,165,124,70,209,68,195,55,19,22,216,53,60,234,241,129,146,155,86,133,14,116,230,96,106,105,36,110,224,59,123,159,254,
+    12,117,246,213,220,165,106,220,202,25,78,159,66,167,168,22,247,188,5,245,108,219,133,121,142,106,237,207,8,61,240,49,
+    51,198,216,121,137,184,215,118,227,246,164,51,157,105,169,205,102,192,66,27,204,7,188,207,20,223,29,217,132,128,211,
+    185,53,130,11,103,209,70,245,80,118,213,216,202,28,111,65,13,119,216,21,206,106,61,205,169,26,188,153,81,96,143,113,
+    173,167,247,18,23,78,37,58,208,153,206,212,201,228,168,52,251,138,15,120,159,17,94,159,217,190,37,123,240,16,173,34,
+    250,253,40,170,197,45,143,65,189,220,26,242,131,163,90,53,152,180,145,23,209,73,238,154,99,55,242,64,98,110,236,217,
+    148,109,105,69,75,90,209,36,19,43,62,43,237,75,134,51,130,161,204,246,221,149,45,40,199,21,92,27,233,174,2,109,43,19,
+    151,60,6,53,244,179,99,157,213,186,132,187,53,116,51,102,132,157,207,87,190,59,81,40,53,105,69,107,90,211,56,39,239,
+    250,255,211,70,50,130,143,24,149,192,141,98,27,202,163,59,255,101,187,200,127,15,81,206,170,183,99,40,187,228,224,72,
+    146,77,241,26,212,102,173,24,233,168,86,62,159,209,84,67,55,99,86,90,111,110,96,150,239,110,20,90,37,90,178,47,123,179,
+    55,219,167,126,172,46,178,47,249,130,47,24,195,248,68,110,239,219,184,3,185,43,182,173,167,138,106,113,197,107,80,195,
+    40,107,238,232,113,162,208,152,207,181,133,39,131,22,218,29,220,202,82,223,221,40,162,202,52,162,41,77,105,74,131,84,
+    205,178,231,219,120,198,48,134,49,124,155,162,120,254,203,246,252,135,238,177,94,132,136,114,1,92,175,235,200,18,207,
+    65,13,39,218,75,206,106,245,226,42,13,220,76,154,108,87,211,207,119,39,138,169,2,141,217,147,250,236,202,46,236,152,
+    192,119,172,23,216,79,124,199,183,124,203,119,124,203,52,223,221,41,166,170,252,139,11,61,220,235,30,237,172,122,24,
+    59,39,110,188,72,20,188,7,245,79,214,192,217,108,168,44,95,105,224,102,214,112,187,44,193,183,109,21,78,73,234,177,43,
+    187,178,11,187,178,11,181,61,141,229,69,246,51,191,50,141,239,249,142,239,248,46,145,247,63,23,69,73,206,225,6,170,121,
+    250,105,70,25,213,181,25,170,51,94,38,120,15,106,184,198,122,57,171,213,150,193,153,216,95,43,27,99,246,34,215,37,246,
+    174,221,162,43,73,77,106,175,254,191,237,168,69,45,106,81,213,241,232,158,111,115,248,131,89,252,198,52,126,225,87,126,
+    230,87,103,207,55,72,130,60,142,227,70,207,87,115,21,213,18,86,2,130,122,129,237,226,240,133,11,143,115,166,134,109,
+    134,45,183,199,185,153,223,124,119,35,50,101,169,66,37,42,83,137,170,171,255,179,18,149,169,8,228,83,105,205,191,85,
+    117,245,127,46,99,49,43,88,72,1,243,129,185,192,124,150,50,135,63,152,179,250,175,149,190,15,40,82,135,242,95,246,76,
+    192,249,32,218,168,30,198,78,9,56,70,137,82,2,130,26,30,183,179,157,213,170,204,68,61,198,49,227,150,217,51,252,155,
+    153,190,187,33,94,237,207,255,104,147,152,51,65,148,219,202,52,171,206,125,137,8,234,2,107,193,103,206,170,29,203,203,
+    26,180,153,183,208,30,228,22,230,251,238,134,120,209,136,127,211,45,97,103,1,69,181,20,95,34,130,26,62,179,22,14,159,
+    50,245,38,93,53,104,133,217,214,139,135,89,236,187,27,18,171,6,220,72,183,68,238,84,137,114,1,188,14,67,181,0,158,195,
+    18,18,212,112,134,61,229,172,214,182,76,212,3,69,5,128,217,246,0,247,230,212,246,40,217,180,134,92,201,137,9,188,197,
+    237,111,81,206,170,21,213,185,44,49,65,253,187,213,119,120,58,61,159,7,53,100,101,181,63,237,73,122,49,195,119,55,36,
+    82,123,112,57,39,37,254,225,49,138,106,41,142,196,4,53,220,107,151,56,171,149,199,135,145,189,25,71,210,104,145,61,206,
+    237,252,234,187,27,18,137,189,184,150,99,18,185,220,189,33,69,181,20,93,130,130,122,165,237,205,215,206,170,237,198,
+    23,148,214,144,149,181,44,181,39,184,51,135,238,179,22,128,86,252,139,78,169,250,164,71,121,173,122,123,134,81,55,85,
+    63,13,41,140,60,223,29,248,127,37,130,251,28,86,251,134,127,249,62,32,73,152,50,193,5,193,247,244,163,133,239,142,136,
+    19,1,157,25,202,199,65,186,98,26,234,4,195,168,23,81,237,159,105,203,148,228,204,190,196,145,4,205,168,1,142,179,190,
+    206,106,229,49,132,3,83,246,17,150,120,140,181,123,232,195,10,223,221,144,98,43,197,113,92,73,163,212,126,190,181,0,
+    46,69,145,176,160,254,197,118,99,161,179,106,117,249,146,138,26,176,178,81,63,219,3,60,166,253,224,41,180,21,231,112,
+    17,219,166,252,147,29,229,2,248,14,12,99,199,148,255,124,100,109,9,11,106,184,219,46,115,88,237,44,30,211,112,149,77,
+    90,104,79,243,48,19,125,119,67,10,173,30,151,112,6,229,115,226,83,173,168,150,194,74,92,80,175,180,125,249,194,97,189,
+    183,57,76,195,85,54,235,99,123,132,87,83,255,142,168,220,215,154,139,57,50,241,55,96,21,69,148,81,189,35,67,21,213,57,
+    35,113,65,13,163,109,127,135,175,164,223,134,241,108,163,225,42,91,48,207,250,114,31,19,124,119,67,54,170,34,39,112,
+    126,34,94,175,225,90,148,215,170,183,103,40,245,114,240,103,150,69,9,12,106,184,208,30,116,88,237,24,250,105,176,74,
+    33,152,13,230,81,222,212,38,179,68,217,147,243,56,137,10,57,251,25,142,118,86,61,140,29,114,246,39,151,37,137,12,234,
+    5,182,187,211,71,83,60,207,73,26,172,82,72,115,173,31,207,50,194,119,55,132,210,116,165,7,29,114,254,179,27,237,172,
+    90,247,85,231,130,68,6,53,244,181,227,28,86,171,194,120,106,107,176,74,17,124,109,207,240,34,211,125,119,35,179,246,
+    229,100,78,160,122,70,62,181,81,206,170,235,50,84,179,234,212,75,104,80,195,97,246,174,195,106,29,24,144,146,7,12,74,
+    114,20,216,72,158,227,5,22,249,238,72,166,212,225,68,78,167,126,198,62,173,154,85,203,230,36,54,168,39,91,35,150,56,
+    172,247,0,23,104,168,74,49,204,183,55,121,133,1,218,21,30,185,170,116,227,100,90,101,244,43,181,102,213,178,105,137,
+    13,106,184,197,174,117,88,173,28,95,176,171,134,170,20,211,2,123,155,87,120,159,165,190,59,146,147,182,166,43,71,208,
+    49,227,79,231,87,84,203,166,36,56,168,87,216,190,140,115,88,111,95,134,83,82,67,85,66,248,211,222,225,21,250,59,93,235,
+    201,182,122,28,193,17,180,200,169,187,163,139,79,81,45,27,151,224,160,134,47,108,95,86,58,172,119,5,183,105,160,74,104,
+    11,237,93,94,225,61,22,251,238,72,170,237,205,17,28,65,99,125,34,215,161,168,150,141,73,116,80,195,63,237,127,46,15,
+    150,247,232,172,129,42,78,44,181,15,121,143,247,248,193,119,71,82,166,52,45,233,202,225,122,106,214,38,40,170,101,67,
+    9,15,234,101,214,212,233,211,162,182,102,28,181,52,80,197,161,201,54,136,183,25,164,171,215,91,84,143,14,116,160,19,
+    149,244,9,220,44,237,0,151,245,37,60,168,225,51,107,233,240,129,162,112,32,131,117,61,76,156,91,98,35,120,155,55,249,
+    201,119,71,18,168,2,109,232,66,39,205,229,10,77,81,45,235,74,124,80,195,165,118,143,211,122,55,113,157,134,169,68,228,
+    59,27,206,71,124,28,217,226,101,154,84,96,95,14,228,32,154,233,171,113,145,105,1,92,214,150,130,160,94,108,123,58,189,
+    14,152,199,64,218,105,152,74,164,102,216,104,70,48,136,47,40,240,221,149,216,109,75,83,90,209,146,125,41,165,207,89,
+    177,105,86,45,255,47,5,65,13,67,172,3,46,251,89,155,113,84,211,48,149,24,204,177,17,140,100,28,227,152,225,187,43,17,
+    43,201,222,180,160,5,45,216,78,159,45,39,52,171,150,191,165,34,168,225,28,235,237,180,222,97,188,149,209,231,31,137,
+    47,51,237,75,198,49,142,47,249,206,233,77,135,126,237,64,35,246,96,15,246,160,129,158,82,224,156,162,90,254,146,146,
+    160,94,96,123,50,213,105,197,187,184,84,131,84,188,88,98,19,24,199,15,76,97,50,147,153,227,187,59,69,148,79,45,234,177,
+    59,141,105,196,30,84,214,167,40,82,138,106,129,212,4,53,12,179,246,78,175,246,149,98,4,251,104,144,138,119,243,236,175,
+    192,158,204,20,126,226,247,196,5,119,62,219,177,3,117,217,145,29,217,129,29,169,163,153,115,172,20,213,146,162,160,134,
+    203,236,110,167,245,118,98,172,238,232,148,196,89,97,179,152,205,12,126,103,54,191,51,131,217,204,98,1,75,152,199,226,
+    72,95,12,82,129,74,84,167,58,219,80,157,106,84,167,26,219,172,254,223,10,102,191,20,213,146,162,160,94,98,77,249,198,
+    105,197,227,121,73,67,84,82,100,149,45,96,33,75,248,147,5,44,97,17,139,88,14,176,230,63,23,178,98,173,255,44,77,185,
+    53,127,178,2,37,87,255,183,128,42,148,161,44,149,40,69,37,202,81,154,42,148,162,130,62,9,9,166,168,206,186,20,5,53,140,
+    181,230,171,79,68,174,220,67,79,13,81,17,73,56,221,172,149,109,121,190,59,80,20,77,2,151,47,190,4,184,156,15,211,244,
+    77,69,68,50,169,78,48,148,157,34,170,253,51,109,152,162,243,96,162,165,106,70,13,43,173,5,163,157,86,172,193,231,212,
+    214,183,73,17,73,56,205,170,179,43,85,51,106,40,17,60,67,89,167,21,103,114,12,203,210,245,109,69,68,50,72,179,234,236,
+    74,89,80,195,110,193,205,142,43,126,70,79,223,7,37,34,178,69,117,130,161,212,139,168,246,207,180,231,39,69,117,66,165,
+    108,233,27,160,192,58,49,200,113,205,199,57,83,203,62,34,146,120,90,0,207,162,20,6,53,76,183,61,153,237,180,98,25,62,
+    162,153,6,168,136,36,158,162,58,123,82,183,244,13,80,43,120,6,183,99,105,41,71,51,43,141,223,89,68,36,99,116,173,58,
+    123,82,25,212,112,72,112,174,227,138,211,56,142,149,26,160,34,146,120,138,234,172,73,229,210,55,192,82,219,143,175,28,
+    215,188,130,219,180,232,35,34,41,16,229,211,202,180,0,158,52,169,13,106,152,96,205,88,226,180,98,64,31,142,213,240,20,
+    145,20,248,217,218,42,170,51,34,165,75,223,0,13,131,91,28,87,52,206,228,235,244,126,115,17,145,12,217,62,24,204,142,
+    17,213,214,205,90,201,146,226,25,53,152,117,229,29,199,53,119,228,83,106,232,155,164,136,164,128,102,213,217,144,234,
+    160,134,153,182,39,51,29,215,108,193,96,202,104,120,138,72,10,76,177,182,252,20,81,109,189,89,43,41,82,188,244,13,80,
+    35,120,137,124,199,53,71,114,42,150,238,239,47,34,146,17,117,131,143,168,27,81,237,41,28,160,29,224,137,144,242,160,
+    134,182,193,63,157,215,236,139,235,199,148,138,136,68,99,251,96,88,100,81,173,155,181,146,33,229,75,223,0,5,214,153,
+    129,142,107,6,60,207,137,90,242,17,145,84,248,217,218,48,37,162,218,186,86,237,95,14,4,53,252,110,123,51,221,113,205,
+    50,12,165,185,6,167,136,164,194,79,214,86,81,157,179,82,191,244,13,176,77,240,162,243,43,213,75,57,82,183,39,136,72,
+    74,236,16,12,141,240,102,45,45,128,251,149,19,65,13,7,6,255,118,94,115,6,135,48,95,131,83,68,82,97,135,96,152,162,58,
+    71,229,196,210,55,64,129,29,204,0,231,85,59,243,14,249,90,242,17,145,84,248,201,218,48,53,162,218,90,0,247,39,71,102,
+    212,144,23,60,199,118,206,171,190,207,229,190,15,76,68,164,144,52,171,206,77,57,19,212,127,93,169,46,225,188,234,61,
+    60,162,161,41,34,41,177,67,48,144,218,17,213,214,131,69,125,201,161,160,134,3,130,219,34,168,122,17,239,107,104,138,
+    72,74,236,28,12,141,96,117,241,47,83,104,171,168,246,32,103,174,81,255,237,84,123,214,121,205,114,12,98,127,93,155,17,
+    145,148,248,193,218,240,107,68,181,117,173,58,126,57,23,212,75,172,37,95,56,175,90,157,225,212,215,208,20,145,148,248,
+    222,218,42,170,115,70,206,5,53,76,181,125,248,195,121,213,58,140,160,142,134,166,136,164,132,162,58,119,228,212,53,234,
+    191,236,24,60,29,193,97,77,227,16,230,230,222,183,26,17,201,81,187,68,120,173,90,59,192,227,149,131,65,13,135,5,215,
+    69,80,245,107,142,100,169,134,166,136,164,132,162,58,87,228,224,210,55,64,129,117,229,221,8,234,30,206,171,122,0,138,
+    136,164,198,247,214,198,249,155,16,254,166,5,240,184,228,104,80,195,60,107,198,15,17,212,61,135,71,52,48,69,36,53,190,
+    179,182,138,234,148,203,201,165,111,128,42,193,91,84,142,160,238,163,220,156,171,223,109,68,36,7,237,26,12,165,86,68,
+    181,181,0,30,143,156,157,81,3,244,183,46,172,114,94,53,160,55,103,233,59,164,136,164,134,102,213,233,150,179,51,106,
+    128,131,131,255,68,80,213,56,151,215,114,249,251,141,136,228,24,205,170,211,45,167,103,212,96,214,157,23,34,168,91,150,
+    1,180,210,119,72,17,73,141,111,172,29,51,34,170,93,151,161,236,160,51,98,100,114,60,168,97,169,181,225,179,8,234,86,
+    98,16,205,52,48,69,36,53,190,181,182,252,22,81,109,45,128,71,41,231,131,26,102,88,51,126,137,160,110,21,6,211,68,3,83,
+    68,82,67,81,157,78,57,125,141,250,47,53,131,55,41,23,65,221,121,116,102,98,238,127,207,17,145,156,81,63,24,202,182,17,
+    213,214,181,234,232,100,32,168,161,73,240,12,81,124,209,155,69,59,38,105,96,138,72,106,40,170,211,40,19,65,13,199,4,
+    255,140,164,238,76,58,233,237,172,34,146,34,245,131,129,108,19,81,237,159,105,175,51,98,4,50,112,141,250,47,102,167,
+    240,124,36,149,119,224,67,237,119,20,145,20,153,100,237,116,173,58,69,50,19,212,176,220,58,51,52,146,202,187,240,33,
+    219,106,96,138,72,106,76,178,182,145,221,172,165,168,118,45,67,65,13,127,88,11,190,139,164,242,30,12,165,154,6,166,136,
+    164,134,162,58,61,50,114,141,250,47,213,130,254,17,93,155,25,79,7,230,100,233,59,143,136,164,92,131,96,40,53,35,170,
+    173,109,101,110,101,42,168,161,94,240,42,101,34,169,60,142,67,249,83,3,83,68,82,163,65,48,68,81,157,10,25,11,106,104,
+    21,60,21,201,173,90,240,41,93,88,172,129,41,34,169,177,91,240,1,213,35,170,173,29,224,238,100,46,168,225,248,224,230,
+    136,42,127,72,39,22,104,96,138,72,106,52,14,6,71,22,213,83,56,64,179,106,39,50,181,153,236,255,157,109,143,71,84,121,
+    127,250,83,89,155,40,68,36,53,190,180,14,204,142,168,182,94,215,225,66,70,131,122,149,29,203,107,17,213,110,194,0,237,
+    0,23,145,20,137,50,170,181,3,60,188,140,6,53,44,177,131,24,30,81,237,189,24,192,214,26,152,34,146,26,138,234,36,203,
+    108,80,195,124,59,128,175,34,170,221,128,193,212,210,192,20,145,212,80,84,39,87,134,131,26,126,181,22,252,28,81,237,
+    93,25,76,109,13,76,17,73,141,47,173,61,127,68,84,91,81,29,70,6,119,125,255,191,237,130,247,216,42,162,218,223,209,154,
+    201,89,254,22,36,34,41,179,103,48,136,106,17,213,214,125,213,97,100,58,168,161,97,240,110,36,239,170,6,152,74,91,126,
+    208,192,20,145,212,216,75,81,157,72,25,15,106,104,30,244,161,68,68,181,127,166,53,19,52,48,69,36,53,20,213,73,148,249,
+    160,134,46,193,131,17,61,171,12,102,208,65,81,45,34,41,178,87,48,128,170,17,213,214,211,202,138,71,65,13,244,8,110,141,
+    172,246,12,218,50,70,3,83,68,82,163,73,48,48,178,168,158,66,91,69,117,145,41,168,1,184,34,248,103,100,181,103,209,134,
+    15,52,48,69,36,53,154,6,131,35,91,0,215,131,69,139,78,65,189,218,205,193,101,145,213,94,72,87,250,104,96,138,72,106,
+    236,29,12,140,236,158,24,93,171,46,42,5,245,26,119,112,86,100,181,151,115,34,119,106,96,138,72,106,236,29,12,82,84,39,
+    68,166,31,120,178,190,85,118,34,125,35,172,127,21,183,16,232,150,127,17,73,137,47,172,3,115,34,170,173,71,160,20,158,
+    130,122,29,203,237,72,222,139,176,254,169,60,78,9,13,77,17,73,137,177,214,81,81,237,157,130,122,61,75,172,51,31,69,88,
+    191,43,125,40,171,161,41,34,41,161,168,246,79,65,189,129,249,214,145,209,17,214,63,128,55,169,162,161,41,34,41,241,153,
+    117,98,126,68,181,245,190,234,194,80,80,111,68,212,81,221,144,247,245,194,14,17,73,141,177,214,129,185,17,213,214,172,
+    122,203,180,235,123,35,42,7,3,216,39,194,250,19,104,205,183,250,134,36,34,41,17,229,35,80,180,3,124,203,20,212,27,85,
+    37,232,79,227,8,235,79,165,53,163,53,52,69,36,37,154,6,239,81,41,162,218,122,176,232,150,40,168,55,161,122,48,136,70,
+    17,214,159,197,1,122,8,138,136,164,70,243,96,72,132,15,22,213,211,202,54,71,65,189,73,91,7,131,105,24,97,253,165,156,
+    200,13,26,154,34,146,18,77,131,119,35,156,85,107,1,124,211,20,212,155,177,77,48,136,250,17,214,55,110,228,44,91,161,
+    193,41,34,169,208,156,110,145,213,214,2,248,166,41,168,55,171,102,48,132,93,34,109,225,9,58,51,87,131,83,68,18,111,177,
+    157,192,19,17,214,255,157,41,190,15,49,161,116,123,214,22,205,176,14,76,136,180,133,157,121,135,250,186,61,65,68,18,
+    236,23,59,146,207,35,172,95,133,119,105,161,243,224,70,105,70,189,69,53,131,33,236,17,105,11,63,208,130,97,250,198,36,
+    34,137,245,177,237,19,105,76,215,96,152,98,122,147,20,212,133,176,77,240,33,205,34,109,97,14,157,120,86,81,45,34,137,
+    212,219,218,51,51,194,250,59,240,49,123,42,166,55,73,65,93,40,85,131,1,236,23,105,11,203,57,149,158,86,160,176,22,145,
+    68,89,102,103,217,57,172,136,176,133,221,24,206,46,138,233,205,208,53,234,66,155,111,135,48,50,226,54,142,225,89,189,
+    178,67,68,18,99,186,29,205,167,145,182,208,148,247,169,174,179,222,102,41,168,139,224,79,59,44,210,55,107,1,52,231,117,
+    106,106,208,138,72,2,124,106,71,51,61,210,22,218,242,38,21,117,198,219,2,45,125,23,65,197,160,63,29,35,110,227,83,154,
+    242,137,190,61,137,136,119,207,91,187,136,99,250,48,222,85,76,23,130,130,186,72,202,5,111,113,104,196,109,76,167,45,
+    189,21,213,34,226,209,10,187,200,186,179,36,210,54,186,243,186,46,245,21,138,150,190,139,108,165,157,205,211,145,183,
+    210,157,71,53,132,69,196,139,63,236,56,6,71,220,198,249,220,79,158,206,113,133,162,160,46,134,2,187,136,135,34,111,101,
+    63,94,101,59,13,99,17,137,217,23,118,36,63,69,220,198,117,220,164,179,91,161,105,233,187,24,242,130,7,131,94,145,183,
+    242,25,123,49,68,223,163,68,36,86,207,91,171,136,99,58,224,118,197,116,145,40,168,139,233,170,224,254,200,127,120,179,
+    233,196,173,138,106,17,137,201,50,235,105,221,89,28,105,27,249,244,230,114,197,116,145,104,233,59,132,167,236,108,86,
+    69,222,202,41,60,162,171,213,34,18,185,105,214,141,207,34,110,163,52,47,114,148,206,103,69,164,160,14,229,109,59,150,
+    165,145,183,178,23,175,81,87,67,91,68,34,244,161,29,23,233,99,66,1,42,242,42,29,117,46,43,50,45,125,135,210,37,120,135,
+    138,145,183,50,142,125,25,172,111,84,34,18,17,179,91,35,126,154,55,64,45,70,40,166,139,69,65,29,82,251,96,24,53,35,111,
+    101,54,157,249,159,158,4,46,34,17,88,96,71,113,117,228,151,241,118,99,36,123,40,166,139,69,75,223,14,76,181,131,153,
+    20,67,59,237,120,158,109,53,208,69,196,161,73,118,52,19,35,111,101,95,222,97,107,157,189,138,73,51,106,7,118,12,62,102,
+    255,24,218,25,66,83,221,176,37,34,14,61,109,251,196,16,211,93,24,170,152,14,65,65,237,68,245,96,40,221,98,104,231,55,
+    58,208,211,86,40,172,69,36,180,63,173,187,157,206,162,200,219,57,149,87,41,167,152,14,65,75,223,206,172,178,139,99,120,
+    94,25,192,129,188,160,103,150,137,72,40,99,237,120,190,143,161,157,171,184,133,64,231,171,80,52,163,118,38,63,120,48,
+    184,135,56,198,227,135,236,197,123,250,134,37,34,197,214,219,90,196,16,211,249,60,68,175,64,49,29,150,102,212,142,61,
+    109,61,88,17,67,59,1,87,112,51,37,245,1,16,145,34,250,195,206,224,173,24,218,41,195,11,122,184,137,19,10,106,231,6,219,
+    49,204,139,165,165,102,244,161,158,62,6,34,82,4,159,217,9,76,137,161,157,234,188,70,107,157,159,156,208,210,183,115,
+    237,131,81,236,26,75,75,163,105,66,63,125,211,18,145,66,50,187,215,90,199,18,211,141,24,173,152,118,70,65,29,129,93,
+    130,225,180,136,165,165,249,28,199,69,182,68,97,45,34,91,244,179,181,231,146,88,46,205,29,204,8,118,84,76,59,163,160,
+    142,196,214,193,16,78,142,165,37,227,1,26,49,66,81,45,34,155,213,207,246,102,104,44,45,245,224,45,42,41,166,29,82,80,
+    71,164,116,240,44,189,98,217,3,14,147,105,195,213,182,92,97,45,34,27,53,207,78,182,99,153,19,67,75,249,220,203,163,65,
+    9,197,180,83,218,76,22,169,190,118,26,75,98,106,171,25,207,210,64,31,15,17,89,207,7,118,38,191,198,210,82,69,94,228,
+    48,157,133,156,211,140,58,82,199,6,3,168,30,83,91,163,105,202,3,102,250,230,37,34,107,44,180,115,237,224,152,98,122,
+    71,62,81,76,71,66,51,234,200,253,98,71,48,38,182,214,58,240,20,181,245,81,17,17,224,51,59,133,239,98,106,171,57,111,
+    80,67,231,158,72,104,70,29,185,218,193,135,28,19,91,107,131,104,76,31,125,251,18,201,188,229,246,79,107,25,91,76,159,
+    200,80,197,116,100,20,212,49,40,31,244,229,166,216,126,212,115,57,129,19,108,174,194,90,36,195,198,217,126,252,47,242,
+    119,76,255,37,159,219,120,158,50,138,233,200,104,233,59,54,239,217,137,204,143,173,181,154,60,166,171,69,34,153,180,
+    194,238,226,223,44,143,169,181,106,188,68,71,157,107,34,165,160,142,209,4,59,156,31,99,107,45,224,44,110,163,138,62,
+    64,34,153,242,137,157,21,195,27,166,255,182,23,175,235,209,38,145,211,210,119,140,26,6,163,232,24,91,107,198,99,236,
+    198,43,250,38,38,146,25,75,236,106,107,29,99,76,159,160,39,144,197,66,65,29,171,173,130,247,184,52,198,246,102,208,141,
+    110,54,67,97,45,146,1,67,172,17,183,198,116,93,26,74,112,55,47,6,229,20,211,49,208,210,183,7,111,218,169,49,94,173,134,
+    42,220,202,217,122,117,187,72,14,91,96,215,241,0,5,177,181,87,157,62,180,215,57,37,38,10,106,47,190,181,163,153,16,107,
+    139,7,240,24,187,234,99,37,146,147,222,179,115,153,22,99,123,123,243,154,150,188,99,164,165,111,47,234,7,159,196,120,
+    111,53,192,71,236,205,157,182,74,223,203,68,114,204,116,59,222,14,141,53,166,79,99,164,98,58,86,10,106,79,42,6,125,185,
+    131,18,49,182,184,152,203,217,159,175,20,213,34,57,99,149,221,107,187,241,114,140,45,150,226,1,158,10,116,207,116,188,
+    180,244,237,213,199,118,28,191,197,218,98,9,254,193,13,122,52,129,72,14,24,107,231,49,42,214,22,183,231,101,154,235,
+    236,17,59,5,181,103,211,237,88,70,196,220,102,3,30,164,157,62,108,34,41,54,215,174,165,119,140,155,199,0,142,226,9,61,
+    153,193,11,45,125,123,86,43,24,198,245,49,255,26,38,209,158,46,246,179,190,163,137,164,84,63,107,192,35,177,198,116,
+    9,122,241,138,98,218,19,205,168,19,97,144,157,204,204,152,219,44,199,21,92,67,105,125,240,68,82,229,123,59,159,65,49,
+    183,185,61,125,216,95,231,10,111,20,212,9,241,139,157,200,199,177,183,218,128,251,233,160,143,159,72,74,44,178,155,185,
+    147,21,49,183,122,36,79,106,46,237,149,150,190,19,162,118,48,52,246,37,112,152,68,71,186,216,79,250,182,38,146,120,102,
+    253,108,119,122,197,28,211,37,232,197,171,138,105,207,52,163,78,148,33,118,114,204,187,192,65,139,224,34,201,55,198,
+    122,198,190,237,84,75,222,73,161,160,78,152,223,173,59,3,60,180,187,51,247,113,176,62,144,34,9,244,155,221,192,227,49,
+    239,240,6,232,202,83,108,165,179,66,2,104,233,59,97,182,9,222,227,166,88,31,132,242,151,31,56,132,163,181,19,92,36,97,
+    150,218,45,182,107,236,55,98,65,57,30,228,13,197,116,66,104,70,157,72,159,218,201,49,190,185,250,255,149,227,74,46,167,
+    188,62,156,34,137,240,154,93,193,100,15,237,54,225,5,26,232,60,144,24,154,81,39,82,243,224,11,78,243,208,238,98,110,
+    96,23,30,215,51,193,69,188,251,202,218,219,209,30,98,58,143,171,249,68,49,157,40,154,81,39,216,171,214,131,57,94,90,
+    110,192,77,116,211,7,85,196,147,95,237,38,158,136,237,205,210,107,219,158,103,104,163,207,126,194,40,168,19,109,154,
+    157,194,48,79,109,183,231,118,246,214,7,86,36,102,11,237,14,110,99,137,151,182,187,241,136,174,75,39,144,130,58,225,
+    204,238,227,74,150,123,105,59,143,163,185,77,175,179,19,137,205,114,123,154,235,248,221,75,219,149,184,157,30,250,180,
+    39,146,130,58,5,62,183,238,76,242,212,118,57,46,225,106,42,234,227,43,18,177,2,123,145,127,241,147,167,214,15,228,89,
+    182,215,231,60,161,180,153,44,5,246,9,190,224,42,242,189,180,189,152,255,81,151,91,109,185,190,209,137,68,104,144,237,
+    67,119,79,49,93,130,235,25,172,152,78,48,205,168,83,227,35,59,221,203,141,26,127,105,64,47,14,215,7,89,36,2,99,237,170,
+    216,95,179,241,255,26,243,180,118,163,36,156,102,212,169,113,64,48,158,171,188,253,194,38,113,4,123,90,63,125,175,19,
+    113,106,162,157,98,205,188,197,116,9,174,98,148,98,58,241,52,163,78,153,129,118,38,211,60,182,223,156,107,233,162,143,
+    181,136,3,83,172,151,167,155,176,254,178,7,79,209,84,159,230,20,208,140,58,101,58,6,227,233,225,177,253,79,233,74,43,
+    27,162,239,119,34,161,76,181,115,108,87,122,123,139,233,18,92,197,231,138,233,148,208,140,58,149,222,180,243,60,188,
+    101,107,109,29,185,137,230,250,144,139,20,195,84,251,15,207,178,210,99,15,246,226,41,246,210,231,55,53,52,163,78,165,
+    195,131,111,232,129,207,207,217,64,246,167,163,141,214,247,60,145,34,249,197,122,90,3,158,244,24,211,37,184,138,207,
+    20,211,169,162,25,117,138,13,178,115,60,238,3,7,8,232,202,141,236,169,143,188,72,33,252,106,183,210,155,101,94,251,176,
+    55,79,233,19,155,58,154,81,167,88,135,224,43,46,241,116,127,245,95,140,55,217,155,99,109,130,190,239,137,108,214,15,
+    214,195,118,226,126,175,49,93,138,155,248,76,49,157,66,154,81,167,222,167,118,22,19,60,247,33,160,11,87,179,191,78,0,
+    34,27,241,149,245,162,175,199,221,221,127,105,201,35,52,210,103,52,149,20,212,57,96,133,221,197,245,158,23,212,0,90,
+    114,21,135,17,232,84,32,178,198,88,235,197,43,248,62,207,86,225,6,46,34,79,159,205,148,82,80,231,136,175,237,92,70,248,
+    238,4,176,39,87,114,44,37,116,66,16,97,160,221,194,80,223,157,0,78,224,110,106,232,51,153,98,10,234,156,97,246,28,151,
+    51,203,119,55,128,29,185,132,179,41,167,19,131,100,150,217,59,252,151,207,124,119,3,168,199,131,116,214,103,49,229,20,
+    212,57,101,150,93,193,179,222,151,217,0,182,161,39,231,83,69,39,8,201,156,37,246,28,247,240,141,239,110,0,37,185,156,
+    235,40,171,79,97,234,41,168,115,206,199,118,158,247,205,101,127,169,192,25,92,65,109,157,38,36,51,126,183,167,184,143,
+    233,190,187,1,104,243,88,46,81,80,231,160,229,118,7,55,179,196,119,55,0,40,205,201,92,164,27,66,36,3,190,182,123,120,
+    62,1,155,58,1,170,210,139,179,181,177,51,103,40,168,115,212,100,187,136,247,124,119,98,141,3,185,136,195,181,197,76,
+    114,148,217,64,238,98,64,34,46,58,65,192,137,220,169,205,99,57,69,65,157,195,6,217,69,76,242,221,137,53,182,165,7,23,
+    82,93,167,15,201,41,203,173,15,119,48,222,119,55,214,216,139,251,104,173,79,89,142,81,80,231,180,165,118,39,183,176,
+    200,119,55,214,40,203,9,92,164,167,12,75,142,248,197,122,211,155,153,190,187,177,70,53,254,67,15,242,245,249,202,57,
+    10,234,156,247,171,93,195,243,9,89,148,251,75,83,46,230,4,74,234,116,34,41,54,220,238,227,13,86,248,238,198,26,121,156,
+    196,157,108,173,79,85,78,82,80,103,194,135,118,49,95,249,238,196,58,182,165,7,23,232,180,34,41,180,192,250,112,63,95,
+    251,238,198,58,14,224,62,109,217,204,97,10,234,140,88,105,15,115,61,115,125,119,99,29,101,56,158,179,105,161,211,139,
+    164,198,23,246,16,47,178,216,119,55,214,81,155,219,57,78,59,188,115,154,130,58,67,102,219,245,244,246,250,186,250,141,
+    217,157,51,232,206,54,58,205,72,162,45,179,190,60,196,167,190,187,177,158,210,252,131,107,41,175,79,79,142,83,80,103,
+    204,36,187,130,119,124,119,98,3,165,232,194,153,28,164,109,48,146,72,227,237,9,94,96,182,239,110,108,160,43,119,177,
+    147,62,51,25,160,160,206,160,33,246,15,198,249,238,196,70,212,162,59,103,235,196,35,9,178,192,250,240,108,34,94,119,
+    179,190,166,220,78,91,125,86,50,66,65,157,73,5,246,42,151,243,179,239,110,108,68,30,251,115,10,39,235,149,30,226,221,
+    24,235,205,11,9,186,185,241,255,213,225,95,156,165,151,86,102,136,130,58,179,22,219,253,252,151,63,125,119,99,163,42,
+    115,28,231,208,68,39,34,241,98,186,61,199,227,252,224,187,27,27,85,149,171,232,73,25,125,54,50,69,65,157,105,191,218,
+    13,60,157,184,237,101,127,219,139,19,57,158,58,58,37,73,108,150,216,219,60,205,0,86,249,238,200,70,149,230,66,254,73,
+    85,125,34,50,71,65,157,121,223,218,117,188,146,168,7,162,172,171,41,221,57,94,79,46,150,136,21,216,72,158,163,15,11,
+    124,119,100,19,2,142,161,23,245,244,57,200,36,5,181,0,163,237,26,6,251,238,196,102,228,211,156,83,56,158,74,58,77,73,
+    4,38,216,115,60,203,111,190,187,177,25,45,184,93,79,28,200,48,5,181,172,54,208,174,229,115,223,157,216,172,178,116,225,
+    4,14,166,180,78,88,226,200,183,246,34,47,38,244,106,244,223,26,209,139,67,53,230,51,77,65,45,107,152,189,194,117,124,
+    235,187,27,91,80,133,35,57,145,182,186,231,90,66,249,213,250,242,98,194,191,154,66,125,174,231,56,237,239,206,60,5,181,
+    172,99,165,61,195,205,76,245,221,141,45,170,201,17,28,65,91,74,233,20,38,69,52,197,94,229,53,62,77,240,190,140,191,212,
+    229,223,116,215,23,82,65,65,45,27,177,194,94,226,38,126,244,221,141,66,40,71,59,186,209,149,42,58,153,73,33,76,182,183,
+    233,199,200,196,71,52,212,230,114,206,213,69,30,89,77,65,45,27,181,194,94,226,70,38,251,238,70,161,228,211,156,110,28,
+    77,109,157,214,100,19,38,88,63,222,97,140,239,110,20,202,214,252,131,139,41,171,209,44,107,40,168,101,147,150,217,99,
+    220,194,116,223,221,40,164,128,125,56,130,195,105,168,19,156,172,177,202,62,229,45,94,77,197,250,16,64,117,174,228,2,
+    61,151,79,214,163,160,150,205,90,106,143,114,107,162,111,92,89,223,206,28,193,225,236,175,107,123,25,55,199,62,224,29,
+    62,224,15,223,29,41,180,42,92,198,37,84,212,184,149,13,40,168,101,139,150,216,19,220,158,200,39,131,111,90,85,218,113,
+    16,7,177,163,78,123,153,243,149,189,199,187,124,146,208,167,139,109,92,53,46,230,34,61,115,76,54,65,65,45,133,178,194,
+    94,226,22,38,249,238,70,145,213,163,3,29,232,168,237,102,25,176,196,70,240,54,111,164,236,43,37,108,195,121,92,74,101,
+    141,80,217,36,5,181,20,90,129,245,227,22,190,244,221,141,98,40,201,254,28,68,71,154,106,65,60,7,173,178,49,12,102,48,
+    35,88,234,187,43,69,86,151,43,57,93,187,187,101,11,20,212,82,68,131,236,122,70,250,238,68,49,85,160,13,93,232,196,14,
+    58,49,230,132,201,54,136,65,12,102,142,239,142,20,203,206,92,193,25,148,208,88,148,45,82,80,75,49,12,181,94,12,76,193,
+    221,168,155,178,11,173,56,144,214,122,197,65,74,77,183,65,12,102,48,191,250,238,72,177,237,195,181,28,174,39,142,73,
+    33,41,168,165,152,190,178,59,233,195,114,223,221,8,101,59,14,160,53,7,176,59,129,78,153,41,240,189,141,100,56,195,83,
+    184,87,98,109,7,114,13,157,52,222,164,8,20,212,18,194,175,118,31,189,153,231,187,27,161,85,163,21,7,208,154,189,181,
+    16,153,64,43,108,44,35,25,206,8,102,250,238,74,72,121,28,206,63,104,169,49,38,69,164,160,150,144,254,180,39,184,135,
+    159,124,119,195,137,10,180,160,53,251,211,76,47,212,76,128,249,54,146,145,124,204,104,22,251,238,138,3,21,56,157,158,
+    236,164,113,37,197,160,160,22,7,86,218,43,220,153,248,55,17,21,94,30,13,216,151,125,217,143,61,40,169,83,107,172,86,
+    217,55,140,102,52,195,153,64,129,239,206,56,82,135,139,56,91,183,8,74,177,41,168,197,153,49,118,47,125,88,225,187,27,
+    78,149,164,49,45,105,74,83,93,199,142,216,116,27,195,24,70,240,9,139,124,119,197,169,189,185,132,19,244,117,79,66,81,
+    80,139,83,191,218,35,244,230,119,223,221,136,192,214,236,75,51,246,96,79,234,106,183,174,51,147,237,115,62,231,115,198,
+    176,192,119,87,156,203,227,8,46,165,149,198,138,132,166,160,22,231,150,89,95,238,103,180,239,110,68,166,60,13,105,204,
+    30,52,98,79,170,233,52,92,100,127,216,215,76,228,107,38,242,85,74,239,128,222,178,10,156,65,79,221,254,39,142,51,135,
+    173,121,0,0,5,68,73,68,65,84,40,168,37,34,159,217,125,188,146,242,219,183,182,108,91,246,160,49,123,208,144,157,245,
+    16,200,205,152,107,19,152,192,4,38,242,117,234,247,110,111,73,67,206,165,187,70,131,56,164,160,150,8,205,176,167,120,
+    140,41,190,187,17,147,234,236,180,250,175,157,217,137,154,25,63,81,207,180,41,252,253,215,55,169,121,89,106,56,165,57,
+    138,115,57,32,227,191,121,113,79,65,45,17,43,176,129,244,230,237,28,219,100,182,101,229,87,135,246,14,108,71,13,106,
+    81,147,50,57,124,2,55,155,197,140,53,193,60,153,41,57,113,75,85,81,212,163,7,167,179,77,14,255,142,197,31,5,181,196,
+    226,55,123,146,199,153,234,187,27,94,85,101,91,106,176,29,219,172,142,238,26,84,161,50,229,83,118,106,47,176,89,252,
+    206,12,102,174,254,255,179,152,206,239,204,98,165,239,142,121,147,207,161,156,75,39,109,49,148,200,40,168,37,54,5,54,
+    128,71,121,39,195,167,244,141,41,65,21,42,83,133,170,84,166,242,234,255,94,153,242,84,1,42,147,71,5,74,82,150,50,148,
+    138,52,210,151,218,18,10,152,15,44,100,5,203,89,196,92,22,240,39,11,88,192,2,230,173,254,207,5,252,153,3,207,161,115,
+    105,91,206,226,108,234,40,162,37,82,10,106,137,217,111,246,28,207,48,209,119,55,82,169,4,21,9,168,2,64,5,74,174,245,
+    79,254,254,187,127,203,103,213,122,127,118,225,122,23,31,22,177,156,21,44,4,230,231,204,131,69,226,84,130,78,156,78,
+    87,221,33,45,49,80,80,139,23,99,236,89,94,100,182,239,110,136,20,195,110,28,203,25,108,175,136,150,152,40,168,197,155,
+    101,54,128,231,120,93,75,225,146,26,85,56,150,238,122,136,137,196,76,65,45,158,253,106,207,242,108,202,95,92,40,185,
+    175,4,157,56,141,46,148,86,72,75,236,20,212,146,8,19,172,31,207,102,230,142,107,73,23,45,117,139,95,10,106,73,140,2,
+    27,198,139,188,170,125,197,146,24,117,232,198,9,236,163,136,22,175,20,212,146,48,203,108,0,253,120,45,199,222,161,36,
+    105,83,141,67,56,133,118,186,59,90,18,64,65,45,137,52,223,222,224,21,6,178,204,119,71,36,115,182,230,104,142,163,53,
+    249,138,104,73,8,5,181,36,216,98,27,76,63,94,103,161,239,142,72,38,84,161,11,221,232,172,123,163,37,97,20,212,146,120,
+    11,237,93,94,225,189,204,61,61,90,226,83,149,195,56,142,142,148,82,68,75,2,41,168,37,37,22,91,127,94,165,191,182,154,
+    137,83,117,233,74,87,14,160,132,34,90,18,75,65,45,169,178,202,62,225,29,222,224,91,223,29,145,212,219,157,110,116,161,
+    9,129,34,90,18,78,65,45,169,52,217,222,166,31,159,232,41,213,82,100,101,104,197,97,28,195,118,10,104,73,9,5,181,164,
+    216,111,246,54,111,51,84,183,114,73,161,212,224,96,186,208,41,117,175,22,149,172,83,80,75,234,173,180,79,121,135,65,
+    140,69,163,89,54,38,159,189,56,140,46,236,173,187,162,37,149,20,212,146,51,102,218,7,188,195,32,230,250,238,136,36,70,
+    61,58,208,129,131,168,172,128,150,20,83,80,75,142,89,105,159,240,62,131,249,124,131,55,50,75,118,84,162,13,157,232,196,
+    78,10,104,201,1,10,106,201,81,139,236,19,6,49,136,47,180,225,44,67,202,209,130,150,180,226,0,221,17,45,57,68,65,45,57,
+    110,150,13,99,56,35,24,227,187,35,18,161,178,52,161,21,29,104,173,215,80,74,14,82,80,75,70,252,108,31,50,156,225,124,
+    163,45,103,57,164,2,251,209,138,182,52,87,64,75,14,83,80,75,198,44,176,81,12,103,4,195,89,234,187,43,82,108,219,210,
+    148,86,180,100,95,45,113,75,6,40,168,37,163,150,216,40,62,102,36,163,248,195,119,87,164,144,242,105,72,107,246,167,21,
+    59,40,158,37,67,20,212,146,121,223,219,40,70,49,138,47,244,82,205,132,218,158,102,236,75,51,154,82,73,1,45,25,164,160,
+    22,89,109,185,141,227,175,200,254,78,215,177,19,160,58,205,86,255,85,67,241,44,153,166,160,22,217,192,159,246,37,95,
+    48,142,47,152,192,114,223,157,201,152,218,236,73,99,246,162,25,117,21,207,34,128,130,90,100,179,150,219,4,198,241,5,
+    227,248,146,5,190,59,147,179,74,177,59,123,210,152,61,217,139,106,138,103,145,245,40,168,69,10,233,103,155,200,215,76,
+    228,107,190,97,161,239,206,164,94,62,245,104,72,3,26,178,7,187,83,82,241,44,178,73,10,106,145,34,51,155,202,95,161,253,
+    45,223,51,199,119,119,82,163,20,187,178,27,187,179,59,13,168,175,59,159,69,10,73,65,45,18,210,31,246,61,223,241,29,223,
+    243,61,223,107,174,189,142,82,212,101,103,118,98,103,118,102,103,234,82,66,225,44,82,100,10,106,17,167,166,219,143,76,
+    101,10,63,49,149,169,76,99,133,239,14,197,172,38,117,216,158,122,236,196,206,236,68,29,242,21,205,34,33,41,168,69,34,
+    180,202,166,51,149,169,76,229,23,166,243,43,191,49,51,167,110,253,42,71,29,234,80,135,29,216,129,58,212,97,123,202,40,
+    152,69,28,83,80,139,196,106,133,253,206,52,102,50,141,25,252,194,108,102,51,139,223,83,176,96,94,130,173,169,65,45,182,
+    161,22,53,168,201,182,108,67,45,42,42,150,69,34,167,160,22,73,128,165,54,155,217,252,206,44,102,243,7,243,89,192,124,
+    22,48,143,121,44,96,65,76,79,76,43,69,121,170,82,158,10,84,97,43,170,173,254,191,173,168,70,53,170,81,89,145,44,226,
+    137,130,90,36,241,150,218,2,22,178,136,229,204,103,21,243,88,193,66,150,178,132,69,171,31,199,178,128,85,0,172,216,200,
+    204,188,10,127,39,108,73,42,0,85,129,10,148,164,12,101,201,167,18,229,169,176,58,160,245,122,11,145,100,250,63,108,218,
+    93,110,88,49,132,66,0,0,0,37,116,69,88,116,100,97,116,101,58,99,114,101,97,116,101,0,50,48,50,49,45,48,51,45,50,53,84,
+    50,48,58,48,55,58,51,53,43,48,48,58,48,48,201,130,62,218,0,0,0,37,116,69,88,116,100,97,116,101,58,109,111,100,105,102,
+    121,0,50,48,49,54,45,48,52,45,50,52,84,49,48,58,52,50,58,49,49,43,48,48,58,48,48,211,78,37,178,0,0,0,0,73,69,78,68,174,
+    66,96,130,
+};
+
+inline const unsigned char texture_white_wins[14743] = {
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,5,220,0,0,3,132,8,6,0,0,0,187,56,243,196,0,0,0,9,112,72,89,115,0,0,
+    11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,
+    0,57,44,73,68,65,84,120,1,236,221,241,149,19,215,221,199,225,225,61,254,159,80,129,67,5,196,21,96,87,0,169,192,80,1,
+    184,2,160,2,67,5,64,5,134,10,128,10,108,42,32,84,64,168,128,215,191,205,153,68,217,236,74,186,87,223,25,205,72,207,115,
+    142,206,38,120,119,165,149,52,51,154,207,220,185,115,99,24,134,111,3,0,0,0,0,0,112,144,255,27,0,0,0,0,0,128,131,9,238,
+    0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,
+    224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,192,119,67,163,111,223,190,13,0,0,0,0,0,
+    112,234,110,220,184,209,244,253,70,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,
+    0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,
+    0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,
+    14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,
+    238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,
+    128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,
+    0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,
+    0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,
+    59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,
+    184,3,0,0,0,0,64,128,224,14,0,0,0,0,0,1,130,59,0,0,0,0,0,4,8,238,0,0,0,0,0,16,32,184,51,0,0,0,0,0,112,56,193,29,0,0,
+    0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,
+    0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,
+    29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,
+    220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,
+    0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,
+    8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,
+    0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,
+    0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,
+    0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,128,239,6,0,128,6,159,
+    63,127,30,254,241,143,127,92,252,239,59,119,238,12,127,249,203,95,6,0,214,109,115,221,94,235,245,90,191,3,0,208,78,112,
+    7,0,118,170,8,243,226,197,139,225,213,171,87,195,63,255,249,207,255,250,111,127,251,219,223,134,31,127,252,113,120,242,
+    228,137,248,14,176,34,219,214,237,127,253,235,95,255,189,110,175,255,13,0,192,126,110,252,121,251,214,242,3,223,190,
+    53,125,59,0,52,251,233,167,159,134,86,191,254,250,235,69,248,37,239,217,179,103,195,211,167,79,119,126,95,197,246,250,
+    190,71,143,30,13,0,44,219,190,235,246,82,223,87,225,29,0,224,28,221,184,113,163,233,251,141,112,7,96,113,222,191,127,
+    63,180,186,60,50,143,140,135,15,31,94,140,124,220,71,189,6,143,31,63,190,248,42,204,0,44,87,203,186,189,140,97,222,186,
+    29,0,96,55,23,77,5,0,174,84,163,31,91,130,204,168,194,76,77,81,0,192,242,88,183,3,0,76,203,148,50,0,44,78,235,233,90,
+    229,221,187,119,23,115,205,146,81,243,250,222,190,125,123,232,85,211,203,124,250,244,201,156,238,0,11,98,221,14,0,208,
+    206,148,50,0,192,193,106,4,228,33,106,90,153,26,9,105,250,1,128,229,176,110,135,227,248,227,143,63,134,143,31,63,54,
+    253,204,157,59,119,92,159,8,96,165,140,112,7,56,80,141,22,171,185,80,91,212,200,176,223,126,251,109,88,163,250,91,235,
+    111,110,209,122,65,83,35,220,143,175,231,53,184,236,175,127,253,235,197,72,72,0,150,193,186,29,142,163,229,34,197,35,
+    23,43,6,88,14,35,220,1,142,160,231,34,159,107,213,51,239,235,173,91,183,6,214,227,195,135,15,67,66,29,152,169,209,144,
+    166,30,0,56,62,235,118,0,128,121,8,238,0,7,170,145,94,61,62,127,254,60,124,255,253,247,195,154,212,14,118,143,181,253,
+    157,228,124,253,250,117,117,81,166,98,82,45,159,45,110,222,188,233,180,111,224,108,172,113,221,14,0,48,23,193,29,32,
+    160,162,123,235,52,43,95,190,124,89,93,136,110,253,27,75,239,1,9,56,150,215,175,95,55,159,246,93,211,25,213,180,70,0,
+    75,213,123,208,28,0,128,54,255,55,0,112,176,158,81,94,173,35,104,151,160,70,180,181,18,220,215,167,70,107,47,241,119,
+    1,208,47,121,144,223,186,29,0,224,122,130,59,64,64,207,84,18,107,28,105,214,115,145,52,167,156,175,79,29,36,73,188,110,
+    169,223,3,192,225,172,219,1,0,230,33,184,3,4,244,236,120,246,76,207,114,108,61,163,242,141,112,95,159,122,63,215,20,
+    41,135,74,252,14,0,50,106,221,158,184,214,132,117,59,204,195,103,104,128,245,18,220,1,2,122,62,16,175,113,132,123,207,
+    99,182,179,176,78,143,30,61,26,14,81,97,231,201,147,39,3,0,203,113,232,122,217,186,29,0,96,55,193,29,32,160,103,46,211,
+    53,6,119,23,77,61,31,53,130,241,241,227,199,67,175,10,50,94,123,128,101,177,110,7,0,152,158,224,14,16,208,115,138,246,
+    26,167,148,233,57,72,224,194,106,235,245,235,175,191,14,63,255,252,243,208,170,130,204,33,65,7,128,233,88,183,195,252,
+    92,247,0,224,188,8,238,0,1,231,50,135,123,79,112,79,204,23,203,241,188,122,245,106,239,233,3,106,57,168,144,243,244,
+    233,211,1,128,229,178,110,135,121,25,128,2,112,94,4,119,128,128,115,153,195,189,231,32,129,17,61,235,87,145,229,211,
+    167,79,195,131,7,15,174,124,61,235,223,106,212,227,239,191,255,110,244,35,192,74,88,183,3,0,76,227,187,1,128,136,138,
+    238,45,65,186,130,123,221,214,20,164,91,15,18,152,231,245,116,212,107,249,242,229,203,139,219,31,127,252,241,239,247,
+    66,253,187,215,25,96,157,172,219,1,0,242,4,119,128,144,214,224,94,190,126,253,186,154,224,238,130,169,140,76,19,4,112,
+    122,172,219,1,0,50,76,41,3,16,210,19,151,235,84,238,181,248,252,249,243,208,202,116,50,0,0,0,192,57,17,220,1,66,122,
+    226,114,79,196,62,22,23,76,5,0,0,0,216,78,112,7,8,57,245,11,167,186,96,42,0,0,0,192,118,130,59,64,200,169,7,247,158,
+    199,106,14,119,0,0,104,103,224,10,192,122,9,238,0,33,223,127,255,253,208,170,103,212,248,177,244,60,214,158,231,4,0,
+    0,206,221,205,155,55,7,0,214,73,112,7,8,49,165,204,255,50,194,29,0,0,0,56,39,130,59,64,72,157,246,217,122,234,231,154,
+    70,184,247,112,42,44,0,0,0,112,78,190,27,0,136,169,192,220,50,106,253,148,71,184,255,237,111,127,27,150,174,158,255,
+    207,159,63,15,127,252,241,199,197,255,191,252,55,214,8,253,122,77,235,235,157,59,119,6,224,48,227,242,86,203,222,120,
+    219,52,46,115,117,171,101,206,65,59,96,41,124,102,216,79,61,71,165,158,159,205,245,252,85,235,252,77,155,3,87,198,255,
+    61,222,76,81,8,192,218,8,238,0,65,181,147,213,18,166,15,25,225,94,59,45,31,63,126,108,250,153,218,97,233,157,230,165,
+    245,177,46,49,148,141,207,217,171,87,175,134,247,239,223,55,255,77,63,254,248,227,197,129,132,7,15,30,44,114,103,186,
+    254,182,165,28,196,185,123,247,238,112,44,31,62,124,24,14,209,179,92,214,243,126,232,253,246,58,230,115,189,77,61,39,
+    111,223,190,189,136,83,181,188,141,145,170,69,173,71,106,153,171,101,175,110,75,253,91,249,111,173,203,66,239,182,169,
+    117,157,119,200,54,176,103,249,78,29,52,178,110,223,174,245,181,217,247,111,56,245,207,12,135,24,183,121,245,156,212,
+    186,189,190,142,183,169,140,7,51,198,175,117,171,231,247,222,189,123,3,0,44,209,183,150,27,0,215,251,115,167,234,91,
+    235,122,245,207,157,147,111,61,254,220,249,107,190,175,231,207,159,127,235,241,229,203,151,230,251,170,231,162,87,235,
+    125,213,237,221,187,119,91,31,255,211,167,79,191,253,185,147,214,245,187,175,186,253,185,163,247,237,207,157,240,111,
+    75,242,231,206,125,236,239,59,244,118,44,159,62,125,90,204,115,48,199,173,222,135,75,82,203,218,155,55,111,38,123,47,
+    214,223,91,235,150,122,157,89,166,158,237,69,239,182,169,245,125,246,248,241,227,111,61,122,254,166,228,122,208,186,
+    125,187,214,191,161,94,207,109,206,229,51,67,139,122,78,106,57,173,245,111,253,45,199,120,239,93,117,171,215,104,45,
+    94,190,124,217,252,247,109,251,108,11,192,188,90,215,225,230,112,7,8,234,25,57,247,231,78,204,208,163,103,180,104,239,
+    200,163,53,95,48,181,70,96,253,240,195,15,195,159,59,207,209,17,130,245,156,212,168,181,219,183,111,15,175,95,191,30,
+    224,156,213,178,245,236,217,179,139,229,225,254,253,251,23,163,65,167,80,203,93,141,54,173,251,249,233,167,159,78,254,
+    58,24,107,212,115,61,147,222,117,115,235,118,240,28,183,129,252,175,175,95,191,94,251,223,124,102,248,143,250,251,95,
+    188,120,113,177,174,189,117,235,214,240,231,1,171,139,245,239,146,214,187,107,152,190,16,128,243,36,184,3,4,245,204,
+    49,57,206,117,217,170,103,135,167,119,39,105,219,206,233,117,150,48,165,76,5,192,58,165,123,202,157,195,113,39,250,151,
+    95,126,25,224,28,141,1,60,29,168,118,169,168,95,247,251,240,225,67,225,125,97,90,99,115,239,52,78,173,239,183,57,183,
+    129,130,251,114,125,250,244,233,202,127,247,153,225,95,234,49,214,122,181,214,175,21,217,167,58,128,154,224,58,31,0,
+    44,149,224,14,16,84,35,128,90,205,53,178,175,247,103,202,117,59,167,219,28,123,190,210,218,113,174,0,56,151,231,207,
+    159,95,140,138,19,254,56,23,181,238,170,145,143,21,102,142,57,191,116,5,255,122,28,111,222,188,25,88,134,214,216,220,
+    243,254,105,189,134,73,233,93,63,247,108,3,141,188,93,174,171,6,58,248,204,240,175,229,176,14,4,84,104,175,245,234,82,
+    174,27,176,141,3,91,0,44,149,224,14,16,212,19,153,231,60,197,189,247,190,122,70,225,31,115,212,81,253,157,115,238,56,
+    143,234,128,70,133,191,53,236,164,194,33,234,189,94,177,104,41,35,31,107,153,255,251,223,255,126,17,205,56,190,214,245,
+    127,239,8,247,158,159,233,217,158,245,252,140,16,184,92,151,223,59,62,51,252,103,42,157,58,16,176,38,150,51,0,150,74,
+    112,7,8,234,137,204,189,59,90,115,198,243,158,199,120,204,157,160,218,129,61,150,122,93,142,121,255,48,181,26,73,190,
+    212,249,211,43,154,137,238,199,55,199,8,247,222,51,182,122,174,155,178,182,109,32,219,93,126,61,207,253,51,67,205,211,
+    62,245,84,58,83,177,156,1,176,84,130,59,64,208,92,23,139,235,13,13,189,63,219,186,19,214,243,60,164,212,40,173,99,239,
+    52,214,115,108,78,119,78,81,197,246,26,73,190,228,179,56,68,247,227,107,189,158,201,156,103,108,205,53,21,77,207,53,
+    93,152,199,230,235,121,238,159,25,42,182,215,60,237,107,101,57,3,96,169,4,119,128,176,57,78,165,239,189,208,106,239,
+    253,181,198,181,99,142,56,170,121,71,151,160,78,203,94,242,133,198,160,85,69,161,154,175,125,13,42,186,87,72,226,56,
+    106,14,232,86,115,93,0,117,174,233,107,204,225,190,92,155,175,231,57,127,102,168,117,250,154,99,123,89,211,8,247,158,
+    235,60,245,172,75,1,88,6,193,29,32,172,117,39,123,206,145,125,189,63,219,26,27,142,57,127,251,146,46,156,104,148,45,
+    167,98,156,35,125,77,215,39,168,232,126,200,217,64,244,235,25,117,250,245,235,215,166,239,239,125,109,231,216,230,154,
+    230,98,217,54,95,207,115,253,204,80,235,242,90,167,175,217,49,207,166,236,177,166,199,10,192,225,4,119,128,176,57,166,
+    148,153,59,184,175,37,54,84,128,105,121,62,235,113,214,1,146,154,187,180,110,245,191,147,59,68,53,90,237,237,219,183,
+    3,172,93,141,108,95,219,252,190,181,46,88,203,136,252,83,211,179,13,248,244,233,211,222,223,91,175,109,239,193,159,57,
+    166,85,19,220,151,109,124,239,180,126,102,152,218,156,159,25,234,12,160,181,173,211,47,179,156,1,176,100,223,13,0,68,
+    245,92,44,174,110,45,161,119,238,57,220,215,50,165,204,174,169,118,42,170,223,191,127,127,184,123,247,238,214,51,17,
+    234,57,170,121,93,235,20,239,67,119,72,235,119,220,187,119,111,152,67,253,109,233,231,190,254,254,53,77,141,83,203,209,
+    131,7,15,134,67,212,235,223,186,156,212,243,94,239,175,185,205,49,98,174,70,93,166,222,3,245,60,213,251,244,206,157,
+    59,23,143,125,115,57,28,215,133,53,199,118,61,255,117,159,135,46,127,245,123,234,241,63,121,242,100,96,94,245,90,183,
+    188,126,45,83,165,205,121,208,121,9,211,201,88,183,103,141,175,233,190,239,185,122,61,235,86,175,193,230,217,27,117,
+    86,70,61,143,227,250,42,97,142,207,12,245,152,235,12,160,169,212,243,52,222,198,255,95,106,157,127,243,230,205,107,127,
+    174,158,207,241,181,25,183,7,155,7,215,234,113,111,46,191,70,140,3,176,100,130,59,64,88,239,169,244,115,5,247,214,216,
+    208,19,54,142,17,220,199,72,119,149,10,161,21,220,246,13,162,227,206,245,163,71,143,46,118,126,43,216,245,142,130,171,
+    157,240,186,205,17,99,235,241,166,213,129,135,99,132,228,94,181,28,189,124,249,114,56,68,189,222,61,193,253,208,251,
+    93,162,90,254,107,25,56,68,189,38,245,222,28,207,36,217,101,243,123,106,217,121,253,250,245,65,243,44,215,227,175,251,
+    23,103,230,53,229,243,125,200,117,76,90,15,114,47,97,27,104,221,158,85,175,127,253,253,219,166,147,169,231,230,231,159,
+    127,190,56,216,177,207,123,101,60,128,81,219,143,67,14,8,205,241,153,33,121,160,101,60,75,176,14,162,214,215,57,62,255,
+    29,114,134,11,0,204,197,148,50,0,97,61,23,69,74,158,74,95,163,123,119,141,240,109,137,21,61,97,163,231,160,195,161,234,
+    194,95,151,163,92,237,36,255,246,219,111,195,187,119,239,186,119,94,235,247,254,254,251,239,7,237,68,154,86,134,181,
+    58,228,96,83,169,229,167,214,111,53,154,178,103,25,172,159,169,3,25,135,44,131,245,248,93,64,117,126,173,175,87,75,164,
+    60,244,204,135,150,159,111,157,91,190,152,234,98,249,106,221,114,213,129,188,122,237,234,51,67,221,234,179,212,190,7,
+    102,234,231,234,251,235,231,14,189,16,233,212,159,25,14,93,31,214,115,82,131,24,106,221,94,235,230,95,127,253,245,226,
+    111,159,235,125,95,247,191,57,130,30,0,150,72,112,7,8,171,81,62,173,146,167,210,143,163,179,183,105,25,189,219,19,219,
+    150,48,146,180,118,196,106,71,176,70,167,37,126,87,237,68,247,254,93,75,186,40,27,236,171,214,53,189,35,203,199,51,13,
+    42,196,36,214,7,181,78,59,100,121,174,81,238,70,68,206,235,152,193,125,215,116,25,117,70,212,190,90,14,136,143,142,113,
+    208,153,195,141,7,216,15,25,93,94,239,251,90,239,29,50,141,213,148,159,25,198,41,112,122,109,30,68,21,188,1,224,122,
+    130,59,64,88,79,92,106,9,65,187,226,124,237,0,109,155,35,179,76,61,146,112,9,59,97,21,200,147,143,99,220,137,238,81,
+    207,161,216,199,218,212,232,246,30,181,14,28,71,135,38,141,103,172,212,52,15,173,106,249,171,169,105,152,79,207,245,
+    76,246,181,45,24,142,211,129,109,51,213,220,242,35,33,114,125,42,144,167,14,16,150,10,210,189,35,221,167,252,204,208,
+    114,176,233,178,244,115,4,0,167,76,112,7,8,171,29,145,214,157,145,84,104,40,21,219,119,141,112,111,137,13,173,59,125,
+    61,127,127,90,237,16,78,17,60,42,32,246,142,124,171,249,98,97,45,14,25,221,94,177,61,125,209,200,77,245,184,122,150,
+    67,103,154,204,107,215,129,223,203,82,7,130,107,221,191,107,59,116,234,219,64,218,212,153,51,83,92,68,180,2,117,239,
+    123,97,170,207,12,189,163,219,107,157,62,229,133,86,1,224,212,8,238,0,19,104,221,193,106,217,249,223,181,179,84,59,69,
+    187,238,127,202,17,238,199,30,217,87,247,127,232,252,169,219,244,158,38,126,200,41,220,48,183,222,139,234,213,193,174,
+    41,99,251,168,166,171,105,93,207,214,223,116,200,197,54,105,211,250,62,104,9,219,187,130,251,230,215,171,180,172,143,
+    91,183,129,115,188,255,201,57,228,236,181,93,106,29,213,251,121,100,170,207,12,189,215,63,16,219,1,160,141,224,14,48,
+    129,41,67,195,174,239,29,47,38,181,45,70,77,25,27,142,61,178,111,234,157,194,125,14,104,92,165,119,39,23,142,161,103,
+    250,149,58,3,100,202,131,93,155,122,15,172,25,229,62,159,169,206,244,218,181,253,26,67,251,182,237,112,114,155,123,221,
+    253,179,14,53,69,213,148,175,217,174,233,141,174,51,213,103,134,222,223,123,247,238,221,1,0,216,159,224,14,48,129,99,
+    141,112,223,12,12,169,211,233,91,29,51,54,212,125,247,204,239,220,162,158,215,158,233,44,140,112,103,45,106,253,208,
+    51,194,253,144,139,4,246,168,144,213,51,202,157,121,244,204,225,190,79,220,254,250,245,235,214,255,62,94,184,124,219,
+    253,183,204,145,189,182,179,188,216,95,173,63,210,215,154,184,234,62,78,225,51,131,105,146,0,160,141,224,14,48,129,169,
+    46,22,183,43,72,108,238,16,237,26,101,191,239,212,10,107,138,13,53,15,235,28,122,166,12,112,209,84,214,162,39,74,87,
+    180,154,123,217,239,153,174,65,112,159,87,235,123,98,87,76,47,251,76,171,86,190,255,254,251,173,223,183,239,182,205,
+    148,50,167,171,62,51,204,177,222,58,133,207,12,62,195,28,199,174,245,24,0,203,37,184,3,76,160,245,3,242,190,59,244,31,
+    63,126,220,250,223,55,119,28,119,141,70,218,119,244,212,154,130,251,189,123,247,134,57,244,236,0,217,89,101,45,222,190,
+    125,59,180,234,157,54,225,80,173,103,180,212,114,104,30,247,249,180,142,138,253,242,229,203,206,239,217,182,77,218,188,
+    96,105,226,160,115,207,122,91,32,91,143,169,207,136,27,141,103,93,180,152,234,51,67,239,72,117,103,233,1,64,27,193,29,
+    96,2,183,110,221,26,90,37,118,254,55,99,247,174,240,189,79,72,95,83,108,232,61,109,187,71,207,235,43,184,179,22,173,
+    97,165,194,230,177,70,245,214,122,174,245,32,159,112,52,159,214,247,197,62,219,193,109,175,95,122,27,216,51,253,154,
+    41,101,214,99,174,245,214,146,62,51,244,6,247,95,126,249,101,0,0,246,39,184,3,76,160,103,52,211,62,35,251,246,61,149,
+    190,36,78,167,239,137,13,199,154,231,115,206,224,103,46,83,78,85,69,158,214,229,126,174,169,156,82,247,239,2,198,243,
+    153,226,194,169,219,190,231,242,89,94,219,226,247,62,7,94,246,153,226,102,211,230,8,123,150,173,247,2,232,61,150,244,
+    158,232,253,172,84,203,203,223,255,254,119,235,79,0,216,147,224,14,48,129,158,157,171,67,71,246,149,155,55,111,254,251,
+    127,239,218,169,218,103,167,169,53,54,236,115,191,83,49,111,46,28,110,215,180,85,87,185,123,247,238,112,76,70,184,47,
+    87,235,107,179,207,118,105,223,11,135,151,109,219,226,125,226,254,167,79,159,134,22,182,67,235,113,174,103,34,244,12,
+    8,25,189,121,243,102,184,125,251,246,240,240,225,67,225,29,0,118,16,220,1,38,208,51,202,237,208,145,125,165,118,132,
+    54,31,195,54,251,68,167,214,216,112,204,81,92,70,21,194,225,122,98,244,92,83,57,93,103,170,139,84,115,184,205,131,192,
+    251,216,245,218,236,138,124,151,131,247,182,0,190,207,123,189,117,190,127,211,201,172,199,185,30,28,73,140,236,127,245,
+    234,213,197,231,205,31,126,248,225,98,170,153,15,31,62,12,0,192,127,19,220,1,38,50,247,200,190,178,57,141,76,98,254,
+    218,53,197,6,161,3,14,215,58,106,241,216,177,189,180,142,216,52,50,115,62,173,81,115,87,112,223,181,77,186,28,248,183,
+    221,255,20,215,49,177,29,90,143,115,125,173,42,182,167,14,54,212,103,210,231,207,159,95,108,7,106,158,250,159,126,250,
+    105,120,241,226,133,0,15,0,131,224,14,48,153,244,168,203,250,239,251,206,93,187,237,223,54,237,138,23,173,177,225,152,
+    163,204,143,117,177,86,56,37,173,49,122,9,103,150,76,113,54,17,25,173,175,205,174,247,95,203,117,76,202,161,219,192,
+    214,229,193,148,50,235,113,206,103,197,61,121,242,100,72,171,245,234,251,247,239,135,199,143,31,95,4,248,27,55,110,92,
+    4,248,103,207,158,9,240,0,156,37,193,29,96,34,233,8,180,107,110,229,158,224,190,43,94,136,13,112,94,90,99,244,18,150,
+    121,193,125,185,210,103,122,109,251,239,87,77,229,182,235,236,135,93,219,192,214,247,74,235,20,58,28,207,57,191,86,21,
+    196,231,184,216,117,5,248,167,79,159,254,87,128,31,167,160,57,199,245,176,129,33,0,231,229,187,1,128,73,164,67,195,174,
+    157,147,158,224,126,232,125,94,102,30,117,88,183,214,131,108,245,253,175,95,191,30,214,68,112,159,87,109,135,246,125,
+    95,29,50,135,251,85,7,127,118,109,147,14,9,252,251,62,6,88,162,151,47,95,94,28,112,154,115,138,173,10,240,117,171,105,
+    104,74,133,248,90,102,42,254,31,251,226,219,0,144,38,184,3,76,164,117,36,203,161,167,210,47,33,184,155,191,22,206,75,
+    93,60,175,110,112,157,185,130,251,85,113,189,254,109,219,253,39,131,123,207,197,210,225,88,234,189,250,238,221,187,139,
+    81,231,115,70,247,77,155,1,190,30,79,133,247,186,221,187,119,111,0,128,181,51,165,12,192,68,110,223,190,221,244,253,
+    187,66,67,79,112,223,21,253,211,163,251,156,46,11,235,118,172,240,194,233,106,61,16,187,109,94,245,214,17,238,219,254,
+    125,215,239,91,227,244,74,208,162,150,205,138,238,75,24,44,81,203,91,29,188,173,224,94,159,159,31,62,124,104,123,4,192,
+    170,9,238,0,19,105,141,207,187,46,138,186,107,199,227,170,251,187,117,235,214,214,159,73,207,95,219,122,144,1,128,211,
+    214,58,234,251,203,151,47,87,254,251,174,109,228,117,193,123,91,76,220,182,13,92,227,5,132,161,85,45,31,159,62,125,154,
+    228,66,170,189,106,217,171,248,126,238,225,221,58,5,96,221,4,119,128,137,244,140,24,250,250,245,235,181,255,109,215,
+    14,199,85,31,204,119,93,48,110,219,239,236,217,193,49,194,29,128,77,169,17,238,187,46,28,126,221,246,103,219,253,111,
+    219,206,109,219,30,95,197,8,119,214,172,46,110,90,225,253,193,131,7,195,146,156,115,120,23,220,1,214,77,112,7,152,80,
+    107,104,168,157,157,171,236,26,217,87,174,218,217,223,231,254,175,139,27,219,78,235,191,138,29,3,0,46,107,221,14,94,
+    183,173,187,110,251,184,235,126,118,221,255,117,219,186,93,247,119,153,224,206,218,213,178,82,23,83,93,106,120,255,225,
+    135,31,134,23,47,94,12,0,176,6,130,59,192,132,90,35,116,239,200,190,109,247,179,43,54,92,119,74,189,249,107,129,83,228,
+    226,206,243,234,153,94,237,42,219,14,2,215,107,122,221,118,112,215,153,94,215,109,3,91,15,58,223,188,121,115,128,83,
+    176,25,222,235,235,143,63,254,56,44,65,173,27,30,63,126,60,252,242,203,47,3,0,44,157,224,14,48,161,185,70,246,109,139,
+    221,187,162,255,117,167,232,154,191,22,206,143,229,152,180,214,237,224,117,219,158,109,243,173,111,187,143,93,247,127,
+    221,118,215,65,103,206,93,45,59,53,210,189,46,172,186,164,248,254,252,249,243,139,41,102,0,96,201,4,119,128,9,165,130,
+    251,33,35,220,119,69,128,235,226,70,107,108,48,106,20,214,239,28,130,187,117,213,188,234,61,213,242,190,234,9,224,187,
+    182,115,61,23,78,109,57,232,220,250,55,194,218,108,198,247,186,176,241,111,191,253,118,49,218,252,88,7,154,106,138,25,
+    35,221,1,88,178,239,6,0,38,147,26,217,183,107,199,223,8,119,32,193,114,204,20,234,125,181,239,65,220,244,8,247,82,219,
+    200,214,109,93,203,65,103,163,219,57,39,181,60,223,191,127,255,226,86,106,89,121,255,254,253,240,246,237,219,139,229,
+    116,219,178,154,84,35,221,239,222,189,251,239,199,177,116,245,188,213,197,105,91,190,31,128,245,18,220,1,38,212,58,167,
+    235,117,59,248,187,226,247,182,15,229,189,243,215,182,6,119,193,1,214,175,194,101,107,44,89,202,252,190,251,90,75,156,
+    57,37,245,190,218,119,155,114,213,247,237,186,112,248,174,237,220,182,32,159,56,232,44,140,113,206,46,7,248,90,118,106,
+    59,50,71,128,175,81,238,181,13,90,195,50,88,143,241,201,147,39,3,0,231,65,112,7,152,80,107,132,238,25,217,87,182,197,
+    134,91,183,110,13,61,247,217,202,5,227,96,253,122,166,91,169,169,5,4,71,182,57,116,26,159,67,166,85,43,219,182,145,137,
+    224,238,128,51,252,71,45,239,117,219,12,240,53,2,254,195,135,15,23,95,83,159,59,199,223,253,250,245,235,225,209,163,
+    71,3,0,44,137,57,220,1,38,212,26,161,174,26,193,183,207,142,201,33,35,220,203,231,207,159,135,158,251,221,116,251,246,
+    237,1,88,183,158,48,58,215,244,1,172,87,203,251,234,186,17,238,219,236,10,222,219,14,60,215,239,190,188,13,116,193,84,
+    200,25,231,127,175,139,174,214,197,87,199,11,176,214,191,37,14,214,190,121,243,102,0,128,165,17,220,1,38,148,152,195,
+    253,170,24,222,114,63,251,236,204,92,21,204,90,131,251,247,223,127,63,0,235,214,19,220,107,218,0,216,166,117,251,112,
+    121,187,183,237,160,206,62,177,123,215,129,231,186,8,228,166,214,237,159,51,188,96,127,155,1,190,150,189,250,122,200,
+    89,48,53,106,190,245,32,25,0,76,77,112,7,152,88,235,78,68,75,104,40,21,212,183,69,245,93,255,189,92,142,11,173,59,46,
+    135,78,23,0,107,151,60,69,254,152,234,2,116,173,94,189,122,53,192,54,187,166,54,219,101,219,242,181,207,65,229,218,70,
+    109,251,190,203,83,214,124,253,250,117,104,97,132,59,244,171,248,254,238,221,187,131,150,35,7,126,1,88,26,193,29,96,
+    98,173,167,203,182,142,180,219,103,7,101,87,16,191,124,31,173,241,80,112,231,148,244,156,226,126,42,163,235,234,111,
+    111,93,158,235,111,23,59,216,102,159,169,205,54,213,148,19,155,182,109,147,246,141,116,45,23,78,189,124,255,219,236,
+    115,80,27,216,174,150,207,138,238,189,159,39,79,229,160,55,0,167,67,112,7,152,88,235,136,157,158,17,238,187,180,6,247,
+    214,209,125,98,3,167,164,103,122,136,138,206,167,18,221,127,252,241,199,161,213,243,231,207,7,184,78,235,54,162,101,
+    59,184,111,160,219,182,45,190,188,13,220,103,42,183,125,126,47,176,191,90,79,60,126,252,120,232,33,184,3,176,52,130,
+    59,192,196,14,189,112,234,174,136,183,79,108,216,245,61,151,99,70,203,232,190,125,126,63,172,73,239,244,23,167,114,241,
+    208,158,105,101,106,14,221,215,175,95,15,112,149,214,81,224,155,219,189,93,7,179,246,29,61,191,237,254,47,47,187,45,
+    7,207,28,112,134,156,123,247,238,13,61,204,225,14,192,210,8,238,0,19,59,244,194,169,187,34,94,34,184,31,50,186,111,159,
+    223,15,107,210,123,1,224,15,31,62,12,167,224,254,253,251,67,143,26,153,40,122,112,157,222,224,190,107,228,234,237,219,
+    183,135,125,108,11,243,135,76,171,102,132,59,228,244,126,158,180,237,1,96,105,4,119,128,137,181,78,79,177,185,211,176,
+    207,136,217,68,112,47,155,145,221,69,83,57,103,189,239,231,26,229,125,10,42,140,246,76,43,83,235,141,135,15,31,14,112,
+    149,150,48,189,25,188,119,29,0,222,247,0,217,182,251,191,60,138,190,101,27,40,184,3,0,112,153,224,14,48,177,214,157,
+    241,205,29,253,125,230,82,223,39,54,236,243,61,155,113,191,117,46,204,158,57,175,97,169,122,47,130,88,193,253,84,162,
+    251,147,39,79,134,30,111,222,188,25,158,61,123,54,192,101,83,140,112,111,217,190,182,156,233,213,178,13,180,253,131,
+    156,83,153,154,109,95,117,64,177,206,142,171,219,199,143,31,7,0,78,135,224,14,48,177,214,112,183,185,163,63,231,8,247,
+    205,251,109,29,225,190,239,41,253,176,22,61,35,188,203,169,196,230,250,251,123,231,166,126,250,244,169,232,206,255,104,
+    57,115,100,223,248,221,242,59,119,29,72,219,140,93,166,148,129,227,232,13,238,107,58,211,178,214,47,191,252,242,203,
+    197,245,98,234,113,215,246,182,110,181,46,169,207,211,117,166,152,139,192,2,172,159,224,14,48,177,67,230,112,223,245,
+    129,123,223,145,184,251,124,223,33,193,189,119,206,107,88,170,222,136,86,35,220,95,188,120,49,156,130,154,147,189,87,
+    69,247,10,10,48,106,217,78,236,59,181,90,235,114,186,109,123,60,110,3,91,47,152,234,162,169,144,81,203,94,239,193,218,
+    181,4,247,250,124,240,195,15,63,12,207,159,63,191,114,93,83,235,161,87,175,94,93,132,119,7,174,1,214,77,112,7,152,65,
+    203,142,64,203,28,238,173,163,251,182,233,61,157,222,252,237,156,162,187,119,239,14,189,42,84,159,194,212,50,143,30,
+    61,58,40,38,86,80,168,104,96,164,30,165,70,115,238,107,138,17,238,101,91,160,31,239,199,232,118,56,142,58,72,219,187,
+    189,88,195,178,88,1,189,229,226,226,206,22,3,88,55,193,29,96,6,173,115,215,142,31,198,119,125,40,111,249,189,187,118,
+    70,54,227,126,203,8,63,193,157,83,116,200,148,42,229,167,159,126,90,253,142,114,253,253,189,115,185,143,42,158,56,69,
+    158,114,231,206,157,166,239,31,183,67,219,222,55,173,103,87,109,219,94,141,219,192,125,174,157,50,50,186,29,14,87,203,
+    120,109,51,107,100,119,175,214,245,203,220,234,243,64,5,244,86,245,51,167,114,214,28,192,185,17,220,1,102,208,58,242,
+    102,220,225,223,53,194,125,138,11,198,181,70,49,193,129,83,245,224,193,131,225,16,181,163,92,177,249,245,235,215,195,
+    90,213,104,188,222,249,236,55,141,167,200,87,120,159,243,194,112,173,211,99,49,157,214,109,69,109,7,147,219,192,178,
+    45,208,143,239,149,79,159,62,13,251,50,194,157,181,169,101,170,226,239,219,183,111,47,46,212,121,204,117,100,221,127,
+    141,106,175,41,86,14,57,43,172,150,195,37,15,254,168,207,213,61,177,125,84,219,97,7,172,1,214,231,187,1,128,201,181,
+    134,134,218,225,255,242,229,203,206,239,107,249,189,251,236,140,124,254,252,249,226,214,194,8,119,78,213,189,123,247,
+    46,166,69,57,68,237,36,87,184,175,157,237,10,215,247,239,223,191,152,174,166,231,64,85,45,155,21,71,42,152,212,215,250,
+    221,227,237,247,223,127,31,166,242,242,229,203,139,32,146,8,51,21,222,235,86,235,141,122,46,234,86,35,19,19,7,238,234,
+    249,169,231,166,158,143,250,58,222,234,185,17,70,143,111,156,239,124,223,247,81,109,7,111,220,184,177,243,247,181,216,
+    53,165,76,61,182,150,109,160,237,31,107,83,235,196,203,241,183,150,163,122,47,95,190,141,255,158,184,78,79,45,87,155,
+    235,230,55,111,222,196,98,127,109,71,150,44,113,182,91,141,114,255,245,215,95,7,0,214,67,112,7,152,65,235,78,121,237,
+    152,108,11,13,163,150,136,116,243,230,205,157,223,179,107,52,225,85,4,135,227,169,29,176,67,131,240,84,106,52,115,82,
+    253,157,21,192,231,84,129,188,110,137,249,216,199,11,161,141,167,204,143,33,99,252,122,217,56,181,212,190,103,158,212,
+    247,78,117,182,73,61,190,154,90,38,121,17,212,250,123,234,53,29,223,191,181,46,219,140,62,215,197,212,203,207,199,230,
+    65,135,235,212,136,122,193,125,25,234,181,221,119,59,51,30,96,186,78,207,107,186,207,153,94,45,17,112,170,11,134,91,
+    183,51,149,171,14,40,141,7,114,183,45,155,227,58,121,115,25,186,110,121,26,183,95,151,183,99,83,249,249,231,159,135,
+    37,75,124,134,168,207,14,130,59,192,186,8,238,0,51,216,39,118,111,218,119,42,139,150,223,187,79,156,232,25,37,36,184,
+    31,207,28,59,178,189,210,143,235,88,167,189,87,104,158,226,2,168,99,224,72,169,231,123,202,168,60,94,232,109,170,121,
+    233,147,207,197,101,78,197,95,142,150,224,190,107,59,216,115,128,105,12,134,215,189,39,234,76,142,22,83,45,115,214,237,
+    76,165,119,93,59,87,60,111,85,235,137,37,127,14,29,207,186,58,212,120,246,205,84,7,249,0,200,51,135,59,192,12,166,218,
+    41,111,249,189,83,141,126,109,61,152,0,107,50,78,3,179,116,173,83,65,245,168,105,8,150,62,146,240,42,130,251,114,36,
+    183,67,189,219,213,84,156,235,153,210,6,142,237,148,14,112,140,103,95,45,89,203,69,152,119,105,185,190,4,0,199,39,184,
+    3,204,96,170,157,242,244,28,238,61,76,213,192,169,171,211,184,151,126,38,199,92,81,185,78,107,95,91,116,159,114,244,
+    60,109,146,203,209,177,131,187,179,187,88,163,83,58,0,185,134,109,51,0,231,75,112,7,152,193,20,59,4,83,204,95,219,195,
+    8,63,78,93,45,55,117,225,208,37,155,51,162,84,116,95,250,168,194,77,166,172,88,142,228,116,8,189,103,87,165,14,18,11,
+    125,172,209,169,4,247,218,6,173,225,236,179,228,58,207,231,109,128,117,17,220,1,102,146,222,57,239,249,224,157,30,141,
+    46,56,112,46,106,106,153,37,71,247,185,35,74,77,47,83,163,11,215,16,0,90,47,132,201,116,146,23,220,60,246,8,119,103,
+    119,177,54,167,114,182,79,197,246,218,6,173,193,120,17,240,196,239,177,206,1,88,23,193,29,96,38,233,56,221,243,251,210,
+    113,76,112,231,156,212,197,217,126,251,237,183,69,70,230,99,132,148,186,144,234,239,191,255,190,138,8,96,30,247,101,
+    72,141,246,60,100,254,244,59,119,238,12,9,182,127,172,77,114,62,241,99,168,101,190,14,124,175,37,182,143,118,93,0,122,
+    31,117,208,31,128,117,17,220,1,102,178,132,224,190,132,81,246,176,102,117,10,123,69,230,165,197,182,99,141,224,174,231,
+    161,158,143,138,32,75,14,144,31,63,126,28,56,190,37,140,46,79,61,134,228,84,17,48,135,53,95,116,179,130,115,109,107,
+    18,241,122,110,143,30,61,58,248,243,242,154,166,113,3,224,95,4,119,128,153,44,97,116,121,58,16,56,189,149,115,84,203,
+    94,133,139,37,69,230,10,238,199,156,54,165,34,200,210,158,147,77,166,148,89,142,196,251,227,208,223,145,120,12,182,127,
+    172,205,231,207,159,135,181,169,208,254,238,221,187,139,219,90,207,42,169,199,125,72,48,175,159,117,70,13,192,250,8,
+    238,0,51,73,127,88,238,137,231,201,249,115,139,17,238,156,179,165,69,230,37,76,155,178,249,156,44,233,20,248,83,153,
+    187,248,20,164,230,51,62,196,161,177,252,144,41,109,224,88,214,178,30,28,3,117,141,104,175,208,126,10,211,169,212,20,
+    108,61,209,125,77,243,213,3,240,223,190,27,0,152,69,58,200,245,196,243,244,8,119,35,110,224,95,145,185,110,21,51,94,
+    191,126,61,188,127,255,126,246,176,81,203,226,146,70,113,143,207,73,29,4,168,231,227,237,219,183,23,95,231,126,140,21,
+    69,43,214,164,230,237,230,112,245,94,61,116,249,56,52,152,47,97,132,60,204,237,231,159,127,190,248,90,235,229,37,197,
+    247,113,61,93,183,123,247,238,157,236,242,53,134,243,103,207,158,237,245,253,117,97,242,10,245,0,172,211,141,63,111,
+    223,90,126,224,219,183,166,111,7,0,56,59,21,150,43,104,124,248,240,225,226,235,248,255,123,131,115,5,136,138,18,227,
+    215,10,142,55,111,222,188,248,58,254,219,26,212,115,80,177,231,242,243,210,107,12,51,245,60,140,207,79,29,88,92,219,
+    243,2,48,183,113,125,92,83,205,212,215,186,213,58,121,252,154,60,64,186,185,13,27,111,181,174,174,200,126,110,235,233,
+    122,126,43,186,215,65,232,203,103,166,213,115,81,7,171,107,222,119,7,246,0,150,229,198,141,27,109,223,63,8,238,0,0,179,
+    25,119,176,175,155,2,102,115,186,138,115,153,186,98,140,59,219,34,207,102,124,16,34,0,230,177,185,173,218,39,196,159,
+    227,54,172,215,230,129,248,241,64,4,0,203,36,184,3,0,0,0,0,64,64,107,112,119,209,84,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,
+    119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,
+    119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,
+    0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,
+    7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,
+    119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,
+    64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,
+    0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,
+    0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,
+    0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,
+    1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,
+    193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,
+    16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,
+    128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,
+    0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,0,32,64,112,7,0,
+    0,0,0,128,0,193,29,0,0,0,0,0,2,4,119,0,0,0,0,0,8,16,220,1,0,0,0,224,255,219,181,131,26,0,96,24,134,129,27,127,208,91,
+    57,212,207,59,41,36,172,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,
+    0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,
+    0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,
+    0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,
+    29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,
+    7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,
+    1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,
+    119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,
+    1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,
+    64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,
+    16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,
+    0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,
+    0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,
+    0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,
+    0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,
+    130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,
+    128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,
+    32,184,3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,
+    0,8,220,217,59,0,0,0,0,0,192,138,135,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,0,0,0,0,0,16,16,220,1,0,0,0,0,32,32,184,
+    3,0,0,0,0,64,64,112,7,0,0,0,0,128,128,224,14,0,0,0,0,0,1,193,29,0,0,0,0,0,2,130,59,0,0,0,0,0,4,4,119,0,0,0,0,0,8,8,238,
+    0,0,0,0,0,16,248,115,133,196,227,77,78,250,161,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+
+inline const EmbeddedTexture embedded_textures[] = {
+    {"back.png", texture_back, sizeof(texture_back)},
+    {"black_wins.png", texture_black_wins, sizeof(texture_black_wins)},
+    {"board.png", texture_board, sizeof(texture_board)},
+    {"draw.png", texture_draw, sizeof(texture_draw)},
+    {"piece_black.png", texture_piece_black, sizeof(texture_piece_black)},
+    {"piece_white.png", texture_piece_white, sizeof(texture_piece_white)},
+    {"queen_black.png", texture_queen_black, sizeof(texture_queen_black)},
+    {"queen_white.png", texture_queen_white, sizeof(texture_queen_white)},
+    {"replay.png", texture_replay, sizeof(texture_replay)},
+    {"white_wins.png", texture_white_wins, sizeof(texture_white_wins)},
+};
+
+// Встроенная текстура по имени файла (например, "board.png"), nullptr — нет такой
+inline const EmbeddedTexture *find_embedded_texture(const char *name)
+{
+    for (const auto &texture : embedded_textures)
+        if (strcmp(texture.name, name) == 0)
+            return &texture;
+    return nullptr;
+}
@@ -11,6 +11,10 @@ struct move_pos
     POS_T x2, y2;           // координаты конечной клетки (куда)
     POS_T xb = -1, yb = -1; // координаты побитой шашки (если есть), -1 если взятия нет
 
+    // Пустой ход — для заранее выделенных буферов поиска
+    move_pos() : x(-1), y(-1), x2(-1), y2(-1)
+    {
+    }
     // Конструктор для обычного хода (без взятия)
     move_pos(const POS_T x, const POS_T y, const POS_T x2, const POS_T y2) : x(x), y(y), x2(x2), y2(y2)
     {
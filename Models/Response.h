@@ -7,5 +7,6 @@ enum class Response
     BACK,    // Откат (возврат) хода
     REPLAY,  // Повтор партии
     QUIT,    // Выход из игры
-    CELL     // Выбор клетки на доске
+    CELL,    // Выбор клетки на доске
+    HINT     // Готовы подсказки (фоновый поиск лучших ходов закончился)
 };
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Оценка поиска: целое число в сотых долях простой шашки с точки зрения ходящей стороны
+// (у соперника та же позиция оценивается -score). Выигрыш и проигрыш кодируются отдельно от материала:
+// выигрыш через n шагов — SCORE_WIN - n, проигрыш — -(SCORE_WIN - n), так что быстрый выигрыш лучше медленного,
+// а поражение чем позже, тем лучше. Шаг — уровень стека поиска: ход, каждое взятие серии — отдельный шаг
+typedef int32_t Score;
+typedef int16_t PackedScore; // оценка в записи хеш-таблицы
+
+const Score SCORE_DRAW = 0;
+const Score SCORE_WIN = 30000;                 // выигрыш в текущей позиции (у соперника нет ходов)
+const Score SCORE_WIN_MIN = SCORE_WIN - 1000;  // от этой оценки и выше — выигрыш с известным числом шагов
+const Score SCORE_INF = SCORE_WIN + 1;         // граница окна вне любых оценок
+static_assert(SCORE_INF <= INT16_MAX, "оценка должна помещаться в 16 бит");
+
+// Выигрыш и проигрыш через ply шагов от корня поиска
+inline Score win_in(const int ply)
+{
+    return SCORE_WIN - ply;
+}
+
+inline Score loss_in(const int ply)
+{
+    return -SCORE_WIN + ply;
+}
+
+// Оценка означает доказанный результат (а не материал)
+inline bool is_decisive(const Score score)
+{
+    return score >= SCORE_WIN_MIN || score <= -SCORE_WIN_MIN;
+}
+
+// Оценки выигрыша считаются от корня поиска; в хеш-таблице они хранятся от узла (через сколько шагов
+// от этой позиции), иначе позиция, встреченная на другом уровне, получит неверное расстояние до результата
+inline PackedScore pack_score(const Score score, const int ply)
+{
+    if (score >= SCORE_WIN_MIN)
+        return PackedScore(score + ply);
+    if (score <= -SCORE_WIN_MIN)
+        return PackedScore(score - ply);
+    return PackedScore(score);
+}
+
+inline Score unpack_score(const PackedScore stored, const int ply)
+{
+    if (stored >= SCORE_WIN_MIN)
+        return Score(stored) - ply;
+    if (stored <= -SCORE_WIN_MIN)
+        return Score(stored) + ply;
+    return stored;
+}
+
+// Оценка для протоколов и журналов: "cp 35" — материал, "win 7" / "loss 6" — результат через столько шагов
+inline std::string score_to_string(const Score score)
+{
+    if (score >= SCORE_WIN_MIN)
+        return "win " + std::to_string(SCORE_WIN - score);
+    if (score <= -SCORE_WIN_MIN)
+        return "loss " + std::to_string(SCORE_WIN + score);
+    return "cp " + std::to_string(score);
+}
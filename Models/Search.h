@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "Move.h"
+#include "Score.h"
+
+// Ограничения поиска для Logic::search
+struct SearchLimits
+{
+    int depth = -1;                                   // максимальная глубина (как Max_depth), -1 — взять Max_depth
+    uint64_t nodes = 0;                               // лимит узлов, 0 — без ограничения
+    std::chrono::steady_clock::time_point deadline =  // момент, когда поиск должен остановиться
+        std::chrono::steady_clock::time_point::max();
+    const std::atomic<bool> *stop = nullptr;          // внешний флаг остановки (команда stop)
+};
+
+// Ход корня с оценкой и вариантом (Logic::search_multipv)
+struct PvLine
+{
+    Score score = 0;          // оценка после хода с точки зрения ходящего (Score.h)
+    std::vector<move_pos> pv; // вариант, начинающийся этим ходом: шаги ходов обеих сторон подряд
+};
+
+// Информация о завершённой итерации поиска
+struct SearchInfo
+{
+    int depth = 0;              // глубина итерации
+    Score score = 0;            // оценка позиции с точки зрения ходящего (Score.h)
+    uint64_t nodes = 0;         // число просмотренных узлов с начала поиска
+    int64_t time_ms = 0;        // время с начала поиска
+    std::vector<move_pos> pv;   // лучший вариант: шаги ходов обеих сторон подряд (делится на ходы split_line)
+    std::vector<PvLine> lines;  // search_multipv: лучшие ходы корня по убыванию оценки
+};
+
+// Результат решателя для ходящей стороны
+enum class SolveOutcome
+{
+    Unknown, // не доказано за отведённый бюджет (или ничья)
+    Win,     // доказан выигрыш
+    Loss     // доказан проигрыш
+};
+
+// Результат Solver::solve
+struct SolveInfo
+{
+    SolveOutcome outcome = SolveOutcome::Unknown;
+    std::vector<move_pos> line; // доказывающий вариант: шаги ходов обеих сторон подряд (делится на ходы split_line)
+    uint64_t nodes = 0;         // число просмотренных узлов
+    int64_t time_ms = 0;
+};
@@ -0,0 +1,183 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Engine/Mcts.h"
+#include "Engine/Notation.h"
+#include "Engine/WorkQueue.h"
+
+// Пакетный анализ позиций.
+// analyze [--depth N] [--movetime MS] [--nodes N] [--threads N] [--optimization O0|O1|O2]
+//         [--algorithm minimax|mcts] [--mcts-threads N] [--shared-cache MB] [--trace out.json] <file|->
+// --shared-cache — общий кеш оценок в разделяемой памяти (Engine/SharedCache.h): его видят все потоки
+// и все процессы analyze и движка на машине, подключённые к тому же сегменту.
+// Вход: по позиции на строку в нотации Engine/Notation.h ("<32 клетки> <w|b>"), пустые строки и '#' пропускаются.
+// Выход (по мере готовности): "<номер строки> <позиция> bestmove <ход> score <cp N|win N|loss N> depth <d> nodes <n> pv <ходы>",
+// для mcts: "<номер строки> <позиция> bestmove <ход> score <доля выигрышей> playouts <n>" (--nodes — лимит симуляций).
+
+struct Task
+{
+    size_t line_no;
+    string text;
+};
+
+int main(int argc, char* argv[])
+{
+    SearchLimits base_limits;
+    base_limits.depth = 5;
+    long long movetime = 0;
+    bool depth_set = false;
+    unsigned int threads = max(1u, thread::hardware_concurrency());
+    Settings settings;
+    settings.no_random = true;
+    settings.mcts_threads = 1;
+    bool mcts = false;
+    string input = "-";
+    string trace_path; // трасса Chrome Trace Event (сборка с -DCHECKERS_TRACE)
+    for (int i = 1; i < argc; ++i)
+    {
+        string arg = argv[i];
+        if (arg == "--depth" && i + 1 < argc)
+        {
+            base_limits.depth = atoi(argv[++i]);
+            depth_set = true;
+        }
+        else if (arg == "--movetime" && i + 1 < argc)
+            movetime = atoll(argv[++i]);
+        else if (arg == "--nodes" && i + 1 < argc)
+            base_limits.nodes = strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--threads" && i + 1 < argc)
+            threads = max(1, atoi(argv[++i]));
+        else if (arg == "--algorithm" && i + 1 < argc)
+            mcts = (string(argv[++i]) == "mcts");
+        else if (arg == "--trace" && i + 1 < argc)
+            trace_path = argv[++i];
+        else if (arg == "--mcts-threads" && i + 1 < argc)
+            settings.mcts_threads = max(1, atoi(argv[++i]));
+        else if (arg == "--shared-cache" && i + 1 < argc)
+            settings.shared_cache_mb = unsigned(atoi(argv[++i]));
+        else if (arg == "--optimization" && i + 1 < argc)
+        {
+            string opt = argv[++i];
+            settings.optimization = (opt == "O0" ? OptLevel::O0 : opt == "O2" ? OptLevel::O2 : OptLevel::O1);
+        }
+        else
+            input = arg;
+    }
+    if (movetime > 0 && !depth_set)
+        base_limits.depth = 64; // при ограничении по времени глубина задаётся временем
+
+    ifstream fin;
+    if (input != "-")
+    {
+        fin.open(input);
+        if (!fin)
+        {
+            cerr << "can't open " << input << endl;
+            return 1;
+        }
+    }
+    istream &in = (input == "-" ? cin : fin);
+
+    shared_ptr<SharedCache> cache; // держим сегмент, пока рабочие потоки пересоздают Logic
+    if (settings.shared_cache_mb && !mcts)
+    {
+        string error;
+        cache = SharedCache::attach(settings.shared_cache_name, settings.shared_cache_mb, error);
+        if (!cache)
+        {
+            cerr << "shared cache: " << error << endl;
+            return 1;
+        }
+    }
+
+    SettingsStore config(settings);
+    WorkQueue<Task> queue(threads * 4);
+    mutex out_mtx;
+    uint64_t total_nodes = 0, cache_hits = 0;
+    size_t done = 0;
+    const auto start = chrono::steady_clock::now();
+
+    // У каждого рабочего потока свой Logic: общих изменяемых данных в поиске нет, кроме общего кеша.
+    // Logic новый на каждую позицию (как в bench.cpp): случайность и семя PV прошлой позиции не влияют на ход,
+    // поэтому с NoRandom результат не зависит от порядка очереди и числа потоков
+    vector<thread> workers;
+    for (unsigned int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&] {
+            TRACE_THREAD_NAME("analyze worker");
+            Mcts tree(&config);
+            Task task;
+            while (queue.pop(task))
+            {
+                TRACE_SCOPE_NAMED(trace, "position", "analyze");
+                Logic logic(&config);
+                TRACE_ARG(trace, "line", task.line_no);
+                istringstream ss(task.text);
+                string squares, side;
+                vector<vector<POS_T>> mtx;
+                bool color;
+                string out;
+                if (!(ss >> squares >> side) || !parse_position(squares, side, mtx, color))
+                {
+                    out = to_string(task.line_no) + " error bad position";
+                }
+                else if (mcts)
+                {
+                    SearchLimits limits;
+                    limits.nodes = base_limits.nodes;
+                    if (movetime > 0)
+                        limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(movetime);
+                    tree.clear();
+                    auto best = tree.search(mtx, color, limits);
+                    out = to_string(task.line_no) + " " + squares + " " + side + " bestmove " + turn_to_string(best) +
+                          " score " + to_string(tree.best_value()) + " playouts " + to_string(tree.playouts());
+                }
+                else
+                {
+                    SearchLimits limits = base_limits;
+                    if (movetime > 0)
+                        limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(movetime);
+                    SearchInfo last;
+                    auto best = logic.search(mtx, color, limits, [&](const SearchInfo &info) { last = info; });
+                    out = to_string(task.line_no) + " " + squares + " " + side + " bestmove " + turn_to_string(best) +
+                          " score " + score_to_string(last.score) + " depth " + to_string(last.depth) + " nodes " +
+                          to_string(logic.searched_nodes()) + " pv " + line_to_string(last.pv);
+                }
+                lock_guard<mutex> lock(out_mtx);
+                cout << out << '\n';
+                total_nodes += (mcts ? tree.playouts() : logic.searched_nodes());
+                cache_hits += (mcts ? 0 : logic.shared_cache_hits());
+                ++done;
+            }
+        });
+    }
+
+    string line;
+    size_t line_no = 0;
+    while (getline(in, line))
+    {
+        ++line_no;
+        if (line.empty() || line[0] == '#')
+            continue;
+        queue.push({line_no, line});
+    }
+    queue.close();
+    for (auto &w : workers)
+        w.join();
+
+    const double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (!trace_path.empty())
+        TRACE_WRITE(trace_path);
+    cout.flush();
+    cerr << "positions " << done << " threads " << threads << " time " << sec << " s, " << (sec > 0 ? done / sec : 0)
+         << " positions/s, " << (sec > 0 ? total_nodes / sec : 0) << (mcts ? " playouts/s" : " nodes/s");
+    if (cache)
+        cerr << ", shared cache hits " << cache_hits;
+    cerr << endl;
+    return 0;
+}
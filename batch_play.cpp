@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "Engine/Batch.h"
+#include "Engine/Logic.h"
+#include "Engine/Notation.h"
+
+// Случайные партии пачкой (Engine/Batch.h): --batch партий идут одновременно, закончившаяся партия
+// сразу сменяется новой, пока не сыграно --games. Ходы выбираются равномерно среди ходов пачки.
+// batch_play [--games N] [--batch N] [--max-turns N] [--seed N] [--logic] [--verify]
+// --logic — те же партии с генерацией ходов по одной позиции через Logic::for_each_turn (для сравнения скорости),
+// --verify — каждую позицию пачки сверить с Logic: множества позиций после хода должны совпасть.
+// Код возврата: 0 — ок, 1 — расхождение с Logic
+
+using Bitboards = tuple<uint64_t, uint64_t, uint64_t>; // белые, чёрные, дамки
+
+static Bitboards to_bitboards(const vector<vector<POS_T>> &mtx)
+{
+    uint64_t w = 0, b = 0, k = 0;
+    for (int s = 0; s < 64; ++s)
+    {
+        const POS_T type = mtx[s / 8][s % 8];
+        w |= uint64_t(type == 1 || type == 3) << s;
+        b |= uint64_t(type == 2 || type == 4) << s;
+        k |= uint64_t(type > 2) << s;
+    }
+    return Bitboards(w, b, k);
+}
+
+// Позиции после всех ходов позиции i пачки (без повторов) и после всех ходов по Logic; true — совпадают
+static bool verify_position(const Batch &batch, const size_t i)
+{
+    const auto mtx = batch.get(i);
+    const bool color = batch.color(i);
+    vector<Bitboards> expected;
+    auto board = mtx;
+    Logic::for_each_turn(board, color, 0, [&](const vector<move_pos> &, uint64_t, bool) {
+        expected.push_back(to_bitboards(board));
+    });
+    sort(expected.begin(), expected.end());
+    expected.erase(unique(expected.begin(), expected.end()), expected.end());
+
+    Batch one;
+    one.add(mtx, color);
+    one.generate();
+    vector<Bitboards> actual;
+    for (uint32_t k = 0; k < one.count(0); ++k)
+    {
+        Batch after;
+        after.add(mtx, color);
+        after.generate();
+        after.apply({int(k)});
+        actual.push_back(to_bitboards(after.get(0)));
+    }
+    sort(actual.begin(), actual.end());
+    const bool distinct = (unique(actual.begin(), actual.end()) == actual.end());
+    if (distinct && actual == expected && one.count(0) == batch.count(i))
+        return true;
+    cerr << "mismatch at " << position_to_string(mtx, color) << ": batch " << one.count(0) << " moves, logic "
+         << expected.size() << " positions" << (distinct ? "" : ", duplicate moves") << endl;
+    return false;
+}
+
+static uint64_t next_random(uint64_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+struct Totals
+{
+    uint64_t games = 0, positions = 0, moves = 0;
+    uint64_t results[3] = {0, 0, 0}; // победы белых, чёрных, ничьи
+};
+
+int main(int argc, char *argv[])
+{
+    uint64_t games = 100000, seed = 1;
+    size_t batch_size = 4096;
+    int max_turns = 200;
+    bool logic_mode = false, verify = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc)
+            games = uint64_t(max(1LL, atoll(argv[++i])));
+        else if (arg == "--batch" && i + 1 < argc)
+            batch_size = size_t(max(1, atoi(argv[++i])));
+        else if (arg == "--max-turns" && i + 1 < argc)
+            max_turns = max(1, atoi(argv[++i]));
+        else if (arg == "--seed" && i + 1 < argc)
+            seed = uint64_t(max(1LL, atoll(argv[++i])));
+        else if (arg == "--logic")
+            logic_mode = true;
+        else if (arg == "--verify")
+            verify = true;
+        else
+        {
+            cerr << "usage: batch_play [--games N] [--batch N] [--max-turns N] [--seed N] [--logic] [--verify]"
+                 << endl;
+            return 1;
+        }
+    }
+    batch_size = size_t(min<uint64_t>(batch_size, games));
+
+    const auto start_mtx = start_position();
+    Batch batch(batch_size);
+    vector<uint64_t> rng(batch_size);
+    vector<int> turns(batch_size, 0), choice(batch_size);
+    for (size_t i = 0; i < batch_size; ++i)
+    {
+        batch.add(start_mtx, false);
+        rng[i] = seed * 0x9E3779B97F4A7C15ULL + i + 1;
+    }
+    // --logic: позиции партий матрицами, ходы — через Logic
+    vector<vector<vector<POS_T>>> boards(logic_mode ? batch_size : 0, start_mtx);
+    vector<bool> colors(boards.size(), false);
+    vector<vector<vector<POS_T>>> after;
+
+    Totals totals;
+    uint64_t started = batch_size;
+    size_t active = batch_size;
+    vector<bool> live(batch_size, true);
+    const auto start = chrono::steady_clock::now();
+    while (active > 0)
+    {
+        if (!logic_mode)
+            batch.generate();
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            choice[i] = -1;
+            if (!live[i])
+                continue;
+            ++totals.positions;
+            uint32_t count = 0;
+            if (logic_mode)
+            {
+                after.clear();
+                Logic::for_each_turn(boards[i], colors[i], 0,
+                                     [&](const vector<move_pos> &, uint64_t, bool) { after.push_back(boards[i]); });
+                count = uint32_t(after.size());
+            }
+            else
+            {
+                count = batch.count(i);
+                if (verify && !verify_position(batch, i))
+                    return 1;
+            }
+            totals.moves += count;
+            const bool color = (logic_mode ? bool(colors[i]) : batch.color(i));
+            if (count == 0 || turns[i] >= max_turns)
+            {
+                // Ходов нет — ходящий проиграл; лимит ходов — ничья. Слот получает новую партию
+                ++totals.games;
+                ++totals.results[count == 0 ? (color ? 0 : 1) : 2];
+                turns[i] = 0;
+                if (started < games)
+                {
+                    ++started;
+                    if (logic_mode)
+                        boards[i] = start_mtx, colors[i] = false;
+                    else
+                        batch.set(i, start_mtx, false);
+                }
+                else
+                {
+                    live[i] = false;
+                    --active;
+                }
+                continue;
+            }
+            const int k = int(next_random(rng[i]) % count);
+            ++turns[i];
+            if (logic_mode)
+                boards[i] = after[k], colors[i] = !colors[i];
+            else
+                choice[i] = k;
+        }
+        if (!logic_mode)
+            batch.apply(choice);
+    }
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << (logic_mode ? "logic" : "batch") << ": games " << totals.games << ", positions " << totals.positions
+         << ", moves " << totals.moves << " (" << (totals.positions ? double(totals.moves) / totals.positions : 0)
+         << " per position)" << endl;
+    cout << "white " << totals.results[0] << ", black " << totals.results[1] << ", draws " << totals.results[2]
+         << endl;
+    cout << "time " << ms << " ms, positions/s " << (ms > 0 ? totals.positions * 1000.0 / ms : 0) << endl;
+    if (verify)
+        cout << "verified " << totals.positions << " positions against Logic" << endl;
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+#include "Engine/BenchPositions.h"
+#include "Engine/Notation.h"
+
+// Воспроизводимый бенчмарк поиска Logic::search.
+// bench [--optimization O0|O1|O2] [--repeat N] [--out result.json] [--baseline base.json] [--tolerance PERCENT]
+// Набор позиций и глубин (Engine/BenchPositions.h) фиксирован и версионирован (Bench_version).
+// Поиск детерминирован (NoRandom, новый Logic на каждую позицию), поэтому число узлов и лучшие ходы
+// воспроизводимы; их свёртка (signature) меняется только при изменении самого поиска.
+// Код возврата: 0 — ок, 1 — NPS ниже базового больше чем на tolerance, 2 — изменилась сигнатура.
+
+struct BenchResult
+{
+    string name;
+    int depth = 0;
+    uint64_t nodes = 0;
+    double time_ms = 0;
+    string bestmove;
+    Score score = 0;
+    vector<double> time_to_depth; // время завершения каждой итерации, мс
+};
+
+static uint64_t fnv1a(uint64_t h, const string &data)
+{
+    for (unsigned char c : data)
+    {
+        h ^= c;
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+int main(int argc, char* argv[])
+{
+    Settings settings;
+    settings.no_random = true;
+    int repeat = 1;
+    double tolerance = 5;
+    string out_path, baseline_path;
+    for (int i = 1; i < argc; ++i)
+    {
+        string arg = argv[i];
+        if (arg == "--optimization" && i + 1 < argc)
+        {
+            string opt = argv[++i];
+            settings.optimization = (opt == "O0" ? OptLevel::O0 : opt == "O2" ? OptLevel::O2 : OptLevel::O1);
+        }
+        else if (arg == "--repeat" && i + 1 < argc)
+            repeat = max(1, atoi(argv[++i]));
+        else if (arg == "--out" && i + 1 < argc)
+            out_path = argv[++i];
+        else if (arg == "--baseline" && i + 1 < argc)
+            baseline_path = argv[++i];
+        else if (arg == "--tolerance" && i + 1 < argc)
+            tolerance = atof(argv[++i]);
+        else
+        {
+            cerr << "usage: bench [--optimization O0|O1|O2] [--repeat N] [--out result.json] [--baseline base.json] "
+                    "[--tolerance PERCENT]"
+                 << endl;
+            return 1;
+        }
+    }
+    SettingsStore config(settings);
+
+    vector<BenchResult> results;
+    uint64_t total_nodes = 0;
+    double total_ms = 0;
+    uint64_t signature = 0xcbf29ce484222325ull;
+    for (const auto &pos : Bench_positions)
+    {
+        vector<vector<POS_T>> mtx;
+        bool color;
+        parse_position(pos.squares, pos.side, mtx, color);
+        BenchResult best;
+        // Из нескольких повторов берём самый быстрый: узлы и ходы в них одинаковые
+        for (int r = 0; r < repeat; ++r)
+        {
+            Logic logic(&config);
+            SearchLimits limits;
+            limits.depth = pos.depth;
+            BenchResult res;
+            res.name = pos.name;
+            res.depth = pos.depth;
+            const auto start = chrono::steady_clock::now();
+            auto turns = logic.search(mtx, color, limits, [&](const SearchInfo &info) {
+                res.time_to_depth.push_back(
+                    chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+                res.score = info.score;
+            });
+            res.time_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            res.nodes = logic.searched_nodes();
+            res.bestmove = turn_to_string(turns);
+            if (r == 0 || res.time_ms < best.time_ms)
+                best = res;
+        }
+        signature = fnv1a(signature, best.name + ":" + to_string(best.nodes) + ":" + best.bestmove + ";");
+        total_nodes += best.nodes;
+        total_ms += best.time_ms;
+        cout << left << setw(8) << best.name << " depth " << setw(3) << best.depth << " nodes " << setw(10)
+             << best.nodes << " time " << setw(10) << fixed << setprecision(1) << best.time_ms << " ms  best "
+             << best.bestmove << endl;
+        results.push_back(best);
+    }
+    ostringstream sig;
+    sig << hex << setw(16) << setfill('0') << signature;
+    const double nps = total_ms > 0 ? total_nodes * 1000.0 / total_ms : 0;
+    cout << "total nodes " << total_nodes << ", time " << total_ms << " ms, nps " << uint64_t(nps) << ", signature "
+         << sig.str() << endl;
+
+    json report;
+    report["version"] = Bench_version;
+    report["optimization"] = settings.optimization == OptLevel::O0 ? "O0" : settings.optimization == OptLevel::O1 ? "O1" : "O2";
+    report["total_nodes"] = total_nodes;
+    report["total_time_ms"] = total_ms;
+    report["nps"] = nps;
+    report["signature"] = sig.str();
+    for (const auto &res : results)
+    {
+        report["positions"].push_back({{"name", res.name},
+                                       {"depth", res.depth},
+                                       {"nodes", res.nodes},
+                                       {"time_ms", res.time_ms},
+                                       {"nps", res.time_ms > 0 ? res.nodes * 1000.0 / res.time_ms : 0},
+                                       {"bestmove", res.bestmove},
+                                       {"score", res.score},
+                                       {"time_to_depth_ms", res.time_to_depth}});
+    }
+    if (!out_path.empty())
+    {
+        ofstream fout(out_path);
+        fout << report.dump(2) << endl;
+    }
+
+    if (baseline_path.empty())
+        return 0;
+    ifstream fin(baseline_path);
+    if (!fin)
+    {
+        cerr << "can't open baseline " << baseline_path << endl;
+        return 1;
+    }
+    json base;
+    fin >> base;
+    if (base.value("version", "") != Bench_version || base.value("optimization", "") != report["optimization"])
+    {
+        cout << "baseline was made with another position set or optimization, skipping comparison" << endl;
+        return 0;
+    }
+    const double base_nps = base.value("nps", 0.0);
+    const double change = base_nps > 0 ? (nps / base_nps - 1) * 100 : 0;
+    cout << "nps " << showpos << setprecision(2) << change << noshowpos << "% vs baseline (tolerance " << tolerance
+         << "%), nodes " << total_nodes << " vs " << base.value("total_nodes", uint64_t(0)) << endl;
+    if (base.value("signature", "") != sig.str())
+    {
+        cout << "SIGNATURE CHANGED: search explores a different tree" << endl;
+        return 2;
+    }
+    if (change < -tolerance)
+    {
+        cout << "REGRESSION: nps below baseline" << endl;
+        return 1;
+    }
+    return 0;
+}
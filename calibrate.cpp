@@ -0,0 +1,374 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+#include "Engine/BenchPositions.h"
+#include "Engine/Notation.h"
+
+// Калибровка уровней бота (WhiteBotLevel/BlackBotLevel — глубина перебора) на этой машине.
+// calibrate [--max-level N] [--optimization O0|O1|O2] [--games N] [--threads N] [--positions N] [--slo MS]
+//           [--out report.json] [--settings-out levels.json]
+// 1. Матчи: каждый уровень с каждым, --games партий на пару (дебют играется обоими цветами). Первые Opening_plies
+//    ходов случайные, дальше боты без случайности (NoRandom); правила ничьей и лимит ходов — как в игре.
+//    Сила — рейтинг Эло по всем партиям (модель Брэдли — Терри, уровень 0 — 0 Эло).
+// 2. Задержка: каждый уровень по очереди в одном потоке ищет позиции бенчмарка (Engine/BenchPositions.h)
+//    и --positions позиций из партий так, как бот в игре (Logic::find_best_turns): p50/p99/максимум времени хода
+//    и узлы на ход. Те же позиции ищутся итеративным углублением до глубины уровня — так ищет бот с бюджетом.
+// 3. Бюджеты: LevelTimeMS уровня — p99 итеративного поиска с запасом Budget_margin, но не меньше Min_budget_ms
+//    и не больше --slo. Массив печатается фрагментом settings.json; с --slo называется старший уровень, которому
+//    хватает SLO без урезания бюджета (бот этого уровня почти всегда доигрывает глубину до конца).
+
+static const int Opening_plies = 2;      // случайных ходов в начале партии
+static const double Budget_margin = 1.25; // запас бюджета над p99 итеративного поиска
+static const unsigned Min_budget_ms = 10; // короче бюджета планировщик ОС не гарантирует
+
+struct Position
+{
+    vector<vector<POS_T>> mtx;
+    bool color;
+};
+
+// Результаты уровня: партии и задержки
+struct LevelStats
+{
+    int wins = 0, draws = 0, losses = 0;
+    double elo = 0;
+    vector<double> direct_ms, iterative_ms; // время хода поиском бота и итеративным углублением
+    uint64_t nodes = 0;                     // узлов поиска бота на всех позициях
+    unsigned budget_ms = 0;
+    double full_depth = 0; // доля позиций, где итеративный поиск уложился в бюджет
+};
+
+// Перцентиль q (0..1) по ближайшему рангу
+static double percentile(vector<double> values, const double q)
+{
+    if (values.empty())
+        return 0;
+    sort(values.begin(), values.end());
+    const size_t rank = size_t(ceil(q * values.size()));
+    return values[min(values.size() - 1, rank ? rank - 1 : 0)];
+}
+
+static double elapsed_ms(const chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Все ходы стороны color целиком
+static vector<vector<move_pos>> legal_turn_list(vector<vector<POS_T>> mtx, const bool color)
+{
+    vector<vector<move_pos>> turns;
+    Logic::for_each_turn(mtx, color, 0, [&](const vector<move_pos> &turn, uint64_t, bool) { turns.push_back(turn); });
+    return turns;
+}
+
+/**
+ * Партия бота уровня white_level против black_level из дебюта opening. Боты создаются на партию: кеш и ходы-убийцы
+ * от прошлых партий потока сделали бы исход зависимым от раскладки партий по потокам. Позиции после дебюта
+ * дописываются в positions. Возвращает 1 — выиграли белые, -1 — чёрные, 0 — ничья (повторение, ходы без прогресса, лимит ходов)
+ */
+static int play_game(const int white_level, const int black_level, const int opening, const SettingsStore &config,
+                     const Settings &settings, vector<Position> &positions)
+{
+    Logic white(&config), black(&config);
+    mt19937 rng(unsigned(opening) * 7919u + 1u);
+    vector<vector<POS_T>> mtx = start_position();
+    vector<vector<vector<POS_T>>> history{mtx};
+    bool color = false;
+    for (int turn_num = 0; turn_num < settings.max_num_turns; ++turn_num)
+    {
+        Logic &side = (color ? black : white);
+        side.set_history(history, false);
+        if (side.history_is_draw())
+            return 0;
+        const auto turns = legal_turn_list(mtx, color);
+        if (turns.empty())
+            return color ? 1 : -1; // ходящий без ходов проиграл
+        vector<move_pos> turn;
+        if (turn_num < Opening_plies)
+            turn = turns[rng() % turns.size()];
+        else
+        {
+            positions.push_back({mtx, color});
+            side.Max_depth = (color ? black_level : white_level);
+            turn = side.find_best_turns(color, mtx);
+        }
+        mtx = apply_turn(side, mtx, turn);
+        history.push_back(mtx);
+        color = !color;
+    }
+    return 0;
+}
+
+// Рейтинги Эло по матрице очков points[i][j] (очки i против j) и партий games[i][j], уровень 0 — 0 Эло.
+// Миноризация-максимизация для модели Брэдли — Терри, ничья — пол-очка. К каждой сыгранной паре добавляется
+// одна виртуальная ничья: иначе при всех выигрышах старшего уровня рейтинг уходит в бесконечность
+static vector<double> elo_ratings(const vector<vector<double>> &points, const vector<vector<int>> &games)
+{
+    const size_t n = points.size();
+    vector<double> gamma(n, 1.0);
+    for (int iter = 0; iter < 10000; ++iter)
+    {
+        double change = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            double won = 0, weight = 0;
+            for (size_t j = 0; j < n; ++j)
+            {
+                if (j == i || !games[i][j])
+                    continue;
+                won += points[i][j] + 0.5;
+                weight += (games[i][j] + 1) / (gamma[i] + gamma[j]);
+            }
+            if (weight > 0)
+            {
+                const double updated = won / weight;
+                change = max(change, fabs(log(updated / gamma[i])));
+                gamma[i] = updated;
+            }
+        }
+        for (size_t i = n; i-- > 0;)
+            gamma[i] /= gamma[0];
+        if (change < 1e-9)
+            break;
+    }
+    vector<double> elo(n);
+    for (size_t i = 0; i < n; ++i)
+        elo[i] = 400 * log10(gamma[i]);
+    return elo;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_level = 7;
+    int games_per_pair = 4;
+    unsigned threads = 1;
+    size_t sample_positions = 100;
+    unsigned slo_ms = 0;
+    string out_path, settings_path;
+    Settings settings;
+    settings.no_random = true;
+    for (int i = 1; i < argc; ++i)
+    {
+        const string arg = argv[i];
+        if (arg == "--max-level" && i + 1 < argc)
+            max_level = max(0, atoi(argv[++i]));
+        else if (arg == "--optimization" && i + 1 < argc)
+        {
+            const string opt = argv[++i];
+            settings.optimization = (opt == "O0" ? OptLevel::O0 : opt == "O2" ? OptLevel::O2 : OptLevel::O1);
+        }
+        else if (arg == "--games" && i + 1 < argc)
+        {
+            const int n = atoi(argv[++i]);
+            games_per_pair = max(2, n + n % 2); // поровну каждым цветом
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+            threads = unsigned(max(1, atoi(argv[++i])));
+        else if (arg == "--positions" && i + 1 < argc)
+            sample_positions = size_t(max(0, atoi(argv[++i])));
+        else if (arg == "--slo" && i + 1 < argc)
+            slo_ms = unsigned(max(0, atoi(argv[++i])));
+        else if (arg == "--out" && i + 1 < argc)
+            out_path = argv[++i];
+        else if (arg == "--settings-out" && i + 1 < argc)
+            settings_path = argv[++i];
+        else
+        {
+            cerr << "usage: calibrate [--max-level N] [--optimization O0|O1|O2] [--games N] [--threads N] "
+                    "[--positions N] [--slo MS] [--out report.json] [--settings-out levels.json]"
+                 << endl;
+            return 1;
+        }
+    }
+    const int levels = max_level + 1;
+    SettingsStore config(settings);
+    vector<LevelStats> stats(levels);
+
+    // 1. Матчи каждый с каждым; партии разбирают рабочие потоки
+    struct Match
+    {
+        int white, black, opening;
+    };
+    vector<Match> matches;
+    for (int a = 0; a < levels; ++a)
+        for (int b = a + 1; b < levels; ++b)
+            for (int k = 0; k < games_per_pair / 2; ++k)
+            {
+                matches.push_back({a, b, k});
+                matches.push_back({b, a, k});
+            }
+    vector<vector<double>> points(levels, vector<double>(levels, 0));
+    vector<vector<int>> games(levels, vector<int>(levels, 0));
+    vector<Position> game_positions;
+    atomic<size_t> next_match{0};
+    size_t done = 0;
+    mutex results_mtx;
+    const auto match_start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&] {
+            for (size_t m; (m = next_match.fetch_add(1)) < matches.size();)
+            {
+                const Match &match = matches[m];
+                vector<Position> positions;
+                const int result = play_game(match.white, match.black, match.opening, config, settings, positions);
+                lock_guard<mutex> lock(results_mtx);
+                const double white_points = (result + 1) / 2.0;
+                points[match.white][match.black] += white_points;
+                points[match.black][match.white] += 1 - white_points;
+                ++games[match.white][match.black];
+                ++games[match.black][match.white];
+                for (const auto &[level, sign] : {pair<int, int>{match.white, 1}, pair<int, int>{match.black, -1}})
+                {
+                    if (result == 0)
+                        ++stats[level].draws;
+                    else if (result == sign)
+                        ++stats[level].wins;
+                    else
+                        ++stats[level].losses;
+                }
+                game_positions.insert(game_positions.end(), positions.begin(), positions.end());
+                cerr << "\rgames " << ++done << "/" << matches.size() << flush;
+            }
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+    cerr << ", " << fixed << setprecision(1) << elapsed_ms(match_start) / 1000 << " s" << endl;
+    const vector<double> elo = elo_ratings(points, games);
+    for (int level = 0; level < levels; ++level)
+        stats[level].elo = elo[level];
+
+    // 2. Задержка на позициях бенчмарка и на равномерной выборке позиций из партий, в одном потоке
+    vector<Position> positions;
+    for (const auto &bench : Bench_positions)
+    {
+        Position p;
+        parse_position(bench.squares, bench.side, p.mtx, p.color);
+        positions.push_back(p);
+    }
+    // Партии доигрываются в разном порядке потоков — для воспроизводимой выборки упорядочиваем позиции
+    sort(game_positions.begin(), game_positions.end(), [](const Position &a, const Position &b) {
+        return make_pair(a.mtx, a.color) < make_pair(b.mtx, b.color);
+    });
+    game_positions.erase(unique(game_positions.begin(), game_positions.end(),
+                                [](const Position &a, const Position &b) { return a.mtx == b.mtx && a.color == b.color; }),
+                         game_positions.end());
+    const size_t sampled = min(sample_positions, game_positions.size());
+    for (size_t i = 0; i < sampled; ++i)
+        positions.push_back(game_positions[i * game_positions.size() / sampled]);
+    for (int level = 0; level < levels; ++level)
+    {
+        LevelStats &s = stats[level];
+        Logic direct(&config), iterative(&config);
+        direct.Max_depth = level;
+        SearchLimits limits;
+        limits.depth = level;
+        for (const auto &p : positions)
+        {
+            auto start = chrono::steady_clock::now();
+            direct.find_best_turns(p.color, p.mtx);
+            s.direct_ms.push_back(elapsed_ms(start));
+            s.nodes += direct.searched_nodes();
+            start = chrono::steady_clock::now();
+            iterative.search(p.mtx, p.color, limits);
+            s.iterative_ms.push_back(elapsed_ms(start));
+        }
+        cerr << "\rlatency level " << level << "/" << max_level << flush;
+    }
+    cerr << endl;
+
+    // 3. Бюджеты по уровням и рекомендация под SLO
+    int recommended = -1;
+    for (int level = 0; level < levels; ++level)
+    {
+        LevelStats &s = stats[level];
+        const double wanted = percentile(s.iterative_ms, 0.99) * Budget_margin;
+        s.budget_ms = max(Min_budget_ms, unsigned(ceil(wanted)));
+        if (slo_ms && wanted <= slo_ms)
+            recommended = level;
+        if (slo_ms)
+            s.budget_ms = min(s.budget_ms, slo_ms);
+        s.full_depth = double(count_if(s.iterative_ms.begin(), s.iterative_ms.end(),
+                                       [&](const double ms) { return ms <= s.budget_ms; })) /
+                       max<size_t>(1, s.iterative_ms.size());
+    }
+
+    const char *opt_name =
+        settings.optimization == OptLevel::O0 ? "O0" : settings.optimization == OptLevel::O1 ? "O1" : "O2";
+    cout << fixed << "optimization " << opt_name << ", " << matches.size() << " games, " << positions.size()
+         << " positions per level (" << size(Bench_positions) << " bench + " << sampled << " from games)" << endl;
+    cout << "level     elo  score  w/d/l          p50 ms    p99 ms    max ms  nodes/move  budget ms  full depth" << endl;
+    json report;
+    report["optimization"] = opt_name;
+    report["hardware_threads"] = thread::hardware_concurrency();
+    report["games"] = matches.size();
+    report["positions"] = positions.size();
+    json budgets = json::array();
+    for (int level = 0; level < levels; ++level)
+    {
+        const LevelStats &s = stats[level];
+        const int played = s.wins + s.draws + s.losses;
+        const double score = played ? (s.wins + 0.5 * s.draws) / played : 0;
+        const double p50 = percentile(s.direct_ms, 0.5), p99 = percentile(s.direct_ms, 0.99);
+        const double max_ms = percentile(s.direct_ms, 1);
+        const uint64_t nodes_per_move = s.nodes / max<size_t>(1, s.direct_ms.size());
+        ostringstream wdl;
+        wdl << s.wins << "/" << s.draws << "/" << s.losses;
+        cout << setw(5) << level << setw(8) << setprecision(0) << s.elo << setw(6) << setprecision(0) << score * 100
+             << "%  " << left << setw(12) << wdl.str() << right << setw(10) << setprecision(2) << p50 << setw(10)
+             << p99 << setw(10) << max_ms << setw(12) << nodes_per_move << setw(11) << s.budget_ms << setw(10)
+             << setprecision(0) << s.full_depth * 100 << "%" << endl;
+        report["levels"].push_back({{"level", level},
+                                    {"elo", s.elo},
+                                    {"score", score},
+                                    {"wins", s.wins},
+                                    {"draws", s.draws},
+                                    {"losses", s.losses},
+                                    {"latency_ms", {{"p50", p50}, {"p99", p99}, {"max", max_ms}}},
+                                    {"iterative_latency_ms",
+                                     {{"p50", percentile(s.iterative_ms, 0.5)}, {"p99", percentile(s.iterative_ms, 0.99)}}},
+                                    {"nodes_per_move", nodes_per_move},
+                                    {"budget_ms", s.budget_ms},
+                                    {"full_depth", s.full_depth}});
+        budgets.push_back(s.budget_ms);
+    }
+    json fragment;
+    fragment["Bot"]["LevelTimeMS"] = budgets;
+    report["settings"] = fragment;
+    cout << "settings.json Bot: \"LevelTimeMS\": " << budgets.dump() << endl;
+    if (slo_ms)
+    {
+        report["slo_ms"] = slo_ms;
+        report["recommended_level"] = recommended;
+        if (recommended >= 0)
+            cout << "SLO " << slo_ms << " ms: up to level " << recommended << " (" << setprecision(0)
+                 << stats[recommended].elo << " Elo) plays at full depth" << endl;
+        else
+            cout << "SLO " << slo_ms << " ms: no level fits without the time limit" << endl;
+    }
+    if (!out_path.empty())
+    {
+        ofstream fout(out_path);
+        fout << report.dump(2) << endl;
+    }
+    if (!settings_path.empty())
+    {
+        ofstream fout(settings_path);
+        fout << fragment.dump(2) << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Engine/Cluster.h"
+
+// Распределённый поиск (протокол — в Engine/Cluster.h).
+// cluster worker [--port N] [--shared-cache MB]
+//   исполнитель: слушает 127.0.0.1:port и считает куски одного координатора за раз
+// cluster search --workers HOST:PORT[,HOST:PORT...] [--depth N] [--movetime MS] [--optimization O0|O1|O2]
+//                [--shared-cache MB] [--compare] [fen <32 клетки> <w|b>] [moves <ход> ...]
+//   --shared-cache — общий кеш оценок в разделяемой памяти (Engine/SharedCache.h) для процессов одной машины
+//   координатор: ищет позицию (по умолчанию начальную) на исполнителях и печатает info/bestmove, как движок.
+//   --compare — затем тот же поиск в одном процессе (Logic::search) для сверки оценки и времени.
+// Исполнителей можно останавливать и запускать заново во время поиска: их куски перераздаются.
+
+// Подключает общий кеш, если он задан, и держит его между координаторами; false — ошибка подключения
+static bool attach_cache(const Settings &settings, shared_ptr<SharedCache> &cache)
+{
+    if (!settings.shared_cache_mb)
+        return true;
+    string error;
+    cache = SharedCache::attach(settings.shared_cache_name, settings.shared_cache_mb, error);
+    if (!cache)
+        cerr << "shared cache: " << error << endl;
+    else
+        cerr << "shared cache " << settings.shared_cache_name << ", " << cache->size() / (1024 * 1024) << " MB" << endl;
+    return cache != nullptr;
+}
+
+static int run_worker(const uint16_t port, const Settings &settings)
+{
+    shared_ptr<SharedCache> cache;
+    if (!attach_cache(settings, cache))
+        return 1;
+    const socket_t listener = listen_local(port);
+    if (listener == BAD_SOCKET)
+    {
+        cerr << "can't listen on 127.0.0.1:" << port << endl;
+        return 1;
+    }
+    cerr << "worker listening on 127.0.0.1:" << local_port(listener) << endl;
+    while (true)
+    {
+        const socket_t sock = accept(listener, nullptr, nullptr);
+        if (sock == BAD_SOCKET)
+            continue;
+        set_no_delay(sock);
+        uint64_t units = 0;
+        {
+            ClusterWorker worker([sock](const string &data) { return send_all(sock, data); }, settings);
+            LineReader reader;
+            string line;
+            while (reader.fill(sock))
+                while (reader.next(line))
+                    worker.handle(line);
+            worker.stop();
+            units = worker.units_done();
+        }
+        close_socket(sock);
+        cerr << "coordinator disconnected, units " << units << endl;
+    }
+}
+
+static string info_line(const SearchInfo &info)
+{
+    const long long nps = info.time_ms ? (long long)(info.nodes * 1000 / info.time_ms) : 0;
+    return "info depth " + to_string(info.depth) + " score " + score_to_string(info.score) + " nodes " +
+           to_string(info.nodes) + " time " + to_string(info.time_ms) + " nps " + to_string(nps) + " pv " +
+           line_to_string(info.pv);
+}
+
+int main(int argc, char *argv[])
+{
+    if (!sockets_startup())
+        return 1;
+    const string mode = (argc > 1 ? argv[1] : "");
+    uint16_t port = 7101;
+    vector<string> addresses;
+    SearchLimits limits;
+    limits.depth = -1;
+    long long movetime = 0;
+    bool compare = false;
+    Settings settings;
+    settings.no_random = true;
+    string squares, side;
+    vector<string> moves;
+    for (int i = 2; i < argc; ++i)
+    {
+        const string arg = argv[i];
+        if (arg == "--port" && i + 1 < argc)
+            port = uint16_t(atoi(argv[++i]));
+        else if (arg == "--workers" && i + 1 < argc)
+        {
+            istringstream list(argv[++i]);
+            string address;
+            while (getline(list, address, ','))
+                if (!address.empty())
+                    addresses.push_back(address);
+        }
+        else if (arg == "--depth" && i + 1 < argc)
+            limits.depth = atoi(argv[++i]);
+        else if (arg == "--movetime" && i + 1 < argc)
+            movetime = atoll(argv[++i]);
+        else if (arg == "--optimization" && i + 1 < argc)
+        {
+            const string value = argv[++i];
+            settings.optimization = (value == "O0" ? OptLevel::O0 : value == "O2" ? OptLevel::O2 : OptLevel::O1);
+        }
+        else if (arg == "--shared-cache" && i + 1 < argc)
+            settings.shared_cache_mb = unsigned(atoi(argv[++i]));
+        else if (arg == "--compare")
+            compare = true;
+        else if (arg == "fen" && i + 2 < argc)
+        {
+            squares = argv[++i];
+            side = argv[++i];
+        }
+        else if (arg == "moves")
+        {
+            while (i + 1 < argc)
+                moves.push_back(argv[++i]);
+        }
+        else
+        {
+            cerr << "unknown option " << arg << endl;
+            return 1;
+        }
+    }
+    if (mode == "worker")
+        return run_worker(port, settings);
+    if (mode != "search" || addresses.empty())
+    {
+        cerr << "usage: cluster worker [--port N] [--shared-cache MB]" << endl
+             << "       cluster search --workers HOST:PORT[,...] [--depth N] [--movetime MS] "
+                "[--optimization O0|O1|O2] [--shared-cache MB] [--compare] [fen <32 squares> <w|b>] [moves <move> ...]"
+             << endl;
+        return 1;
+    }
+
+    shared_ptr<SharedCache> cache;
+    if (!attach_cache(settings, cache))
+        return 1;
+    SettingsStore config(settings);
+    Logic logic(&config);
+    vector<vector<POS_T>> mtx = start_position();
+    bool color = false;
+    if (!squares.empty() && !parse_position(squares, side, mtx, color))
+    {
+        cerr << "bad position" << endl;
+        return 1;
+    }
+    const bool first_color = color;
+    vector<vector<vector<POS_T>>> history{mtx};
+    for (const auto &text : moves)
+    {
+        vector<move_pos> turn;
+        if (!parse_turn(logic, text, mtx, color, turn))
+        {
+            cerr << "illegal move " << text << endl;
+            return 1;
+        }
+        mtx = apply_turn(logic, mtx, turn);
+        color = !color;
+        history.push_back(mtx);
+    }
+    // Без --depth: до 8, а с --movetime глубину ограничивает время
+    if (limits.depth < 0)
+        limits.depth = (movetime > 0 ? 64 : 8);
+    if (movetime > 0)
+        limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(movetime);
+
+    ClusterSearch cluster(&config, addresses);
+    cluster.set_history(history, first_color);
+    const auto start = chrono::steady_clock::now();
+    Score score = 0;
+    const auto best = cluster.search(mtx, color, limits, [&score](const SearchInfo &info) {
+        score = info.score;
+        cout << info_line(info) << endl;
+    });
+    const double cluster_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "bestmove " << turn_to_string(best) << endl;
+    cerr << cluster.stats() << endl;
+    if (!compare)
+        return 0;
+
+    // Сверка — без общего кеша: он уже заполнен поиском на исполнителях
+    Settings local_settings = settings;
+    local_settings.shared_cache_mb = 0;
+    config.set(local_settings);
+    SearchLimits local_limits = limits;
+    if (movetime > 0)
+        local_limits.deadline = chrono::steady_clock::now() + chrono::milliseconds(movetime);
+    logic.set_history(history, first_color);
+    Score local_score = 0;
+    const auto local_start = chrono::steady_clock::now();
+    const auto local_best = logic.search(mtx, color, local_limits, [&local_score](const SearchInfo &info) {
+        local_score = info.score;
+        cout << "local " << info_line(info) << endl;
+    });
+    const double local_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - local_start).count();
+    cout << "local bestmove " << turn_to_string(local_best) << endl;
+    cout << "compare score " << (score == local_score ? "same" : "differs") << ", cluster " << cluster_ms
+         << " ms, single process " << local_ms << " ms, speedup " << (cluster_ms > 0 ? local_ms / cluster_ms : 0)
+         << endl;
+    return 0;
+}
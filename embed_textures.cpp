@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Встраивание текстур в программу: все Textures/*.png записываются массивами байтов в Game/Textures.h,
+// игра и render_bench декодируют их из памяти и не читают файлы при запуске.
+// embed_textures [--dir Textures] [--out Game/Textures.h]
+// Запускать из папки проекта после изменения любой картинки.
+
+int main(int argc, char *argv[])
+{
+    string dir = "Textures", out_path = "Game/Textures.h";
+    for (int i = 1; i < argc; ++i)
+    {
+        const string arg = argv[i];
+        if (arg == "--dir" && i + 1 < argc)
+            dir = argv[++i];
+        else if (arg == "--out" && i + 1 < argc)
+            out_path = argv[++i];
+        else
+        {
+            cerr << "usage: embed_textures [--dir Textures] [--out Game/Textures.h]" << endl;
+            return 1;
+        }
+    }
+    vector<filesystem::path> files;
+    error_code ec;
+    for (const auto &entry : filesystem::directory_iterator(dir, ec))
+        if (entry.is_regular_file() && entry.path().extension() == ".png")
+            files.push_back(entry.path());
+    if (ec || files.empty())
+    {
+        cerr << "no .png files in " << dir << endl;
+        return 1;
+    }
+    sort(files.begin(), files.end()); // порядок не зависит от файловой системы: заголовок воспроизводим
+
+    string text = "#pragma once\n#include <cstddef>\n#include <cstring>\n\n"
+                  "// Сгенерировано embed_textures.cpp из " + dir + "/*.png, вручную не править\n\n"
+                  "struct EmbeddedTexture\n{\n    const char *name;          // имя файла\n"
+                  "    const unsigned char *data; // содержимое PNG\n    size_t size;\n};\n\n";
+    size_t total = 0;
+    vector<string> names;
+    for (const auto &path : files)
+    {
+        ifstream fin(path, ios_base::binary);
+        const vector<unsigned char> data((istreambuf_iterator<char>(fin)), istreambuf_iterator<char>());
+        if (!fin.is_open() || data.empty())
+        {
+            cerr << "can't read " << path.string() << endl;
+            return 1;
+        }
+        string name = path.stem().string();
+        replace_if(name.begin(), name.end(), [](const char c) { return !isalnum((unsigned char)c); }, '_');
+        names.push_back(name);
+        text += "inline const unsigned char texture_" + name + "[" + to_string(data.size()) + "] = {\n";
+        string line;
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            line += to_string(data[i]) + ",";
+            if (line.size() >= 116 || i + 1 == data.size())
+            {
+                text += "    " + line + "\n";
+                line.clear();
+            }
+        }
+        text += "};\n\n";
+        total += data.size();
+    }
+    text += "inline const EmbeddedTexture embedded_textures[] = {\n";
+    for (size_t i = 0; i < files.size(); ++i)
+        text += "    {\"" + files[i].filename().string() + "\", texture_" + names[i] + ", sizeof(texture_" + names[i] +
+                ")},\n";
+    text += "};\n\n"
+            "// Встроенная текстура по имени файла (например, \"board.png\"), nullptr — нет такой\n"
+            "inline const EmbeddedTexture *find_embedded_texture(const char *name)\n{\n"
+            "    for (const auto &texture : embedded_textures)\n"
+            "        if (strcmp(texture.name, name) == 0)\n"
+            "            return &texture;\n"
+            "    return nullptr;\n}\n";
+
+    ofstream fout(out_path, ios_base::binary);
+    fout << text;
+    if (!fout)
+    {
+        cerr << "can't write " << out_path << endl;
+        return 1;
+    }
+    cout << files.size() << " textures, " << total << " bytes -> " << out_path << endl;
+    return 0;
+}
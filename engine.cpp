@@ -0,0 +1,9 @@
+#include <iostream>
+
+#include "Engine/Protocol.h"
+
+int main()
+{
+    EngineProtocol engine(cin, cout);
+    return engine.run();
+}
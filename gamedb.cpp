@@ -0,0 +1,119 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Engine/GameDatabase.h"
+
+// Работа с базой партий.
+//   gamedb import <out.ckdb> [--index-plies N] <in.pdn>...  — конвертировать PDN в бинарную базу
+//   gamedb stats <db>                                      — число партий и позиций по результатам
+//   gamedb find <db> <32 клетки> <w|b>                     — партии, в которых встречалась позиция
+//   gamedb result <db> <1-0|0-1|1/2-1/2>                   — номера партий с результатом
+//   gamedb export <db> <номер>                             — партия в PDN
+
+static int usage()
+{
+    cerr << "usage: gamedb import <out.ckdb> [--index-plies N] <in.pdn>...\n"
+            "       gamedb stats <db>\n"
+            "       gamedb find <db> <squares> <w|b>\n"
+            "       gamedb result <db> <1-0|0-1|1/2-1/2>\n"
+            "       gamedb export <db> <game>\n";
+    return 1;
+}
+
+static int import_pdn(int argc, char *argv[])
+{
+    size_t index_plies = 0;
+    vector<string> inputs;
+    for (int i = 3; i < argc; ++i)
+    {
+        string arg = argv[i];
+        if (arg == "--index-plies" && i + 1 < argc)
+            index_plies = strtoull(argv[++i], nullptr, 10);
+        else
+            inputs.push_back(arg);
+    }
+    Settings settings;
+    settings.no_random = true;
+    SettingsStore config(settings);
+    Logic logic(&config);
+    GameDatabaseWriter writer(index_plies);
+    size_t total = 0;
+    for (const auto &path : inputs)
+    {
+        ifstream fin(path);
+        if (!fin)
+        {
+            cerr << "can't open " << path << endl;
+            return 1;
+        }
+        vector<string> errors;
+        auto games = read_pdn(fin, logic, &errors);
+        for (const auto &error : errors)
+            cerr << path << ": " << error << endl;
+        for (const auto &game : games)
+            writer.add(game);
+        total += games.size();
+    }
+    if (!writer.write(argv[2]))
+    {
+        cerr << "can't write " << argv[2] << endl;
+        return 1;
+    }
+    cout << "games " << total << endl;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+        return usage();
+    const string cmd = argv[1];
+    if (cmd == "import")
+        return import_pdn(argc, argv);
+
+    const auto start = chrono::steady_clock::now();
+    GameDatabase db;
+    string error;
+    if (!db.open(argv[2], &error))
+    {
+        cerr << error << endl;
+        return 1;
+    }
+    if (cmd == "stats")
+    {
+        cout << "games " << db.games() << "\n";
+        for (auto r : {GameResult::WhiteWin, GameResult::BlackWin, GameResult::Draw, GameResult::Unknown})
+            cout << result_to_pdn(r) << " " << db.games_with_result(r).size() << "\n";
+    }
+    else if (cmd == "find" && argc >= 5)
+    {
+        vector<vector<POS_T>> mtx;
+        bool color;
+        if (!parse_position(argv[3], argv[4], mtx, color))
+            return usage();
+        for (const auto &e : db.find_position(Zobrist::instance().hash(mtx, color)))
+            cout << "game " << e.game << " ply " << e.ply << " " << result_to_pdn(db.result(e.game)) << "\n";
+    }
+    else if (cmd == "result" && argc >= 4)
+    {
+        GameResult result;
+        if (!pdn_to_result(argv[3], result))
+            return usage();
+        for (auto id : db.games_with_result(result))
+            cout << id << "\n";
+    }
+    else if (cmd == "export" && argc >= 4)
+    {
+        const uint64_t id = strtoull(argv[3], nullptr, 10);
+        if (id >= db.games())
+            return usage();
+        cout << write_pdn(db.record(uint32_t(id)));
+    }
+    else
+        return usage();
+    cerr << "query time " << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() << " ms"
+         << endl;
+    return 0;
+}
@@ -2,8 +2,10 @@
 
 int main(int argc, char* argv[])
 {
+    TRACE_THREAD_NAME("main");
     Game g;
     g.play();
+    TRACE_WRITE(project_path + "trace.json"); // только в сборке с -DCHECKERS_TRACE
 
     return 0;
 }
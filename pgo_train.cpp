@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Engine/EngineApi.h"
+
+// Обучающая нагрузка для PGO-сборки библиотеки движка: самоигра через C API.
+// Партии начинаются с разных первых ходов и играются на нескольких уровнях, чтобы профиль
+// покрывал генерацию ходов, серии взятий, дамочные эндшпили и alpha-beta поиск.
+int main()
+{
+    checkers_engine *engine = checkers_engine_create();
+    if (!engine)
+        return 1;
+    char buf[4096];
+    checkers_result result;
+    unsigned long long total_nodes = 0;
+    for (int level : {2, 4, 6})
+    {
+        for (int opening = 0; opening < 7; ++opening)
+        {
+            checkers_engine_set_position(engine, "startpos");
+            for (int ply = 0; ply < 80; ++ply)
+            {
+                if (checkers_engine_legal_moves(engine, buf, sizeof(buf)) != 0 || !buf[0])
+                    break;
+                std::string move;
+                if (ply == 0)
+                {
+                    // разные первые ходы белых
+                    std::vector<std::string> moves;
+                    for (char *tok = strtok(buf, " "); tok; tok = strtok(nullptr, " "))
+                        moves.push_back(tok);
+                    move = moves[opening % moves.size()];
+                }
+                else
+                {
+                    if (checkers_engine_search(engine, level, 0, 0, &result) != 0)
+                        break;
+                    total_nodes += result.nodes;
+                    move = result.bestmove;
+                }
+                if (checkers_engine_play(engine, move.c_str()) != 0)
+                    break;
+            }
+        }
+    }
+    checkers_engine_destroy(engine);
+    printf("nodes %llu\n", total_nodes);
+    return 0;
+}
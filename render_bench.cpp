@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+#include "Engine/Pdn.h"
+#include "Game/Board.h"
+
+// Бенчмарк отрисовки доски без дисплея: партии проигрываются через настоящий Board с видеодрайвером SDL
+// dummy (или SDL_VIDEODRIVER из окружения, например offscreen) и программным рендерером, без задержки кадра.
+// render_bench [--games N] [--width W] [--height H] [--out result.json] [--baseline base.json]
+//              [--tolerance PERCENT] [in.pdn ...]
+// Без PDN играются N партий бота с самим собой (NoRandom, уровни по номеру партии), так что набор партий
+// воспроизводим. Каждый ход рисуется так же, как ход человека в Game::player_turn: подсветка фигур, выбор фигуры,
+// подсветка полей, ход (и так для каждого взятия серии); после партии — финальный экран и несколько перерисовок.
+// Код возврата: 0 — ок, 1 — медиана времени кадра выше базовой больше чем на tolerance,
+// 2 — изменилось число кадров на ход или загрузок текстур на кадр (изменился путь отрисовки)
+
+static const char *const Render_bench_version = "2";
+static const int Final_frames = 10; // перерисовок финального экрана (события окна после конца партии)
+
+// Партии бота с самим собой: уровни белых и чёрных зависят от номера партии
+static vector<GameRecord> self_play(const int games)
+{
+    Settings settings;
+    settings.no_random = true;
+    SettingsStore config(settings);
+    vector<GameRecord> res;
+    for (int g = 0; g < games; ++g)
+    {
+        Logic logic(&config);
+        GameRecord game;
+        auto mtx = start_position();
+        vector<vector<vector<POS_T>>> history{mtx};
+        bool color = false;
+        game.result = GameResult::Draw;
+        while (int(game.turns.size()) < settings.max_num_turns)
+        {
+            logic.set_history(history, false);
+            if (logic.history_is_draw())
+                break;
+            logic.find_turns(color, mtx);
+            if (logic.turns.empty())
+            {
+                game.result = (color ? GameResult::WhiteWin : GameResult::BlackWin);
+                break;
+            }
+            logic.Max_depth = (color ? 1 + g % 3 : 1 + (g / 3) % 3);
+            const auto turn = logic.find_best_turns(color, mtx);
+            mtx = apply_turn(logic, mtx, turn);
+            history.push_back(mtx);
+            game.turns.push_back(turn);
+            color = !color;
+        }
+        res.push_back(game);
+    }
+    return res;
+}
+
+static double percentile(const vector<double> &sorted, const double p)
+{
+    return sorted.empty() ? 0 : sorted[min(sorted.size() - 1, size_t(p * sorted.size()))];
+}
+
+int main(int argc, char *argv[])
+{
+    int games = 6;
+    unsigned int width = 800, height = 800;
+    double tolerance = 10;
+    string out_path, baseline_path;
+    vector<string> inputs;
+    for (int i = 1; i < argc; ++i)
+    {
+        string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc)
+            games = max(1, atoi(argv[++i]));
+        else if (arg == "--width" && i + 1 < argc)
+            width = unsigned(max(100, atoi(argv[++i])));
+        else if (arg == "--height" && i + 1 < argc)
+            height = unsigned(max(100, atoi(argv[++i])));
+        else if (arg == "--out" && i + 1 < argc)
+            out_path = argv[++i];
+        else if (arg == "--baseline" && i + 1 < argc)
+            baseline_path = argv[++i];
+        else if (arg == "--tolerance" && i + 1 < argc)
+            tolerance = atof(argv[++i]);
+        else if (arg.rfind("--", 0) == 0)
+        {
+            cerr << "usage: render_bench [--games N] [--width W] [--height H] [--out result.json] "
+                    "[--baseline base.json] [--tolerance PERCENT] [in.pdn ...]"
+                 << endl;
+            return 1;
+        }
+        else
+            inputs.push_back(arg);
+    }
+
+    Settings settings;
+    settings.no_random = true;
+    SettingsStore config(settings);
+    Logic logic(&config);
+    vector<GameRecord> records;
+    for (const auto &path : inputs)
+    {
+        ifstream fin(path);
+        if (!fin)
+        {
+            cerr << "can't open " << path << endl;
+            return 1;
+        }
+        vector<string> errors;
+        for (auto &game : read_pdn(fin, logic, &errors))
+            records.push_back(move(game));
+        for (const auto &e : errors)
+            cerr << path << ": " << e << endl;
+    }
+    if (inputs.empty())
+        records = self_play(games);
+
+    // Без дисплея: драйвер из окружения или dummy, звук не нужен
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+    Logger::instance().open(project_path + "log.jsonl", LogLevel::Info, 1024 * 1024, 3); // ошибки SDL из Board
+    Board board(width, height);
+    board.set_software_renderer(true);
+    board.set_frame_delay(0);
+    vector<double> frame_ms;
+    board.set_frame_observer(
+        [&frame_ms](const chrono::nanoseconds t) { frame_ms.push_back(chrono::duration<double, milli>(t).count()); });
+    const auto start = chrono::steady_clock::now();
+    if (board.start_draw())
+    {
+        cerr << "can't start the board, see log.jsonl" << endl;
+        return 1;
+    }
+    const double startup_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    board.wait_assets(); // кнопки и экраны результата создаются до измеряемых кадров
+    const uint64_t startup_loads = board.textures_loaded();
+    const auto startup_times = board.startup_times();
+
+    uint64_t moves = 0, move_frames = 0, final_frames = 0;
+    for (size_t g = 0; g < records.size(); ++g)
+    {
+        if (g)
+            board.redraw();
+        bool color = false;
+        for (const auto &turn : records[g].turns)
+        {
+            const uint64_t before = board.frames_drawn();
+            // Ход человека: подсветка фигур, которыми можно ходить, затем выбор фигуры и полей для каждого шага
+            logic.find_turns(color, board.get_board());
+            vector<pair<POS_T, POS_T>> cells;
+            for (const auto &t : logic.turns)
+                cells.emplace_back(t.x, t.y);
+            board.highlight_cells(cells);
+            int beat_series = 0;
+            for (const auto &step : turn)
+            {
+                if (beat_series)
+                    logic.find_turns(step.x, step.y, board.get_board());
+                vector<pair<POS_T, POS_T>> targets;
+                for (const auto &t : logic.turns)
+                    if (t.x == step.x && t.y == step.y)
+                        targets.emplace_back(t.x2, t.y2);
+                board.clear_highlight();
+                board.set_active(step.x, step.y);
+                board.highlight_cells(targets);
+                board.clear_highlight();
+                board.clear_active();
+                beat_series += (step.xb != -1);
+                board.move_piece(step, beat_series);
+            }
+            move_frames += board.frames_drawn() - before;
+            ++moves;
+            color = !color;
+        }
+        const uint64_t before = board.frames_drawn();
+        const GameResult result = records[g].result;
+        board.show_final(result == GameResult::Unknown ? 0 : int(result));
+        for (int i = 0; i < Final_frames; ++i)
+            board.reset_window_size();
+        final_frames += board.frames_drawn() - before;
+    }
+    const double total_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    const uint64_t frames = board.frames_drawn();
+    const double loads_per_frame = frames ? double(board.textures_loaded() - startup_loads) / frames : 0;
+    const double frames_per_move = moves ? double(move_frames) / moves : 0;
+    double sum = 0;
+    for (const double t : frame_ms)
+        sum += t;
+    vector<double> sorted = frame_ms;
+    sort(sorted.begin(), sorted.end());
+    const double p50 = percentile(sorted, 0.5), p90 = percentile(sorted, 0.9), p99 = percentile(sorted, 0.99);
+    const double max_ms = sorted.empty() ? 0 : sorted.back();
+
+    cout << fixed << setprecision(3);
+    cout << "games " << records.size() << ", moves " << moves << ", frames " << frames << " (" << final_frames
+         << " on final screens), startup " << startup_ms << " ms (" << startup_loads << " textures)" << endl;
+    cout << "startup ms: sdl_init " << startup_times.sdl_init << " window " << startup_times.window << " renderer "
+         << startup_times.renderer << " textures " << startup_times.textures << " first frame "
+         << startup_times.first_frame << " all textures " << startup_times.assets << endl;
+    cout << "frames per move " << frames_per_move << ", texture loads per frame " << loads_per_frame << endl;
+    cout << "frame ms: avg " << (frames ? sum / frames : 0) << " p50 " << p50 << " p90 " << p90 << " p99 " << p99
+         << " max " << max_ms << ", fps " << (sum > 0 ? frames * 1000.0 / sum : 0) << ", total " << total_ms << " ms"
+         << endl;
+
+    json report;
+    report["version"] = Render_bench_version;
+    report["width"] = width;
+    report["height"] = height;
+    report["games"] = records.size();
+    report["moves"] = moves;
+    report["frames"] = frames;
+    report["frames_per_move"] = frames_per_move;
+    report["texture_loads_per_frame"] = loads_per_frame;
+    report["startup_ms"] = startup_ms;
+    report["first_frame_ms"] = startup_times.first_frame;
+    report["all_textures_ms"] = startup_times.assets;
+    report["frame_ms"] = {{"avg", frames ? sum / frames : 0}, {"p50", p50}, {"p90", p90}, {"p99", p99}, {"max", max_ms}};
+    if (!out_path.empty())
+    {
+        ofstream fout(out_path);
+        fout << report.dump(2) << endl;
+    }
+
+    if (baseline_path.empty())
+        return 0;
+    ifstream fin(baseline_path);
+    if (!fin)
+    {
+        cerr << "can't open baseline " << baseline_path << endl;
+        return 1;
+    }
+    json base;
+    fin >> base;
+    if (base.value("version", "") != Render_bench_version || base.value("width", 0u) != width ||
+        base.value("height", 0u) != height || base.value("moves", uint64_t(0)) != moves)
+    {
+        cout << "baseline was made with another game set or window size, skipping comparison" << endl;
+        return 0;
+    }
+    const double base_p50 = base["frame_ms"].value("p50", 0.0);
+    const double change = base_p50 > 0 ? (p50 / base_p50 - 1) * 100 : 0;
+    cout << "frame p50 " << showpos << setprecision(2) << change << noshowpos << "% vs baseline (tolerance "
+         << tolerance << "%)" << endl;
+    if (base.value("frames", uint64_t(0)) != frames ||
+        abs(base.value("texture_loads_per_frame", 0.0) - loads_per_frame) > 1e-9)
+    {
+        cout << "RENDER PATH CHANGED: frames " << frames << " vs " << base.value("frames", uint64_t(0))
+             << ", texture loads per frame " << loads_per_frame << " vs "
+             << base.value("texture_loads_per_frame", 0.0) << endl;
+        return 2;
+    }
+    if (change > tolerance)
+    {
+        cout << "REGRESSION: frame time above baseline" << endl;
+        return 1;
+    }
+    return 0;
+}
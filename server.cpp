@@ -0,0 +1,136 @@
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Engine/Server.h"
+#include "Engine/Socket.h"
+
+// Сервер партий (протокол — в Engine/Server.h) на локальном TCP-порту.
+// server [--port N] [--threads N] [--level N] [--budget MS] [--max-budget MS] [--max-sessions N]
+//        [--optimization O0|O1|O2] [--trace out.json]
+// Один поток ввода-вывода обслуживает все подключения через poll, поиск ходов ботов идёт на пуле из --threads потоков.
+// Подключение закрывается командой quit; сервер останавливается по Ctrl+C.
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void on_signal(int)
+{
+    stop_requested = 1;
+}
+
+struct Client
+{
+    socket_t sock;
+    LineReader reader;
+    shared_ptr<ServerConnection> conn;
+};
+
+int main(int argc, char *argv[])
+{
+    uint16_t port = 7070;
+    ServerOptions options;
+    Settings settings;
+    string trace_path; // трасса Chrome Trace Event (сборка с -DCHECKERS_TRACE)
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const string arg = argv[i], value = argv[i + 1];
+        if (arg == "--port")
+            port = uint16_t(atoi(value.c_str()));
+        else if (arg == "--threads")
+            options.threads = unsigned(atoi(value.c_str()));
+        else if (arg == "--level")
+            options.default_level = atoi(value.c_str());
+        else if (arg == "--budget")
+            options.default_budget_ms = unsigned(atoi(value.c_str()));
+        else if (arg == "--max-budget")
+            options.max_budget_ms = unsigned(atoi(value.c_str()));
+        else if (arg == "--max-sessions")
+            options.max_sessions = size_t(atoi(value.c_str()));
+        else if (arg == "--trace")
+            trace_path = value;
+        else if (arg == "--optimization")
+            settings.optimization = (value == "O0" ? OptLevel::O0 : value == "O2" ? OptLevel::O2 : OptLevel::O1);
+        else
+        {
+            cerr << "unknown option " << arg << endl;
+            return 1;
+        }
+    }
+
+    if (!sockets_startup())
+        return 1;
+    const socket_t listener = listen_local(port);
+    if (listener == BAD_SOCKET)
+    {
+        cerr << "can't listen on 127.0.0.1:" << port << endl;
+        return 1;
+    }
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    TRACE_THREAD_NAME("io");
+    auto server = make_unique<GameServer>(settings, options);
+    cerr << "listening on 127.0.0.1:" << local_port(listener) << endl;
+    vector<unique_ptr<Client>> clients;
+    vector<pollfd> fds;
+    while (!stop_requested)
+    {
+        fds.clear();
+        fds.push_back({listener, POLLIN, 0});
+        for (const auto &c : clients)
+            fds.push_back({c->sock, POLLIN, 0});
+        if (poll_sockets(fds.data(), fds.size(), 200) <= 0)
+            continue;
+        for (size_t i = 0; i < clients.size(); ++i)
+        {
+            Client &c = *clients[i];
+            if (!(fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)))
+                continue;
+            bool alive = c.reader.fill(c.sock);
+            string line;
+            while (alive && c.reader.next(line))
+            {
+                if (line == "quit")
+                    alive = false;
+                else
+                    server->handle(c.conn, line);
+            }
+            if (!alive)
+            {
+                server->disconnect(c.conn);
+                c.conn->close();
+                close_socket(c.sock);
+                c.sock = BAD_SOCKET;
+            }
+        }
+        clients.erase(remove_if(clients.begin(), clients.end(),
+                                [](const unique_ptr<Client> &c) { return c->sock == BAD_SOCKET; }),
+                      clients.end());
+        if (fds[0].revents & POLLIN)
+        {
+            const socket_t sock = accept(listener, nullptr, nullptr);
+            if (sock != BAD_SOCKET)
+            {
+                set_no_delay(sock);
+                auto c = make_unique<Client>();
+                c->sock = sock;
+                c->conn = make_shared<ServerConnection>([sock](const string &data) { return send_all(sock, data); });
+                clients.push_back(move(c));
+            }
+        }
+    }
+    cerr << server->stats() << endl;
+    for (auto &c : clients)
+    {
+        server->disconnect(c->conn);
+        c->conn->close();
+        close_socket(c->sock);
+    }
+    close_socket(listener);
+    server.reset(); // дожидаемся рабочих пула: трасса пишется, когда они стоят
+    if (!trace_path.empty())
+        TRACE_WRITE(trace_path);
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Socket.h"
+
+// Нагрузочный клиент сервера партий (server.cpp): играет случайными ходами за белых против бота сразу во многих
+// партиях и измеряет задержку ответа бота.
+// server_client [--port N] [--games N] [--connections N] [--level N] [--budget MS] [--seed N]
+// Партии делятся между --connections подключениями, у каждого подключения свой поток.
+
+struct Totals
+{
+    mutex mtx;
+    vector<double> latency_ms; // от отправки хода до ответа бота
+    int white = 0, black = 0, draws = 0, errors = 0;
+};
+
+static void play(const uint16_t port, const int games, const int level, const int budget, const unsigned int seed,
+                 Totals &totals)
+{
+    const socket_t sock = connect_local("127.0.0.1", port);
+    if (sock == BAD_SOCKET)
+    {
+        lock_guard<mutex> lock(totals.mtx);
+        totals.errors += games;
+        return;
+    }
+    mt19937 rng(seed);
+    string requests;
+    for (int g = 0; g < games; ++g)
+        requests += "new bot black level " + to_string(level) + " budget " + to_string(budget) + "\n";
+    send_all(sock, requests);
+
+    unordered_map<int, chrono::steady_clock::time_point> sent_at;
+    unordered_map<int, bool> finished;
+    vector<double> latency;
+    int white = 0, black = 0, draws = 0, errors = 0, done = 0;
+    LineReader reader;
+    string line;
+    while (done < games && reader.fill(sock))
+    {
+        while (reader.next(line))
+        {
+            istringstream in(line);
+            string kind, word;
+            int id = -1;
+            in >> kind >> id;
+            if (kind == "session" || kind == "botmove")
+            {
+                if (kind == "botmove")
+                    latency.push_back(
+                        chrono::duration<double, milli>(chrono::steady_clock::now() - sent_at[id]).count());
+                send_all(sock, "moves " + to_string(id) + "\n");
+            }
+            else if (kind == "moves" && !finished[id])
+            {
+                vector<string> moves;
+                while (in >> word)
+                    moves.push_back(word);
+                if (moves.empty())
+                    continue;
+                sent_at[id] = chrono::steady_clock::now();
+                send_all(sock, "move " + to_string(id) + " " + moves[rng() % moves.size()] + "\n");
+            }
+            else if (kind == "result")
+            {
+                in >> word;
+                white += (word == "1-0");
+                black += (word == "0-1");
+                draws += (word == "1/2-1/2");
+                finished[id] = true;
+                ++done;
+                send_all(sock, "close " + to_string(id) + "\n");
+            }
+            else if (kind == "error")
+            {
+                cerr << line << endl;
+                ++errors;
+                // Ошибка без номера — сессия не создана, партия не состоится
+                if (id < 0 || !finished[id])
+                {
+                    if (id >= 0)
+                        finished[id] = true;
+                    ++done;
+                }
+            }
+        }
+    }
+    send_all(sock, "quit\n");
+    close_socket(sock);
+
+    lock_guard<mutex> lock(totals.mtx);
+    totals.latency_ms.insert(totals.latency_ms.end(), latency.begin(), latency.end());
+    totals.white += white;
+    totals.black += black;
+    totals.draws += draws;
+    totals.errors += errors;
+}
+
+int main(int argc, char *argv[])
+{
+    uint16_t port = 7070;
+    int games = 100, connections = 4, level = 3, budget = 200;
+    unsigned int seed = 1;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const string arg = argv[i];
+        const int value = atoi(argv[i + 1]);
+        if (arg == "--port")
+            port = uint16_t(value);
+        else if (arg == "--games")
+            games = max(1, value);
+        else if (arg == "--connections")
+            connections = max(1, value);
+        else if (arg == "--level")
+            level = value;
+        else if (arg == "--budget")
+            budget = value;
+        else if (arg == "--seed")
+            seed = unsigned(value);
+    }
+    connections = min(connections, games);
+    if (!sockets_startup())
+        return 1;
+
+    Totals totals;
+    const auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (int c = 0; c < connections; ++c)
+    {
+        const int share = games / connections + (c < games % connections);
+        threads.emplace_back(play, port, share, level, budget, seed + c, ref(totals));
+    }
+    for (auto &t : threads)
+        t.join();
+    const double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    auto &lat = totals.latency_ms;
+    sort(lat.begin(), lat.end());
+    double sum = 0;
+    for (const double l : lat)
+        sum += l;
+    const auto percentile = [&](const double p) {
+        return lat.empty() ? 0 : lat[min(lat.size() - 1, size_t(p * lat.size()))];
+    };
+    cout << "games " << totals.white + totals.black + totals.draws << " (white " << totals.white << ", black "
+         << totals.black << ", draws " << totals.draws << "), errors " << totals.errors << ", time " << sec << " s\n";
+    cout << "bot moves " << lat.size() << ", " << (sec > 0 ? lat.size() / sec : 0) << " moves/s, latency ms: avg "
+         << (lat.empty() ? 0 : sum / lat.size()) << " p50 " << percentile(0.5) << " p95 " << percentile(0.95)
+         << " max " << (lat.empty() ? 0 : lat.back()) << endl;
+    return totals.errors ? 1 : 0;
+}